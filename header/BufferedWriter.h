@@ -0,0 +1,122 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file BufferedWriter.h
+///
+/// \brief Header file for the BufferedWriter class.
+///
+
+
+#ifndef BUFFEREDWRITER_H
+#define BUFFEREDWRITER_H
+
+// std and third-party
+#include "std_includes.h"
+
+
+#ifndef BUFFERED_WRITER_BUFFER_BYTES
+    ///
+    /// \def BUFFERED_WRITER_BUFFER_BYTES
+    ///
+    /// \brief The default size [bytes] of the BufferedWriter output buffer.
+    ///
+    
+    #define BUFFERED_WRITER_BUFFER_BYTES 1048576
+#endif  /* BUFFERED_WRITER_BUFFER_BYTES */
+
+
+///
+/// \class BufferedWriter
+///
+/// \brief A drop-in replacement for std::ofstream, for writing results. Values are
+///     formatted with std::to_chars into a large buffer, which is written out only
+///     when full (or on close). Formatting matches std::ofstream under its default
+///     flags (i.e., doubles are written as by printf("%.6g"), and bools as 1/0), so
+///     output is byte-identical.
+///
+
+class BufferedWriter {
+    private:
+        //  1. attributes
+        std::ofstream ofs; ///< The underlying file stream.
+        
+        std::vector<char> buffer_vec; ///< The output buffer.
+        size_t n_buffered_bytes; ///< The number of bytes currently held in the output buffer.
+        
+        
+        //  2. methods
+        char* __reserve(size_t);
+        void __flush(void);
+        
+        void __writeBytes(const char*, size_t);
+        void __writeSigned(long long);
+        void __writeUnsigned(unsigned long long);
+        
+        
+    public:
+        //  1. attributes
+        size_t total_bytes_written; ///< The total number of bytes written since the last open().
+        
+        
+        //  2. methods
+        BufferedWriter(void);
+        BufferedWriter(size_t);
+        
+        void open(std::string, std::ios_base::openmode = std::ofstream::out);
+        bool is_open(void);
+        
+        BufferedWriter& operator << (double);
+        BufferedWriter& operator << (int);
+        BufferedWriter& operator << (long);
+        BufferedWriter& operator << (long long);
+        BufferedWriter& operator << (unsigned int);
+        BufferedWriter& operator << (unsigned long);
+        BufferedWriter& operator << (unsigned long long);
+        BufferedWriter& operator << (bool);
+        BufferedWriter& operator << (char);
+        BufferedWriter& operator << (const char*);
+        BufferedWriter& operator << (const std::string&);
+        
+        void close(void);
+        
+        ~BufferedWriter(void);
+        
+};  /* BufferedWriter */
+
+
+#endif  /* BUFFEREDWRITER_H */
@@ -0,0 +1,84 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+/// \file CapitalCostEvent.h
+///
+/// \brief Header file for the CapitalCostEvent structure (and CapitalCostReason
+///     enumeration), by which Production and Storage assets log their capital costs.
+///
+
+
+#ifndef CAPITALCOSTEVENT_H
+#define CAPITALCOSTEVENT_H
+
+// std and third-party
+#include "std_includes.h"
+
+
+///
+/// \enum CapitalCostReason
+///
+/// \brief An enumeration of the reasons for which an asset may incur a capital cost.
+///
+
+enum CapitalCostReason {
+    CAPITAL_COST_INITIAL, ///< The initial capital cost of the asset (if not sunk).
+    CAPITAL_COST_REPLACEMENT, ///< A replacement of the asset (e.g., on running hours or state of health).
+    CAPITAL_COST_ELECTROLYZER_REPLACEMENT, ///< A replacement of the electrolyzer of a hydrogen (H2) asset.
+    CAPITAL_COST_FUEL_CELL_REPLACEMENT, ///< A replacement of the fuel cell of a hydrogen (H2) asset.
+    N_CAPITAL_COST_REASONS ///< A simple hack to get the number of elements in CapitalCostReason
+};
+
+
+///
+/// \struct CapitalCostEvent
+///
+/// \brief A structure which records a single capital cost incurred by an asset. Since
+///     capital costs are incurred only at a handful of timesteps, assets keep a log of
+///     these events rather than a (mostly zero) time series.
+///
+
+struct CapitalCostEvent {
+    int timestep = 0; ///< The timestep (i.e., time series index) in which the cost was incurred.
+    double cost = 0; ///< The capital cost incurred (undefined currency). This cost is not discounted (i.e., this is an actual cost).
+    CapitalCostReason reason = CapitalCostReason :: CAPITAL_COST_INITIAL; ///< The reason for which the cost was incurred.
+};
+
+
+#endif  /* CAPITALCOSTEVENT_H */
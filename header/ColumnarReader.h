@@ -0,0 +1,98 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file ColumnarReader.h
+///
+/// \brief Header file for the ColumnarReader class.
+///
+
+
+#ifndef COLUMNARREADER_H
+#define COLUMNARREADER_H
+
+// std and third-party
+#include "std_includes.h"
+
+// components
+#include "ColumnarWriter.h"
+
+
+///
+/// \class ColumnarReader
+///
+/// \brief A class which reads columnar results files (as written by ColumnarWriter).
+///     The header is read on construction, and then individual columns can be read on
+///     demand (without reading any other column).
+///
+
+class ColumnarReader {
+    private:
+        //  1. attributes
+        std::string path; ///< The path to the columnar results file.
+        
+        
+        //  2. methods
+        void __throwReadError(std::string);
+        
+        uint32_t __readUint32(std::ifstream*);
+        uint64_t __readUint64(std::ifstream*);
+        double __readFloat64(std::ifstream*);
+        std::string __readString(std::ifstream*);
+        
+        
+    public:
+        //  1. attributes
+        int bytes_per_value; ///< The number of bytes per value (8 for float64, 4 for float32).
+        int n_rows; ///< The number of rows in every column.
+        
+        std::vector<ColumnarColumn> column_vec; ///< A vector of column descriptors (no column data is held).
+        
+        
+        //  2. methods
+        ColumnarReader(void);
+        ColumnarReader(std::string);
+        
+        int getColumnIndex(std::string, int, std::string);
+        std::vector<double> readColumn(int);
+        
+        ~ColumnarReader(void);
+        
+};  /* ColumnarReader */
+
+
+#endif  /* COLUMNARREADER_H */
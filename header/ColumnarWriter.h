@@ -0,0 +1,171 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file ColumnarWriter.h
+///
+/// \brief Header file for the ColumnarWriter class.
+///
+
+
+#ifndef COLUMNARWRITER_H
+#define COLUMNARWRITER_H
+
+// std and third-party
+#include "std_includes.h"
+
+
+///
+/// \def COLUMNAR_MAGIC
+///
+/// \brief The eight byte signature which opens every columnar results file.
+///
+
+#define COLUMNAR_MAGIC "PGMCOLS"
+
+
+///
+/// \def COLUMNAR_VERSION
+///
+/// \brief The version of the columnar results file layout.
+///
+
+#define COLUMNAR_VERSION 1
+
+
+///
+/// \def COLUMNAR_ALIGNMENT_BYTES
+///
+/// \brief The alignment [bytes] of every column (relative to the start of the file),
+///     so that columns can be memory mapped and read in place.
+///
+
+#define COLUMNAR_ALIGNMENT_BYTES 64
+
+
+///
+/// \enum ColumnarFormat
+///
+/// \brief An enumeration of the columnar results formats supported by PGMcpp
+///
+
+enum ColumnarFormat {
+    COLUMNAR_NONE, ///< No columnar results file is written.
+    COLUMNAR_FLOAT64, ///< Columns are written as little-endian float64.
+    COLUMNAR_FLOAT32, ///< Columns are written as little-endian float32.
+    N_COLUMNAR_FORMATS ///< A simple hack to get the number of elements in ColumnarFormat
+};
+
+
+///
+/// \struct ColumnarColumn
+///
+/// \brief A structure which describes a single column of a columnar results file.
+///
+
+struct ColumnarColumn {
+    std::string group = ""; ///< The group to which the column belongs (i.e., "Model", "Combustion", "Noncombustion", "Renewable", or "Storage").
+    std::string type_str = ""; ///< The type of the asset to which the column belongs (empty for Model columns).
+    int asset_index = -1; ///< The index of the asset in the Model (-1 for Model columns).
+    double capacity_kW = 0; ///< The (power) capacity [kW] of the asset (0 for Model columns).
+    
+    std::string name = ""; ///< The name of the column.
+    std::string units = ""; ///< The units of the column (empty if not applicable).
+    
+    std::vector<double>* data_ptr = NULL; ///< A pointer to the column data (NULL if the column data is held in data_vec).
+    std::vector<double> data_vec = {}; ///< The column data, if not referred to by data_ptr.
+    
+    uint64_t data_offset = 0; ///< The offset [bytes] of the column data, relative to the start of the file.
+};
+
+
+///
+/// \class ColumnarWriter
+///
+/// \brief A class which writes a set of result columns as a single binary columnar
+///     file. The file consists of a header (the eight byte COLUMNAR_MAGIC, then the
+///     layout version, bytes per value, number of rows, number of columns, and a
+///     descriptor per column) followed by each column as one contiguous,
+///     COLUMNAR_ALIGNMENT_BYTES aligned, little-endian array. All header integers are
+///     little-endian, and all header strings are written as a uint32 length followed
+///     by their bytes. See ColumnarReader (and pybindings/PGMcpp_columnar.py).
+///
+
+class ColumnarWriter {
+    private:
+        //  1. attributes
+        std::string group; ///< The group of the asset whose columns are being added.
+        std::string type_str; ///< The type of the asset whose columns are being added.
+        int asset_index; ///< The index of the asset whose columns are being added.
+        double capacity_kW; ///< The (power) capacity [kW] of the asset whose columns are being added.
+        
+        
+        //  2. methods
+        bool __hostIsLittleEndian(void);
+        
+        void __appendUint32(std::vector<char>*, uint32_t);
+        void __appendUint64(std::vector<char>*, uint64_t);
+        void __appendFloat64(std::vector<char>*, double);
+        void __appendString(std::vector<char>*, std::string);
+        
+        void __writeColumn(std::ofstream*, ColumnarColumn*, int, ColumnarFormat);
+        
+        
+    public:
+        //  1. attributes
+        std::vector<ColumnarColumn> column_vec; ///< A vector of the columns to be written.
+        
+        
+        //  2. methods
+        ColumnarWriter(void);
+        
+        void setAsset(std::string, std::string, int, double);
+        
+        void addColumn(std::string, std::string, std::vector<double>*);
+        void addColumn(std::string, std::string, std::vector<bool>*);
+        void addColumn(std::string, std::string, std::vector<double>);
+        
+        void write(std::string, int, ColumnarFormat = ColumnarFormat :: COLUMNAR_FLOAT64);
+        
+        void clear(void);
+        
+        ~ColumnarWriter(void);
+        
+};  /* ColumnarWriter */
+
+
+#endif  /* COLUMNARWRITER_H */
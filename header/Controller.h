@@ -52,6 +52,7 @@
 //  components
 #include "ElectricalLoad.h"
 #include "Resources.h"
+#include "TaskRunner.h"
 #include "ThermalModel.h"
 
 // production and storage
@@ -62,6 +63,18 @@
 #include "Storage/Storage.h"
 
 
+#ifndef COMBUSTION_MAP_MAX_STATES
+    ///
+    /// \def COMBUSTION_MAP_MAX_STATES
+    ///
+    /// \brief The number of distinct total capacities above which the Combustion map
+    ///     bins total capacities (rather than resolving them exactly).
+    ///
+    
+    #define COMBUSTION_MAP_MAX_STATES 16384
+#endif  /* COMBUSTION_MAP_MAX_STATES */
+
+
 ///
 /// \enum ControlMode
 ///
@@ -104,15 +117,28 @@ class Controller {
         
         
         //  2. methods
-        void __computeRenewableProduction(
+        ResourceSpan __getBoundResourceSpan(
+            ElectricalLoad*,
+            Resources*,
+            int,
+            int,
+            std::string
+        );
+        void __bindResources(
             ElectricalLoad*,
             std::vector<Renewable*>*,
+            std::vector<Noncombustion*>*,
             Resources*
         );
         
+        void __computeRenewableProduction(ElectricalLoad*, std::vector<Renewable*>*);
+        
+        double __getCombustionMapResolution(std::vector<Combustion*>*);
         void __constructCombustionMap(std::vector<Combustion*>*);
+        void __constructCombustionTable(void);
+        size_t __getCombustionTableRow(double);
         
-        double __getRenewableProduction(int, double, Renewable*, Resources*);
+        double __getRenewableProduction(int, double, Renewable*, const ResourceBinding*);
         
         // **** DEPRECATED ****
         /*
@@ -149,8 +175,7 @@ class Controller {
             int,
             double,
             LoadStruct,
-            std::vector<Noncombustion*>*,
-            Resources*
+            std::vector<Noncombustion*>*
         );
         
         LoadStruct __handleCombustionDispatch(
@@ -184,6 +209,15 @@ class Controller {
             ThermalModel*
         );
         
+        void __summarizeTimestep(
+            int,
+            double,
+            std::vector<Combustion*>*,
+            std::vector<Noncombustion*>*,
+            std::vector<Renewable*>*,
+            std::vector<Storage*>*
+        );
+        
         
     public:
         //  1. attributes
@@ -197,9 +231,17 @@ class Controller {
         double required_operating_reserve_kW; //< A required operating reserve [kW], to absorb load and Renewable production fluctuations.
         */
         
+        int n_threads; ///< The number of worker threads on which to compute Renewable production (one asset per task) on init(). If <= 0, then all available hardware threads are used.
+        
+        bool summary_only; ///< A flag which indicates whether or not only summary results are recorded. If so, Renewable production is computed as the dispatch proceeds (rather than up front), the net load and missed load vectors are not recorded, and assets are summarized at the end of each time step.
+        
         double firm_dispatch_ratio; ///< The ratio [0, 1] of the load in each time step that must be dispatched from firm assets.
         double load_reserve_ratio; ///< The ratio [0, 1] of the load in each time step that must be included in the required spinning reserve.
         
+        double total_missed_load_kWh; ///< The total missed load [kWh] over the Model run.
+        double total_missed_firm_dispatch_kWh; ///< The total missed firm dispatch [kWh] over the Model run.
+        double total_missed_spinning_reserve_kWh; ///< The total missed spinning reserve [kWh] over the Model run.
+        
         std::vector<bool> storage_discharge_bool_vec; ///< A boolean vector attribute to track which Storage assets have been discharged in each time step.
         
         std::vector<double> net_load_vec_kW; ///< A vector of net load values [kW] at each point in the modelling time series. Net load is defined as load minus all available Renewable production.
@@ -207,8 +249,17 @@ class Controller {
         std::vector<double> missed_firm_dispatch_vec_kW; ///< A vector of missed firm dispatch values [kW] at each point in the modelling time series.
         std::vector<double> missed_spinning_reserve_vec_kW; ///< A vector of missed spinning reserve values [kw] at each point in the modelling time series.
         
+        double combustion_map_resolution_kW; ///< The capacity resolution [kW] of the Combustion map. Zero if every attainable total capacity is resolved exactly.
+        
         std::map<double, std::vector<bool>> combustion_map; ///< A map of all possible combustion states, for use in determining optimal dispatch. 
         
+        size_t n_combustion_table_words; ///< The number of 64-bit words in each row of the packed Combustion state matrix.
+        std::vector<double> combustion_table_capacity_vec_kW; ///< The sorted total capacities [kW] of the Combustion map, frozen on init() for binary search during dispatch.
+        std::vector<uint64_t> combustion_table_state_vec; ///< The operating states of the Combustion map, frozen on init() as a packed, row-major bitset matrix (one row per element of combustion_table_capacity_vec_kW).
+        
+        std::vector<ResourceBinding> renewable_resource_binding_vec; ///< The resource bindings of the Renewable assets (one per asset, in order), resolved on init().
+        std::vector<ResourceBinding> noncombustion_resource_binding_vec; ///< The resource bindings of the Noncombustion assets (one per asset, in order), resolved on init().
+        
         
         //  2. methods
         Controller(void);
@@ -222,12 +273,15 @@ class Controller {
         */
         void setFirmDispatchRatio(double);
         void setLoadReserveRatio(double);
+        void setSummaryOnly(bool);
+        void setNThreads(int);
         
         void init(
             ElectricalLoad*,
             std::vector<Renewable*>*,
             Resources*,
-            std::vector<Combustion*>*
+            std::vector<Combustion*>*,
+            std::vector<Noncombustion*>* = NULL
         );
         
         void applyDispatchControl(
@@ -237,7 +291,9 @@ class Controller {
             std::vector<Noncombustion*>*,
             std::vector<Renewable*>*,
             std::vector<Storage*>*,
-            ThermalModel*
+            ThermalModel*,
+            int = 0,
+            int = -1
         );
         
         void clear(void);
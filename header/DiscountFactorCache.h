@@ -0,0 +1,104 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file DiscountFactorCache.h
+///
+/// \brief Header file for the DiscountFactorCache class.
+///
+
+
+#ifndef DISCOUNTFACTORCACHE_H
+#define DISCOUNTFACTORCACHE_H
+
+// std and third-party
+#include "std_includes.h"
+
+//  components
+#include "CapitalCostEvent.h"
+
+
+///
+/// \class DiscountFactorCache
+///
+/// \brief A class which computes, and then caches, the vector of discount factors
+///     1 / (1 + r)^(t / 8760) over a modelling time vector, for each distinct real
+///     annual rate r requested. Present values then reduce to a dot product of the
+///     cached factors with a cost vector. Intended to be shared by all the assets of a
+///     Model (and by all the Models of a Sweep, which share a single time vector).
+///
+/// Lookups are guarded by a mutex, so a single cache can be shared across threads.
+///
+
+class DiscountFactorCache {
+    private:
+        //  1. attributes
+        mutable std::mutex mutex; ///< A mutex guarding discount_factor_map (mutable, so that the source of a copy may be locked).
+        
+        
+        //  2. methods
+        std::vector<double>* __computeDiscountFactors(double);
+        double __dot(std::vector<double>*, std::vector<double>*);
+        
+        
+    public:
+        //  1. attributes
+        std::vector<double>* time_vec_hrs_ptr; ///< A pointer to the modelling time vector [hrs] over which discount factors are computed.
+        
+        std::map<double, std::vector<double>> discount_factor_map; ///< A map <real annual rate, vector of discount factors> of all discount factor vectors computed so far.
+        
+        
+        //  2. methods
+        DiscountFactorCache(void);
+        DiscountFactorCache(std::vector<double>*);
+        DiscountFactorCache(const DiscountFactorCache&);
+        DiscountFactorCache& operator = (const DiscountFactorCache&);
+        
+        void setTimeVec(std::vector<double>*);
+        
+        std::vector<double>* getDiscountFactors(double);
+        double computePresentValue(double, std::vector<double>*);
+        double computePresentValue(double, std::vector<CapitalCostEvent>*);
+        
+        void clear(void);
+        
+        ~DiscountFactorCache(void);
+        
+};  /* DiscountFactorCache */
+
+
+#endif  /* DISCOUNTFACTORCACHE_H */
@@ -50,6 +50,9 @@
 #include "std_includes.h"
 #include "../third_party/fast-cpp-csv-parser/csv.h"
 
+// components
+#include "TimeSeriesCache.h"
+
 
 ///
 /// \class ElectricalLoad
@@ -76,6 +79,8 @@ class ElectricalLoad {
         
         std::vector<double> load_vec_kW; ///< A vector to hold a given sequence of electrical load values [kW].
         
+        TimeSeriesCache time_series_cache; ///< A transparent binary cache through which the electrical load time series is read.
+        
         
         //  2. methods
         ElectricalLoad(void);
@@ -50,10 +50,30 @@
 #include "../third_party/fast-cpp-csv-parser/csv.h"
 
 
+///
+/// \struct InterpolatorAxis
+///
+/// \brief A struct which holds the search properties of an axis (i.e., a vector of
+///     independent data) of an interpolation table. These are determined once, when
+///     the data is read, and let the interpolation index be found in O(1) on uniform
+///     grids, and by a hinted binary search otherwise (the search hints are held per
+///     Interpolator, since the data may be shared).
+///
+
+struct InterpolatorAxis {
+    bool is_increasing = false; ///< A boolean which indicates if the axis is strictly increasing (if not, the index search falls back to a linear scan).
+    bool is_uniform = false; ///< A boolean which indicates if the axis is (to within a small tolerance) uniformly spaced.
+    
+    double inverse_dx = 0; ///< The inverse of the axis spacing (uniform axes only).
+};
+
+
 ///
 /// \struct InterpolatorStruct1D
 ///
-/// \brief A struct which holds two parallel vectors for use in 1D interpolation.
+/// \brief A struct which holds two parallel vectors for use in 1D interpolation. Once
+///     added to an Interpolator, it is immutable (and may be shared between
+///     Interpolators; see InterpolatorTableCache).
 ///
 
 struct InterpolatorStruct1D {
@@ -64,6 +84,8 @@ struct InterpolatorStruct1D {
     double min_x = 0; ///< The minimum (i.e., first) element of x_vec.
     double max_x = 0; ///< The maximum (i.e., last) element of x_vec.
     
+    InterpolatorAxis x_axis; ///< The search properties of x_vec.
+    
     std::vector<double> y_vec = {}; ///< A vector of dependent data.
 };
 
@@ -72,7 +94,8 @@ struct InterpolatorStruct1D {
 /// \struct InterpolatorStruct2D
 ///
 /// \brief A struct which holds two parallel vectors and a matrix for use in 2D 
-///     interpolation.
+///     interpolation. Once added to an Interpolator, it is immutable (and may be shared
+///     between Interpolators; see InterpolatorTableCache).
 ///
 
 struct InterpolatorStruct2D {
@@ -89,7 +112,38 @@ struct InterpolatorStruct2D {
     double min_y = 0; ///< The minimum (i.e., first) element of y_vec.
     double max_y = 0; ///< The maximum (i.e., last) element of y_vec.
     
-    std::vector<std::vector<double>> z_matrix = {}; ///< A matrix of dependent data.
+    InterpolatorAxis x_axis; ///< The search properties of x_vec.
+    InterpolatorAxis y_axis; ///< The search properties of y_vec.
+    
+    std::vector<double> z_vec = {}; ///< A matrix of dependent data, stored contiguously in row-major order (i.e., element [i][j] is z_vec[i * n_cols + j]).
+};
+
+
+///
+/// \struct InterpolatorHandle1D
+///
+/// \brief A struct which identifies 1D interpolation data that has been resolved (once,
+///     by Interpolator::getHandle1D()) so that it can then be interpolated with no
+///     std::map lookups. A handle remains valid in copies of the Interpolator which
+///     issued it.
+///
+
+struct InterpolatorHandle1D {
+    int idx = -1; ///< The index of the resolved data in the issuing Interpolator (-1 if unresolved).
+};
+
+
+///
+/// \struct InterpolatorHandle2D
+///
+/// \brief A struct which identifies 2D interpolation data that has been resolved (once,
+///     by Interpolator::getHandle2D()) so that it can then be interpolated with no
+///     std::map lookups. A handle remains valid in copies of the Interpolator which
+///     issued it.
+///
+
+struct InterpolatorHandle2D {
+    int idx = -1; ///< The index of the resolved data in the issuing Interpolator (-1 if unresolved).
 };
 
 
@@ -103,39 +157,65 @@ struct InterpolatorStruct2D {
 class Interpolator {
     private:
         //  1. attributes
-        //...
+        std::map<int, int> handle_map_1D; ///< A map <data key, handle index> of all issued 1D handles.
+        std::vector<std::shared_ptr<const InterpolatorStruct1D>> handle_ptr_vec_1D; ///< A vector of pointers to the 1D interpolation data of all issued 1D handles (indexed by handle).
+        std::vector<int> hint_vec_1D; ///< A vector of the search hints of all issued 1D handles (indexed by handle).
+        
+        std::map<int, int> handle_map_2D; ///< A map <data key, handle index> of all issued 2D handles.
+        std::vector<std::shared_ptr<const InterpolatorStruct2D>> handle_ptr_vec_2D; ///< A vector of pointers to the 2D interpolation data of all issued 2D handles (indexed by handle).
+        std::vector<int> hint_x_vec_2D; ///< A vector of the x axis search hints of all issued 2D handles (indexed by handle).
+        std::vector<int> hint_y_vec_2D; ///< A vector of the y axis search hints of all issued 2D handles (indexed by handle).
         
         
         //  2. methods
         void __checkDataKey1D(int);
         void __checkDataKey2D(int);
         
-        void __checkBounds1D(int, double);
-        void __checkBounds2D(int, double, double);
+        int __getHandleIdx1D(int);
+        int __getHandleIdx2D(int);
         
-        void __throwReadError(std::string, int);
+        void __checkHandle1D(InterpolatorHandle1D);
+        void __checkHandle2D(InterpolatorHandle2D);
         
-        bool __isNonNumeric(std::string);
+        void __checkBounds1D(const InterpolatorStruct1D*, double);
+        void __checkBounds2D(const InterpolatorStruct2D*, double, double);
         
-        int __getInterpolationIndex(double, std::vector<double>*);
+        void __throwReadError(std::string, int);
         
-        std::vector<std::string> __splitCommaSeparatedString(
-            std::string,
-            std::string = "||"
+        InterpolatorAxis __getInterpolatorAxis(std::vector<double>*);
+        int __getInterpolationIndex(
+            double,
+            const std::vector<double>*,
+            const InterpolatorAxis*,
+            int*
         );
         
-        std::vector<std::vector<std::string>> __getDataStringMatrix(std::string);
+        std::string __readDataBuffer(std::string);
+        bool __parseNumber(const char*, const char*, double*);
+        int __parseDataLine(const char*, const char*, double*, double*, int);
         
         void __readData1D(int, std::string);
         void __readData2D(int, std::string);
         
+        double __interp1D(int, double);
+        double __interp2D(int, double, double);
+        
+        void __interp1DBatch(int, const double*, double*, size_t);
+        void __interp2DBatch(
+            int,
+            const double*,
+            const double*,
+            double*,
+            size_t
+        );
+        
         
     public:
         //  1. attributes
-        std::map<int, InterpolatorStruct1D> interp_map_1D; ///< A map <int, InterpolatorStruct1D> of given 1D interpolation data.
+        std::map<int, std::shared_ptr<const InterpolatorStruct1D>> interp_map_1D; ///< A map <int, pointer to InterpolatorStruct1D> of given 1D interpolation data (immutable, and possibly shared).
         std::map<int, std::string> path_map_1D; ///< A map <int, string> of the paths (either relative or absolute) to the given 1D interpolation data.
         
-        std::map<int, InterpolatorStruct2D> interp_map_2D; ///< A map <int, InterpolatorStruct2D> of given 2D interpolation data.
+        std::map<int, std::shared_ptr<const InterpolatorStruct2D>> interp_map_2D; ///< A map <int, pointer to InterpolatorStruct2D> of given 2D interpolation data (immutable, and possibly shared).
         std::map<int, std::string> path_map_2D; ///< A map <int, string> of the paths (either relative or absolute) to the given 2D interpolation data.
         
         
@@ -145,9 +225,30 @@ class Interpolator {
         void addData1D(int, std::string);
         void addData2D(int, std::string);
         
+        void addData1D(int, InterpolatorStruct1D);
+        void addData2D(int, InterpolatorStruct2D);
+        
+        InterpolatorHandle1D getHandle1D(int);
+        InterpolatorHandle2D getHandle2D(int);
+        
         double interp1D(int, double);
         double interp2D(int, double, double);
         
+        double interp1D(InterpolatorHandle1D, double);
+        double interp2D(InterpolatorHandle2D, double, double);
+        
+        void interp1DBatch(int, const double*, double*, size_t);
+        void interp2DBatch(int, const double*, const double*, double*, size_t);
+        
+        void interp1DBatch(InterpolatorHandle1D, const double*, double*, size_t);
+        void interp2DBatch(
+            InterpolatorHandle2D,
+            const double*,
+            const double*,
+            double*,
+            size_t
+        );
+        
         ~Interpolator(void);
         
 };  /* Interpolator */
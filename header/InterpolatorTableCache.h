@@ -0,0 +1,116 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file InterpolatorTableCache.h
+///
+/// \brief Header file for the InterpolatorTableCache class.
+///
+
+
+#ifndef INTERPOLATORTABLECACHE_H
+#define INTERPOLATORTABLECACHE_H
+
+// std and third-party
+#include "std_includes.h"
+
+//  components
+#include "WeakReferenceCache.h"
+
+
+struct InterpolatorStruct1D;
+struct InterpolatorStruct2D;
+
+
+///
+/// \class InterpolatorTableCache
+///
+/// \brief A (process-wide) class which lets Interpolators share immutable interpolation
+///     tables read from file. Tables are keyed by the canonical path of the file and a
+///     hash of its contents, so a table is parsed once and then shared by every asset
+///     which reads the same (unchanged) file, while an edited file is simply read again.
+///
+/// The cache holds weak references only (see WeakReferenceCache); a table is freed once
+/// the last Interpolator holding it is destroyed (i.e., tables are reference counted).
+/// All access is guarded by a mutex, so assets can be constructed concurrently.
+///
+
+class InterpolatorTableCache {
+    private:
+        //  1. attributes
+        WeakReferenceCache<const InterpolatorStruct1D> table_cache_1D; ///< A cache <table key, weak reference> of all 1D tables cached so far.
+        WeakReferenceCache<const InterpolatorStruct2D> table_cache_2D; ///< A cache <table key, weak reference> of all 2D tables cached so far.
+        
+        
+        //  2. methods
+        InterpolatorTableCache(void);
+        
+        
+    public:
+        //  1. attributes
+        //...
+        
+        
+        //  2. methods
+        static InterpolatorTableCache& getInstance(void);
+        
+        InterpolatorTableCache(const InterpolatorTableCache&) = delete;
+        InterpolatorTableCache& operator = (const InterpolatorTableCache&) = delete;
+        
+        std::string getTableKey(std::string, const std::string&);
+        
+        std::shared_ptr<const InterpolatorStruct1D> get1D(std::string);
+        std::shared_ptr<const InterpolatorStruct2D> get2D(std::string);
+        
+        std::shared_ptr<const InterpolatorStruct1D> insert1D(
+            std::string,
+            std::shared_ptr<const InterpolatorStruct1D>
+        );
+        std::shared_ptr<const InterpolatorStruct2D> insert2D(
+            std::string,
+            std::shared_ptr<const InterpolatorStruct2D>
+        );
+        
+        size_t size(void);
+        void clear(void);
+        
+        ~InterpolatorTableCache(void);
+        
+};  /* InterpolatorTableCache */
+
+
+#endif  /* INTERPOLATORTABLECACHE_H */
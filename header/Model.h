@@ -47,10 +47,12 @@
 
 
 //  components
+#include "ColumnarReader.h"
 #include "Controller.h"
 #include "ElectricalLoad.h"
 #include "Resources.h"
 #include "ThermalModel.h"
+#include "TaskRunner.h"
 
 //  production
 #include "Production/Combustion/Diesel.h"
@@ -89,6 +91,29 @@ struct ModelInputs {
     
     double firm_dispatch_ratio = 0.1; ///< The ratio [0, 1] of the load in each time step that must be dispatched from firm assets.
     double load_reserve_ratio = 0.1; ///< The ratio [0, 1] of the load in each time step that must be included in the required spinning reserve.
+    
+    bool summary_only = false; ///< A flag which indicates whether or not to record only summary results. If so, no per-timestep result vectors are recorded (so memory scales with the number of assets, not the length of the modelling time series), totals and discounted costs are accumulated as the Model runs, and writeResults() writes only summary results. Note that the ThermalModel always records full time series.
+    
+    int n_threads = 0; ///< The number of worker threads on which to compute Renewable production up front (one asset per task). If <= 0, then all available hardware threads are used. Results do not depend on the number of threads.
+};
+
+
+///
+/// \struct CostInputs
+///
+/// \brief A structure which bundles the economic inputs for Model::recomputeEconomics().
+///     The rates are applied to every asset, and the scalars are applied to the costs
+///     recorded over the Model run (so that, e.g., a capital_cost_scalar of 1.2 models
+///     capital costs 20% higher than those the assets were constructed with).
+///
+
+struct CostInputs {
+    double nominal_inflation_annual = 0.02; ///< The nominal, annual inflation rate to use in computing model economics.
+    double nominal_discount_annual = 0.08; ///< The nominal, annual discount rate to use in computing model economics.
+    
+    double capital_cost_scalar = 1; ///< A scalar applied to all recorded capital costs.
+    double operation_maintenance_cost_scalar = 1; ///< A scalar applied to all recorded operation and maintenance costs.
+    double fuel_cost_scalar = 1; ///< A scalar applied to all recorded fuel costs.
 };
 
 
@@ -97,13 +122,15 @@ struct ModelInputs {
 ///
 /// \brief A container class which forms the centre of PGMcpp. The Model class is
 ///     intended to serve as the primary user interface with the functionality of
-///     PGMcpp, and as such it contains all other classes.
+///     PGMcpp, and as such it contains all other classes. A Model refers to its own
+///     components by pointer, and so is not copyable; use clone() instead.
 ///
 
 class Model {
     private:
         //  1. attributes
         void __checkInputs(ModelInputs);
+        void __init(ModelInputs);
         
         void __computeFuelAndEmissions(void);
         void __computeNetPresentCost(void);
@@ -112,6 +139,7 @@ class Model {
         
         void __writeSummary(std::string);
         void __writeTimeSeries(std::string, int = -1);
+        void __writeColumnar(std::string, int, ColumnarFormat);
         
         
         //  2. methods
@@ -134,9 +162,18 @@ class Model {
         
         double levellized_cost_of_energy_kWh; ///< The levellized cost of energy, per unit energy dispatched/discharged, of the Model [1/kWh] (undefined currency).
         
+        bool summary_only; ///< A flag which indicates whether or not only summary results are recorded (see ModelInputs::summary_only).
+        
+        int next_timestep; ///< The next time step to be dispatched (0 before the Model is run, n_points once dispatch is complete).
+        
         Controller controller; ///< Controller component of Model
         ElectricalLoad electrical_load; ///< ElectricalLoad component of Model
         Resources resources; ///< Resources component of Model
+        DiscountFactorCache discount_factor_cache; ///< DiscountFactorCache component of Model
+        
+        ElectricalLoad* electrical_load_ptr; ///< A pointer to the ElectricalLoad in use by the Model (either the electrical_load component, or a shared ElectricalLoad object).
+        Resources* resources_ptr; ///< A pointer to the Resources in use by the Model (either the resources component, or a shared Resources object).
+        DiscountFactorCache* discount_factor_cache_ptr; ///< A pointer to the DiscountFactorCache in use by the Model (either the discount_factor_cache component, or a shared DiscountFactorCache object). Discount factors are computed once per distinct real annual rate, and then reused by every asset.
         
         ThermalModel* thermal_model_ptr; ///< Pointer to Thermal Model
         
@@ -150,11 +187,16 @@ class Model {
         //  2. methods
         Model(void);
         Model(ModelInputs);
+        Model(ModelInputs, ElectricalLoad*, Resources*, DiscountFactorCache* = NULL);
+        
+        Model(const Model&) = delete;
+        Model& operator = (const Model&) = delete;
         
         void addDiesel(DieselInputs);
         
         void addResource(NoncombustionType, std::string, int);
         void addResource(RenewableType, std::string, int);
+        void addResources(std::vector<ResourceInputs>, int = 0);
         
         void addHydro(HydroInputs);
         
@@ -168,11 +210,21 @@ class Model {
         void addThermalModel(ThermalModelInputs);
         
         void run(void);
+        void runUntil(int);
+        
+        void recomputeEconomics(CostInputs);
+        
+        Model* clone(void);
+        Model* fork(int);
         
         void reset(void);
         void clear(void);
         
-        void writeResults(std::string, int = -1);
+        void writeResults(
+            std::string,
+            int = -1,
+            ColumnarFormat = ColumnarFormat :: COLUMNAR_NONE
+        );
         
         ~Model(void);
         
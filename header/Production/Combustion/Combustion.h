@@ -49,6 +49,18 @@
 #include "../Production.h"
 
 
+#ifndef FUEL_CURVE_MAX_BINS
+    ///
+    /// \def FUEL_CURVE_MAX_BINS
+    ///
+    /// \brief The maximum number of load ratio bins in a compiled fuel curve (see
+    ///     FuelCurveTable).
+    ///
+    
+    #define FUEL_CURVE_MAX_BINS 1024
+#endif  /* FUEL_CURVE_MAX_BINS */
+
+
 ///
 /// \enum CombustionType
 ///
@@ -111,6 +123,32 @@ struct Emissions {
 };
 
 
+///
+/// \struct FuelCurveTable
+///
+/// \brief A structure which holds a fuel curve (FUEL_MODE_LOOKUP only), compiled at
+///     construction into piecewise linear segments (fuel consumption rate [L/hr] =
+///     slope * load ratio + intercept) over a uniform grid of load ratio bins. Each bin
+///     records the first segment which it overlaps, and bins are no wider than the
+///     narrowest segment (up to a fixed maximum number of bins), so a lookup is one bin
+///     index plus (at most) a short forward step.
+///
+
+struct FuelCurveTable {
+    int n_bins = 0; ///< The number of load ratio bins (0 if the fuel curve is not compiled).
+    
+    double min_load_ratio = 0; ///< The minimum load ratio covered by the table.
+    double max_load_ratio = 0; ///< The maximum load ratio covered by the table.
+    double inverse_bin_width = 0; ///< The inverse of the load ratio bin width.
+    
+    std::vector<int> bin_segment_vec = {}; ///< A vector of the first segment overlapped by each load ratio bin.
+    
+    std::vector<double> segment_max_load_ratio_vec = {}; ///< A vector of the upper load ratio bound of each segment.
+    std::vector<double> slope_vec_Lhr = {}; ///< A vector of the fuel consumption rate slope [L/hr] (per unit load ratio) of each segment.
+    std::vector<double> intercept_vec_Lhr = {}; ///< A vector of the fuel consumption rate intercept [L/hr] of each segment.
+};
+
+
 ///
 /// \class Combustion
 ///
@@ -127,6 +165,7 @@ class Combustion : public Production {
         
         //  2. methods
         void __checkInputs(CombustionInputs);
+        void __compileFuelCurve(void);
         
         virtual void __writeSummary(std::string) {return;}
         virtual void __writeTimeSeries(
@@ -145,10 +184,14 @@ class Combustion : public Production {
         double fuel_cost_L; ///< The cost of fuel [1/L] (undefined currency).
         double nominal_fuel_escalation_annual; ///< The nominal, annual fuel escalation rate to use in computing model economics.
         double real_fuel_escalation_annual; ///< The real, annual fuel escalation rate used in computing model economics. Is computed from the given nominal inflation and discount rates.
+        double fuel_cost_scalar; ///< A scalar applied to the recorded fuel costs in computing net present cost and in writing results (see Model::recomputeEconomics()).
         
         double linear_fuel_slope_LkWh; ///< The slope [L/kWh] to use in computing linearized fuel consumption. This is fuel consumption per unit energy produced.
         double linear_fuel_intercept_LkWh; ///< The intercept [L/kWh] to use in computing linearized fuel consumption. This is fuel consumption per unit energy produced.
         
+        InterpolatorHandle1D fuel_interp_handle; ///< A handle to the fuel consumption interpolation data (FUEL_MODE_LOOKUP only).
+        FuelCurveTable fuel_curve_table; ///< The fuel consumption interpolation data, compiled into a piecewise linear table (FUEL_MODE_LOOKUP only).
+        
         double cycle_charging_setpoint; ///< The cycle charging set point (the load ratio at which to produce when running in cycle charging mode).
         
         double CO2_emissions_intensity_kgL; ///< Carbon dioxide (CO2) emissions intensity [kg/L].
@@ -165,12 +208,12 @@ class Combustion : public Production {
         std::vector<double> fuel_consumption_vec_L; ///< A vector of fuel consumed [L] over each modelling time step.
         std::vector<double> fuel_cost_vec; ///< A vector of fuel costs (undefined currency) incurred over each modelling time step. These costs are not discounted (i.e., these are actual costs).
         
-        std::vector<double> CO2_emissions_vec_kg; ///< A vector of carbon dioxide (CO2) emitted [kg] over each modelling time step.
-        std::vector<double> CO_emissions_vec_kg; ///< A vector of carbon monoxide (CO) emitted [kg] over each modelling time step.
-        std::vector<double> NOx_emissions_vec_kg; ///< A vector of nitrogen oxide (NOx) emitted [kg] over each modelling time step.
-        std::vector<double> SOx_emissions_vec_kg; ///< A vector of sulfur oxide (SOx) emitted [kg] over each modelling time step.
-        std::vector<double> CH4_emissions_vec_kg; ///< A vector of methane (CH4) emitted [kg] over each modelling time step.
-        std::vector<double> PM_emissions_vec_kg; ///< A vector of particulate matter (PM) emitted [kg] over each modelling time step.
+        std::vector<double> CO2_emissions_vec_kg; ///< A vector of carbon dioxide (CO2) emitted [kg] over each modelling time step. Derived from fuel consumption on demand (see computeEmissionsSeries()).
+        std::vector<double> CO_emissions_vec_kg; ///< A vector of carbon monoxide (CO) emitted [kg] over each modelling time step. Derived from fuel consumption on demand (see computeEmissionsSeries()).
+        std::vector<double> NOx_emissions_vec_kg; ///< A vector of nitrogen oxide (NOx) emitted [kg] over each modelling time step. Derived from fuel consumption on demand (see computeEmissionsSeries()).
+        std::vector<double> SOx_emissions_vec_kg; ///< A vector of sulfur oxide (SOx) emitted [kg] over each modelling time step. Derived from fuel consumption on demand (see computeEmissionsSeries()).
+        std::vector<double> CH4_emissions_vec_kg; ///< A vector of methane (CH4) emitted [kg] over each modelling time step. Derived from fuel consumption on demand (see computeEmissionsSeries()).
+        std::vector<double> PM_emissions_vec_kg; ///< A vector of particulate matter (PM) emitted [kg] over each modelling time step. Derived from fuel consumption on demand (see computeEmissionsSeries()).
         
         
         //  2. methods
@@ -179,10 +222,17 @@ class Combustion : public Production {
         virtual void handleReplacement(int);
         
         void computeFuelAndEmissions(void);
-        void computeEconomics(std::vector<double>*);
+        void computeEmissionsSeries(void);
+        void computeEconomics(std::vector<double>*, DiscountFactorCache* = NULL);
+        void resetEconomics(double, double);
+        
+        double getFuelCost(int);
         
         virtual double requestProductionkW(int, double, double) {return 0;}
         virtual double commit(int, double, double, double);
+        void summarizeTimestep(int, double);
+        
+        void addResultColumns(ColumnarWriter*);
         
         double getFuelConsumptionL(double, double);
         Emissions getEmissionskg(double);
@@ -161,6 +161,10 @@ class Hydro : public Noncombustion {
         double minimum_flow_m3hr; ///< The minimum required flow [m3/hr] for the asset to produce. Corresponds to minimum power.
         double maximum_flow_m3hr; ///< The maximum productive flow [m3/hr] that the asset can support.
         
+        InterpolatorHandle1D generator_efficiency_handle; ///< A handle to the generator efficiency interpolation data.
+        InterpolatorHandle1D turbine_efficiency_handle; ///< A handle to the turbine efficiency interpolation data.
+        InterpolatorHandle1D flow_to_power_handle; ///< A handle to the flow to power interpolation data.
+        
         std::vector<double> turbine_flow_vec_m3hr; ///< A vector of the turbine flow [m3/hr] at each point in the modelling time series.
         std::vector<double> spill_rate_vec_m3hr; ///< A vector of the spill rate [m3/hr] at each point in the modelling time series.
         std::vector<double> stored_volume_vec_m3; ///< A vector of the stored volume [m3] in the reservoir at each point in the modelling time series.
@@ -174,6 +178,8 @@ class Hydro : public Noncombustion {
         double requestProductionkW(int, double, double, double);
         double commit(int, double, double, double, double);
         
+        void addResultColumns(ColumnarWriter*);
+        
         ~Hydro(void);
         
         
@@ -112,7 +112,7 @@ class Noncombustion : public Production {
         Noncombustion(int, double, NoncombustionInputs, std::vector<double>*);
         virtual void handleReplacement(int);
         
-        void computeEconomics(std::vector<double>*);
+        void computeEconomics(std::vector<double>*, DiscountFactorCache* = NULL);
         
         virtual double requestProductionkW(int, double, double) {return 0;}
         virtual double requestProductionkW(int, double, double, double) {return 0;}
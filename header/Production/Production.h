@@ -49,6 +49,10 @@
 #include "../std_includes.h"
 #include "../../third_party/fast-cpp-csv-parser/csv.h"
 
+#include "../BufferedWriter.h"
+#include "../ColumnarWriter.h"
+#include "../CapitalCostEvent.h"
+#include "../DiscountFactorCache.h"
 #include "../Interpolator.h"
 
 
@@ -62,6 +66,7 @@
 struct ProductionInputs {
     bool print_flag = false; ///< A flag which indicates whether or not object construct/destruction should be verbose.
     bool is_sunk = false; ///< A boolean which indicates whether or not the asset should be considered a sunk cost (i.e., capital cost incurred at the start of the model, or no).
+    bool summary_only = false; ///< A flag which indicates whether or not to record only summary results (i.e., no per-timestep result vectors). This is set by the Model (see ModelInputs::summary_only).
     
     double capacity_kW = 100; ///< The rated production capacity [kW] of the asset.
     
@@ -104,6 +109,7 @@ class Production {
         bool is_running; ///< A boolean which indicates whether or not the asset is running.
         bool is_sunk; ///< A boolean which indicates whether or not the asset should be considered a sunk cost (i.e., capital cost incurred at the start of the model, or no).
         bool normalized_production_series_given; ///< A boolen which indicates whether or not a normalized production time series is given
+        bool summary_only; ///< A flag which indicates whether or not only summary results are recorded. If so, the per-timestep result vectors hold only the current time step (see getRecordIndex()), and totals and discounted costs are accumulated as the Model runs (see summarizeTimestep()).
         
         int n_points; ///< The number of points in the modelling time series.
         int n_starts; ///< The number of times the asset has been started.
@@ -121,6 +127,8 @@ class Production {
         double real_discount_annual; ///< The real, annual discount rate used in computing model economics. Is computed from the given nominal inflation and discount rates.
         double capital_cost; ///< The capital cost of the asset (undefined currency).
         double operation_maintenance_cost_kWh; ///< The operation and maintenance cost of the asset [1/kWh] (undefined currency). This is a cost incurred per unit of energy produced.
+        double capital_cost_scalar; ///< A scalar applied to the recorded capital costs in computing net present cost and in writing results (see Model::recomputeEconomics()).
+        double operation_maintenance_cost_scalar; ///< A scalar applied to the recorded operation and maintenance costs in computing net present cost and in writing results (see Model::recomputeEconomics()).
         
         double net_present_cost; ///< The net present cost of this asset.
         double total_dispatch_kWh; ///< The total energy dispatched [kWh] over the Model run.
@@ -139,7 +147,8 @@ class Production {
         std::vector<double> storage_vec_kW; ///< A vector of storage [kW] at each point in the modelling time series. Storage is the amount of production that is sent to storage.
         std::vector<double> curtailment_vec_kW; ///< A vector of curtailment [kW] at each point in the modelling time series. Curtailment is the amount of production that can be neither dispatched nor stored, and is hence curtailed.
         
-        std::vector<double> capital_cost_vec; ///< A vector of capital costs (undefined currency) incurred over each modelling time step. These costs are not discounted (i.e., these are actual costs).
+        std::vector<CapitalCostEvent> capital_cost_event_vec; ///< A log of the capital costs incurred by the asset (initial and replacement), in time order. These costs are not discounted (i.e., these are actual costs). Expanded into a time series only on writing results (see getCapitalCost(), getCapitalCostSeries()).
+        
         std::vector<double> operation_maintenance_cost_vec; ///< A vector of operation and maintenance costs (undefined currency) incurred over each modelling time step. These costs are not discounted (i.e., these are actual costs).
         
         
@@ -147,13 +156,26 @@ class Production {
         Production(void);
         Production(int, double, ProductionInputs, std::vector<double>*);
         virtual void handleReplacement(int);
+        void incurCapitalCost(int, double, CapitalCostReason);
+        double getCapitalCost(int, size_t*);
+        std::vector<double> getCapitalCostSeries(void);
+        double getOperationMaintenanceCost(int);
         
         double computeRealDiscountAnnual(double, double);
-        virtual void computeEconomics(std::vector<double>*);
+        virtual void computeEconomics(
+            std::vector<double>*,
+            DiscountFactorCache* = NULL
+        );
+        virtual void resetEconomics(double, double);
         
         double getProductionkW(int);
         virtual double commit(int, double, double, double);
         
+        int getRecordIndex(int);
+        virtual void summarizeTimestep(int, double);
+        
+        virtual void addResultColumns(ColumnarWriter*);
+        
         virtual ~Production(void);
         
 };  /* Production */
@@ -64,6 +64,66 @@ enum RenewableType {
 };
 
 
+///
+/// \struct ResourceSpan
+///
+/// \brief A read-only, non-owning view of a contiguous resource time series (i.e., a
+///     minimal std::span<const double>, since PGMcpp targets C++17).
+///
+
+struct ResourceSpan {
+    const double* data_ptr = NULL; ///< A pointer to the first element of the series.
+    size_t n_points = 0; ///< The number of elements in the series.
+    
+    const double& operator[](size_t i) const {return this->data_ptr[i];}
+    const double* begin(void) const {return this->data_ptr;}
+    const double* end(void) const {return this->data_ptr + this->n_points;}
+    size_t size(void) const {return this->n_points;}
+};
+
+
+///
+/// \struct ResourceBinding
+///
+/// \brief A structure which binds an asset to its resource time series. Bindings are
+///     resolved (and validated) once, on Controller::init(), so that dispatch does no
+///     Resources map lookups.
+///
+
+struct ResourceBinding {
+    ResourceSpan resource_span; ///< The 1D resource time series of the asset (or channel 0 of its 2D resource time series). Empty if the asset is given a normalized production series.
+    ResourceSpan resource_span_2D; ///< Channel 1 of the 2D resource time series of the asset. Empty unless the asset reads a 2D resource.
+};
+
+
+///
+/// \struct ResourceStruct2D
+///
+/// \brief A structure which stores a 2D renewable resource time series as a structure
+///     of arrays (one contiguous array per channel). For wave resources, channel 0 is
+///     significant wave height [m] and channel 1 is energy period [s].
+///
+/// operator[] is a read-only compatibility view which returns {channel 0, channel 1}
+/// at the given timestep, so that resource_map_2D[key][timestep][channel] reads as it
+/// did when 2D resources were stored as one vector per timestep.
+///
+
+struct ResourceStruct2D {
+    int n_points = 0; ///< The number of points in each channel.
+    std::array<std::vector<double>, 2> channel_vec; ///< The channels, each a contiguous vector<double> of length n_points.
+    
+    ResourceSpan getSpan(int channel) const {
+        return ResourceSpan{this->channel_vec[channel].data(), (size_t)this->n_points};
+    }
+    
+    const std::array<double, 2> operator[](size_t timestep) const {
+        return {this->channel_vec[0][timestep], this->channel_vec[1][timestep]};
+    }
+    
+    size_t size(void) const {return this->n_points;}
+};
+
+
 ///
 /// \struct RenewableInputs
 ///
@@ -99,7 +159,7 @@ class Renewable : public Production {
             std::string,
             std::vector<double>*,
             std::map<int, std::vector<double>>*,
-            std::map<int, std::vector<std::vector<double>>>*,
+            std::map<int, ResourceStruct2D>*,
             int = -1
         ) {return;}
         
@@ -118,17 +178,36 @@ class Renewable : public Production {
         Renewable(int, double, RenewableInputs, std::vector<double>*);
         virtual void handleReplacement(int);
         
-        void computeEconomics(std::vector<double>*);
+        void computeEconomics(std::vector<double>*, DiscountFactorCache* = NULL);
         
         virtual double computeProductionkW(int, double, double) {return 0;}
         virtual double computeProductionkW(int, double, double, double) {return 0;}
+        virtual void computeProductionkWBatch(
+            int,
+            const double*,
+            const double*,
+            double*
+        );
+        virtual void computeProductionkWBatch(
+            int,
+            const double*,
+            const double*,
+            const double*,
+            double*
+        );
+        virtual void computeProductionkWBatch(
+            int,
+            const double*,
+            const ResourceBinding*,
+            double*
+        );
         virtual double commit(int, double, double, double);
         
         void writeResults(
             std::string,
             std::vector<double>*,
             std::map<int, std::vector<double>>*,
-            std::map<int, std::vector<std::vector<double>>>*,
+            std::map<int, ResourceStruct2D>*,
             int,
             int = -1
         );
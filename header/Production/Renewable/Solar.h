@@ -47,6 +47,7 @@
 
 
 #include "Renewable.h"
+#include "../../SolarGeometryCache.h"
 
 
 ///
@@ -116,13 +117,13 @@ class Solar : public Renewable {
         double __getGenericCapitalCost(void);
         double __getGenericOpMaintCost(void);
         
-        double __getMeanLongitudeDeg(void);
-        double __getMeanAnomalyRad(void);
+        double __getMeanLongitudeDeg(double);
+        double __getMeanAnomalyRad(double);
         
         double __getEclipticLongitudeRad(double, double);
-        double __getObliquityOfEclipticRad(void);
+        double __getObliquityOfEclipticRad(double);
         
-        double __getGreenwichMeanSiderialTimeHrs(void);
+        double __getGreenwichMeanSiderialTimeHrs(double);
         double __getLocalMeanSiderialTimeHrs(double);
         
         double __getRightAscensionRad(double, double);
@@ -133,6 +134,9 @@ class Solar : public Renewable {
         double __getSolarAzimuthRad(double, double);
         double __getSolarZenithRad(double, double);
         
+        void __computeSolarGeometry(double, double*, double*);
+        void __bindSolarGeometry(std::vector<double>*);
+        
         double __getDiffuseHorizontalIrradiancekWm2(double);
         double __getDirectNormalIrradiancekWm2(double, double, double);
         
@@ -146,13 +150,14 @@ class Solar : public Renewable {
         
         double __computeSimpleProductionkW(int, double, double);
         double __computeDetailedProductionkW(int, double, double);
+        void __computeDetailedProductionkWBatch(int, const double*, double*);
         
         void __writeSummary(std::string);
         void __writeTimeSeries(
             std::string,
             std::vector<double>*,
             std::map<int, std::vector<double>>*,
-            std::map<int, std::vector<std::vector<double>>>*,
+            std::map<int, ResourceStruct2D>*,
             int = -1
         );
         
@@ -180,12 +185,15 @@ class Solar : public Renewable {
         SolarPowerProductionModel power_model; ///< The solar power production model to be applied.
         std::string power_model_string; ///< A string describing the active power production model.
         
+        std::shared_ptr<const SolarGeometryStruct> solar_geometry_ptr; ///< A pointer to the position of the sun over the modelling time series (shared by all Solar assets at the same site; see SolarGeometryCache). Only bound for the detailed power production model.
+        
         //  2. methods
         Solar(void);
         Solar(int, double, SolarInputs, std::vector<double>*);
         void handleReplacement(int);
         
         double computeProductionkW(int, double, double);
+        void computeProductionkWBatch(int, const double*, const double*, double*);
         double commit(int, double, double, double);
         
         ~Solar(void);
@@ -116,7 +116,7 @@ class Tidal : public Renewable {
             std::string,
             std::vector<double>*,
             std::map<int, std::vector<double>>*,
-            std::map<int, std::vector<std::vector<double>>>*,
+            std::map<int, ResourceStruct2D>*,
             int = -1
         );
         
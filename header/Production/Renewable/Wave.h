@@ -119,7 +119,7 @@ class Wave : public Renewable {
             std::string,
             std::vector<double>*,
             std::map<int, std::vector<double>>*,
-            std::map<int, std::vector<std::vector<double>>>*,
+            std::map<int, ResourceStruct2D>*,
             int = -1
         );
         
@@ -132,6 +132,8 @@ class Wave : public Renewable {
         WavePowerProductionModel power_model; ///< The wave power production model to be applied.
         std::string power_model_string; ///< A string describing the active power production model.
         
+        InterpolatorHandle2D performance_interp_handle; ///< A handle to the normalized performance matrix interpolation data (WAVE_POWER_LOOKUP only).
+        
         
         //  2. methods
         Wave(void);
@@ -139,6 +141,19 @@ class Wave : public Renewable {
         void handleReplacement(int);
         
         double computeProductionkW(int, double, double, double);
+        void computeProductionkWBatch(
+            int,
+            const double*,
+            const double*,
+            const double*,
+            double*
+        );
+        void computeProductionkWBatch(
+            int,
+            const double*,
+            const ResourceBinding*,
+            double*
+        );
         double commit(int, double, double, double);
         
         ~Wave(void);
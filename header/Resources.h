@@ -52,12 +52,30 @@
 
 // components
 #include "ElectricalLoad.h"
+#include "TaskRunner.h"
+#include "TimeSeriesCache.h"
 
 // production
 #include "Production/Noncombustion/Noncombustion.h"
 #include "Production/Renewable/Renewable.h"
 
 
+///
+/// \struct ResourceInputs
+///
+/// \brief A structure which describes a single resource time series to be added to
+///     Resources (see Resources::addResources()). Exactly one of renewable_type and
+///     noncombustion_type should be set.
+///
+
+struct ResourceInputs {
+    RenewableType renewable_type = RenewableType :: N_RENEWABLE_TYPES; ///< The type of renewable resource (N_RENEWABLE_TYPES if a Noncombustion resource).
+    NoncombustionType noncombustion_type = NoncombustionType :: N_NONCOMBUSTION_TYPES; ///< The type of Noncombustion resource (N_NONCOMBUSTION_TYPES if a renewable resource).
+    std::string path_2_resource_data = ""; ///< The path (either relative or absolute) to the resource time series.
+    int resource_key = 0; ///< A key used to index into the Resources object, used to associate assets with the corresponding resource.
+};
+
+
 ///
 /// \class Resources
 ///
@@ -77,15 +95,25 @@ class Resources {
         
         void __checkResourceKey1D(int, NoncombustionType);
         
-        void __checkTimePoint(double, double, std::string, ElectricalLoad*);
+        bool __checkResourceKey(ResourceInputs);
+        
+        void __checkTimeSeries(std::vector<double>*, std::string, ElectricalLoad*);
         void __throwLengthError(std::string, ElectricalLoad*);
         
-        void __readHydroResource(std::string, int, ElectricalLoad*);
+        void __getResourceHeaders(
+            ResourceInputs,
+            std::vector<std::string>*,
+            std::string*
+        );
+        
+        void __parseResource(
+            ResourceInputs,
+            ElectricalLoad*,
+            TimeSeriesCache*,
+            std::vector<std::vector<double>>*
+        );
         
-        void __readSolarResource(std::string, int, ElectricalLoad*);
-        void __readTidalResource(std::string, int, ElectricalLoad*);
-        void __readWaveResource(std::string, int, ElectricalLoad*);
-        void __readWindResource(std::string, int, ElectricalLoad*);
+        void __recordResource(ResourceInputs, std::vector<std::vector<double>>*);
         
         
     public:
@@ -94,10 +122,12 @@ class Resources {
         std::map<int, std::string> string_map_1D; ///< A map <int, string> of descriptors for the type of the given 1D renewable resource time series.
         std::map<int, std::string> path_map_1D; ///< A map <int, string> of the paths (either relative or absolute) to given 1D renewable resource time series.
         
-        std::map<int, std::vector<std::vector<double>>> resource_map_2D; ///< A map <int, vector<vector<double>>> of given 2D renewable resource time series.
+        std::map<int, ResourceStruct2D> resource_map_2D; ///< A map <int, ResourceStruct2D> of given 2D renewable resource time series (stored as a structure of arrays).
         std::map<int, std::string> string_map_2D; ///< A map <int, string> of descriptors for the type of the given 2D renewable resource time series.
         std::map<int, std::string> path_map_2D; ///< A map <int, string> of the paths (either relative or absolute) to given 2D renewable resource time series.
         
+        TimeSeriesCache time_series_cache; ///< A transparent binary cache through which all resource time series are read.
+        
         
         //  2. methods
         Resources(void);
@@ -105,6 +135,11 @@ class Resources {
         void addResource(NoncombustionType, std::string, int, ElectricalLoad*);
         void addResource(RenewableType, std::string, int, ElectricalLoad*);
         
+        void addResources(std::vector<ResourceInputs>, ElectricalLoad*, int = 0);
+        
+        ResourceSpan getResourceSpan1D(int);
+        ResourceSpan getResourceSpan2D(int, int);
+        
         void clear(void);
         
         ~Resources(void);
@@ -0,0 +1,129 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file SolarGeometryCache.h
+///
+/// \brief Header file for the SolarGeometryCache class.
+///
+
+
+#ifndef SOLARGEOMETRYCACHE_H
+#define SOLARGEOMETRYCACHE_H
+
+// std and third-party
+#include "std_includes.h"
+
+//  components
+#include "WeakReferenceCache.h"
+
+
+///
+/// \struct SolarGeometryStruct
+///
+/// \brief A struct which holds the position of the sun (zenith and azimuth) over a
+///     modelling time series, for a given site, along with the tangent of the zenith and
+///     the sine and cosine of the azimuth (so that the plane of array irradiance of any
+///     array at the site reduces to arithmetic; see Solar::computeProductionkWBatch()). Once cached, it is immutable
+///     (and may be shared between Solar assets; see SolarGeometryCache).
+///
+
+struct SolarGeometryStruct {
+    std::vector<double> solar_zenith_vec_rad; ///< A vector of the solar zenith [rad] at each point in the modelling time series.
+    std::vector<double> solar_azimuth_vec_rad; ///< A vector of the solar azimuth [rad] at each point in the modelling time series.
+    
+    std::vector<double> tan_solar_zenith_vec; ///< A vector of the tangent of the solar zenith at each point in the modelling time series.
+    std::vector<double> cos_solar_azimuth_vec; ///< A vector of the cosine of the solar azimuth at each point in the modelling time series.
+    std::vector<double> sin_solar_azimuth_vec; ///< A vector of the sine of the solar azimuth at each point in the modelling time series.
+    
+    size_t size(void) const { return this->solar_zenith_vec_rad.size(); }
+};
+
+
+///
+/// \class SolarGeometryCache
+///
+/// \brief A (process-wide) class which lets Solar assets share the position of the sun
+///     over the modelling time series. Since the position of the sun depends only on
+///     time and site (and not on irradiance or panel orientation), geometries are keyed
+///     by latitude, longitude, starting Julian day, and (a hash of) the modelling time
+///     vector. Every array at a given site (east/west/tilt variants, bifacial pairs, 
+///     etc.) then shares the one geometry, and pays only for its angle of incidence.
+///
+/// The cache holds weak references only (see WeakReferenceCache); a geometry is freed
+/// once the last Solar asset holding it is destroyed. All access is guarded by a mutex, so assets can be
+/// constructed concurrently.
+///
+
+class SolarGeometryCache {
+    private:
+        //  1. attributes
+        WeakReferenceCache<const SolarGeometryStruct> geometry_cache; ///< A cache <geometry key, weak reference> of all geometries cached so far.
+        
+        
+        //  2. methods
+        SolarGeometryCache(void);
+        
+        
+    public:
+        //  1. attributes
+        //...
+        
+        
+        //  2. methods
+        static SolarGeometryCache& getInstance(void);
+        
+        SolarGeometryCache(const SolarGeometryCache&) = delete;
+        SolarGeometryCache& operator = (const SolarGeometryCache&) = delete;
+        
+        std::string getGeometryKey(double, double, double, std::vector<double>*);
+        
+        std::shared_ptr<const SolarGeometryStruct> get(std::string);
+        std::shared_ptr<const SolarGeometryStruct> insert(
+            std::string,
+            std::shared_ptr<const SolarGeometryStruct>
+        );
+        
+        size_t size(void);
+        void clear(void);
+        
+        ~SolarGeometryCache(void);
+        
+};  /* SolarGeometryCache */
+
+
+#endif  /* SOLARGEOMETRYCACHE_H */
@@ -33,7 +33,7 @@
 
 struct ElectrolyzerInputs {
 
-    double n_points = 8760*25;  // 25 years, project lifetime
+    double n_points = 8760;  // number of time series records (H2 sets this to match the Model)
     double el_capital_cost_per_kW = 1600; // default capital cost per kW
     double el_operation_maintenance_cost_kWh = 0.06; // default O&M cost per kWh
     double B_capacity_factor = 0.1; // capacity factor lower limit
@@ -64,7 +64,7 @@ class Electrolyzer {
         double el_output_kg; // output of the electrolyzer in kg of hydrogen
         double el_draw_kW; // draw of the electrolyzer in kW 
         double charging_efficiency; // charging efficiency of electrolyzer 
-        double n_points; // number of timeseries data points
+        double n_points; // number of time series records (see getRecordIndex())
         double el_operation_maintenance_cost_kWh; // O&M cost per kW
         double B_capacity_factor; // capacity factor lower limit
         double el_SOH; // electrolyzer state of health
@@ -93,6 +93,9 @@ class Electrolyzer {
         double el_degradation(int, double, double, double); // computes component capacity degradation  
         double getQ_el(int, double, double, double); // computer net thermal energy of component
 
+        int getRecordIndex(int); // index of the record of a given timestep
+        void clearRecord(int); // zeroes the record of a given timestep
+
         Electrolyzer(void);
         Electrolyzer(ElectrolyzerInputs);
         ~Electrolyzer(void);
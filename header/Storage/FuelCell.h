@@ -33,7 +33,7 @@
 struct FuelCellInputs {
 
 
-    double n_points = 8760*25;  // 25 years, project lifetime
+    double n_points = 8760;  // number of time series records (H2 sets this to match the Model)
     double fc_capital_cost_per_kW = 2000; // default capital cost per kW
     double fc_operation_maintenance_cost_kWh = 0.06; // default O&M cost per kWh
     double B_capacity_factor = 0.1; // capacity factor lower limit
@@ -60,7 +60,7 @@ class FuelCell { // Should be set up such that FuelCell is a derived class of H2
         // 1. attributes
         double fc_consumption_kg; // draw of the fuel cell in kg of hydrogen 
         double fc_output_kW; // output of the fuel cell in kW
-        double n_points; // number of timeseries data points
+        double n_points; // number of time series records (see getRecordIndex())
         double fc_capital_cost_per_kW; // capital cost per kW
         double fc_operation_maintenance_cost_kWh; // O&M cost per kW
         double B_capacity_factor; // capacity factor lower limit
@@ -93,6 +93,9 @@ class FuelCell { // Should be set up such that FuelCell is a derived class of H2
         double fc_degradation(int,double,double); // computes component capacity degradation 
         double getQ_fc(int, double, double, double); // computer net thermal energy of component
         
+        int getRecordIndex(int); // index of the record of a given timestep
+        void clearRecord(int); // zeroes the record of a given timestep
+
         FuelCell(void);
         FuelCell(FuelCellInputs); 
         ~FuelCell(void); 
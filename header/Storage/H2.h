@@ -159,7 +159,6 @@ class H2 : public Storage {
         double compressor_cap_cost_kW;
         bool compression_included;
         bool water_treatment_included;
-        bool external_hydrogen_load_included;
         bool excess_hydrogen_potential_included;
         double water_treatment_cap_cost;
         double water_demand_L;
@@ -185,7 +184,6 @@ class H2 : public Storage {
         bool el_min_runtime_enforced;
         double el_runtime_enforced_total;
 
-        bool making_hydrogen_for_external_load; 
         double total_external_hydrogen_load_met;
 
         double init_SOC; ///< The initial state of charge of the asset. 
@@ -248,6 +246,10 @@ class H2 : public Storage {
         double getCompressorPowerkW(double); // computes compression energy demand
         void getWaterDemand(int, double); // computes water demand
 
+        void summarizeTimestep(int, double);
+        
+        void addResultColumns(ColumnarWriter*);
+        
         ~H2(void);
         
 };  /* H2 */
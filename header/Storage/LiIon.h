@@ -174,6 +174,8 @@ class LiIon : public Storage {
         double getMcp(int);
         void commit_SelfDischarge(int,double);
         
+        void addResultColumns(ColumnarWriter*);
+        
         ~LiIon(void);
         
 };  /* LiIon */
@@ -48,6 +48,10 @@
 #include "../std_includes.h"
 #include "../../third_party/fast-cpp-csv-parser/csv.h"
 
+#include "../BufferedWriter.h"
+#include "../ColumnarWriter.h"
+#include "../CapitalCostEvent.h"
+#include "../DiscountFactorCache.h"
 #include "../Interpolator.h"
 
 
@@ -74,6 +78,7 @@ enum StorageType {
 struct StorageInputs {
     bool print_flag = false; ///< A flag which indicates whether or not object construct/destruction should be verbose.
     bool is_sunk = false; ///< A boolean which indicates whether or not the asset should be considered a sunk cost (i.e., capital cost incurred at the start of the model, or no).
+    bool summary_only = false; ///< A flag which indicates whether or not to record only summary results (i.e., no per-timestep result vectors). This is set by the Model (see ModelInputs::summary_only).
     
     double power_capacity_kW = 100; ///< The rated power capacity [kW] of the asset.
     double energy_capacity_kWh = 1000; ///< The rated energy capacity [kWh] of the asset.
@@ -114,10 +119,12 @@ class Storage {
         bool print_flag; ///< A flag which indicates whether or not object construct/destruction should be verbose.
         bool is_depleted; ///< A boolean which indicates whether or not the asset is currently considered depleted.
         bool is_sunk; ///< A boolean which indicates whether or not the asset should be considered a sunk cost (i.e., capital cost incurred at the start of the model, or no).
+        bool summary_only; ///< A flag which indicates whether or not only summary results are recorded. If so, the per-timestep result vectors hold only the current and previous time steps (see getRecordIndex()), and discounted costs are accumulated as the Model runs (see summarizeTimestep()).
         bool external_hydrogen_load_included; ///< A boolean which indicates if the (hydrogen) asset contains an external load component
         bool making_hydrogen_for_external_load; ///< A boolean which indicates if a (hydrogen) asset is currently servign an external load
 
         int n_points; ///< The number of points in the modelling time series.
+        int n_record_points; ///< The number of points held by the per-timestep result vectors (n_points, or 2 if only summary results are recorded).
         int n_replacements; ///< The number of times the asset has been replaced.
         
         double n_years; ///< The number of years being modelled.
@@ -133,6 +140,8 @@ class Storage {
         double real_discount_annual; ///< The real, annual discount rate used in computing model economics. Is computed from the given nominal inflation and discount rates.
         double capital_cost; ///< The capital cost of the asset (undefined currency).
         double operation_maintenance_cost_kWh; ///< The operation and maintenance cost of the asset [1/kWh] (undefined currency). This is a cost incurred per unit of energy charged/discharged.
+        double capital_cost_scalar; ///< A scalar applied to the recorded capital costs in computing net present cost and in writing results (see Model::recomputeEconomics()).
+        double operation_maintenance_cost_scalar; ///< A scalar applied to the recorded operation and maintenance costs in computing net present cost and in writing results (see Model::recomputeEconomics()).
         
         double net_present_cost; ///< The net present cost of this asset.
         double total_discharge_kWh; ///< The total energy discharged [kWh] over the Model run.
@@ -144,7 +153,8 @@ class Storage {
         std::vector<double> charging_power_vec_kW; ///< A vector of the charging power [kW] at each point in the modelling time series.
         std::vector<double> discharging_power_vec_kW; ///< A vector of the discharging power [kW] at each point in the modelling time series.
         
-        std::vector<double> capital_cost_vec; ///< A vector of capital costs (undefined currency) incurred over each modelling time step. These costs are not discounted (i.e., these are actual costs).
+        std::vector<CapitalCostEvent> capital_cost_event_vec; ///< A log of the capital costs incurred by the asset (initial and replacement), in time order. These costs are not discounted (i.e., these are actual costs). Expanded into a time series only on writing results (see getCapitalCost(), getCapitalCostSeries()).
+        
         std::vector<double> operation_maintenance_cost_vec; ///< A vector of operation and maintenance costs (undefined currency) incurred over each modelling time step. These costs are not discounted (i.e., these are actual costs).
         
         
@@ -152,8 +162,18 @@ class Storage {
         Storage(void);
         Storage(int, double, StorageInputs);
         virtual void handleReplacement(int);
+        void incurCapitalCost(int, double, CapitalCostReason);
+        double getCapitalCost(int, size_t*);
+        std::vector<double> getCapitalCostSeries(void);
+        double getOperationMaintenanceCost(int);
+        
+        void computeEconomics(std::vector<double>*, DiscountFactorCache* = NULL);
+        void resetEconomics(double, double);
+        
+        int getRecordIndex(int);
+        virtual void summarizeTimestep(int, double);
         
-        void computeEconomics(std::vector<double>*);
+        virtual void addResultColumns(ColumnarWriter*);
         
         virtual double getAvailablekW(int, double) {return 0;}
         virtual double getAcceptablekW(int, double) {return 0;}
@@ -0,0 +1,175 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file Sweep.h
+///
+/// \brief Header file for the Sweep class.
+///
+
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+
+//  components
+#include "Model.h"
+#include "TaskRunner.h"
+
+
+///
+/// \struct SweepInputs
+///
+/// \brief A structure which bundles the necessary inputs for the Sweep constructor.
+///     Provides default values for every necessary input (except
+///     path_2_electrical_load_time_series, for which a valid input must be provided).
+///
+
+struct SweepInputs {
+    std::string path_2_electrical_load_time_series = ""; ///< A string defining the path (either relative or absolute) to the given electrical load time series.
+    
+    int n_threads = 0; ///< The number of worker threads on which to run scenarios. If <= 0, then all available hardware threads are used.
+};
+
+
+///
+/// \struct ScenarioInputs
+///
+/// \brief A structure which defines a single scenario (i.e., candidate microgrid design)
+///     of a Sweep. Each vector element adds one asset of the corresponding type.
+///
+
+struct ScenarioInputs {
+    ModelInputs model_inputs; ///< A structure of Model constructor inputs (ModelInputs::path_2_electrical_load_time_series is ignored).
+    
+    std::vector<DieselInputs> diesel_inputs_vec = {}; ///< A vector of Diesel asset inputs.
+    
+    std::vector<HydroInputs> hydro_inputs_vec = {}; ///< A vector of Hydro asset inputs.
+    
+    std::vector<SolarInputs> solar_inputs_vec = {}; ///< A vector of Solar asset inputs.
+    std::vector<TidalInputs> tidal_inputs_vec = {}; ///< A vector of Tidal asset inputs.
+    std::vector<WaveInputs> wave_inputs_vec = {}; ///< A vector of Wave asset inputs.
+    std::vector<WindInputs> wind_inputs_vec = {}; ///< A vector of Wind asset inputs.
+    
+    std::vector<LiIonInputs> liion_inputs_vec = {}; ///< A vector of LiIon asset inputs.
+    std::vector<H2Inputs> h2_inputs_vec = {}; ///< A vector of H2 asset inputs.
+};
+
+
+///
+/// \struct ScenarioSummary
+///
+/// \brief A structure which holds the summary results of a single scenario of a Sweep.
+///
+
+struct ScenarioSummary {
+    int scenario_index = -1; ///< The index of the scenario (order of Sweep::addScenario()).
+    
+    bool is_complete = false; ///< A boolean which indicates whether or not the scenario ran successfully.
+    std::string error_str = ""; ///< The error message raised by the scenario (if any).
+    
+    double net_present_cost = 0; ///< The net present cost of the scenario (undefined currency).
+    double levellized_cost_of_energy_kWh = 0; ///< The levellized cost of energy of the scenario [1/kWh] (undefined currency).
+    
+    double total_fuel_consumed_L = 0; ///< The total fuel consumed [L] over the scenario.
+    Emissions total_emissions; ///< An Emissions structure for holding total emissions [kg].
+    
+    double total_dispatch_kWh = 0; ///< The total energy dispatched [kWh] from all production assets over the scenario.
+    double total_discharge_kWh = 0; ///< The total energy discharged [kWh] from all storage assets over the scenario.
+    double total_missed_load_kWh = 0; ///< The total load missed [kWh] over the scenario.
+    double renewable_penetration = 0; ///< The total renewable (i.e. non-combustion) penetration over the scenario.
+};
+
+
+///
+/// \class Sweep
+///
+/// \brief A class which runs many scenarios (i.e., candidate microgrid designs) against
+///     the same electrical load and resource data, in parallel. The electrical load and
+///     resource data are read in once and shared (read only) by every scenario, so
+///     memory use grows with the assets of the scenarios in flight only. Each scenario
+///     is reduced to a ScenarioSummary as soon as it completes.
+///
+
+class Sweep {
+    private:
+        //  1. attributes
+        //...
+        
+        
+        //  2. methods
+        void __checkInputs(SweepInputs);
+        void __checkResourceKey1D(int, int, std::string);
+        void __checkResourceKey2D(int, int, std::string);
+        void __checkScenario(int);
+        
+        ScenarioSummary __runScenario(int);
+        
+        
+    public:
+        //  1. attributes
+        int n_threads; ///< The number of worker threads on which to run scenarios.
+        
+        ElectricalLoad electrical_load; ///< ElectricalLoad component of Sweep (shared by all scenarios).
+        Resources resources; ///< Resources component of Sweep (shared by all scenarios).
+        DiscountFactorCache discount_factor_cache; ///< DiscountFactorCache component of Sweep (shared by all scenarios, so that discount factors are computed once per distinct real annual rate across the whole sweep).
+        
+        std::vector<ScenarioInputs> scenario_inputs_vec; ///< A vector of the scenarios to be run.
+        std::vector<ScenarioSummary> scenario_summary_vec; ///< A vector of scenario summaries (in scenario order), populated by run().
+        
+        
+        //  2. methods
+        Sweep(void);
+        Sweep(SweepInputs);
+        
+        void addResource(NoncombustionType, std::string, int);
+        void addResource(RenewableType, std::string, int);
+        
+        void addScenario(ScenarioInputs);
+        
+        void run(std::function<void(const ScenarioSummary&)> = nullptr);
+        
+        void clear(void);
+        
+        void writeResults(std::string);
+        
+        ~Sweep(void);
+        
+};  /* Sweep */
+
+
+#endif  /* SWEEP_H */
@@ -0,0 +1,80 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file TaskRunner.h
+///
+/// \brief Header file for the TaskRunner class.
+///
+
+
+#ifndef TASKRUNNER_H
+#define TASKRUNNER_H
+
+// std and third-party
+#include "std_includes.h"
+
+
+///
+/// \class TaskRunner
+///
+/// \brief A class which runs a set of independent, indexed tasks on up to a fixed
+///     number of worker threads. Intended to serve as a utility for embarrassingly
+///     parallel work (e.g., scenario sweeps, per-asset pre-processing, per-asset
+///     output). Workers are not persistent; they are started and joined within each
+///     call to run(), so a TaskRunner is cheap to hold but each run() pays the cost of
+///     thread creation (negligible against the coarse tasks it is intended for).
+///
+
+class TaskRunner {
+    public:
+        //  1. attributes
+        int n_threads; ///< The number of worker threads to use.
+        
+        
+        //  2. methods
+        TaskRunner(void);
+        TaskRunner(int);
+        
+        void run(size_t, std::function<void(size_t)>);
+        
+        ~TaskRunner(void);
+        
+};  /* TaskRunner */
+
+
+#endif  /* TASKRUNNER_H */
@@ -0,0 +1,159 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file TimeSeriesCache.h
+///
+/// \brief Header file for the TimeSeriesCache class.
+///
+
+
+#ifndef TIMESERIESCACHE_H
+#define TIMESERIESCACHE_H
+
+// std and third-party
+#include "std_includes.h"
+#include "../third_party/fast-cpp-csv-parser/csv.h"
+
+
+///
+/// \def TIME_SERIES_CACHE_MAGIC
+///
+/// \brief The magic string (including the terminating null character, so 8 bytes) at
+///     the start of every time series cache (sidecar) file.
+///
+
+#ifndef TIME_SERIES_CACHE_MAGIC
+    #define TIME_SERIES_CACHE_MAGIC "PGMTSC1"
+#endif  /* TIME_SERIES_CACHE_MAGIC */
+
+
+///
+/// \def TIME_SERIES_CACHE_VERSION
+///
+/// \brief The version of the time series cache file format.
+///
+
+#ifndef TIME_SERIES_CACHE_VERSION
+    #define TIME_SERIES_CACHE_VERSION 1
+#endif  /* TIME_SERIES_CACHE_VERSION */
+
+
+///
+/// \def TIME_SERIES_CACHE_EXTENSION
+///
+/// \brief The extension appended to the path of a CSV time series to get the path of
+///     its cache (sidecar) file.
+///
+
+#ifndef TIME_SERIES_CACHE_EXTENSION
+    #define TIME_SERIES_CACHE_EXTENSION ".pgmcache"
+#endif  /* TIME_SERIES_CACHE_EXTENSION */
+
+
+///
+/// \struct TimeSeriesCacheHeader
+///
+/// \brief A structure which defines the (fixed size) header of a time series cache
+///     file. The header is followed immediately by n_columns * n_rows doubles, stored
+///     column by column in native byte order (a cache file is never meant to leave the
+///     machine on which it was written).
+///
+
+struct TimeSeriesCacheHeader {
+    char magic[8]; ///< The magic string (TIME_SERIES_CACHE_MAGIC).
+    uint32_t version = 0; ///< The version of the file format (TIME_SERIES_CACHE_VERSION).
+    uint32_t n_columns = 0; ///< The number of columns.
+    uint64_t n_rows = 0; ///< The number of rows in every column.
+    int64_t source_mtime = 0; ///< The last write time of the source CSV (in file clock ticks).
+    uint64_t source_size = 0; ///< The size [bytes] of the source CSV.
+    uint64_t header_hash = 0; ///< A hash of the CSV column headers which were read.
+    uint64_t checksum = 0; ///< A checksum of the column data.
+};
+
+
+///
+/// \class TimeSeriesCache
+///
+/// \brief A class which reads time series data (from CSV) through a transparent binary
+///     cache. The first time a given CSV is read, its columns are parsed as usual and
+///     then written to a binary sidecar file (the CSV path plus
+///     TIME_SERIES_CACHE_EXTENSION). On later reads, the sidecar is memory mapped and
+///     copied out directly, skipping the CSV parse entirely.
+///
+/// A sidecar is only used if its source mtime, source size, and header hash all match
+/// the CSV being read and its checksum matches its data; otherwise it is ignored (and
+/// rewritten). Failure to write a sidecar (e.g., read-only data directory) is not an
+/// error; the data is simply parsed again next time.
+///
+
+class TimeSeriesCache {
+    private:
+        //  1. attributes
+        //...
+        
+        
+        //  2. methods
+        uint64_t __hashHeader(std::vector<std::string>*);
+        
+        bool __getSourceStamp(std::string, int64_t*, uint64_t*);
+        
+        void __readCSV(std::string, std::vector<std::string>*, std::vector<std::vector<double>>*);
+        
+        bool __readSidecar(std::string, std::vector<std::string>*, std::vector<std::vector<double>>*);
+        void __writeSidecar(std::string, std::vector<std::string>*, std::vector<std::vector<double>>*);
+        
+        
+    public:
+        //  1. attributes
+        bool enabled; ///< A boolean which indicates whether or not sidecar files are read and written (if false, every read parses the CSV).
+        bool last_read_from_cache; ///< A boolean which indicates whether or not the most recent read was served from a sidecar file.
+        
+        
+        //  2. methods
+        TimeSeriesCache(void);
+        
+        std::string getSidecarPath(std::string);
+        
+        void read(std::string, std::vector<std::string>, std::vector<std::vector<double>>*);
+        
+        ~TimeSeriesCache(void);
+        
+};  /* TimeSeriesCache */
+
+
+#endif  /* TIMESERIESCACHE_H */
@@ -0,0 +1,264 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+/// \file WeakReferenceCache.h
+///
+/// \brief Header file for the WeakReferenceCache class template. Being a template, it
+///     is defined entirely in this header.
+///
+
+
+#ifndef WEAKREFERENCECACHE_H
+#define WEAKREFERENCECACHE_H
+
+// std and third-party
+#include "std_includes.h"
+
+
+///
+/// \class WeakReferenceCache
+///
+/// \brief A class template which maps string keys to weak references of shared,
+///     immutable objects of type T (e.g., interpolation tables, solar geometries). An
+///     object is freed once the last of its holders is destroyed (i.e., objects are
+///     reference counted), at which point its entry is pruned. Insertion is first
+///     insert wins, so concurrent builders of the same object converge on one copy. All
+///     access is guarded by a mutex, so the cache can be shared across threads.
+///
+/// \tparam T The (typically const qualified) type of object cached.
+///
+
+template <typename T>
+class WeakReferenceCache {
+    private:
+        //  1. attributes
+        std::mutex mutex; ///< A mutex guarding cache_map.
+        
+        std::map<std::string, std::weak_ptr<T>> cache_map; ///< A map <key, weak reference> of all objects cached so far.
+        
+        
+        //  2. methods
+        void __pruneExpired(void);
+        
+        
+    public:
+        //  1. attributes
+        //...
+        
+        
+        //  2. methods
+        WeakReferenceCache(void) {}
+        
+        WeakReferenceCache(const WeakReferenceCache&) = delete;
+        WeakReferenceCache& operator = (const WeakReferenceCache&) = delete;
+        
+        std::shared_ptr<T> get(std::string);
+        std::shared_ptr<T> insert(std::string, std::shared_ptr<T>);
+        
+        size_t size(void);
+        void clear(void);
+        
+        ~WeakReferenceCache(void) {}
+        
+};  /* WeakReferenceCache */
+
+
+
+// ======== PRIVATE ================================================================= //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn template <typename T> void WeakReferenceCache<T> :: __pruneExpired(void)
+///
+/// \brief Helper method to drop all cache entries whose objects have since been freed.
+///     Assumes that the caller holds the mutex.
+///
+
+template <typename T>
+void WeakReferenceCache<T> :: __pruneExpired(void)
+{
+    for (auto iter = this->cache_map.begin(); iter != this->cache_map.end(); ) {
+        if (iter->second.expired()) {
+            iter = this->cache_map.erase(iter);
+        }
+        
+        else {
+            iter++;
+        }
+    }
+    
+    return;
+}   /* __pruneExpired() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PRIVATE ============================================================= //
+
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn template <typename T> std::shared_ptr<T> WeakReferenceCache<T> :: get(
+///         std::string key
+///     )
+///
+/// \brief Method to get the cached object with the given key (if any).
+///
+/// \param key The key of the given object.
+///
+/// \return A shared pointer to the cached object, or an empty shared pointer if there
+///     is none.
+///
+
+template <typename T>
+std::shared_ptr<T> WeakReferenceCache<T> :: get(std::string key)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    
+    auto iter = this->cache_map.find(key);
+    
+    if (iter == this->cache_map.end()) {
+        return std::shared_ptr<T>();
+    }
+    
+    return iter->second.lock();
+}   /* get() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn template <typename T> std::shared_ptr<T> WeakReferenceCache<T> :: insert(
+///         std::string key,
+///         std::shared_ptr<T> object_ptr
+///     )
+///
+/// \brief Method to insert the given object into the cache. If another thread has
+///     inserted a (live) object under the same key in the meantime, then that object is
+///     kept, and returned instead.
+///
+/// \param key The key of the given object.
+///
+/// \param object_ptr A shared pointer to the given object.
+///
+/// \return A shared pointer to the object now cached under the given key.
+///
+
+template <typename T>
+std::shared_ptr<T> WeakReferenceCache<T> :: insert(
+    std::string key,
+    std::shared_ptr<T> object_ptr
+)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    
+    this->__pruneExpired();
+    
+    std::shared_ptr<T> cached_ptr = this->cache_map[key].lock();
+    
+    if (cached_ptr) {
+        return cached_ptr;
+    }
+    
+    this->cache_map[key] = object_ptr;
+    
+    return object_ptr;
+}   /* insert() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn template <typename T> size_t WeakReferenceCache<T> :: size(void)
+///
+/// \brief Method to get the number of (live) objects in the cache.
+///
+/// \return The number of (live) objects in the cache.
+///
+
+template <typename T>
+size_t WeakReferenceCache<T> :: size(void)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    
+    this->__pruneExpired();
+    
+    return this->cache_map.size();
+}   /* size() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn template <typename T> void WeakReferenceCache<T> :: clear(void)
+///
+/// \brief Method to clear the cache. Objects already held elsewhere are unaffected
+///     (they are only freed once no longer held), but will no longer be shared with
+///     subsequent lookups.
+///
+
+template <typename T>
+void WeakReferenceCache<T> :: clear(void)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    
+    this->cache_map.clear();
+    
+    return;
+}   /* clear() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PUBLIC ============================================================== //
+
+
+#endif  /* WEAKREFERENCECACHE_H */
@@ -47,18 +47,29 @@
 
 #define _USE_MATH_DEFINES
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #ifdef _WIN32
@@ -0,0 +1,192 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file example_sweep.cpp
+///
+/// \brief An example PGMcpp sweep, accessed natively in C++.
+///
+/// This is an example of sizing a microgrid by sweeping over many candidate designs.
+/// See comments below for guidance.
+///
+
+
+#include "../header/Sweep.h"
+
+
+int main(int argc, char** argv)
+{
+    /*
+     *  1. construct Sweep object
+     *
+     *  This block constructs a Sweep object. The Sweep reads in the given electrical
+     *  load time series once, and then shares it (read only) with every scenario. The
+     *  number of worker threads can also be set; if nothing is given here, then all
+     *  available hardware threads are used.
+     */
+    
+    SweepInputs sweep_inputs;
+    
+    sweep_inputs.path_2_electrical_load_time_series =
+        "data/test/electrical_load/electrical_load_generic_peak-500kW_1yr_dt-1hr.csv";
+    
+    Sweep sweep(sweep_inputs);
+
+
+
+    /*
+     *  2. add renewable resources to Sweep
+     *
+     *  This block adds the renewable resource time series to the Sweep. As with the
+     *  electrical load, these are read in once and shared (read only) with every
+     *  scenario. Resource keys work exactly as they do for Model::addResource().
+     */
+    
+    int solar_resource_key = 0;
+    
+    sweep.addResource(
+        RenewableType :: SOLAR,
+        "data/test/resources/solar_GHI_peak-1kWm2_1yr_dt-1hr.csv",
+        solar_resource_key
+    );
+    
+    int wind_resource_key = 1;
+    
+    sweep.addResource(
+        RenewableType :: WIND,
+        "data/test/resources/wind_speed_peak-25ms_1yr_dt-1hr.csv",
+        wind_resource_key
+    );
+
+
+
+    /*
+     *  3. add scenarios to Sweep
+     *
+     *  This block defines and adds a set of scenarios (i.e., candidate microgrid
+     *  designs) to the Sweep. Each scenario is defined by a ScenarioInputs structure,
+     *  which holds the ModelInputs and a vector of inputs for each asset type (one
+     *  element per asset).
+     *
+     *  In this example, every scenario has the same diesel fleet (1 x 300 kW and
+     *  2 x 150 kW, all sunk), and the solar, wind, and battery capacities are swept.
+     */
+    
+    DieselInputs diesel_inputs;
+    diesel_inputs.combustion_inputs.production_inputs.is_sunk = true;
+    
+    for (int solar_kW = 0; solar_kW <= 500; solar_kW += 100) {
+        for (int wind_kW = 0; wind_kW <= 300; wind_kW += 150) {
+            for (int liion_kWh = 0; liion_kWh <= 2000; liion_kWh += 500) {
+                ScenarioInputs scenario_inputs;
+                
+                scenario_inputs.model_inputs.control_mode = ControlMode :: CYCLE_CHARGING;
+                
+                //  3.1. diesel fleet
+                diesel_inputs.combustion_inputs.production_inputs.capacity_kW = 300;
+                scenario_inputs.diesel_inputs_vec.push_back(diesel_inputs);
+                
+                diesel_inputs.combustion_inputs.production_inputs.capacity_kW = 150;
+                scenario_inputs.diesel_inputs_vec.push_back(diesel_inputs);
+                scenario_inputs.diesel_inputs_vec.push_back(diesel_inputs);
+                
+                //  3.2. solar PV array
+                if (solar_kW > 0) {
+                    SolarInputs solar_inputs;
+                    
+                    solar_inputs.renewable_inputs.production_inputs.capacity_kW =
+                        solar_kW;
+                    solar_inputs.resource_key = solar_resource_key;
+                    
+                    scenario_inputs.solar_inputs_vec.push_back(solar_inputs);
+                }
+                
+                //  3.3. wind turbine
+                if (wind_kW > 0) {
+                    WindInputs wind_inputs;
+                    
+                    wind_inputs.renewable_inputs.production_inputs.capacity_kW =
+                        wind_kW;
+                    wind_inputs.resource_key = wind_resource_key;
+                    
+                    scenario_inputs.wind_inputs_vec.push_back(wind_inputs);
+                }
+                
+                //  3.4. lithium ion battery energy storage system (4 hr)
+                if (liion_kWh > 0) {
+                    LiIonInputs liion_inputs;
+                    
+                    liion_inputs.storage_inputs.power_capacity_kW = liion_kWh / 4;
+                    liion_inputs.storage_inputs.energy_capacity_kWh = liion_kWh;
+                    
+                    scenario_inputs.liion_inputs_vec.push_back(liion_inputs);
+                }
+                
+                sweep.addScenario(scenario_inputs);
+            }
+        }
+    }
+
+
+
+    /*
+     *  4. run and write results
+     *
+     *  This block runs every scenario (in parallel), and then writes a summary of each
+     *  scenario to the given output path (either relative or absolute). The optional
+     *  callback passed to run() is called as each scenario completes; here, it is used
+     *  to report progress.
+     */
+    
+    size_t n_complete = 0;
+    
+    sweep.run(
+        [&](const ScenarioSummary& scenario_summary) {
+            n_complete++;
+            
+            std::cout << "\r" << n_complete << " / "
+                << sweep.scenario_inputs_vec.size() << " scenarios complete"
+                << std::flush;
+        }
+    );
+    
+    std::cout << std::endl;
+    
+    sweep.writeResults("projects/example_sweep");
+    
+    return 0;
+}   /* main() */
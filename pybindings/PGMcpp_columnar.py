@@ -0,0 +1,188 @@
+"""
+    PGMcpp : PRIMED Grid Modelling (in C++)
+    Copyright 2023 (C)
+
+    Anthony Truelove MASc, P.Eng.
+    email:  gears1763@tutanota.com
+    github: gears1763-2
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    1. Redistributions of source code must retain the above copyright notice,
+       this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+
+    CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+"""
+
+
+"""
+    A zero-copy reader for PGMcpp columnar results files (as written by
+    Model.writeResults(..., columnar_format=PGMcpp.ColumnarFormat.COLUMNAR_FLOAT64) or
+    COLUMNAR_FLOAT32).
+    
+    The file is memory mapped (numpy.memmap), and each column is returned as a numpy
+    view into the mapping, so no column data is copied until it is actually touched.
+    
+    Usage:
+    
+        import PGMcpp_columnar
+        
+        results = PGMcpp_columnar.ColumnarResults(
+            "results/time_series_results.pgmcol"
+        )
+        
+        load_kW = results.getColumn("Model", -1, "Electrical Load")
+"""
+
+
+import struct
+
+import numpy
+
+
+COLUMNAR_MAGIC = b"PGMCOLS\x00"
+COLUMNAR_VERSION = 1
+
+
+class ColumnarResults:
+    """
+        A class which memory maps a columnar results file and exposes each column as a
+        (read-only, zero-copy) numpy array.
+    """
+    
+    def __init__(self, path):
+        """
+            Memory map the given columnar results file and read its header.
+            
+            Parameters
+            ----------
+            path : str
+                The path to the columnar results file.
+        """
+        
+        self.path = path
+        self.buffer = numpy.memmap(path, dtype=numpy.uint8, mode="r")
+        
+        if self.buffer.size < 32 or bytes(self.buffer[0:8]) != COLUMNAR_MAGIC:
+            raise RuntimeError(
+                "ERROR:  ColumnarResults():  " + path + " is not a columnar results file"
+            )
+        
+        version, self.bytes_per_value, self.n_rows, n_columns = struct.unpack_from(
+            "<IIQQ", self.buffer, 8
+        )
+        
+        if version != COLUMNAR_VERSION:
+            raise RuntimeError(
+                "ERROR:  ColumnarResults():  unsupported columnar version " +
+                str(version)
+            )
+        
+        if self.bytes_per_value == 8:
+            self.dtype = numpy.dtype("<f8")
+        
+        elif self.bytes_per_value == 4:
+            self.dtype = numpy.dtype("<f4")
+        
+        else:
+            raise RuntimeError(
+                "ERROR:  ColumnarResults():  unsupported bytes per value " +
+                str(self.bytes_per_value)
+            )
+        
+        self.column_list = []
+        
+        offset = 32
+        for i in range(0, n_columns):
+            group, offset = self.__readString(offset)
+            type_str, offset = self.__readString(offset)
+            asset_index, capacity_kW = struct.unpack_from("<Id", self.buffer, offset)
+            offset += 12
+            name, offset = self.__readString(offset)
+            units, offset = self.__readString(offset)
+            data_offset, = struct.unpack_from("<Q", self.buffer, offset)
+            offset += 8
+            
+            if asset_index == 0xFFFFFFFF:
+                asset_index = -1
+            
+            self.column_list.append(
+                {
+                    "group": group,
+                    "type_str": type_str,
+                    "asset_index": asset_index,
+                    "capacity_kW": capacity_kW,
+                    "name": name,
+                    "units": units,
+                    "data_offset": data_offset
+                }
+            )
+        
+        return
+    
+    
+    def __readString(self, offset):
+        length, = struct.unpack_from("<I", self.buffer, offset)
+        offset += 4
+        string = bytes(self.buffer[offset : offset + length]).decode("utf-8")
+        
+        return string, offset + length
+    
+    
+    def getColumnIndex(self, group, asset_index, name):
+        """
+            Get the index of the column with the given group, asset index, and name.
+            Raises a ValueError if no such column exists.
+        """
+        
+        for i, column in enumerate(self.column_list):
+            if (
+                column["group"] == group and
+                column["asset_index"] == asset_index and
+                column["name"] == name
+            ):
+                return i
+        
+        raise ValueError(
+            "ERROR:  ColumnarResults.getColumnIndex():  no column (" + group + ", " +
+            str(asset_index) + ", " + name + ") in " + self.path
+        )
+    
+    
+    def readColumn(self, column_index):
+        """
+            Get a zero-copy numpy view of the column with the given index.
+        """
+        
+        data_offset = self.column_list[column_index]["data_offset"]
+        n_bytes = self.n_rows * self.bytes_per_value
+        
+        return self.buffer[data_offset : data_offset + n_bytes].view(self.dtype)
+    
+    
+    def getColumn(self, group, asset_index, name):
+        """
+            Get a zero-copy numpy view of the column with the given group, asset index,
+            and name.
+        """
+        
+        return self.readColumn(self.getColumnIndex(group, asset_index, name))
@@ -51,16 +51,21 @@
 #include <pybind11/stl.h>
 
 #include "../header/Model.h"
+#include "../header/Sweep.h"
 
 
 PYBIND11_MODULE(PGMcpp, m) {
 
+    #include "snippets/PYBIND11_ColumnarReader.cpp"
     #include "snippets/PYBIND11_Controller.cpp"
+    #include "snippets/PYBIND11_DiscountFactorCache.cpp"
     #include "snippets/PYBIND11_ElectricalLoad.cpp"
     #include "snippets/PYBIND11_Interpolator.cpp"
     #include "snippets/PYBIND11_Model.cpp"
     #include "snippets/PYBIND11_Resources.cpp"
+    #include "snippets/PYBIND11_Sweep.cpp"
     #include "snippets/PYBIND11_ThermalModel.cpp" 
+    #include "snippets/PYBIND11_TimeSeriesCache.cpp"
     
     #include "snippets/Production/PYBIND11_Production.cpp"
     
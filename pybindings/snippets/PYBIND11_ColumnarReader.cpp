@@ -0,0 +1,81 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+/// \file PYBIND11_ColumnarReader.cpp
+///
+/// \brief Bindings file for the ColumnarReader class (and the supporting
+///     ColumnarFormat enum and ColumnarColumn struct). Intended to be #include'd in
+///     PYBIND11_PGM.cpp
+///
+/// Ref: \cite pybind11\n
+///
+/// A file which instructs pybind11 how to build Python bindings for the
+/// ColumnarReader class. Only public attributes/methods are bound! For zero-copy
+/// (numpy.memmap) access to columnar results files, see PGMcpp_columnar.py.
+///
+
+
+pybind11::enum_<ColumnarFormat>(m, "ColumnarFormat")
+    .value("COLUMNAR_NONE", ColumnarFormat::COLUMNAR_NONE)
+    .value("COLUMNAR_FLOAT64", ColumnarFormat::COLUMNAR_FLOAT64)
+    .value("COLUMNAR_FLOAT32", ColumnarFormat::COLUMNAR_FLOAT32)
+    .value("N_COLUMNAR_FORMATS", ColumnarFormat::N_COLUMNAR_FORMATS);
+
+
+pybind11::class_<ColumnarColumn>(m, "ColumnarColumn")
+    .def_readwrite("group", &ColumnarColumn::group)
+    .def_readwrite("type_str", &ColumnarColumn::type_str)
+    .def_readwrite("asset_index", &ColumnarColumn::asset_index)
+    .def_readwrite("capacity_kW", &ColumnarColumn::capacity_kW)
+    .def_readwrite("name", &ColumnarColumn::name)
+    .def_readwrite("units", &ColumnarColumn::units)
+    .def_readwrite("data_offset", &ColumnarColumn::data_offset)
+    
+    .def(pybind11::init());
+
+
+pybind11::class_<ColumnarReader>(m, "ColumnarReader")
+    .def_readwrite("bytes_per_value", &ColumnarReader::bytes_per_value)
+    .def_readwrite("n_rows", &ColumnarReader::n_rows)
+    .def_readwrite("column_vec", &ColumnarReader::column_vec)
+    
+    .def(pybind11::init<>())
+    .def(pybind11::init<std::string>())
+    .def("getColumnIndex", &ColumnarReader::getColumnIndex)
+    .def("readColumn", &ColumnarReader::readColumn);
@@ -58,7 +58,18 @@ pybind11::class_<Controller>(m, "Controller")
     .def_readwrite("control_mode", &Controller::control_mode)
     .def_readwrite("control_string", &Controller::control_string)
     .def_readwrite("firm_dispatch_ratio", &Controller::firm_dispatch_ratio)
+    .def_readwrite("n_threads", &Controller::n_threads)
+    .def_readwrite("summary_only", &Controller::summary_only)
     .def_readwrite("load_reserve_ratio", &Controller::load_reserve_ratio)
+    .def_readwrite("total_missed_load_kWh", &Controller::total_missed_load_kWh)
+    .def_readwrite(
+        "total_missed_firm_dispatch_kWh",
+        &Controller::total_missed_firm_dispatch_kWh
+    )
+    .def_readwrite(
+        "total_missed_spinning_reserve_kWh",
+        &Controller::total_missed_spinning_reserve_kWh
+    )
     .def_readwrite("net_load_vec_kW", &Controller::net_load_vec_kW)
     .def_readwrite("missed_load_vec_kW", &Controller::missed_load_vec_kW)
     .def_readwrite(
@@ -69,10 +80,40 @@ pybind11::class_<Controller>(m, "Controller")
         "missed_spinning_reserve_vec_kW",
         &Controller::missed_spinning_reserve_vec_kW
     )
+    .def_readwrite(
+        "combustion_map_resolution_kW",
+        &Controller::combustion_map_resolution_kW
+    )
     .def_readwrite("combustion_map", &Controller::combustion_map)
+    .def_readwrite(
+        "combustion_table_capacity_vec_kW",
+        &Controller::combustion_table_capacity_vec_kW
+    )
     
     .def(pybind11::init<>())
     .def("setControlMode", &Controller::setControlMode)
-    .def("init", &Controller::init)
-    .def("applyDispatchControl", &Controller::applyDispatchControl)
+    .def("setSummaryOnly", &Controller::setSummaryOnly)
+    .def("setNThreads", &Controller::setNThreads)
+    .def(
+        "init",
+        &Controller::init,
+        pybind11::arg("electrical_load_ptr"),
+        pybind11::arg("renewable_ptr_vec_ptr"),
+        pybind11::arg("resources_ptr"),
+        pybind11::arg("combustion_ptr_vec_ptr"),
+        pybind11::arg("noncombustion_ptr_vec_ptr") = nullptr
+    )
+    .def(
+        "applyDispatchControl",
+        &Controller::applyDispatchControl,
+        pybind11::arg("electrical_load_ptr"),
+        pybind11::arg("resources_ptr"),
+        pybind11::arg("combustion_ptr_vec_ptr"),
+        pybind11::arg("noncombustion_ptr_vec_ptr"),
+        pybind11::arg("renewable_ptr_vec_ptr"),
+        pybind11::arg("storage_ptr_vec_ptr"),
+        pybind11::arg("thermal_model_ptr"),
+        pybind11::arg("start_timestep") = 0,
+        pybind11::arg("end_timestep") = -1
+    )
     .def("clear", &Controller::clear);
@@ -58,6 +58,7 @@ pybind11::class_<ElectricalLoad>(m, "ElectricalLoad")
     .def_readwrite("time_vec_hrs", &ElectricalLoad::time_vec_hrs)
     .def_readwrite("dt_vec_hrs", &ElectricalLoad::dt_vec_hrs)
     .def_readwrite("load_vec_kW", &ElectricalLoad::load_vec_kW)
+    .def_readwrite("time_series_cache", &ElectricalLoad::time_series_cache)
     
     .def(pybind11::init<>())
     .def(pybind11::init<std::string>())
@@ -48,11 +48,20 @@
 ///
 
 
+pybind11::class_<InterpolatorAxis>(m, "InterpolatorAxis")
+    .def_readwrite("is_increasing", &InterpolatorAxis::is_increasing)
+    .def_readwrite("is_uniform", &InterpolatorAxis::is_uniform)
+    .def_readwrite("inverse_dx", &InterpolatorAxis::inverse_dx)
+    
+    .def(pybind11::init());
+
+
 pybind11::class_<InterpolatorStruct1D>(m, "InterpolatorStruct1D")
     .def_readwrite("n_points", &InterpolatorStruct1D::n_points)
     .def_readwrite("x_vec", &InterpolatorStruct1D::x_vec)
     .def_readwrite("min_x", &InterpolatorStruct1D::min_x)
     .def_readwrite("max_x", &InterpolatorStruct1D::max_x)
+    .def_readwrite("x_axis", &InterpolatorStruct1D::x_axis)
     .def_readwrite("y_vec", &InterpolatorStruct1D::y_vec)
     
     .def(pybind11::init());
@@ -67,19 +76,124 @@ pybind11::class_<InterpolatorStruct2D>(m, "InterpolatorStruct2D")
     .def_readwrite("y_vec", &InterpolatorStruct2D::y_vec)
     .def_readwrite("min_y", &InterpolatorStruct2D::min_y)
     .def_readwrite("max_y", &InterpolatorStruct2D::max_y)
-    .def_readwrite("z_matrix", &InterpolatorStruct2D::z_matrix)
+    .def_readwrite("x_axis", &InterpolatorStruct2D::x_axis)
+    .def_readwrite("y_axis", &InterpolatorStruct2D::y_axis)
+    .def_readwrite("z_vec", &InterpolatorStruct2D::z_vec)
+    
+    .def(pybind11::init());
+
+
+pybind11::class_<InterpolatorHandle1D>(m, "InterpolatorHandle1D")
+    .def_readwrite("idx", &InterpolatorHandle1D::idx)
+    
+    .def(pybind11::init());
+
+
+pybind11::class_<InterpolatorHandle2D>(m, "InterpolatorHandle2D")
+    .def_readwrite("idx", &InterpolatorHandle2D::idx)
     
     .def(pybind11::init());
 
 
 pybind11::class_<Interpolator>(m, "Interpolator")
-    .def_readwrite("interp_map_1D", &Interpolator::interp_map_1D)
+    .def_property_readonly(
+        "interp_map_1D",
+        [](Interpolator& interpolator) {
+            std::map<int, InterpolatorStruct1D> interp_map_1D;
+            
+            for (auto iter : interpolator.interp_map_1D) {
+                interp_map_1D[iter.first] = *(iter.second);
+            }
+            
+            return interp_map_1D;
+        }
+    )
     .def_readwrite("path_map_1D", &Interpolator::path_map_1D)
-    .def_readwrite("interp_map_2D", &Interpolator::interp_map_2D)
+    .def_property_readonly(
+        "interp_map_2D",
+        [](Interpolator& interpolator) {
+            std::map<int, InterpolatorStruct2D> interp_map_2D;
+            
+            for (auto iter : interpolator.interp_map_2D) {
+                interp_map_2D[iter.first] = *(iter.second);
+            }
+            
+            return interp_map_2D;
+        }
+    )
     .def_readwrite("path_map_2D", &Interpolator::path_map_2D)
     
     .def(pybind11::init<>())
-    .def("addData1D", &Interpolator::addData1D)
-    .def("addData2D", &Interpolator::addData2D)
-    .def("interp1D", &Interpolator::interp1D)
-    .def("interp2D", &Interpolator::interp2D);
+    .def(
+        "addData1D",
+        pybind11::overload_cast<int, std::string>(&Interpolator::addData1D)
+    )
+    .def(
+        "addData1D",
+        pybind11::overload_cast<int, InterpolatorStruct1D>(&Interpolator::addData1D)
+    )
+    .def(
+        "addData2D",
+        pybind11::overload_cast<int, std::string>(&Interpolator::addData2D)
+    )
+    .def(
+        "addData2D",
+        pybind11::overload_cast<int, InterpolatorStruct2D>(&Interpolator::addData2D)
+    )
+    .def("getHandle1D", &Interpolator::getHandle1D)
+    .def("getHandle2D", &Interpolator::getHandle2D)
+    .def(
+        "interp1D",
+        pybind11::overload_cast<int, double>(&Interpolator::interp1D)
+    )
+    .def(
+        "interp1D",
+        pybind11::overload_cast<InterpolatorHandle1D, double>(&Interpolator::interp1D)
+    )
+    .def(
+        "interp2D",
+        pybind11::overload_cast<int, double, double>(&Interpolator::interp2D)
+    )
+    .def(
+        "interp2D",
+        pybind11::overload_cast<InterpolatorHandle2D, double, double>(
+            &Interpolator::interp2D
+        )
+    )
+    .def(
+        "interp1DBatch",
+        [](Interpolator& interpolator, int data_key, std::vector<double> interp_x_vec) {
+            std::vector<double> interp_y_vec(interp_x_vec.size(), 0);
+            
+            interpolator.interp1DBatch(
+                data_key,
+                interp_x_vec.data(),
+                interp_y_vec.data(),
+                interp_x_vec.size()
+            );
+            
+            return interp_y_vec;
+        }
+    )
+    .def(
+        "interp2DBatch",
+        [](
+            Interpolator& interpolator,
+            int data_key,
+            std::vector<double> interp_x_vec,
+            std::vector<double> interp_y_vec
+        ) {
+            size_t n = std::min(interp_x_vec.size(), interp_y_vec.size());
+            std::vector<double> interp_z_vec(n, 0);
+            
+            interpolator.interp2DBatch(
+                data_key,
+                interp_x_vec.data(),
+                interp_y_vec.data(),
+                interp_z_vec.data(),
+                n
+            );
+            
+            return interp_z_vec;
+        }
+    );
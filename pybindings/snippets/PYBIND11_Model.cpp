@@ -56,6 +56,21 @@ pybind11::class_<ModelInputs>(m, "ModelInputs")
     .def_readwrite("control_mode", &ModelInputs::control_mode)
     .def_readwrite("firm_dispatch_ratio", &ModelInputs::firm_dispatch_ratio)
     .def_readwrite("load_reserve_ratio", &ModelInputs::load_reserve_ratio)
+    .def_readwrite("summary_only", &ModelInputs::summary_only)
+    .def_readwrite("n_threads", &ModelInputs::n_threads)
+    
+    .def(pybind11::init());
+
+
+pybind11::class_<CostInputs>(m, "CostInputs")
+    .def_readwrite("nominal_inflation_annual", &CostInputs::nominal_inflation_annual)
+    .def_readwrite("nominal_discount_annual", &CostInputs::nominal_discount_annual)
+    .def_readwrite("capital_cost_scalar", &CostInputs::capital_cost_scalar)
+    .def_readwrite(
+        "operation_maintenance_cost_scalar",
+        &CostInputs::operation_maintenance_cost_scalar
+    )
+    .def_readwrite("fuel_cost_scalar", &CostInputs::fuel_cost_scalar)
     
     .def(pybind11::init());
 
@@ -83,7 +98,11 @@ pybind11::class_<Model>(m, "Model")
     .def_readwrite("controller", &Model::controller)
     .def_readwrite("electrical_load", &Model::electrical_load)
     .def_readwrite("resources", &Model::resources)
+    .def_readwrite("discount_factor_cache", &Model::discount_factor_cache)
+    .def_readwrite("discount_factor_cache_ptr", &Model::discount_factor_cache_ptr)
     .def_readwrite("thermal_model_ptr", &Model::thermal_model_ptr)
+    .def_readwrite("summary_only", &Model::summary_only)
+    .def_readwrite("next_timestep", &Model::next_timestep)
 
     .def_readwrite("combustion_ptr_vec", &Model::combustion_ptr_vec)
     .def_readwrite("noncombustion_ptr_vec", &Model::noncombustion_ptr_vec)
@@ -101,6 +120,12 @@ pybind11::class_<Model>(m, "Model")
         "addResource",
         pybind11::overload_cast<RenewableType, std::string, int>(&Model::addResource)
     )
+    .def(
+        "addResources",
+        &Model::addResources,
+        pybind11::arg("resource_inputs_vec"),
+        pybind11::arg("n_threads") = 0
+    )
     .def("addHydro", &Model::addHydro)
     .def("addSolar", &Model::addSolar)
     .def("addTidal", &Model::addTidal)
@@ -111,11 +136,16 @@ pybind11::class_<Model>(m, "Model")
     .def("addThermalModel", &Model::addThermalModel)
 
     .def("run", &Model::run)
+    .def("runUntil", &Model::runUntil)
+    .def("recomputeEconomics", &Model::recomputeEconomics)
+    .def("clone", &Model::clone, pybind11::keep_alive<0, 1>())
+    .def("fork", &Model::fork, pybind11::keep_alive<0, 1>())
     .def("reset", &Model::reset)
     .def("clear", &Model::clear)
     .def(
         "writeResults",
         &Model::writeResults,
         pybind11::arg("write_path"),
-        pybind11::arg("max_lines") = -1
+        pybind11::arg("max_lines") = -1,
+        pybind11::arg("columnar_format") = ColumnarFormat::COLUMNAR_NONE
     );
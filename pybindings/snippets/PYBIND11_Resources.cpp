@@ -48,13 +48,45 @@
 ///
 
 
+pybind11::class_<ResourceInputs>(m, "ResourceInputs")
+    .def_readwrite("renewable_type", &ResourceInputs::renewable_type)
+    .def_readwrite("noncombustion_type", &ResourceInputs::noncombustion_type)
+    .def_readwrite("path_2_resource_data", &ResourceInputs::path_2_resource_data)
+    .def_readwrite("resource_key", &ResourceInputs::resource_key)
+    
+    .def(pybind11::init());
+
+
 pybind11::class_<Resources>(m, "Resources")
     .def_readwrite("resource_map_1D", &Resources::resource_map_1D)
     .def_readwrite("string_map_1D", &Resources::string_map_1D)
     .def_readwrite("path_map_1D", &Resources::path_map_1D)
-    .def_readwrite("resource_map_2D", &Resources::resource_map_2D)
+    .def_property_readonly(
+        "resource_map_2D",
+        [](const Resources& resources) {
+            std::map<int, std::vector<std::vector<double>>> resource_map_2D;
+            
+            for (const auto& resource_pair : resources.resource_map_2D) {
+                std::vector<std::vector<double>>& series_vec =
+                    resource_map_2D[resource_pair.first];
+                
+                for (int i = 0; i < resource_pair.second.n_points; i++) {
+                    series_vec.push_back(
+                        {
+                            resource_pair.second.channel_vec[0][i],
+                            resource_pair.second.channel_vec[1][i]
+                        }
+                    );
+                }
+            }
+            
+            return resource_map_2D;
+        }
+    )
+    .def_readwrite("resource_soa_map_2D", &Resources::resource_map_2D)
     .def_readwrite("string_map_2D", &Resources::string_map_2D)
     .def_readwrite("path_map_2D", &Resources::path_map_2D)
+    .def_readwrite("time_series_cache", &Resources::time_series_cache)
 
     .def(pybind11::init<>())
     .def(
@@ -65,4 +97,18 @@ pybind11::class_<Resources>(m, "Resources")
         "addResource",
         pybind11::overload_cast<RenewableType, std::string, int, ElectricalLoad*>(&Resources::addResource)
     )
+    .def(
+        "addResources",
+        &Resources::addResources,
+        pybind11::arg("resource_inputs_vec"),
+        pybind11::arg("electrical_load_ptr"),
+        pybind11::arg("n_threads") = 0
+    )
+    .def(
+        "getResourceSpan2D",
+        [](Resources& resources, int resource_key, int channel) {
+            ResourceSpan span = resources.getResourceSpan2D(resource_key, channel);
+            return std::vector<double>(span.begin(), span.end());
+        }
+    )
     .def("clear", &Resources::clear);
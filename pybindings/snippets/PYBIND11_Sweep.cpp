@@ -0,0 +1,119 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file PYBIND11_Sweep.cpp
+///
+/// \brief Bindings file for the Sweep class. Intended to be #include'd in
+///     PYBIND11_PGM.cpp
+///
+/// Ref: \cite pybind11\n
+///
+/// A file which instructs pybind11 how to build Python bindings for the Sweep
+/// class. Only public attributes/methods are bound!
+///
+
+
+pybind11::class_<SweepInputs>(m, "SweepInputs")
+    .def_readwrite(
+        "path_2_electrical_load_time_series",
+        &SweepInputs::path_2_electrical_load_time_series
+    )
+    .def_readwrite("n_threads", &SweepInputs::n_threads)
+    
+    .def(pybind11::init());
+
+
+pybind11::class_<ScenarioInputs>(m, "ScenarioInputs")
+    .def_readwrite("model_inputs", &ScenarioInputs::model_inputs)
+    .def_readwrite("diesel_inputs_vec", &ScenarioInputs::diesel_inputs_vec)
+    .def_readwrite("hydro_inputs_vec", &ScenarioInputs::hydro_inputs_vec)
+    .def_readwrite("solar_inputs_vec", &ScenarioInputs::solar_inputs_vec)
+    .def_readwrite("tidal_inputs_vec", &ScenarioInputs::tidal_inputs_vec)
+    .def_readwrite("wave_inputs_vec", &ScenarioInputs::wave_inputs_vec)
+    .def_readwrite("wind_inputs_vec", &ScenarioInputs::wind_inputs_vec)
+    .def_readwrite("liion_inputs_vec", &ScenarioInputs::liion_inputs_vec)
+    .def_readwrite("h2_inputs_vec", &ScenarioInputs::h2_inputs_vec)
+    
+    .def(pybind11::init());
+
+
+pybind11::class_<ScenarioSummary>(m, "ScenarioSummary")
+    .def_readwrite("scenario_index", &ScenarioSummary::scenario_index)
+    .def_readwrite("is_complete", &ScenarioSummary::is_complete)
+    .def_readwrite("error_str", &ScenarioSummary::error_str)
+    .def_readwrite("net_present_cost", &ScenarioSummary::net_present_cost)
+    .def_readwrite(
+        "levellized_cost_of_energy_kWh",
+        &ScenarioSummary::levellized_cost_of_energy_kWh
+    )
+    .def_readwrite("total_fuel_consumed_L", &ScenarioSummary::total_fuel_consumed_L)
+    .def_readwrite("total_emissions", &ScenarioSummary::total_emissions)
+    .def_readwrite("total_dispatch_kWh", &ScenarioSummary::total_dispatch_kWh)
+    .def_readwrite("total_discharge_kWh", &ScenarioSummary::total_discharge_kWh)
+    .def_readwrite("total_missed_load_kWh", &ScenarioSummary::total_missed_load_kWh)
+    .def_readwrite("renewable_penetration", &ScenarioSummary::renewable_penetration)
+    
+    .def(pybind11::init());
+
+
+pybind11::class_<Sweep>(m, "Sweep")
+    .def_readwrite("n_threads", &Sweep::n_threads)
+    .def_readwrite("electrical_load", &Sweep::electrical_load)
+    .def_readwrite("resources", &Sweep::resources)
+    .def_readwrite("discount_factor_cache", &Sweep::discount_factor_cache)
+    .def_readwrite("scenario_inputs_vec", &Sweep::scenario_inputs_vec)
+    .def_readwrite("scenario_summary_vec", &Sweep::scenario_summary_vec)
+    
+    .def(pybind11::init<>())
+    .def(pybind11::init<SweepInputs>())
+    .def(
+        "addResource",
+        pybind11::overload_cast<NoncombustionType, std::string, int>(&Sweep::addResource)
+    )
+    .def(
+        "addResource",
+        pybind11::overload_cast<RenewableType, std::string, int>(&Sweep::addResource)
+    )
+    .def("addScenario", &Sweep::addScenario)
+    .def(
+        "run",
+        [](Sweep& sweep) { sweep.run(); },
+        pybind11::call_guard<pybind11::gil_scoped_release>()
+    )
+    .def("clear", &Sweep::clear)
+    .def("writeResults", &Sweep::writeResults);
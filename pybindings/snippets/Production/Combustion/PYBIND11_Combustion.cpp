@@ -90,6 +90,22 @@ pybind11::class_<Emissions>(m, "Emissions")
     .def(pybind11::init());
 
 
+pybind11::class_<FuelCurveTable>(m, "FuelCurveTable")
+    .def_readwrite("n_bins", &FuelCurveTable::n_bins)
+    .def_readwrite("min_load_ratio", &FuelCurveTable::min_load_ratio)
+    .def_readwrite("max_load_ratio", &FuelCurveTable::max_load_ratio)
+    .def_readwrite("inverse_bin_width", &FuelCurveTable::inverse_bin_width)
+    .def_readwrite("bin_segment_vec", &FuelCurveTable::bin_segment_vec)
+    .def_readwrite(
+        "segment_max_load_ratio_vec",
+        &FuelCurveTable::segment_max_load_ratio_vec
+    )
+    .def_readwrite("slope_vec_Lhr", &FuelCurveTable::slope_vec_Lhr)
+    .def_readwrite("intercept_vec_Lhr", &FuelCurveTable::intercept_vec_Lhr)
+    
+    .def(pybind11::init());
+
+
 pybind11::class_<Combustion>(m, "Combustion")
     .def_readwrite("type", &Combustion::type)
     .def_readwrite("fuel_mode", &Combustion::fuel_mode)
@@ -103,11 +119,14 @@ pybind11::class_<Combustion>(m, "Combustion")
         "real_fuel_escalation_annual",
         &Combustion::real_fuel_escalation_annual
     )
+    .def_readwrite("fuel_cost_scalar", &Combustion::fuel_cost_scalar)
     .def_readwrite("linear_fuel_slope_LkWh", &Combustion::linear_fuel_slope_LkWh)
     .def_readwrite(
         "linear_fuel_intercept_LkWh",
         &Combustion::linear_fuel_intercept_LkWh
     )
+    .def_readwrite("fuel_interp_handle", &Combustion::fuel_interp_handle)
+    .def_readwrite("fuel_curve_table", &Combustion::fuel_curve_table)
     .def_readwrite(
         "cycle_charging_setpoint",
         &Combustion::cycle_charging_setpoint
@@ -151,9 +170,18 @@ pybind11::class_<Combustion>(m, "Combustion")
     .def(pybind11::init<int, double, CombustionInputs, std::vector<double>*>())
     .def("handleReplacement", &Combustion::handleReplacement)
     .def("computeFuelAndEmissions", &Combustion::computeFuelAndEmissions)
-    .def("computeEconomics", &Combustion::computeEconomics)
+    .def("computeEmissionsSeries", &Combustion::computeEmissionsSeries)
+    .def(
+        "computeEconomics",
+        &Combustion::computeEconomics,
+        pybind11::arg("time_vec_hrs_ptr"),
+        pybind11::arg("discount_factor_cache_ptr") = nullptr
+    )
+    .def("resetEconomics", &Combustion::resetEconomics)
+    .def("getFuelCost", &Combustion::getFuelCost)
     .def("requestProductionkW", &Combustion::requestProductionkW)
     .def("commit", &Combustion::commit)
+    .def("summarizeTimestep", &Combustion::summarizeTimestep)
     .def("getFuelConsumptionL", &Combustion::getFuelConsumptionL)
     .def("getEmissionskg", &Combustion::getEmissionskg)
     .def("writeResults", &Combustion::writeResults);
@@ -82,6 +82,12 @@ pybind11::class_<Hydro>(m, "Hydro")
     .def_readwrite("minimum_power_kW", &Hydro::minimum_power_kW)
     .def_readwrite("minimum_flow_m3hr", &Hydro::minimum_flow_m3hr)
     .def_readwrite("maximum_flow_m3hr", &Hydro::maximum_flow_m3hr)
+    .def_readwrite(
+        "generator_efficiency_handle",
+        &Hydro::generator_efficiency_handle
+    )
+    .def_readwrite("turbine_efficiency_handle", &Hydro::turbine_efficiency_handle)
+    .def_readwrite("flow_to_power_handle", &Hydro::flow_to_power_handle)
     .def_readwrite("turbine_flow_vec_m3hr", &Hydro::turbine_flow_vec_m3hr)
     .def_readwrite("spill_rate_vec_m3hr", &Hydro::spill_rate_vec_m3hr)
     .def_readwrite("stored_volume_vec_m3", &Hydro::stored_volume_vec_m3)
@@ -66,7 +66,12 @@ pybind11::class_<Noncombustion>(m, "Noncombustion")
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, NoncombustionInputs, std::vector<double>*>())
     .def("handleReplacement", &Noncombustion::handleReplacement)
-    .def("computeEconomics", &Noncombustion::computeEconomics)
+    .def(
+        "computeEconomics",
+        &Noncombustion::computeEconomics,
+        pybind11::arg("time_vec_hrs_ptr"),
+        pybind11::arg("discount_factor_cache_ptr") = nullptr
+    )
     .def(
         "requestProductionkW",
         pybind11::overload_cast<int, double, double>(&Noncombustion::requestProductionkW)
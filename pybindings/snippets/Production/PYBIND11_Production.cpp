@@ -48,9 +48,32 @@
 ///
 
 
+pybind11::enum_<CapitalCostReason>(m, "CapitalCostReason")
+    .value("CAPITAL_COST_INITIAL", CapitalCostReason::CAPITAL_COST_INITIAL)
+    .value("CAPITAL_COST_REPLACEMENT", CapitalCostReason::CAPITAL_COST_REPLACEMENT)
+    .value(
+        "CAPITAL_COST_ELECTROLYZER_REPLACEMENT",
+        CapitalCostReason::CAPITAL_COST_ELECTROLYZER_REPLACEMENT
+    )
+    .value(
+        "CAPITAL_COST_FUEL_CELL_REPLACEMENT",
+        CapitalCostReason::CAPITAL_COST_FUEL_CELL_REPLACEMENT
+    )
+    .value("N_CAPITAL_COST_REASONS", CapitalCostReason::N_CAPITAL_COST_REASONS);
+
+
+pybind11::class_<CapitalCostEvent>(m, "CapitalCostEvent")
+    .def_readwrite("timestep", &CapitalCostEvent::timestep)
+    .def_readwrite("cost", &CapitalCostEvent::cost)
+    .def_readwrite("reason", &CapitalCostEvent::reason)
+    
+    .def(pybind11::init());
+
+
 pybind11::class_<ProductionInputs>(m, "ProductionInputs")
     .def_readwrite("print_flag", &ProductionInputs::print_flag)
     .def_readwrite("is_sunk", &ProductionInputs::is_sunk)
+    .def_readwrite("summary_only", &ProductionInputs::summary_only)
     .def_readwrite("capacity_kW", &ProductionInputs::capacity_kW)
     .def_readwrite("nominal_inflation_annual", &ProductionInputs::nominal_inflation_annual)
     .def_readwrite("nominal_discount_annual", &ProductionInputs::nominal_discount_annual)
@@ -68,6 +91,7 @@ pybind11::class_<Production>(m, "Production")
     .def_readwrite("print_flag", &Production::print_flag)
     .def_readwrite("is_running", &Production::is_running)
     .def_readwrite("is_sunk", &Production::is_sunk)
+    .def_readwrite("summary_only", &Production::summary_only)
     .def_readwrite(
         "normalized_production_series_given",
         &Production::normalized_production_series_given
@@ -87,6 +111,11 @@ pybind11::class_<Production>(m, "Production")
         "operation_maintenance_cost_kWh",
         &Production::operation_maintenance_cost_kWh
     )
+    .def_readwrite("capital_cost_scalar", &Production::capital_cost_scalar)
+    .def_readwrite(
+        "operation_maintenance_cost_scalar",
+        &Production::operation_maintenance_cost_scalar
+    )
     .def_readwrite("net_present_cost", &Production::net_present_cost)
     .def_readwrite("total_dispatch_kWh", &Production::total_dispatch_kWh)
     .def_readwrite("total_stored_kWh", &Production::total_stored_kWh)
@@ -106,7 +135,7 @@ pybind11::class_<Production>(m, "Production")
     .def_readwrite("dispatch_vec_kW", &Production::dispatch_vec_kW)
     .def_readwrite("storage_vec_kW", &Production::storage_vec_kW)
     .def_readwrite("curtailment_vec_kW", &Production::curtailment_vec_kW)
-    .def_readwrite("capital_cost_vec", &Production::capital_cost_vec)
+    .def_readwrite("capital_cost_event_vec", &Production::capital_cost_event_vec)
     .def_readwrite(
         "operation_maintenance_cost_vec",
         &Production::operation_maintenance_cost_vec
@@ -115,7 +144,18 @@ pybind11::class_<Production>(m, "Production")
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, ProductionInputs, std::vector<double>*>())
     .def("handleReplacement", &Production::handleReplacement)
+    .def("incurCapitalCost", &Production::incurCapitalCost)
+    .def("getCapitalCostSeries", &Production::getCapitalCostSeries)
+    .def("getOperationMaintenanceCost", &Production::getOperationMaintenanceCost)
     .def("computeRealDiscountAnnual", &Production::computeRealDiscountAnnual)
-    .def("computeEconomics", &Production::computeEconomics)
+    .def(
+        "computeEconomics",
+        &Production::computeEconomics,
+        pybind11::arg("time_vec_hrs_ptr"),
+        pybind11::arg("discount_factor_cache_ptr") = nullptr
+    )
+    .def("resetEconomics", &Production::resetEconomics)
     .def("getProductionkW", &Production::getProductionkW)
-    .def("commit", &Production::commit);
+    .def("commit", &Production::commit)
+    .def("getRecordIndex", &Production::getRecordIndex)
+    .def("summarizeTimestep", &Production::summarizeTimestep);
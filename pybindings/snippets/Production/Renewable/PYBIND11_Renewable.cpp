@@ -56,6 +56,13 @@ pybind11::enum_<RenewableType>(m, "RenewableType")
     .value("N_RENEWABLE_TYPES", RenewableType::N_RENEWABLE_TYPES);
 
 
+pybind11::class_<ResourceStruct2D>(m, "ResourceStruct2D")
+    .def_readwrite("n_points", &ResourceStruct2D::n_points)
+    .def_readwrite("channel_vec", &ResourceStruct2D::channel_vec)
+    
+    .def(pybind11::init());
+
+
 pybind11::class_<RenewableInputs>(m, "RenewableInputs")
     .def_readwrite("production_inputs", &RenewableInputs::production_inputs)
     
@@ -70,7 +77,12 @@ pybind11::class_<Renewable>(m, "Renewable")
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, RenewableInputs, std::vector<double>*>())
     .def("handleReplacement", &Renewable::handleReplacement)
-    .def("computeEconomics", &Renewable::computeEconomics)
+    .def(
+        "computeEconomics",
+        &Renewable::computeEconomics,
+        pybind11::arg("time_vec_hrs_ptr"),
+        pybind11::arg("discount_factor_cache_ptr") = nullptr
+    )
     .def(
         "computeProductionkW",
         pybind11::overload_cast<int, double, double>(&Renewable::computeProductionkW)
@@ -79,5 +91,45 @@ pybind11::class_<Renewable>(m, "Renewable")
         "computeProductionkW",
         pybind11::overload_cast<int, double, double, double>(&Renewable::computeProductionkW)
     )
+    .def(
+        "computeProductionkWBatch",
+        [](
+            Renewable& self,
+            std::vector<double> dt_vec_hrs,
+            std::vector<double> resource_vec
+        ) {
+            std::vector<double> production_vec_kW(resource_vec.size(), 0);
+            
+            self.computeProductionkWBatch(
+                resource_vec.size(),
+                dt_vec_hrs.data(),
+                resource_vec.data(),
+                production_vec_kW.data()
+            );
+            
+            return production_vec_kW;
+        }
+    )
+    .def(
+        "computeProductionkWBatch",
+        [](
+            Renewable& self,
+            std::vector<double> dt_vec_hrs,
+            std::vector<double> resource_vec_1,
+            std::vector<double> resource_vec_2
+        ) {
+            std::vector<double> production_vec_kW(resource_vec_1.size(), 0);
+            
+            self.computeProductionkWBatch(
+                resource_vec_1.size(),
+                dt_vec_hrs.data(),
+                resource_vec_1.data(),
+                resource_vec_2.data(),
+                production_vec_kW.data()
+            );
+            
+            return production_vec_kW;
+        }
+    )
     .def("commit", &Renewable::commit)
     .def("writeResults", &Renewable::writeResults);
@@ -57,6 +57,7 @@ pybind11::enum_<StorageType>(m, "StorageType")
 pybind11::class_<StorageInputs>(m, "StorageInputs")
     .def_readwrite("print_flag", &StorageInputs::print_flag)
     .def_readwrite("is_sunk", &StorageInputs::is_sunk)
+    .def_readwrite("summary_only", &StorageInputs::summary_only)
 
     .def_readwrite("power_capacity_kW", &StorageInputs::power_capacity_kW)
     .def_readwrite("energy_capacity_kWh", &StorageInputs::energy_capacity_kWh)
@@ -75,10 +76,12 @@ pybind11::class_<Storage>(m, "Storage")
     .def_readwrite("print_flag", &Storage::print_flag)
     .def_readwrite("is_depleted", &Storage::is_depleted)
     .def_readwrite("is_sunk", &Storage::is_sunk)
+    .def_readwrite("summary_only", &Storage::summary_only)
     .def_readwrite("external_hydrogen_load_included", &Storage::external_hydrogen_load_included)    
     .def_readwrite("making_hydrogen_for_external_load", &Storage::making_hydrogen_for_external_load)  
     
     .def_readwrite("n_points", &Storage::n_points)
+    .def_readwrite("n_record_points", &Storage::n_record_points)
     .def_readwrite("n_replacements", &Storage::n_replacements)
     
     .def_readwrite("n_years", &Storage::n_years)
@@ -97,6 +100,11 @@ pybind11::class_<Storage>(m, "Storage")
         "operation_maintenance_cost_kWh",
         &Storage::operation_maintenance_cost_kWh
     )
+    .def_readwrite("capital_cost_scalar", &Storage::capital_cost_scalar)
+    .def_readwrite(
+        "operation_maintenance_cost_scalar",
+        &Storage::operation_maintenance_cost_scalar
+    )
     .def_readwrite("net_present_cost", &Storage::net_present_cost)
     .def_readwrite("total_discharge_kWh", &Storage::total_discharge_kWh)
     .def_readwrite(
@@ -107,7 +115,7 @@ pybind11::class_<Storage>(m, "Storage")
     .def_readwrite("charge_vec_kWh", &Storage::charge_vec_kWh)
     .def_readwrite("charging_power_vec_kW", &Storage::charging_power_vec_kW)
     .def_readwrite("discharging_power_vec_kW", &Storage::discharging_power_vec_kW)
-    .def_readwrite("capital_cost_vec", &Storage::capital_cost_vec)
+    .def_readwrite("capital_cost_event_vec", &Storage::capital_cost_event_vec)
     .def_readwrite(
         "operation_maintenance_cost_vec",
         &Storage::operation_maintenance_cost_vec
@@ -116,8 +124,19 @@ pybind11::class_<Storage>(m, "Storage")
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, StorageInputs>())
     .def("handleReplacement", &Storage::handleReplacement)
+    .def("incurCapitalCost", &Storage::incurCapitalCost)
+    .def("getCapitalCostSeries", &Storage::getCapitalCostSeries)
+    .def("getOperationMaintenanceCost", &Storage::getOperationMaintenanceCost)
 
-    .def("computeEconomics", &Storage::computeEconomics)
+    .def(
+        "computeEconomics",
+        &Storage::computeEconomics,
+        pybind11::arg("time_vec_hrs_ptr"),
+        pybind11::arg("discount_factor_cache_ptr") = nullptr
+    )
+    .def("resetEconomics", &Storage::resetEconomics)
+    .def("getRecordIndex", &Storage::getRecordIndex)
+    .def("summarizeTimestep", &Storage::summarizeTimestep)
 
     .def("getAvailablekW", &Storage::getAvailablekW)
     .def("getAcceptablekW", &Storage::getAcceptablekW)
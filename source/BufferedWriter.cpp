@@ -0,0 +1,589 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file BufferedWriter.cpp
+///
+///
+/// \brief Implementation file for the BufferedWriter class.
+///
+/// A drop-in replacement for std::ofstream, for writing results, which formats values
+/// with std::to_chars into a large output buffer.
+///
+
+
+#include "../header/BufferedWriter.h"
+
+
+
+// ======== PRIVATE ================================================================= //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn char* BufferedWriter :: __reserve(size_t n_bytes)
+///
+/// \brief Helper method to make room for (at least) the given number of bytes at the
+///     end of the output buffer, flushing the buffer first if necessary.
+///
+/// \param n_bytes The number of bytes to make room for (must not exceed the buffer
+///     size).
+///
+/// \return A pointer to the first free byte of the output buffer.
+///
+
+char* BufferedWriter :: __reserve(size_t n_bytes)
+{
+    if (this->n_buffered_bytes + n_bytes > this->buffer_vec.size()) {
+        this->__flush();
+    }
+    
+    return this->buffer_vec.data() + this->n_buffered_bytes;
+}   /* __reserve() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void BufferedWriter :: __flush(void)
+///
+/// \brief Helper method to write out (and then empty) the output buffer.
+///
+
+void BufferedWriter :: __flush(void)
+{
+    if (this->n_buffered_bytes > 0) {
+        this->ofs.write(this->buffer_vec.data(), this->n_buffered_bytes);
+        this->n_buffered_bytes = 0;
+    }
+    
+    return;
+}   /* __flush() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void BufferedWriter :: __writeBytes(const char* bytes, size_t n_bytes)
+///
+/// \brief Helper method to write the given bytes. Byte strings larger than the output
+///     buffer bypass it.
+///
+/// \param bytes A pointer to the bytes to write.
+///
+/// \param n_bytes The number of bytes to write.
+///
+
+void BufferedWriter :: __writeBytes(const char* bytes, size_t n_bytes)
+{
+    if (n_bytes > this->buffer_vec.size()) {
+        this->__flush();
+        this->ofs.write(bytes, n_bytes);
+    }
+    
+    else {
+        char* first = this->__reserve(n_bytes);
+        memcpy(first, bytes, n_bytes);
+        
+        this->n_buffered_bytes += n_bytes;
+    }
+    
+    this->total_bytes_written += n_bytes;
+    
+    return;
+}   /* __writeBytes() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void BufferedWriter :: __writeSigned(long long value)
+///
+/// \brief Helper method to format and buffer a signed integer.
+///
+/// \param value The value to write.
+///
+
+void BufferedWriter :: __writeSigned(long long value)
+{
+    char* first = this->__reserve(32);
+    char* last = std::to_chars(first, first + 32, value).ptr;
+    
+    this->n_buffered_bytes += last - first;
+    this->total_bytes_written += last - first;
+    
+    return;
+}   /* __writeSigned() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void BufferedWriter :: __writeUnsigned(unsigned long long value)
+///
+/// \brief Helper method to format and buffer an unsigned integer.
+///
+/// \param value The value to write.
+///
+
+void BufferedWriter :: __writeUnsigned(unsigned long long value)
+{
+    char* first = this->__reserve(32);
+    char* last = std::to_chars(first, first + 32, value).ptr;
+    
+    this->n_buffered_bytes += last - first;
+    this->total_bytes_written += last - first;
+    
+    return;
+}   /* __writeUnsigned() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PRIVATE ============================================================= //
+
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter :: BufferedWriter(void)
+///
+/// \brief Constructor for the BufferedWriter class. Uses an output buffer of
+///     BUFFERED_WRITER_BUFFER_BYTES bytes.
+///
+
+BufferedWriter :: BufferedWriter(void)
+{
+    this->buffer_vec.resize(BUFFERED_WRITER_BUFFER_BYTES);
+    this->n_buffered_bytes = 0;
+    this->total_bytes_written = 0;
+    
+    return;
+}   /* BufferedWriter() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter :: BufferedWriter(size_t buffer_bytes)
+///
+/// \brief Constructor for the BufferedWriter class.
+///
+/// \param buffer_bytes The size [bytes] of the output buffer (at least 64 bytes are
+///     always used).
+///
+
+BufferedWriter :: BufferedWriter(size_t buffer_bytes)
+{
+    if (buffer_bytes < 64) {
+        buffer_bytes = 64;
+    }
+    
+    this->buffer_vec.resize(buffer_bytes);
+    this->n_buffered_bytes = 0;
+    this->total_bytes_written = 0;
+    
+    return;
+}   /* BufferedWriter() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void BufferedWriter :: open(std::string path, std::ios_base::openmode mode)
+///
+/// \brief Method to open a file for writing (as std::ofstream::open()). Any file
+///     already open is closed first.
+///
+/// \param path A path (either relative or absolute) to the file to write.
+///
+/// \param mode The mode in which to open the file (defaults to std::ofstream::out).
+///
+
+void BufferedWriter :: open(std::string path, std::ios_base::openmode mode)
+{
+    if (this->ofs.is_open()) {
+        this->close();
+    }
+    
+    this->ofs.open(path, mode);
+    this->total_bytes_written = 0;
+    
+    return;
+}   /* open() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn bool BufferedWriter :: is_open(void)
+///
+/// \brief Method to check whether or not a file is open for writing.
+///
+/// \return Boolean indicating whether or not a file is open for writing.
+///
+
+bool BufferedWriter :: is_open(void)
+{
+    return this->ofs.is_open();
+}   /* is_open() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter& BufferedWriter :: operator << (double value)
+///
+/// \brief Method to write a double, formatted as by printf("%.6g") (which is the
+///     formatting std::ofstream uses under its default flags).
+///
+/// \param value The value to write.
+///
+/// \return A reference to this BufferedWriter.
+///
+
+BufferedWriter& BufferedWriter :: operator << (double value)
+{
+    char* first = this->__reserve(32);
+    char* last = std::to_chars(
+        first,
+        first + 32,
+        value,
+        std::chars_format::general,
+        6
+    ).ptr;
+    
+    this->n_buffered_bytes += last - first;
+    this->total_bytes_written += last - first;
+    
+    return *this;
+}   /* operator << () */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter& BufferedWriter :: operator << (int value)
+///
+/// \brief Method to write an int.
+///
+/// \param value The value to write.
+///
+/// \return A reference to this BufferedWriter.
+///
+
+BufferedWriter& BufferedWriter :: operator << (int value)
+{
+    this->__writeSigned(value);
+    return *this;
+}   /* operator << () */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter& BufferedWriter :: operator << (long value)
+///
+/// \brief Method to write a long.
+///
+/// \param value The value to write.
+///
+/// \return A reference to this BufferedWriter.
+///
+
+BufferedWriter& BufferedWriter :: operator << (long value)
+{
+    this->__writeSigned(value);
+    return *this;
+}   /* operator << () */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter& BufferedWriter :: operator << (long long value)
+///
+/// \brief Method to write a long long.
+///
+/// \param value The value to write.
+///
+/// \return A reference to this BufferedWriter.
+///
+
+BufferedWriter& BufferedWriter :: operator << (long long value)
+{
+    this->__writeSigned(value);
+    return *this;
+}   /* operator << () */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter& BufferedWriter :: operator << (unsigned int value)
+///
+/// \brief Method to write an unsigned int.
+///
+/// \param value The value to write.
+///
+/// \return A reference to this BufferedWriter.
+///
+
+BufferedWriter& BufferedWriter :: operator << (unsigned int value)
+{
+    this->__writeUnsigned(value);
+    return *this;
+}   /* operator << () */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter& BufferedWriter :: operator << (unsigned long value)
+///
+/// \brief Method to write an unsigned long.
+///
+/// \param value The value to write.
+///
+/// \return A reference to this BufferedWriter.
+///
+
+BufferedWriter& BufferedWriter :: operator << (unsigned long value)
+{
+    this->__writeUnsigned(value);
+    return *this;
+}   /* operator << () */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter& BufferedWriter :: operator << (unsigned long long value)
+///
+/// \brief Method to write an unsigned long long.
+///
+/// \param value The value to write.
+///
+/// \return A reference to this BufferedWriter.
+///
+
+BufferedWriter& BufferedWriter :: operator << (unsigned long long value)
+{
+    this->__writeUnsigned(value);
+    return *this;
+}   /* operator << () */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter& BufferedWriter :: operator << (bool value)
+///
+/// \brief Method to write a bool, as 1 or 0 (as std::ofstream does under its default
+///     flags).
+///
+/// \param value The value to write.
+///
+/// \return A reference to this BufferedWriter.
+///
+
+BufferedWriter& BufferedWriter :: operator << (bool value)
+{
+    char c = value ? '1' : '0';
+    this->__writeBytes(&c, 1);
+    
+    return *this;
+}   /* operator << () */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter& BufferedWriter :: operator << (char value)
+///
+/// \brief Method to write a char.
+///
+/// \param value The value to write.
+///
+/// \return A reference to this BufferedWriter.
+///
+
+BufferedWriter& BufferedWriter :: operator << (char value)
+{
+    this->__writeBytes(&value, 1);
+    return *this;
+}   /* operator << () */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter& BufferedWriter :: operator << (const char* value)
+///
+/// \brief Method to write a (null terminated) C string.
+///
+/// \param value The value to write.
+///
+/// \return A reference to this BufferedWriter.
+///
+
+BufferedWriter& BufferedWriter :: operator << (const char* value)
+{
+    this->__writeBytes(value, strlen(value));
+    return *this;
+}   /* operator << () */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter& BufferedWriter :: operator << (const std::string& value)
+///
+/// \brief Method to write a string.
+///
+/// \param value The value to write.
+///
+/// \return A reference to this BufferedWriter.
+///
+
+BufferedWriter& BufferedWriter :: operator << (const std::string& value)
+{
+    this->__writeBytes(value.data(), value.size());
+    return *this;
+}   /* operator << () */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void BufferedWriter :: close(void)
+///
+/// \brief Method to write out any buffered output, and then close the file.
+///
+
+void BufferedWriter :: close(void)
+{
+    if (this->ofs.is_open()) {
+        this->__flush();
+        this->ofs.close();
+    }
+    
+    this->n_buffered_bytes = 0;
+    
+    return;
+}   /* close() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn BufferedWriter :: ~BufferedWriter(void)
+///
+/// \brief Destructor for the BufferedWriter class. Closes the file (if open).
+///
+
+BufferedWriter :: ~BufferedWriter(void)
+{
+    this->close();
+    return;
+}   /* ~BufferedWriter() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PUBLIC ============================================================== //
@@ -0,0 +1,450 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file ColumnarReader.cpp
+///
+///
+/// \brief Implementation file for the ColumnarReader class.
+///
+/// A class which reads columnar results files (as written by ColumnarWriter).
+///
+
+
+#include "../header/ColumnarReader.h"
+
+
+
+// ======== PRIVATE ================================================================= //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ColumnarReader :: __throwReadError(std::string reason)
+///
+/// \brief Helper method to throw a read error.
+///
+/// \param reason The reason for the read error.
+///
+
+void ColumnarReader :: __throwReadError(std::string reason)
+{
+    std::string error_str = "ERROR:  ColumnarReader():  ";
+    error_str += this->path;
+    error_str += ":  ";
+    error_str += reason;
+    
+    #ifdef _WIN32
+        std::cout << error_str << std::endl;
+    #endif
+    
+    throw std::runtime_error(error_str);
+    
+    return;
+}   /* __throwReadError() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn uint32_t ColumnarReader :: __readUint32(std::ifstream* ifs_ptr)
+///
+/// \brief Helper method to read a uint32 (little-endian).
+///
+/// \param ifs_ptr A pointer to the (binary) input file stream.
+///
+/// \return The value read.
+///
+
+uint32_t ColumnarReader :: __readUint32(std::ifstream* ifs_ptr)
+{
+    unsigned char bytes[4];
+    
+    if (not ifs_ptr->read((char*)bytes, 4)) {
+        this->__throwReadError("unexpected end of file");
+    }
+    
+    uint32_t x = 0;
+    
+    for (int i = 0; i < 4; i++) {
+        x |= (uint32_t)bytes[i] << (8 * i);
+    }
+    
+    return x;
+}   /* __readUint32() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn uint64_t ColumnarReader :: __readUint64(std::ifstream* ifs_ptr)
+///
+/// \brief Helper method to read a uint64 (little-endian).
+///
+/// \param ifs_ptr A pointer to the (binary) input file stream.
+///
+/// \return The value read.
+///
+
+uint64_t ColumnarReader :: __readUint64(std::ifstream* ifs_ptr)
+{
+    unsigned char bytes[8];
+    
+    if (not ifs_ptr->read((char*)bytes, 8)) {
+        this->__throwReadError("unexpected end of file");
+    }
+    
+    uint64_t x = 0;
+    
+    for (int i = 0; i < 8; i++) {
+        x |= (uint64_t)bytes[i] << (8 * i);
+    }
+    
+    return x;
+}   /* __readUint64() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double ColumnarReader :: __readFloat64(std::ifstream* ifs_ptr)
+///
+/// \brief Helper method to read a float64 (little-endian).
+///
+/// \param ifs_ptr A pointer to the (binary) input file stream.
+///
+/// \return The value read.
+///
+
+double ColumnarReader :: __readFloat64(std::ifstream* ifs_ptr)
+{
+    uint64_t bits = this->__readUint64(ifs_ptr);
+    
+    double x = 0;
+    memcpy(&x, &bits, 8);
+    
+    return x;
+}   /* __readFloat64() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string ColumnarReader :: __readString(std::ifstream* ifs_ptr)
+///
+/// \brief Helper method to read a string (as a uint32 length followed by its bytes).
+///
+/// \param ifs_ptr A pointer to the (binary) input file stream.
+///
+/// \return The value read.
+///
+
+std::string ColumnarReader :: __readString(std::ifstream* ifs_ptr)
+{
+    uint32_t n_bytes = this->__readUint32(ifs_ptr);
+    std::string x(n_bytes, '\0');
+    
+    if (n_bytes > 0 and not ifs_ptr->read(&(x[0]), n_bytes)) {
+        this->__throwReadError("unexpected end of file");
+    }
+    
+    return x;
+}   /* __readString() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PRIVATE ============================================================= //
+
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn ColumnarReader :: ColumnarReader(void)
+///
+/// \brief Constructor (dummy) for the ColumnarReader class.
+///
+
+ColumnarReader :: ColumnarReader(void)
+{
+    this->bytes_per_value = 0;
+    this->n_rows = 0;
+    
+    return;
+}   /* ColumnarReader() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn ColumnarReader :: ColumnarReader(std::string path)
+///
+/// \brief Constructor (intended) for the ColumnarReader class. Reads the header of the
+///     given columnar results file.
+///
+/// \param path A path (either relative or absolute) to the columnar results file.
+///
+
+ColumnarReader :: ColumnarReader(std::string path)
+{
+    //  1. open file
+    this->path = path;
+    
+    std::ifstream ifs;
+    ifs.open(path, std::ifstream::in | std::ifstream::binary);
+    
+    if (not ifs.is_open()) {
+        this->__throwReadError("could not open file");
+    }
+    
+    //  2. check signature and version
+    char magic[8];
+    
+    if (
+        not ifs.read(magic, 8) or
+        memcmp(magic, COLUMNAR_MAGIC, 8) != 0
+    ) {
+        this->__throwReadError("not a columnar results file");
+    }
+    
+    if (this->__readUint32(&ifs) != COLUMNAR_VERSION) {
+        this->__throwReadError("unsupported columnar results file version");
+    }
+    
+    this->bytes_per_value = this->__readUint32(&ifs);
+    
+    if (this->bytes_per_value != 8 and this->bytes_per_value != 4) {
+        this->__throwReadError("unsupported bytes per value");
+    }
+    
+    //  3. read column descriptors
+    this->n_rows = this->__readUint64(&ifs);
+    uint64_t n_columns = this->__readUint64(&ifs);
+    
+    for (uint64_t i = 0; i < n_columns; i++) {
+        ColumnarColumn column;
+        
+        column.group = this->__readString(&ifs);
+        column.type_str = this->__readString(&ifs);
+        column.asset_index = (int32_t)this->__readUint32(&ifs);
+        column.capacity_kW = this->__readFloat64(&ifs);
+        column.name = this->__readString(&ifs);
+        column.units = this->__readString(&ifs);
+        column.data_offset = this->__readUint64(&ifs);
+        
+        this->column_vec.push_back(column);
+    }
+    
+    ifs.close();
+    return;
+}   /* ColumnarReader() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn int ColumnarReader :: getColumnIndex(
+///         std::string group,
+///         int asset_index,
+///         std::string name
+///     )
+///
+/// \brief Method to look up a column by group, asset index, and name.
+///
+/// \param group The group to which the column belongs (e.g., "Combustion").
+///
+/// \param asset_index The index of the asset in the Model (-1 for Model columns).
+///
+/// \param name The name of the column.
+///
+/// \return The index of the column.
+///
+
+int ColumnarReader :: getColumnIndex(
+    std::string group,
+    int asset_index,
+    std::string name
+)
+{
+    for (size_t i = 0; i < this->column_vec.size(); i++) {
+        if (
+            this->column_vec[i].group == group and
+            this->column_vec[i].asset_index == asset_index and
+            this->column_vec[i].name == name
+        ) {
+            return i;
+        }
+    }
+    
+    std::string error_str = "ERROR:  ColumnarReader::getColumnIndex():  ";
+    error_str += "no column ";
+    error_str += name;
+    error_str += " for ";
+    error_str += group;
+    error_str += " asset ";
+    error_str += std::to_string(asset_index);
+    
+    #ifdef _WIN32
+        std::cout << error_str << std::endl;
+    #endif
+    
+    throw std::invalid_argument(error_str);
+    
+    return -1;
+}   /* getColumnIndex() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::vector<double> ColumnarReader :: readColumn(int column_index)
+///
+/// \brief Method to read a single column (and only that column).
+///
+/// \param column_index The index of the column to read.
+///
+/// \return A vector of the column values.
+///
+
+std::vector<double> ColumnarReader :: readColumn(int column_index)
+{
+    //  1. check index
+    if (column_index < 0 or column_index >= (int)this->column_vec.size()) {
+        std::string error_str = "ERROR:  ColumnarReader::readColumn():  ";
+        error_str += "column index out of bounds";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+        
+        throw std::out_of_range(error_str);
+    }
+    
+    //  2. seek to column
+    std::ifstream ifs;
+    ifs.open(this->path, std::ifstream::in | std::ifstream::binary);
+    
+    if (not ifs.is_open()) {
+        this->__throwReadError("could not open file");
+    }
+    
+    ifs.seekg(this->column_vec[column_index].data_offset);
+    
+    //  3. read column (in one go), then decode
+    size_t n_bytes = (size_t)this->n_rows * this->bytes_per_value;
+    std::vector<unsigned char> bytes_vec(n_bytes, 0);
+    
+    if (not ifs.read((char*)bytes_vec.data(), n_bytes)) {
+        this->__throwReadError("unexpected end of file");
+    }
+    
+    std::vector<double> column_vec(this->n_rows, 0);
+    
+    for (int i = 0; i < this->n_rows; i++) {
+        const unsigned char* bytes = bytes_vec.data() + (size_t)i * this->bytes_per_value;
+        
+        if (this->bytes_per_value == 4) {
+            uint32_t bits = 0;
+            
+            for (int j = 0; j < 4; j++) {
+                bits |= (uint32_t)bytes[j] << (8 * j);
+            }
+            
+            float x = 0;
+            memcpy(&x, &bits, 4);
+            
+            column_vec[i] = x;
+        }
+        
+        else {
+            uint64_t bits = 0;
+            
+            for (int j = 0; j < 8; j++) {
+                bits |= (uint64_t)bytes[j] << (8 * j);
+            }
+            
+            memcpy(&(column_vec[i]), &bits, 8);
+        }
+    }
+    
+    ifs.close();
+    return column_vec;
+}   /* readColumn() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn ColumnarReader :: ~ColumnarReader(void)
+///
+/// \brief Destructor for the ColumnarReader class.
+///
+
+ColumnarReader :: ~ColumnarReader(void)
+{
+    return;
+}   /* ~ColumnarReader() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PUBLIC ============================================================== //
@@ -0,0 +1,627 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file ColumnarWriter.cpp
+///
+///
+/// \brief Implementation file for the ColumnarWriter class.
+///
+/// A class which writes a set of result columns as a single binary columnar file.
+///
+
+
+#include "../header/ColumnarWriter.h"
+
+
+
+// ======== PRIVATE ================================================================= //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn bool ColumnarWriter :: __hostIsLittleEndian(void)
+///
+/// \brief Helper method to check whether or not the host is little-endian.
+///
+/// \return Boolean indicating whether or not the host is little-endian.
+///
+
+bool ColumnarWriter :: __hostIsLittleEndian(void)
+{
+    uint16_t x = 1;
+    char first_byte = 0;
+    
+    memcpy(&first_byte, &x, 1);
+    
+    return first_byte == 1;
+}   /* __hostIsLittleEndian() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ColumnarWriter :: __appendUint32(std::vector<char>* bytes_ptr, uint32_t x)
+///
+/// \brief Helper method to append a uint32 (little-endian) to the given bytes.
+///
+/// \param bytes_ptr A pointer to the bytes to append to.
+///
+/// \param x The value to append.
+///
+
+void ColumnarWriter :: __appendUint32(std::vector<char>* bytes_ptr, uint32_t x)
+{
+    for (int i = 0; i < 4; i++) {
+        bytes_ptr->push_back((char)((x >> (8 * i)) & 0xFF));
+    }
+    
+    return;
+}   /* __appendUint32() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ColumnarWriter :: __appendUint64(std::vector<char>* bytes_ptr, uint64_t x)
+///
+/// \brief Helper method to append a uint64 (little-endian) to the given bytes.
+///
+/// \param bytes_ptr A pointer to the bytes to append to.
+///
+/// \param x The value to append.
+///
+
+void ColumnarWriter :: __appendUint64(std::vector<char>* bytes_ptr, uint64_t x)
+{
+    for (int i = 0; i < 8; i++) {
+        bytes_ptr->push_back((char)((x >> (8 * i)) & 0xFF));
+    }
+    
+    return;
+}   /* __appendUint64() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ColumnarWriter :: __appendFloat64(std::vector<char>* bytes_ptr, double x)
+///
+/// \brief Helper method to append a float64 (little-endian) to the given bytes.
+///
+/// \param bytes_ptr A pointer to the bytes to append to.
+///
+/// \param x The value to append.
+///
+
+void ColumnarWriter :: __appendFloat64(std::vector<char>* bytes_ptr, double x)
+{
+    uint64_t bits = 0;
+    memcpy(&bits, &x, 8);
+    
+    this->__appendUint64(bytes_ptr, bits);
+    
+    return;
+}   /* __appendFloat64() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ColumnarWriter :: __appendString(std::vector<char>* bytes_ptr, std::string x)
+///
+/// \brief Helper method to append a string (as a uint32 length followed by its bytes)
+///     to the given bytes.
+///
+/// \param bytes_ptr A pointer to the bytes to append to.
+///
+/// \param x The value to append.
+///
+
+void ColumnarWriter :: __appendString(std::vector<char>* bytes_ptr, std::string x)
+{
+    this->__appendUint32(bytes_ptr, x.size());
+    bytes_ptr->insert(bytes_ptr->end(), x.begin(), x.end());
+    
+    return;
+}   /* __appendString() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ColumnarWriter :: __writeColumn(
+///         std::ofstream* ofs_ptr,
+///         ColumnarColumn* column_ptr,
+///         int n_rows,
+///         ColumnarFormat columnar_format
+///     )
+///
+/// \brief Helper method to write the first n_rows values of a column, as a contiguous
+///     little-endian array.
+///
+/// \param ofs_ptr A pointer to the (binary) output file stream.
+///
+/// \param column_ptr A pointer to the column to write.
+///
+/// \param n_rows The number of rows to write.
+///
+/// \param columnar_format The format in which to write the column.
+///
+
+void ColumnarWriter :: __writeColumn(
+    std::ofstream* ofs_ptr,
+    ColumnarColumn* column_ptr,
+    int n_rows,
+    ColumnarFormat columnar_format
+)
+{
+    //  1. get column data
+    const double* data = column_ptr->data_vec.data();
+    
+    if (column_ptr->data_ptr != NULL) {
+        data = column_ptr->data_ptr->data();
+    }
+    
+    //  2. float64 on a little-endian host, write as is
+    if (
+        columnar_format == ColumnarFormat :: COLUMNAR_FLOAT64 and
+        this->__hostIsLittleEndian()
+    ) {
+        ofs_ptr->write((const char*)data, n_rows * sizeof(double));
+        return;
+    }
+    
+    //  3. otherwise, convert in chunks
+    std::vector<char> bytes_vec;
+    bytes_vec.reserve(8 * 4096);
+    
+    for (int i = 0; i < n_rows; i++) {
+        if (columnar_format == ColumnarFormat :: COLUMNAR_FLOAT32) {
+            float x = data[i];
+            uint32_t bits = 0;
+            memcpy(&bits, &x, 4);
+            
+            this->__appendUint32(&bytes_vec, bits);
+        }
+        
+        else {
+            this->__appendFloat64(&bytes_vec, data[i]);
+        }
+        
+        if (bytes_vec.size() >= 8 * 4096) {
+            ofs_ptr->write(bytes_vec.data(), bytes_vec.size());
+            bytes_vec.clear();
+        }
+    }
+    
+    ofs_ptr->write(bytes_vec.data(), bytes_vec.size());
+    
+    return;
+}   /* __writeColumn() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PRIVATE ============================================================= //
+
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn ColumnarWriter :: ColumnarWriter(void)
+///
+/// \brief Constructor for the ColumnarWriter class.
+///
+
+ColumnarWriter :: ColumnarWriter(void)
+{
+    this->setAsset("Model", "", -1, 0);
+    
+    return;
+}   /* ColumnarWriter() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ColumnarWriter :: setAsset(
+///         std::string group,
+///         std::string type_str,
+///         int asset_index,
+///         double capacity_kW
+///     )
+///
+/// \brief Method to set the asset metadata attached to subsequently added columns.
+///
+/// \param group The group to which the asset belongs (e.g., "Combustion").
+///
+/// \param type_str The type of the asset (e.g., "DIESEL").
+///
+/// \param asset_index The index of the asset in the Model.
+///
+/// \param capacity_kW The (power) capacity [kW] of the asset.
+///
+
+void ColumnarWriter :: setAsset(
+    std::string group,
+    std::string type_str,
+    int asset_index,
+    double capacity_kW
+)
+{
+    this->group = group;
+    this->type_str = type_str;
+    this->asset_index = asset_index;
+    this->capacity_kW = capacity_kW;
+    
+    return;
+}   /* setAsset() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ColumnarWriter :: addColumn(
+///         std::string name,
+///         std::string units,
+///         std::vector<double>* data_ptr
+///     )
+///
+/// \brief Method to add a column (by reference, so the data must outlive write()).
+///
+/// \param name The name of the column.
+///
+/// \param units The units of the column (empty if not applicable).
+///
+/// \param data_ptr A pointer to the column data.
+///
+
+void ColumnarWriter :: addColumn(
+    std::string name,
+    std::string units,
+    std::vector<double>* data_ptr
+)
+{
+    ColumnarColumn column;
+    
+    column.group = this->group;
+    column.type_str = this->type_str;
+    column.asset_index = this->asset_index;
+    column.capacity_kW = this->capacity_kW;
+    
+    column.name = name;
+    column.units = units;
+    column.data_ptr = data_ptr;
+    
+    this->column_vec.push_back(column);
+    
+    return;
+}   /* addColumn() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ColumnarWriter :: addColumn(
+///         std::string name,
+///         std::string units,
+///         std::vector<bool>* data_ptr
+///     )
+///
+/// \brief Method to add a boolean column (by value, as 0/1).
+///
+/// \param name The name of the column.
+///
+/// \param units The units of the column (empty if not applicable).
+///
+/// \param data_ptr A pointer to the column data.
+///
+
+void ColumnarWriter :: addColumn(
+    std::string name,
+    std::string units,
+    std::vector<bool>* data_ptr
+)
+{
+    this->addColumn(name, units, (std::vector<double>*)NULL);
+    
+    ColumnarColumn* column_ptr = &(this->column_vec.back());
+    column_ptr->data_vec.resize(data_ptr->size(), 0);
+    
+    for (size_t i = 0; i < data_ptr->size(); i++) {
+        if ((*data_ptr)[i]) {
+            column_ptr->data_vec[i] = 1;
+        }
+    }
+    
+    return;
+}   /* addColumn() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ColumnarWriter :: addColumn(
+///         std::string name,
+///         std::string units,
+///         std::vector<double> data_vec
+///     )
+///
+/// \brief Method to add a column by value, for series which are derived on demand
+///     (e.g., capital costs, expanded from an event log). The writer then holds the
+///     column data, so it need not outlive write().
+///
+/// \param name The name of the column.
+///
+/// \param units The units of the column (empty if not applicable).
+///
+/// \param data_vec The column data.
+///
+
+void ColumnarWriter :: addColumn(
+    std::string name,
+    std::string units,
+    std::vector<double> data_vec
+)
+{
+    this->addColumn(name, units, (std::vector<double>*)NULL);
+    this->column_vec.back().data_vec = std::move(data_vec);
+    
+    return;
+}   /* addColumn() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ColumnarWriter :: write(
+///         std::string path,
+///         int n_rows,
+///         ColumnarFormat columnar_format
+///     )
+///
+/// \brief Method to write the first n_rows rows of every column to a single binary
+///     columnar file.
+///
+/// \param path A path (either relative or absolute) to the file to write. If already
+///     exists, will overwrite.
+///
+/// \param n_rows The number of rows to write (must not exceed the length of any
+///     column).
+///
+/// \param columnar_format The format in which to write the columns (defaults to
+///     COLUMNAR_FLOAT64).
+///
+
+void ColumnarWriter :: write(
+    std::string path,
+    int n_rows,
+    ColumnarFormat columnar_format
+)
+{
+    //  1. check inputs
+    if (
+        columnar_format != ColumnarFormat :: COLUMNAR_FLOAT64 and
+        columnar_format != ColumnarFormat :: COLUMNAR_FLOAT32
+    ) {
+        std::string error_str = "ERROR:  ColumnarWriter::write():  ";
+        error_str += "columnar_format must be COLUMNAR_FLOAT64 or COLUMNAR_FLOAT32";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+        
+        throw std::invalid_argument(error_str);
+    }
+    
+    if (n_rows < 0) {
+        n_rows = 0;
+    }
+    
+    for (size_t i = 0; i < this->column_vec.size(); i++) {
+        size_t n_points = this->column_vec[i].data_vec.size();
+        
+        if (this->column_vec[i].data_ptr != NULL) {
+            n_points = this->column_vec[i].data_ptr->size();
+        }
+        
+        if (n_points < (size_t)n_rows) {
+            std::string error_str = "ERROR:  ColumnarWriter::write():  ";
+            error_str += "column ";
+            error_str += this->column_vec[i].name;
+            error_str += " has fewer than n_rows values";
+            
+            #ifdef _WIN32
+                std::cout << error_str << std::endl;
+            #endif
+            
+            throw std::invalid_argument(error_str);
+        }
+    }
+    
+    //  2. build header (column offsets are filled in on a second pass, once the size
+    //     of the header is known)
+    uint32_t bytes_per_value = 8;
+    
+    if (columnar_format == ColumnarFormat :: COLUMNAR_FLOAT32) {
+        bytes_per_value = 4;
+    }
+    
+    uint64_t column_bytes = (uint64_t)n_rows * bytes_per_value;
+    uint64_t aligned_column_bytes = COLUMNAR_ALIGNMENT_BYTES *
+        ((column_bytes + COLUMNAR_ALIGNMENT_BYTES - 1) / COLUMNAR_ALIGNMENT_BYTES);
+    
+    std::vector<char> header_vec;
+    
+    for (int pass = 0; pass < 2; pass++) {
+        uint64_t data_offset = COLUMNAR_ALIGNMENT_BYTES *
+            ((header_vec.size() + COLUMNAR_ALIGNMENT_BYTES - 1) /
+                COLUMNAR_ALIGNMENT_BYTES);
+        
+        header_vec.clear();
+        header_vec.insert(
+            header_vec.end(),
+            COLUMNAR_MAGIC,
+            COLUMNAR_MAGIC + 8
+        );
+        
+        this->__appendUint32(&header_vec, COLUMNAR_VERSION);
+        this->__appendUint32(&header_vec, bytes_per_value);
+        this->__appendUint64(&header_vec, n_rows);
+        this->__appendUint64(&header_vec, this->column_vec.size());
+        
+        for (size_t i = 0; i < this->column_vec.size(); i++) {
+            ColumnarColumn* column_ptr = &(this->column_vec[i]);
+            column_ptr->data_offset = data_offset + i * aligned_column_bytes;
+            
+            this->__appendString(&header_vec, column_ptr->group);
+            this->__appendString(&header_vec, column_ptr->type_str);
+            this->__appendUint32(&header_vec, (uint32_t)column_ptr->asset_index);
+            this->__appendFloat64(&header_vec, column_ptr->capacity_kW);
+            this->__appendString(&header_vec, column_ptr->name);
+            this->__appendString(&header_vec, column_ptr->units);
+            this->__appendUint64(&header_vec, column_ptr->data_offset);
+        }
+    }
+    
+    //  3. write header, then columns (each padded out to alignment)
+    std::ofstream ofs;
+    ofs.open(path, std::ofstream::out | std::ofstream::binary);
+    
+    if (not ofs.is_open()) {
+        std::string error_str = "ERROR:  ColumnarWriter::write():  ";
+        error_str += "could not open ";
+        error_str += path;
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+        
+        throw std::runtime_error(error_str);
+    }
+    
+    std::vector<char> padding_vec(COLUMNAR_ALIGNMENT_BYTES, 0);
+    uint64_t n_bytes_written = header_vec.size();
+    
+    ofs.write(header_vec.data(), header_vec.size());
+    
+    for (size_t i = 0; i < this->column_vec.size(); i++) {
+        ColumnarColumn* column_ptr = &(this->column_vec[i]);
+        
+        ofs.write(padding_vec.data(), column_ptr->data_offset - n_bytes_written);
+        this->__writeColumn(&ofs, column_ptr, n_rows, columnar_format);
+        
+        n_bytes_written = column_ptr->data_offset + column_bytes;
+    }
+    
+    ofs.close();
+    return;
+}   /* write() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ColumnarWriter :: clear(void)
+///
+/// \brief Method to clear all columns.
+///
+
+void ColumnarWriter :: clear(void)
+{
+    this->column_vec.clear();
+    this->setAsset("Model", "", -1, 0);
+    
+    return;
+}   /* clear() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn ColumnarWriter :: ~ColumnarWriter(void)
+///
+/// \brief Destructor for the ColumnarWriter class.
+///
+
+ColumnarWriter :: ~ColumnarWriter(void)
+{
+    return;
+}   /* ~ColumnarWriter() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PUBLIC ============================================================== //
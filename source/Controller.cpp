@@ -51,60 +51,284 @@
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Controller :: __computeRenewableProduction(
+/// \fn ResourceSpan Controller :: __getBoundResourceSpan(
+///         ElectricalLoad* electrical_load_ptr,
+///         Resources* resources_ptr,
+///         int resource_key,
+///         int channel,
+///         std::string asset_str
+///     )
+///
+/// \brief Helper method to resolve and validate a single resource time series binding.
+///     This is the one place where resource keys are checked; a key which is not in
+///     Resources, or a resource time series which is shorter than the modelling time
+///     series, is an error.
+///
+/// \param electrical_load_ptr A pointer to the ElectricalLoad component of the Model.
+///
+/// \param resources_ptr A pointer to the Resources component of the Model.
+///
+/// \param resource_key The key associated with the given renewable resource.
+///
+/// \param channel The channel of the given 2D renewable resource, or -1 for a 1D
+///     renewable resource.
+///
+/// \param asset_str A string describing the asset being bound (for error reporting).
+///
+/// \return A ResourceSpan over the given resource time series.
+///
+
+ResourceSpan Controller :: __getBoundResourceSpan(
+    ElectricalLoad* electrical_load_ptr,
+    Resources* resources_ptr,
+    int resource_key,
+    int channel,
+    std::string asset_str
+)
+{
+    //  1. check that resource key is recognized
+    bool is_1D = channel < 0;
+    
+    if (
+        (is_1D and resources_ptr->resource_map_1D.count(resource_key) == 0) or
+        ((not is_1D) and resources_ptr->resource_map_2D.count(resource_key) == 0)
+    ) {
+        std::string error_str = "ERROR:  Controller::init():  ";
+        error_str += asset_str;
+        error_str += ":  resource key ";
+        error_str += is_1D ? "(1D) " : "(2D) ";
+        error_str += std::to_string(resource_key);
+        error_str += " is not recognized";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  2. get span, check length
+    ResourceSpan resource_span = is_1D ?
+        resources_ptr->getResourceSpan1D(resource_key) :
+        resources_ptr->getResourceSpan2D(resource_key, channel);
+    
+    if (resource_span.size() < (size_t)electrical_load_ptr->n_points) {
+        std::string error_str = "ERROR:  Controller::init():  ";
+        error_str += asset_str;
+        error_str += ":  resource time series (key ";
+        error_str += std::to_string(resource_key);
+        error_str += ") has ";
+        error_str += std::to_string(resource_span.size());
+        error_str += " points, but the modelling time series has ";
+        error_str += std::to_string(electrical_load_ptr->n_points);
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    return resource_span;
+}   /* __getBoundResourceSpan() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Controller :: __bindResources(
 ///         ElectricalLoad* electrical_load_ptr,
 ///         std::vector<Renewable*>* renewable_ptr_vec_ptr,
+///         std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr,
 ///         Resources* resources_ptr
 ///     )
 ///
-/// \brief Helper method to compute and record Renewable production, net load.
-///
-/// The net load at a given point in time is defined as the load at that point in time,
-/// minus the sum of all Renewable production at that point in time. Therefore, a
-/// negative net load indicates a surplus of Renewable production, and a positive
-/// net load indicates a deficit of Renewable production.
+/// \brief Helper method to bind every Renewable and Noncombustion asset to its
+///     (validated) resource time series, so that dispatch does no map lookups. Assets
+///     which are given a normalized production series are left unbound.
 ///
 /// \param electrical_load_ptr A pointer to the ElectricalLoad component of the Model.
 ///
 /// \param renewable_ptr_vec_ptr A pointer to the Renewable pointer vector of the Model.
 ///
+/// \param noncombustion_ptr_vec_ptr A pointer to the Noncombustion pointer vector of
+///     the Model (NULL if none).
+///
 /// \param resources_ptr A pointer to the Resources component of the Model.
 ///
 
-void Controller :: __computeRenewableProduction(
+void Controller :: __bindResources(
     ElectricalLoad* electrical_load_ptr,
     std::vector<Renewable*>* renewable_ptr_vec_ptr,
+    std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr,
     Resources* resources_ptr
 )
 {
-    double dt_hrs = 0;
-    double load_kW = 0;
-    double net_load_kW = 0;
-    double production_kW = 0;
+    std::string asset_str;
+    
+    //  1. bind Renewable assets
+    this->renewable_resource_binding_vec.clear();
+    this->renewable_resource_binding_vec.resize(renewable_ptr_vec_ptr->size());
     
     Renewable* renewable_ptr;
     
-    for (int timestep = 0; timestep < electrical_load_ptr->n_points; timestep++) {
-        dt_hrs = electrical_load_ptr->dt_vec_hrs[timestep];
-        load_kW = electrical_load_ptr->load_vec_kW[timestep];
-        net_load_kW = load_kW;
+    for (size_t asset = 0; asset < renewable_ptr_vec_ptr->size(); asset++) {
+        renewable_ptr = renewable_ptr_vec_ptr->at(asset);
         
-        for (size_t asset = 0; asset < renewable_ptr_vec_ptr->size(); asset++) {
-            renewable_ptr = renewable_ptr_vec_ptr->at(asset);
-            
-            production_kW = this->__getRenewableProduction(
-                timestep,
-                dt_hrs,
-                renewable_ptr,
-                resources_ptr
-            );
+        if (renewable_ptr->normalized_production_series_given) {
+            continue;
+        }
+        
+        asset_str = "Renewable asset " + std::to_string(asset);
+        asset_str += " (" + renewable_ptr->type_str + ")";
+        
+        ResourceBinding& resource_binding = this->renewable_resource_binding_vec[asset];
+        
+        switch (renewable_ptr->type) {
+            case (RenewableType :: WAVE): {
+                resource_binding.resource_span = this->__getBoundResourceSpan(
+                    electrical_load_ptr,
+                    resources_ptr,
+                    renewable_ptr->resource_key,
+                    0,
+                    asset_str
+                );
+                
+                resource_binding.resource_span_2D = this->__getBoundResourceSpan(
+                    electrical_load_ptr,
+                    resources_ptr,
+                    renewable_ptr->resource_key,
+                    1,
+                    asset_str
+                );
+                
+                break;
+            }
             
-            renewable_ptr->production_vec_kW[timestep] = production_kW;
+            default: {
+                resource_binding.resource_span = this->__getBoundResourceSpan(
+                    electrical_load_ptr,
+                    resources_ptr,
+                    renewable_ptr->resource_key,
+                    -1,
+                    asset_str
+                );
+                
+                break;
+            }
+        }
+    }
+    
+    //  2. bind Noncombustion assets
+    this->noncombustion_resource_binding_vec.clear();
+    
+    if (noncombustion_ptr_vec_ptr == NULL) {
+        return;
+    }
+    
+    this->noncombustion_resource_binding_vec.resize(noncombustion_ptr_vec_ptr->size());
+    
+    Noncombustion* noncombustion_ptr;
+    
+    for (size_t asset = 0; asset < noncombustion_ptr_vec_ptr->size(); asset++) {
+        noncombustion_ptr = noncombustion_ptr_vec_ptr->at(asset);
         
-            net_load_kW -= production_kW;
+        if (
+            noncombustion_ptr->type != NoncombustionType :: HYDRO or
+            noncombustion_ptr->normalized_production_series_given
+        ) {
+            continue;
         }
         
-        this->net_load_vec_kW[timestep] = net_load_kW;
+        asset_str = "Noncombustion asset " + std::to_string(asset);
+        asset_str += " (" + noncombustion_ptr->type_str + ")";
+        
+        this->noncombustion_resource_binding_vec[asset].resource_span =
+            this->__getBoundResourceSpan(
+                electrical_load_ptr,
+                resources_ptr,
+                noncombustion_ptr->resource_key,
+                -1,
+                asset_str
+            );
+    }
+    
+    return;
+}   /* __bindResources() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Controller :: __computeRenewableProduction(
+///         ElectricalLoad* electrical_load_ptr,
+///         std::vector<Renewable*>* renewable_ptr_vec_ptr
+///     )
+///
+/// \brief Helper method to compute and record Renewable production, net load.
+///
+/// The net load at a given point in time is defined as the load at that point in time,
+/// minus the sum of all Renewable production at that point in time. Therefore, a
+/// negative net load indicates a surplus of Renewable production, and a positive
+/// net load indicates a deficit of Renewable production.
+///
+/// Production is computed asset-major: each asset computes its whole production series
+/// in one call (see Renewable::computeProductionkWBatch()), with the assets spread over
+/// a TaskRunner of (up to) n_threads workers. Each asset reads its resource channels
+/// from its own binding, so no asset types are distinguished here. Assets are not
+/// chunked in time, since some (e.g. lookup models) carry per-asset interpolation
+/// search state. If any asset fails, the
+/// error of the first such asset (in order) is raised, regardless of thread count.
+///
+/// \param electrical_load_ptr A pointer to the ElectricalLoad component of the Model.
+///
+/// \param renewable_ptr_vec_ptr A pointer to the Renewable pointer vector of the Model.
+///
+
+void Controller :: __computeRenewableProduction(
+    ElectricalLoad* electrical_load_ptr,
+    std::vector<Renewable*>* renewable_ptr_vec_ptr
+)
+{
+    int n_points = electrical_load_ptr->n_points;
+    
+    //  1. compute production of each asset over the whole series (asset-major, one
+    //     asset per task; assets are independent, and each writes only its own
+    //     production vector)
+    auto production_task = [&](size_t asset) {
+        Renewable* renewable_ptr = renewable_ptr_vec_ptr->at(asset);
+        
+        renewable_ptr->computeProductionkWBatch(
+            n_points,
+            electrical_load_ptr->dt_vec_hrs.data(),
+            &(this->renewable_resource_binding_vec[asset]),
+            renewable_ptr->production_vec_kW.data()
+        );
+        
+        return;
+    };
+    
+    TaskRunner task_runner(this->n_threads);
+    task_runner.run(renewable_ptr_vec_ptr->size(), production_task);
+    
+    //  2. compute net load (assets deducted in order, as in dispatch)
+    for (int timestep = 0; timestep < n_points; timestep++) {
+        this->net_load_vec_kW[timestep] = electrical_load_ptr->load_vec_kW[timestep];
+    }
+    
+    for (size_t asset = 0; asset < renewable_ptr_vec_ptr->size(); asset++) {
+        const double* production_ptr_kW =
+            renewable_ptr_vec_ptr->at(asset)->production_vec_kW.data();
+        
+        for (int timestep = 0; timestep < n_points; timestep++) {
+            this->net_load_vec_kW[timestep] -= production_ptr_kW[timestep];
+        }
     }
     
     return;
@@ -113,6 +337,61 @@ void Controller :: __computeRenewableProduction(
 // ---------------------------------------------------------------------------------- //
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Controller :: __getCombustionMapResolution(
+///         std::vector<Combustion*>* combustion_ptr_vec_ptr
+///     )
+///
+/// \brief Helper method to determine the capacity resolution [kW] of the Combustion
+///     map. If the number of distinct total capacities that the Combustion assets can
+///     form is at most COMBUSTION_MAP_MAX_STATES, then the map is built exactly (and a
+///     resolution of zero is returned). Otherwise, total capacities are binned such
+///     that the map holds at most COMBUSTION_MAP_MAX_STATES + 1 states.
+///
+/// \param combustion_ptr_vec_ptr A pointer to the Combustion pointer vector of the Model.
+///
+/// \return The capacity resolution [kW] of the Combustion map (0 if exact).
+///
+
+double Controller :: __getCombustionMapResolution(
+    std::vector<Combustion*>* combustion_ptr_vec_ptr
+)
+{
+    //  1. count assets of each distinct capacity, get total capacity
+    double total_capacity_kW = 0;
+    std::map<double, unsigned int> capacity_count_map;
+    
+    for (size_t i = 0; i < combustion_ptr_vec_ptr->size(); i++) {
+        capacity_count_map[combustion_ptr_vec_ptr->at(i)->capacity_kW]++;
+        total_capacity_kW += combustion_ptr_vec_ptr->at(i)->capacity_kW;
+    }
+    
+    //  2. bound the number of distinct total capacities (product of (count + 1) over
+    //     distinct capacities), return early if within limit
+    double n_states_bound = 1;
+    std::map<double, unsigned int>::iterator iter;
+    
+    for (
+        iter = capacity_count_map.begin();
+        iter != capacity_count_map.end();
+        iter++
+    ) {
+        n_states_bound *= iter->second + 1;
+        
+        if (n_states_bound > COMBUSTION_MAP_MAX_STATES) {
+            return total_capacity_kW / COMBUSTION_MAP_MAX_STATES;
+        }
+    }
+    
+    return 0;
+}   /* __getCombustionMapResolution() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -123,6 +402,15 @@ void Controller :: __computeRenewableProduction(
 /// \brief Helper method to construct a Combustion map, for use in determining
 //      the optimal dispatch of Combustion assets in each time step of the Model run.
 ///
+/// The map associates each attainable total capacity with the operating state (on/off)
+/// that attains it using the fewest assets (ties going to the lowest-index assets). It
+/// is built by a subset-sum style sweep over the Combustion assets: the states using
+/// assets 0, ..., i - 1 are merged with a copy of themselves that also runs asset i,
+/// keeping only the best state for each total capacity. For fleets with few distinct
+/// capacities, this is polynomial in the number of assets. For fleets with many
+/// distinct capacities, total capacities are binned at combustion_map_resolution_kW so
+/// that the map never grows beyond COMBUSTION_MAP_MAX_STATES + 1 states.
+///
 /// \param combustion_ptr_vec_ptr A pointer to the Combustion pointer vector of the Model.
 ///
 
@@ -130,99 +418,185 @@ void Controller :: __constructCombustionMap(
     std::vector<Combustion*>* combustion_ptr_vec_ptr
 )
 {
-    std::string print_str = "Controller :: __constructCombustionMap()  ";
-    print_str += "constructing combustion map (dispatch)  ";
-    
-    //  1. get state table dimensions
+    //  1. get state table dimensions, resolution
     unsigned int n_cols = combustion_ptr_vec_ptr->size();
-    unsigned long int n_rows = pow(2, n_cols);
     
-    //  2. walk through all possible operating states (on/off) and populate combustion
-    //     map, keeping only states with minimum number of assets running.
-    for (unsigned long int row = 0; row < n_rows; row++) {
-        std::vector<bool> state_vec(n_cols, false);
+    this->combustion_map_resolution_kW =
+        this->__getCombustionMapResolution(combustion_ptr_vec_ptr);
+    
+    //  2. init sweep with the all-off state
+    std::vector<double> capacity_vec_kW(1, 0);
+    std::vector<unsigned int> asset_count_vec(1, 0);
+    std::vector<std::vector<bool>> state_vec_vec(1, std::vector<bool>(n_cols, false));
+    
+    //  3. sweep over assets, merging the states without asset i (sorted by capacity)
+    //     with the states running asset i (also sorted by capacity)
+    for (unsigned int i = 0; i < n_cols; i++) {
+        double asset_capacity_kW = combustion_ptr_vec_ptr->at(i)->capacity_kW;
+        size_t n_rows = capacity_vec_kW.size();
         
-        unsigned int asset_count = 0;
-        unsigned long int x = row;
-        double total_capacity_kW = 0;
+        std::vector<double> merged_capacity_vec_kW;
+        std::vector<unsigned int> merged_asset_count_vec;
+        std::vector<std::vector<bool>> merged_state_vec_vec;
         
-        for (unsigned int i = 0; i < n_cols; i++) {
-            if (x <= 0) {
-                break;
+        merged_capacity_vec_kW.reserve(2 * n_rows);
+        merged_asset_count_vec.reserve(2 * n_rows);
+        merged_state_vec_vec.reserve(2 * n_rows);
+        
+        size_t row_off = 0;
+        size_t row_on = 0;
+        
+        while (row_off < n_rows or row_on < n_rows) {
+            //  3.1. get next candidate (in order of capacity, off first on ties)
+            bool is_on = (
+                row_off >= n_rows or
+                (
+                    row_on < n_rows and
+                    capacity_vec_kW[row_on] + asset_capacity_kW <
+                        capacity_vec_kW[row_off]
+                )
+            );
+            
+            double total_capacity_kW = 0;
+            unsigned int asset_count = 0;
+            size_t row = 0;
+            
+            if (is_on) {
+                row = row_on;
+                total_capacity_kW = capacity_vec_kW[row] + asset_capacity_kW;
+                asset_count = asset_count_vec[row] + 1;
+                row_on++;
             }
             
-            if (x % 2 != 0) {
-                state_vec[i] = true;
-                total_capacity_kW += combustion_ptr_vec_ptr->at(i)->capacity_kW;
-                asset_count++;
+            else {
+                row = row_off;
+                total_capacity_kW = capacity_vec_kW[row];
+                asset_count = asset_count_vec[row];
+                row_off++;
             }
             
-            x /= 2;
-        }
-        
-        if (this->combustion_map.count(total_capacity_kW) == 0) {
-            this->combustion_map[total_capacity_kW] = state_vec;
-        }
-        
-        else {
-            unsigned int incumbent_asset_count = 0;
+            //  3.2. if candidate collides with incumbent (same capacity, or same
+            //       capacity bin), keep candidate only if it runs fewer assets
+            bool collides = false;
             
-            for (unsigned int i = 0; i < n_cols; i++) {
-                if (this->combustion_map[total_capacity_kW][i]) {
-                    incumbent_asset_count++;
+            if (not merged_capacity_vec_kW.empty()) {
+                double incumbent_capacity_kW = merged_capacity_vec_kW.back();
+                
+                if (this->combustion_map_resolution_kW > 0) {
+                    collides = (
+                        floor(total_capacity_kW / this->combustion_map_resolution_kW) ==
+                        floor(incumbent_capacity_kW / this->combustion_map_resolution_kW)
+                    );
+                }
+                
+                else {
+                    collides = (total_capacity_kW == incumbent_capacity_kW);
                 }
             }
             
-            if (asset_count < incumbent_asset_count) {
-                this->combustion_map[total_capacity_kW] = state_vec;
+            if (collides and asset_count >= merged_asset_count_vec.back()) {
+                continue;
+            }
+            
+            if (collides) {
+                merged_capacity_vec_kW.pop_back();
+                merged_asset_count_vec.pop_back();
+                merged_state_vec_vec.pop_back();
+            }
+            
+            //  3.3. log candidate
+            merged_capacity_vec_kW.push_back(total_capacity_kW);
+            merged_asset_count_vec.push_back(asset_count);
+            
+            merged_state_vec_vec.push_back(state_vec_vec[row]);
+            
+            if (is_on) {
+                merged_state_vec_vec.back()[i] = true;
             }
         }
         
-        if (n_cols >= 14) {
-            std::cout << print_str << row + 1 << " / " << n_rows << "\r";
-        }
+        capacity_vec_kW = std::move(merged_capacity_vec_kW);
+        asset_count_vec = std::move(merged_asset_count_vec);
+        state_vec_vec = std::move(merged_state_vec_vec);
     }
     
-    if (n_cols >= 14) {
-        std::cout << print_str << n_rows << " / " << n_rows << "  DONE" << std::endl;
-    }
-    
-    //  3. sort combustion map by key value (ascending order)
+    //  4. populate combustion map
     /*
-     *  Not necessary, since std::map is automatically sorted by key value on insertion.
-     *  See https://en.cppreference.com/w/cpp/container/map, namely "std::map is a
-     *  sorted associative container that contains key-value pairs with unique keys.
-     *  Keys are sorted by using the comparison function Compare."
+     *  Inserting in ascending order of key, so hint at end. Recall that std::map is
+     *  automatically sorted by key value on insertion.
      */
+    this->combustion_map.clear();
     
-    /*
-    // ==== TEST PRINT ==== //
-    std::cout << std::endl << std::endl;
+    for (size_t row = 0; row < capacity_vec_kW.size(); row++) {
+        this->combustion_map.emplace_hint(
+            this->combustion_map.end(),
+            capacity_vec_kW[row],
+            std::move(state_vec_vec[row])
+        );
+    }
     
-    std::cout << "\t\t";
-    for (size_t i = 0; i < combustion_ptr_vec_ptr->size(); i++) {
-        std::cout << combustion_ptr_vec_ptr->at(i)->capacity_kW << "\t";
+    return;
+}   /* __constructCombustionMap() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Controller :: __constructCombustionTable(void)
+///
+/// \brief Helper method to freeze the Combustion map into a flat table, for use in
+///     dispatch. The total capacities are stored in a contiguous sorted vector, and
+///     the operating states in a packed, row-major bitset matrix (row i corresponding
+///     to capacity i, with asset j at bit j % 64 of word j / 64). This avoids map
+///     traversal and lookups in each time step of the Model run.
+///
+
+void Controller :: __constructCombustionTable(void)
+{
+    //  1. get table dimensions
+    size_t n_rows = this->combustion_map.size();
+    size_t n_cols = 0;
+    
+    if (n_rows > 0) {
+        n_cols = this->combustion_map.begin()->second.size();
     }
-    std::cout << std::endl;
     
-    std::map<double, std::vector<bool>>::iterator iter;
+    this->n_combustion_table_words = (n_cols + 63) / 64;
+    
+    //  2. init table
+    this->combustion_table_capacity_vec_kW.clear();
+    this->combustion_table_capacity_vec_kW.reserve(n_rows);
+    
+    this->combustion_table_state_vec.assign(
+        n_rows * this->n_combustion_table_words,
+        0
+    );
+    
+    //  3. populate table (map is sorted by key, so capacities come out sorted)
+    size_t row = 0;
+    
     for (
-        iter = this->combustion_map.begin();
+        std::map<double, std::vector<bool>>::iterator iter =
+            this->combustion_map.begin();
         iter != this->combustion_map.end();
         iter++
     ) {
-        std::cout << iter->first << ":\t{\t";
+        this->combustion_table_capacity_vec_kW.push_back(iter->first);
         
-        for (size_t i = 0; i < iter->second.size(); i++) {
-            std::cout << iter->second[i] << "\t";
+        for (size_t asset = 0; asset < iter->second.size(); asset++) {
+            if (iter->second[asset]) {
+                this->combustion_table_state_vec[
+                    row * this->n_combustion_table_words + asset / 64
+                ] |= (uint64_t(1) << (asset % 64));
+            }
         }
-        std::cout << "}" << std::endl;
+        
+        row++;
     }
     
-    
-    // ==== END TEST PRINT ==== //
-    */
-    
     return;
 }   /* __constructCombustionTable() */
 
@@ -230,6 +604,39 @@ void Controller :: __constructCombustionMap(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn size_t Controller :: __getCombustionTableRow(double allocation_kW)
+///
+/// \brief Helper method to get the row of the Combustion table with the smallest
+///     total capacity which covers the given allocation, by binary search. If no row
+///     covers the allocation, the last row (i.e., all assets running) is returned.
+///
+/// \param allocation_kW The capacity [kW] to be allocated.
+///
+/// \return The row of the Combustion table to be dispatched.
+///
+
+size_t Controller :: __getCombustionTableRow(double allocation_kW)
+{
+    std::vector<double>::iterator iter = std::lower_bound(
+        this->combustion_table_capacity_vec_kW.begin(),
+        this->combustion_table_capacity_vec_kW.end(),
+        allocation_kW
+    );
+    
+    if (iter == this->combustion_table_capacity_vec_kW.end()) {
+        iter--;
+    }
+    
+    return iter - this->combustion_table_capacity_vec_kW.begin();
+}   /* __getCombustionTableRow() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -237,7 +644,7 @@ void Controller :: __constructCombustionMap(
 ///         int timestep,
 ///         double dt_hrs,
 ///         Renewable* renewable_ptr,
-///         Resources* resources_ptr
+///         const ResourceBinding* resource_binding_ptr
 ///     )
 ///
 /// \brief Helper method to compute the production from the given Renewable asset at
@@ -249,7 +656,8 @@ void Controller :: __constructCombustionMap(
 ///
 /// \param renewable_ptr A pointer to the Renewable asset.
 ///
-/// \param resources_ptr A pointer to the Resources component of the Model.
+/// \param resource_binding_ptr A pointer to the resource binding of the Renewable
+///     asset.
 ///
 /// \return The production [kW] of the Renewable asset.
 ///
@@ -258,7 +666,7 @@ double Controller :: __getRenewableProduction(
     int timestep,
     double dt_hrs,
     Renewable* renewable_ptr,
-    Resources* resources_ptr
+    const ResourceBinding* resource_binding_ptr
 )
 {
     double production_kW = 0;
@@ -268,8 +676,7 @@ double Controller :: __getRenewableProduction(
             double resource_value = 0;
             
             if (not renewable_ptr->normalized_production_series_given) {
-                resource_value =
-                    resources_ptr->resource_map_1D[renewable_ptr->resource_key][timestep];
+                resource_value = resource_binding_ptr->resource_span[timestep];
             }
             
             production_kW = renewable_ptr->computeProductionkW(
@@ -285,8 +692,7 @@ double Controller :: __getRenewableProduction(
             double resource_value = 0;
             
             if (not renewable_ptr->normalized_production_series_given) {
-                resource_value =
-                    resources_ptr->resource_map_1D[renewable_ptr->resource_key][timestep];
+                resource_value = resource_binding_ptr->resource_span[timestep];
             }
             
             production_kW = renewable_ptr->computeProductionkW(
@@ -303,11 +709,8 @@ double Controller :: __getRenewableProduction(
             double energy_period_s = 0;
             
             if (not renewable_ptr->normalized_production_series_given) {
-                significant_wave_height_m =
-                    resources_ptr->resource_map_2D[renewable_ptr->resource_key][timestep][0];
-                
-                energy_period_s =
-                    resources_ptr->resource_map_2D[renewable_ptr->resource_key][timestep][1];
+                significant_wave_height_m = resource_binding_ptr->resource_span[timestep];
+                energy_period_s = resource_binding_ptr->resource_span_2D[timestep];
             }
             
             production_kW = renewable_ptr->computeProductionkW(
@@ -324,8 +727,7 @@ double Controller :: __getRenewableProduction(
             double resource_value = 0;
             
             if (not renewable_ptr->normalized_production_series_given) {
-                resource_value =
-                    resources_ptr->resource_map_1D[renewable_ptr->resource_key][timestep];
+                resource_value = resource_binding_ptr->resource_span[timestep];
             }
             
             production_kW = renewable_ptr->computeProductionkW(
@@ -660,8 +1062,7 @@ LoadStruct Controller :: __handleStorageDischarging(
 ///         int timestep,
 ///         double dt_hrs,
 ///         LoadStruct load_struct,
-///         std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr,
-///         Resources* resources_ptr
+///         std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr
 ///     )
 ///
 /// \brief Helper method to handle the dispatch of Noncombustion assets.
@@ -677,8 +1078,6 @@ LoadStruct Controller :: __handleStorageDischarging(
 /// \param noncombustion_ptr_vec_ptr A pointer to the Noncombustion pointer
 ///     vector of the Model.
 ///
-/// \param resources_ptr A pointer to the Resources component of the Model.
-///
 /// \return A structure of the load remaining [kW], total renewable 
 ///     production [kW], required firm dispatch remaining [kW], and required
 ///     spinning reserve remaining [kW] after discharge.
@@ -688,8 +1087,7 @@ LoadStruct Controller :: __handleNoncombustionDispatch(
     int timestep,
     double dt_hrs,
     LoadStruct load_struct,
-    std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr,
-    Resources* resources_ptr
+    std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr
 )
 {
     //  1. get total available production
@@ -714,9 +1112,9 @@ LoadStruct Controller :: __handleNoncombustionDispatch(
                     not noncombustion_ptr->normalized_production_series_given
                 ) {
                     resource_value =
-                        resources_ptr->resource_map_1D[
-                            noncombustion_ptr->resource_key
-                        ][timestep];
+                        this->noncombustion_resource_binding_vec[
+                            asset
+                        ].resource_span[timestep];
                 }
                 
                 available_production_vec_kW[asset] =
@@ -805,9 +1203,9 @@ LoadStruct Controller :: __handleNoncombustionDispatch(
                     not noncombustion_ptr->normalized_production_series_given
                 ) {
                     resource_value =
-                        resources_ptr->resource_map_1D[
-                            noncombustion_ptr->resource_key
-                        ][timestep];
+                        this->noncombustion_resource_binding_vec[
+                            asset
+                        ].resource_span[timestep];
                 }
                 
                 load_struct.load_kW = noncombustion_ptr->commit(
@@ -898,18 +1296,11 @@ LoadStruct Controller :: __handleCombustionDispatch(
     }  
     
     //  2. allocate Combustion assets
-    double allocated_capacity_kW = 0;
-    std::map<double, std::vector<bool>>::iterator iter =
-        this->combustion_map.begin();
+    size_t row = this->__getCombustionTableRow(allocation_kW);
+    double allocated_capacity_kW = this->combustion_table_capacity_vec_kW[row];
     
-    while (iter != std::prev(this->combustion_map.end(), 1)) {
-        if (allocation_kW <= allocated_capacity_kW) {
-            break;
-        }
-        
-        iter++;
-        allocated_capacity_kW = iter->first;
-    }
+    const uint64_t* state_row_ptr = this->combustion_table_state_vec.data() +
+        row * this->n_combustion_table_words;
     
     //  3. set total production
     double total_production_kW = 
@@ -943,16 +1334,15 @@ LoadStruct Controller :: __handleCombustionDispatch(
     //     force starts of allocated assets even if production is zero
     //     (to satisfy spinning reserve requirement)
     double asset_production_kW = 0;
+    bool is_allocated = false;
     Combustion* combustion_ptr;
     
-    for (
-        size_t asset = 0;
-        asset < this->combustion_map[allocated_capacity_kW].size();
-        asset++
-    ) {
-        //  6.1. get pointer
+    for (size_t asset = 0; asset < combustion_ptr_vec_ptr->size(); asset++) {
+        //  6.1. get pointer, allocation state
         combustion_ptr = combustion_ptr_vec_ptr->at(asset);
         
+        is_allocated = (state_row_ptr[asset / 64] >> (asset % 64)) & uint64_t(1);
+        
         //  6.2. get asset production
         if (allocated_capacity_kW <= 0) {
             asset_production_kW = 0;
@@ -960,7 +1350,7 @@ LoadStruct Controller :: __handleCombustionDispatch(
         
         else {
             asset_production_kW =
-                int(this->combustion_map[allocated_capacity_kW][asset]) *
+                int(is_allocated) *
                 (combustion_ptr->capacity_kW / allocated_capacity_kW) *
                 total_production_kW;
         }
@@ -980,7 +1370,7 @@ LoadStruct Controller :: __handleCombustionDispatch(
         //  6.3. force start (if applicable), commit production, log
         if (
             allocated_capacity_kW > 0 and
-            this->combustion_map[allocated_capacity_kW][asset] and
+            is_allocated and
             not combustion_ptr->is_running and
             asset_production_kW == 0
         ) {
@@ -1069,7 +1459,8 @@ double Controller :: __handleRenewableDispatch(
     for (size_t asset = 0; asset < renewable_ptr_vec_ptr->size(); asset++) {
         renewable_ptr = renewable_ptr_vec_ptr->at(asset);
         
-        production_kW = renewable_ptr->production_vec_kW[timestep];
+        production_kW =
+            renewable_ptr->production_vec_kW[renewable_ptr->getRecordIndex(timestep)];
         
         target_dispatch_kW = renewable_ptr->commit(
             timestep,
@@ -1127,6 +1518,7 @@ void Controller :: __handleStorageCharging(
     std::vector<Renewable*>* renewable_ptr_vec_ptr
 )
 {
+    int record_index = 0;
     double acceptable_kW = 0;
     double curtailment_kW = 0;
     double unused_curtailment = 0;
@@ -1169,7 +1561,8 @@ void Controller :: __handleStorageCharging(
         //  3. attempt to charge from Combustion curtailment first
         for (size_t asset = 0; asset < combustion_ptr_vec_ptr->size(); asset++) {
             combustion_ptr = combustion_ptr_vec_ptr->at(asset);
-            curtailment_kW = combustion_ptr->curtailment_vec_kW[timestep];
+            record_index = combustion_ptr->getRecordIndex(timestep);
+            curtailment_kW = combustion_ptr->curtailment_vec_kW[record_index];
             
             if (curtailment_kW <= 0) {
                 continue;
@@ -1185,8 +1578,8 @@ void Controller :: __handleStorageCharging(
                 unused_curtailment += (curtailment_kW - acceptable_kW);
             }
             
-            combustion_ptr->curtailment_vec_kW[timestep] -= acceptable_kW;
-            combustion_ptr->storage_vec_kW[timestep] += acceptable_kW;
+            combustion_ptr->curtailment_vec_kW[record_index] -= acceptable_kW;
+            combustion_ptr->storage_vec_kW[record_index] += acceptable_kW;
             combustion_ptr->total_stored_kWh += acceptable_kW * dt_hrs;
             storage_ptr->power_kW += acceptable_kW;
         }
@@ -1194,7 +1587,8 @@ void Controller :: __handleStorageCharging(
         //  4. attempt to charge from Noncombustion curtailment second
         for (size_t asset = 0; asset < noncombustion_ptr_vec_ptr->size(); asset++) {
             noncombustion_ptr = noncombustion_ptr_vec_ptr->at(asset);
-            curtailment_kW = noncombustion_ptr->curtailment_vec_kW[timestep];
+            record_index = noncombustion_ptr->getRecordIndex(timestep);
+            curtailment_kW = noncombustion_ptr->curtailment_vec_kW[record_index];
             
             if (curtailment_kW <= 0) {
                 continue;
@@ -1210,8 +1604,8 @@ void Controller :: __handleStorageCharging(
                 unused_curtailment += (curtailment_kW - acceptable_kW);
             }
             
-            noncombustion_ptr->curtailment_vec_kW[timestep] -= acceptable_kW;
-            noncombustion_ptr->storage_vec_kW[timestep] += acceptable_kW;
+            noncombustion_ptr->curtailment_vec_kW[record_index] -= acceptable_kW;
+            noncombustion_ptr->storage_vec_kW[record_index] += acceptable_kW;
             noncombustion_ptr->total_stored_kWh += acceptable_kW * dt_hrs;
             storage_ptr->power_kW += acceptable_kW;
         }
@@ -1219,7 +1613,8 @@ void Controller :: __handleStorageCharging(
         //  5. attempt to charge from Renewable curtailment third
         for (size_t asset = 0; asset < renewable_ptr_vec_ptr->size(); asset++) {
             renewable_ptr = renewable_ptr_vec_ptr->at(asset);
-            curtailment_kW = renewable_ptr->curtailment_vec_kW[timestep];
+            record_index = renewable_ptr->getRecordIndex(timestep);
+            curtailment_kW = renewable_ptr->curtailment_vec_kW[record_index];
             
             if (curtailment_kW <= 0) {
                 continue;
@@ -1235,8 +1630,8 @@ void Controller :: __handleStorageCharging(
                 unused_curtailment += (curtailment_kW - acceptable_kW);
             }
             
-            renewable_ptr->curtailment_vec_kW[timestep] -= acceptable_kW;
-            renewable_ptr->storage_vec_kW[timestep] += acceptable_kW;
+            renewable_ptr->curtailment_vec_kW[record_index] -= acceptable_kW;
+            renewable_ptr->storage_vec_kW[record_index] += acceptable_kW;
             renewable_ptr->total_stored_kWh += acceptable_kW * dt_hrs;
             storage_ptr->power_kW += acceptable_kW;
 
@@ -1334,6 +1729,68 @@ void Controller :: __handleThermalTracking(
 
 // ---------------------------------------------------------------------------------- //
 
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Controller :: __summarizeTimestep(
+///         int timestep,
+///         double t_hrs,
+///         std::vector<Combustion*>* combustion_ptr_vec_ptr,
+///         std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr,
+///         std::vector<Renewable*>* renewable_ptr_vec_ptr,
+///         std::vector<Storage*>* storage_ptr_vec_ptr
+///     )
+///
+/// \brief Helper method to have every asset fold the results of the given (completed)
+///     time step into its running totals (for use when only summary results are
+///     recorded).
+///
+/// \param timestep The current time step of the Model run.
+///
+/// \param t_hrs The point in time [hrs] associated with the time step.
+///
+/// \param combustion_ptr_vec_ptr A pointer to the Combustion pointer vector of the Model.
+///
+/// \param noncombustion_ptr_vec_ptr A pointer to the Noncombustion pointer vector of
+///     the Model.
+///
+/// \param renewable_ptr_vec_ptr A pointer to the Renewable pointer vector of the Model.
+///
+/// \param storage_ptr_vec_ptr A pointer to the Storage pointer vector of the Model.
+///
+
+void Controller :: __summarizeTimestep(
+    int timestep,
+    double t_hrs,
+    std::vector<Combustion*>* combustion_ptr_vec_ptr,
+    std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr,
+    std::vector<Renewable*>* renewable_ptr_vec_ptr,
+    std::vector<Storage*>* storage_ptr_vec_ptr
+)
+{
+    for (size_t asset = 0; asset < combustion_ptr_vec_ptr->size(); asset++) {
+        combustion_ptr_vec_ptr->at(asset)->summarizeTimestep(timestep, t_hrs);
+    }
+    
+    for (size_t asset = 0; asset < noncombustion_ptr_vec_ptr->size(); asset++) {
+        noncombustion_ptr_vec_ptr->at(asset)->summarizeTimestep(timestep, t_hrs);
+    }
+    
+    for (size_t asset = 0; asset < renewable_ptr_vec_ptr->size(); asset++) {
+        renewable_ptr_vec_ptr->at(asset)->summarizeTimestep(timestep, t_hrs);
+    }
+    
+    for (size_t asset = 0; asset < storage_ptr_vec_ptr->size(); asset++) {
+        storage_ptr_vec_ptr->at(asset)->summarizeTimestep(timestep, t_hrs);
+    }
+    
+    return;
+}   /* __summarizeTimestep() */
+
+// ---------------------------------------------------------------------------------- //
+
 // ======== END PRIVATE ============================================================= //
 
 
@@ -1350,6 +1807,17 @@ void Controller :: __handleThermalTracking(
 
 Controller :: Controller(void)
 {
+    this->n_threads = 1;
+    
+    this->summary_only = false;
+    
+    this->total_missed_load_kWh = 0;
+    this->total_missed_firm_dispatch_kWh = 0;
+    this->total_missed_spinning_reserve_kWh = 0;
+    
+    this->combustion_map_resolution_kW = 0;
+    this->n_combustion_table_words = 0;
+    
     return;
 }   /* Controller() */
 
@@ -1450,6 +1918,50 @@ void Controller :: setLoadReserveRatio(double load_reserve_ratio)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Controller :: setSummaryOnly(bool summary_only)
+///
+/// \brief Method to set Controller summary_only attribute.
+///
+/// \param summary_only A flag which indicates whether or not only summary results are
+///     to be recorded.
+///
+
+void Controller :: setSummaryOnly(bool summary_only)
+{
+    this->summary_only = summary_only;
+    
+    return;
+}   /* setSummaryOnly() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Controller :: setNThreads(int n_threads)
+///
+/// \brief Method to set Controller n_threads attribute.
+///
+/// \param n_threads The number of worker threads on which to compute Renewable
+///     production on init(). If <= 0, then all available hardware threads are used.
+///
+
+void Controller :: setNThreads(int n_threads)
+{
+    this->n_threads = n_threads;
+    
+    return;
+}   /* setNThreads() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -1457,7 +1969,8 @@ void Controller :: setLoadReserveRatio(double load_reserve_ratio)
 ///         ElectricalLoad* electrical_load_ptr,
 ///         std::vector<Renewable*>* renewable_ptr_vec_ptr,
 ///         Resources* resources_ptr,
-///         std::vector<Combustion*>* combustion_ptr_vec_ptr
+///         std::vector<Combustion*>* combustion_ptr_vec_ptr,
+///         std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr
 ///     )
 ///
 /// \brief Method to initialize the Controller component of the Model.
@@ -1470,29 +1983,46 @@ void Controller :: setLoadReserveRatio(double load_reserve_ratio)
 ///
 /// \param combustion_ptr_vec_ptr A pointer to the Combustion pointer vector of the Model.
 ///
+/// \param noncombustion_ptr_vec_ptr A pointer to the Noncombustion pointer vector of
+///     the Model (NULL if none, in which case Noncombustion assets are bound on the
+///     first call to applyDispatchControl()).
+///
 
 void Controller :: init(
     ElectricalLoad* electrical_load_ptr,
     std::vector<Renewable*>* renewable_ptr_vec_ptr,
     Resources* resources_ptr,
-    std::vector<Combustion*>* combustion_ptr_vec_ptr
+    std::vector<Combustion*>* combustion_ptr_vec_ptr,
+    std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr
 )
 {
-    //  1. init vector attributes
-    this->net_load_vec_kW.resize(electrical_load_ptr->n_points, 0);
-    this->missed_load_vec_kW.resize(electrical_load_ptr->n_points, 0);
-    this->missed_firm_dispatch_vec_kW.resize(electrical_load_ptr->n_points, 0);
-    this->missed_spinning_reserve_vec_kW.resize(electrical_load_ptr->n_points, 0);
-    
-    //  2. compute Renewable production
-    this->__computeRenewableProduction(
+    //  1. init totals
+    this->total_missed_load_kWh = 0;
+    this->total_missed_firm_dispatch_kWh = 0;
+    this->total_missed_spinning_reserve_kWh = 0;
+    
+    //  2. bind Renewable and Noncombustion assets to their resource time series
+    this->__bindResources(
         electrical_load_ptr,
         renewable_ptr_vec_ptr,
+        noncombustion_ptr_vec_ptr,
         resources_ptr
     );
     
-    //  3. construct Combustion table
+    //  3. init vector attributes, compute Renewable production (if summary only, then
+    //     production is instead computed as the dispatch proceeds)
+    if (not this->summary_only) {
+        this->net_load_vec_kW.resize(electrical_load_ptr->n_points, 0);
+        this->missed_load_vec_kW.resize(electrical_load_ptr->n_points, 0);
+        this->missed_firm_dispatch_vec_kW.resize(electrical_load_ptr->n_points, 0);
+        this->missed_spinning_reserve_vec_kW.resize(electrical_load_ptr->n_points, 0);
+        
+        this->__computeRenewableProduction(electrical_load_ptr, renewable_ptr_vec_ptr);
+    }
+    
+    //  4. construct Combustion table
     this->__constructCombustionMap(combustion_ptr_vec_ptr);
+    this->__constructCombustionTable();
     
     return;
 }   /* init() */
@@ -1510,10 +2040,15 @@ void Controller :: init(
 ///         std::vector<Combustion*>* combustion_ptr_vec_ptr,
 ///         std::vector<Nonombustion*>* noncombustion_ptr_vec_ptr,
 ///         std::vector<Renewable*>* renewable_ptr_vec_ptr,
-///         std::vector<Storage*>* storage_ptr_vec_ptr
+///         std::vector<Storage*>* storage_ptr_vec_ptr,
+///         ThermalModel* thermal_model_ptr,
+///         int start_timestep,
+///         int end_timestep
 ///     )
 ///
-/// \brief Method to apply dispatch control at every point in the modelling time series.
+/// \brief Method to apply dispatch control at every point in the modelling time series
+///     (or, optionally, at every point in the range [start_timestep, end_timestep), so
+///     that a Model run can be advanced in stages).
 ///
 /// \param electrical_load_ptr A pointer to the ElectricalLoad component of the Model.
 ///
@@ -1528,6 +2063,13 @@ void Controller :: init(
 ///
 /// \param storage_ptr_vec_ptr A pointer to the Storage pointer vector of the Model.
 ///
+/// \param thermal_model_ptr A pointer to the ThermalModel of the Model (NULL if none).
+///
+/// \param start_timestep The first time step to dispatch.
+///
+/// \param end_timestep One past the last time step to dispatch. If <0, then every
+///     time step from start_timestep onwards is dispatched.
+///
 
 void Controller :: applyDispatchControl(
     ElectricalLoad* electrical_load_ptr,
@@ -1536,11 +2078,19 @@ void Controller :: applyDispatchControl(
     std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr,
     std::vector<Renewable*>* renewable_ptr_vec_ptr,
     std::vector<Storage*>* storage_ptr_vec_ptr,
-    ThermalModel* thermal_model_ptr
+    ThermalModel* thermal_model_ptr,
+    int start_timestep,
+    int end_timestep
 )
 {
+    if (end_timestep < 0 or end_timestep > electrical_load_ptr->n_points) {
+        end_timestep = electrical_load_ptr->n_points;
+    }
+    
+    int record_index = 0;
     double dt_hrs = 0;
     double load_kW = 0;
+    double production_kW = 0;
     double required_firm_dispatch_kW = 0;
     double total_renewable_production_kW = 0;
     double required_spinning_reserve_kW = 0;
@@ -1552,9 +2102,20 @@ void Controller :: applyDispatchControl(
     this->storage_discharge_bool_vec.clear();
     this->storage_discharge_bool_vec.resize(storage_ptr_vec_ptr->size(), false);
     
-    for (
-        int timestep = 0; timestep < electrical_load_ptr->n_points; timestep++
+    if (
+        this->renewable_resource_binding_vec.size() != renewable_ptr_vec_ptr->size() or
+        this->noncombustion_resource_binding_vec.size() !=
+            noncombustion_ptr_vec_ptr->size()
     ) {
+        this->__bindResources(
+            electrical_load_ptr,
+            renewable_ptr_vec_ptr,
+            noncombustion_ptr_vec_ptr,
+            resources_ptr
+        );
+    }
+    
+    for (int timestep = start_timestep; timestep < end_timestep; timestep++) {
         //  1. get load and dt_hrs
         load_kW = electrical_load_ptr->load_vec_kW[timestep];
         dt_hrs = electrical_load_ptr->dt_vec_hrs[timestep];
@@ -1591,13 +2152,24 @@ void Controller :: applyDispatchControl(
             size_t asset = 0; asset < renewable_ptr_vec_ptr->size(); asset++
         ) {
             renewable_ptr = renewable_ptr_vec_ptr->at(asset);
+            record_index = renewable_ptr->getRecordIndex(timestep);
+            
+            if (this->summary_only) {
+                renewable_ptr->production_vec_kW[record_index] =
+                    this->__getRenewableProduction(
+                        timestep,
+                        dt_hrs,
+                        renewable_ptr,
+                        &(this->renewable_resource_binding_vec[asset])
+                    );
+            }
+            
+            production_kW = renewable_ptr->production_vec_kW[record_index];
             
-            total_renewable_production_kW +=
-                renewable_ptr->production_vec_kW[timestep];
+            total_renewable_production_kW += production_kW;
             
             required_spinning_reserve_kW += 
-                (1 - renewable_ptr->firmness_factor) *
-                renewable_ptr->production_vec_kW[timestep];
+                (1 - renewable_ptr->firmness_factor) * production_kW;
         }
         
         if (required_spinning_reserve_kW > load_kW) {
@@ -1617,8 +2189,7 @@ void Controller :: applyDispatchControl(
             timestep,
             dt_hrs,
             load_struct,
-            noncombustion_ptr_vec_ptr,
-            resources_ptr
+            noncombustion_ptr_vec_ptr
         );
         
         //  6. handle Storage discharge
@@ -1714,20 +2285,46 @@ void Controller :: applyDispatchControl(
         
         //  11. log missed load, firm dispatch, and/or spinning reserve, if any
         if (load_struct.load_kW > 1e-6) {
-            this->missed_load_vec_kW[timestep] = load_struct.load_kW;
+            if (not this->summary_only) {
+                this->missed_load_vec_kW[timestep] = load_struct.load_kW;
+            }
+            
+            this->total_missed_load_kWh += load_struct.load_kW * dt_hrs;
         }
         
         if (load_struct.required_firm_dispatch_kW > 1e-6) {
-            this->missed_firm_dispatch_vec_kW[timestep] =
-                load_struct.required_firm_dispatch_kW;
+            if (not this->summary_only) {
+                this->missed_firm_dispatch_vec_kW[timestep] =
+                    load_struct.required_firm_dispatch_kW;
+            }
+            
+            this->total_missed_firm_dispatch_kWh +=
+                load_struct.required_firm_dispatch_kW * dt_hrs;
         }
         
         if (load_struct.required_spinning_reserve_kW > 1e-6) {
-            this->missed_spinning_reserve_vec_kW[timestep] =
-                load_struct.required_spinning_reserve_kW;
+            if (not this->summary_only) {
+                this->missed_spinning_reserve_vec_kW[timestep] =
+                    load_struct.required_spinning_reserve_kW;
+            }
+            
+            this->total_missed_spinning_reserve_kWh +=
+                load_struct.required_spinning_reserve_kW * dt_hrs;
+        }
+        
+        //  12. summarize time step (if applicable)
+        if (this->summary_only) {
+            this->__summarizeTimestep(
+                timestep,
+                electrical_load_ptr->time_vec_hrs[timestep],
+                combustion_ptr_vec_ptr,
+                noncombustion_ptr_vec_ptr,
+                renewable_ptr_vec_ptr,
+                storage_ptr_vec_ptr
+            );
         }
 
-        //  11. reset storage_discharge_bool_vec
+        //  13. reset storage_discharge_bool_vec
         for (size_t asset = 0; asset < storage_ptr_vec_ptr->size(); asset++) {
             this->storage_discharge_bool_vec[asset] = false;
         }
@@ -1750,11 +2347,20 @@ void Controller :: applyDispatchControl(
 
 void Controller :: clear(void)
 {
+    this->total_missed_load_kWh = 0;
+    this->total_missed_firm_dispatch_kWh = 0;
+    this->total_missed_spinning_reserve_kWh = 0;
     this->net_load_vec_kW.clear();
     this->missed_load_vec_kW.clear();
     this->missed_firm_dispatch_vec_kW.clear();
     this->missed_spinning_reserve_vec_kW.clear();
     this->combustion_map.clear();
+    this->combustion_map_resolution_kW = 0;
+    this->n_combustion_table_words = 0;
+    this->combustion_table_capacity_vec_kW.clear();
+    this->combustion_table_state_vec.clear();
+    this->renewable_resource_binding_vec.clear();
+    this->noncombustion_resource_binding_vec.clear();
     
     return;
 }   /* clear() */
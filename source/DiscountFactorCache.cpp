@@ -0,0 +1,474 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file DiscountFactorCache.cpp
+///
+///
+/// \brief Implementation file for the DiscountFactorCache class.
+///
+/// A class which computes, and then caches, the vector of discount factors over a
+/// modelling time vector, for each distinct real annual rate requested.
+///
+
+
+#include "../header/DiscountFactorCache.h"
+
+
+
+// ======== PRIVATE ================================================================= //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::vector<double>* DiscountFactorCache :: __computeDiscountFactors(
+///         double real_annual_rate
+///     )
+///
+/// \brief Helper method to compute (and insert into the cache) the vector of discount
+///     factors 1 / (1 + r)^(t / 8760) over the modelling time vector. Assumes that the
+///     caller holds the mutex.
+///
+/// \param real_annual_rate The real annual rate r to discount at.
+///
+/// \return A pointer to the cached vector of discount factors.
+///
+
+std::vector<double>* DiscountFactorCache :: __computeDiscountFactors(
+    double real_annual_rate
+)
+{
+    //  1. check time vector
+    if (this->time_vec_hrs_ptr == NULL) {
+        std::string error_str = "ERROR:  DiscountFactorCache::getDiscountFactors():  ";
+        error_str += "no time vector has been set";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+        
+        throw std::runtime_error(error_str);
+    }
+    
+    //  2. compute discount factors
+    size_t n_points = this->time_vec_hrs_ptr->size();
+    std::vector<double> discount_factor_vec(n_points, 0);
+    
+    double t_hrs = 0;
+    
+    for (size_t i = 0; i < n_points; i++) {
+        t_hrs = (*(this->time_vec_hrs_ptr))[i];
+        discount_factor_vec[i] = 1.0 / pow(1 + real_annual_rate, t_hrs / 8760);
+    }
+    
+    //  3. insert into cache
+    auto inserted = this->discount_factor_map.insert(
+        std::pair<double, std::vector<double>>(
+            real_annual_rate,
+            std::move(discount_factor_vec)
+        )
+    );
+    
+    return &(inserted.first->second);
+}   /* __computeDiscountFactors() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double DiscountFactorCache :: __dot(
+///         std::vector<double>* x_vec_ptr,
+///         std::vector<double>* y_vec_ptr
+///     )
+///
+/// \brief Helper method to compute the dot product of two vectors of equal length.
+///     Uses four independent partial sums, so that the loop is free to vectorize.
+///
+/// \param x_vec_ptr A pointer to the first vector.
+///
+/// \param y_vec_ptr A pointer to the second vector.
+///
+/// \return The dot product of the two vectors.
+///
+
+double DiscountFactorCache :: __dot(
+    std::vector<double>* x_vec_ptr,
+    std::vector<double>* y_vec_ptr
+)
+{
+    size_t n_points = x_vec_ptr->size();
+    
+    const double* x = x_vec_ptr->data();
+    const double* y = y_vec_ptr->data();
+    
+    double sum_0 = 0;
+    double sum_1 = 0;
+    double sum_2 = 0;
+    double sum_3 = 0;
+    
+    size_t i = 0;
+    
+    for ( ; i + 4 <= n_points; i += 4) {
+        sum_0 += x[i] * y[i];
+        sum_1 += x[i + 1] * y[i + 1];
+        sum_2 += x[i + 2] * y[i + 2];
+        sum_3 += x[i + 3] * y[i + 3];
+    }
+    
+    for ( ; i < n_points; i++) {
+        sum_0 += x[i] * y[i];
+    }
+    
+    return (sum_0 + sum_1) + (sum_2 + sum_3);
+}   /* __dot() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PRIVATE ============================================================= //
+
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn DiscountFactorCache :: DiscountFactorCache(void)
+///
+/// \brief Constructor (dummy) for the DiscountFactorCache class.
+///
+
+DiscountFactorCache :: DiscountFactorCache(void)
+{
+    this->time_vec_hrs_ptr = NULL;
+    
+    return;
+}   /* DiscountFactorCache() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn DiscountFactorCache :: DiscountFactorCache(
+///         std::vector<double>* time_vec_hrs_ptr
+///     )
+///
+/// \brief Constructor (intended) for the DiscountFactorCache class.
+///
+/// \param time_vec_hrs_ptr A pointer to the modelling time vector [hrs].
+///
+
+DiscountFactorCache :: DiscountFactorCache(std::vector<double>* time_vec_hrs_ptr)
+{
+    this->time_vec_hrs_ptr = time_vec_hrs_ptr;
+    
+    return;
+}   /* DiscountFactorCache() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn DiscountFactorCache :: DiscountFactorCache(const DiscountFactorCache& other)
+///
+/// \brief Copy constructor for the DiscountFactorCache class. Copies the time vector
+///     pointer and the cached discount factors (but not the mutex), under the lock of
+///     the copied cache.
+///
+/// \param other The DiscountFactorCache to copy.
+///
+
+DiscountFactorCache :: DiscountFactorCache(const DiscountFactorCache& other)
+{
+    std::lock_guard<std::mutex> lock(other.mutex);
+    
+    this->time_vec_hrs_ptr = other.time_vec_hrs_ptr;
+    this->discount_factor_map = other.discount_factor_map;
+    
+    return;
+}   /* DiscountFactorCache() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn DiscountFactorCache& DiscountFactorCache :: operator = (
+///         const DiscountFactorCache& other
+///     )
+///
+/// \brief Copy assignment operator for the DiscountFactorCache class. Copies the time
+///     vector pointer and the cached discount factors (but not the mutex), under the
+///     locks of both caches.
+///
+/// \param other The DiscountFactorCache to copy.
+///
+/// \return A reference to this DiscountFactorCache.
+///
+
+DiscountFactorCache& DiscountFactorCache :: operator = (
+    const DiscountFactorCache& other
+)
+{
+    if (this != &other) {
+        std::scoped_lock lock(this->mutex, other.mutex);
+        
+        this->time_vec_hrs_ptr = other.time_vec_hrs_ptr;
+        this->discount_factor_map = other.discount_factor_map;
+    }
+    
+    return *this;
+}   /* operator = () */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void DiscountFactorCache :: setTimeVec(std::vector<double>* time_vec_hrs_ptr)
+///
+/// \brief Method to (re)set the modelling time vector. Clears any cached discount
+///     factors, since they are no longer valid.
+///
+/// \param time_vec_hrs_ptr A pointer to the modelling time vector [hrs].
+///
+
+void DiscountFactorCache :: setTimeVec(std::vector<double>* time_vec_hrs_ptr)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    
+    this->time_vec_hrs_ptr = time_vec_hrs_ptr;
+    this->discount_factor_map.clear();
+    
+    return;
+}   /* setTimeVec() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::vector<double>* DiscountFactorCache :: getDiscountFactors(
+///         double real_annual_rate
+///     )
+///
+/// \brief Method to get the vector of discount factors for the given real annual rate.
+///     Factors are computed on the first request for a given rate, and then reused.
+///
+/// The returned pointer remains valid until the cache is cleared or its time vector is
+/// reset.
+///
+/// \param real_annual_rate The real annual rate r to discount at.
+///
+/// \return A pointer to the vector of discount factors 1 / (1 + r)^(t / 8760).
+///
+
+std::vector<double>* DiscountFactorCache :: getDiscountFactors(double real_annual_rate)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    
+    auto it = this->discount_factor_map.find(real_annual_rate);
+    
+    if (it != this->discount_factor_map.end()) {
+        return &(it->second);
+    }
+    
+    return this->__computeDiscountFactors(real_annual_rate);
+}   /* getDiscountFactors() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double DiscountFactorCache :: computePresentValue(
+///         double real_annual_rate,
+///         std::vector<double>* cost_vec_ptr
+///     )
+///
+/// \brief Method to compute the present value of a vector of (real) costs incurred
+///     over the modelling time vector.
+///
+/// \param real_annual_rate The real annual rate r to discount at.
+///
+/// \param cost_vec_ptr A pointer to the vector of costs, one per modelling timestep.
+///
+/// \return The present value of the given costs.
+///
+
+double DiscountFactorCache :: computePresentValue(
+    double real_annual_rate,
+    std::vector<double>* cost_vec_ptr
+)
+{
+    std::vector<double>* discount_factor_vec_ptr =
+        this->getDiscountFactors(real_annual_rate);
+    
+    if (cost_vec_ptr->size() != discount_factor_vec_ptr->size()) {
+        std::string error_str = "ERROR:  DiscountFactorCache::computePresentValue():  ";
+        error_str += "cost vector and time vector are not the same length";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+        
+        throw std::invalid_argument(error_str);
+    }
+    
+    return this->__dot(discount_factor_vec_ptr, cost_vec_ptr);
+}   /* computePresentValue() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double DiscountFactorCache :: computePresentValue(
+///         double real_annual_rate,
+///         std::vector<CapitalCostEvent>* event_vec_ptr
+///     )
+///
+/// \brief Method to compute the present value of a log of (real) capital costs, each
+///     incurred at some timestep of the modelling time vector. The work done is
+///     proportional to the number of events, once the discount factors are cached.
+///
+/// \param real_annual_rate The real annual rate r to discount at.
+///
+/// \param event_vec_ptr A pointer to the vector of capital cost events.
+///
+/// \return The present value of the given costs.
+///
+
+double DiscountFactorCache :: computePresentValue(
+    double real_annual_rate,
+    std::vector<CapitalCostEvent>* event_vec_ptr
+)
+{
+    if (event_vec_ptr->empty()) {
+        return 0;
+    }
+    
+    std::vector<double>* discount_factor_vec_ptr =
+        this->getDiscountFactors(real_annual_rate);
+    
+    int n_points = discount_factor_vec_ptr->size();
+    double present_value = 0;
+    
+    for (size_t i = 0; i < event_vec_ptr->size(); i++) {
+        int timestep = (*event_vec_ptr)[i].timestep;
+        
+        if (timestep < 0 or timestep >= n_points) {
+            std::string error_str = "ERROR:  ";
+            error_str += "DiscountFactorCache::computePresentValue():  ";
+            error_str += "capital cost event timestep ";
+            error_str += std::to_string(timestep);
+            error_str += " is outside of the time vector";
+            
+            #ifdef _WIN32
+                std::cout << error_str << std::endl;
+            #endif
+            
+            throw std::invalid_argument(error_str);
+        }
+        
+        present_value +=
+            (*discount_factor_vec_ptr)[timestep] * (*event_vec_ptr)[i].cost;
+    }
+    
+    return present_value;
+}   /* computePresentValue() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void DiscountFactorCache :: clear(void)
+///
+/// \brief Method to clear all cached discount factors.
+///
+
+void DiscountFactorCache :: clear(void)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    
+    this->discount_factor_map.clear();
+    
+    return;
+}   /* clear() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn DiscountFactorCache :: ~DiscountFactorCache(void)
+///
+/// \brief Destructor for the DiscountFactorCache class.
+///
+
+DiscountFactorCache :: ~DiscountFactorCache(void)
+{
+    return;
+}   /* ~DiscountFactorCache() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PUBLIC ============================================================== //
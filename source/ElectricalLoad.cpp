@@ -105,35 +105,33 @@ void ElectricalLoad :: readLoadData(std::string path_2_electrical_load_time_seri
     //  1. clear
     this->clear();
     
-    //  2. init CSV reader, record path
-    io::CSVReader<2> CSV(path_2_electrical_load_time_series);
+    //  2. read in time and load data (through time series cache), record path
+    std::vector<std::vector<double>> column_vec;
     
-    CSV.read_header(
-        io::ignore_extra_column,
-        "Time (since start of data) [hrs]",
-        "Electrical Load [kW]"
+    this->time_series_cache.read(
+        path_2_electrical_load_time_series,
+        {"Time (since start of data) [hrs]", "Electrical Load [kW]"},
+        &column_vec
     );
     
     this->path_2_electrical_load_time_series = path_2_electrical_load_time_series;
     
-    //  3. read in time and load data, increment n_points, track min and max load
-    double time_hrs = 0;
-    double load_kW = 0;
+    this->time_vec_hrs.swap(column_vec[0]);
+    this->load_vec_kW.swap(column_vec[1]);
+    
+    //  3. set n_points, track min and max load
     double load_sum_kW = 0;
     
-    this->n_points = 0;
+    this->n_points = this->load_vec_kW.size();
     
     this->min_load_kW = std::numeric_limits<double>::infinity();
     this->max_load_kW = -1 * std::numeric_limits<double>::infinity();
     
-    while (CSV.read_row(time_hrs, load_kW)) {
-        this->time_vec_hrs.push_back(time_hrs);
-        this->load_vec_kW.push_back(load_kW);
+    for (int i = 0; i < this->n_points; i++) {
+        double load_kW = this->load_vec_kW[i];
         
         load_sum_kW += load_kW;
         
-        this->n_points++;
-        
         if (this->min_load_kW > load_kW) {
             this->min_load_kW = load_kW;
         }
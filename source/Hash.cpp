@@ -0,0 +1,95 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+/// \file Hash.cpp
+///
+/// \brief Implementation file for the PGMcpp hashing utility.
+///
+/// A 64-bit FNV-1a style hash of raw bytes, shared by the various caches.
+///
+
+
+#include "../header/Hash.h"
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn uint64_t hashBytes(const void* data_ptr, size_t n_bytes)
+///
+/// \brief A function to compute a 64-bit FNV-1a style hash of the given bytes. Bytes
+///     are consumed eight at a time (as 64-bit words), so hashing multi-megabyte
+///     buffers (e.g., TimeSeriesCache sidecars) is cheap relative to reading them.
+///
+/// \param data_ptr A pointer to the bytes to hash.
+///
+/// \param n_bytes The number of bytes to hash.
+///
+/// \return The hash of the given bytes.
+///
+
+uint64_t hashBytes(const void* data_ptr, size_t n_bytes)
+{
+    const uint64_t FNV_OFFSET = 14695981039346656037ULL;
+    const uint64_t FNV_PRIME = 1099511628211ULL;
+    
+    const unsigned char* byte_ptr = (const unsigned char*)data_ptr;
+    uint64_t hash = FNV_OFFSET;
+    uint64_t word = 0;
+    
+    //  1. hash whole words
+    size_t n_words = n_bytes / sizeof(uint64_t);
+    
+    for (size_t i = 0; i < n_words; i++) {
+        std::memcpy(&word, byte_ptr + i * sizeof(uint64_t), sizeof(uint64_t));
+        
+        hash ^= word;
+        hash *= FNV_PRIME;
+    }
+    
+    //  2. hash any trailing bytes
+    for (size_t i = n_words * sizeof(uint64_t); i < n_bytes; i++) {
+        hash ^= byte_ptr[i];
+        hash *= FNV_PRIME;
+    }
+    
+    return hash;
+}   /* hashBytes() */
+
+// ---------------------------------------------------------------------------------- //
@@ -46,6 +46,36 @@
 
 
 #include "../header/Interpolator.h"
+#include "../header/InterpolatorTableCache.h"
+
+#ifdef __AVX2__
+    #include <immintrin.h>
+    
+    ///
+    /// \fn static inline __m256d gatherPD(const double* base_ptr, __m128i idx)
+    ///
+    /// \brief Helper function to gather four doubles, base_ptr[idx[0 ... 3]]. Is a
+    ///     full-mask gather over a zeroed source (which is equivalent to
+    ///     _mm256_i32gather_pd(), but does not trip -Wmaybe-uninitialized).
+    ///
+    /// \param base_ptr A pointer to the data to gather from.
+    ///
+    /// \param idx The four indices to gather.
+    ///
+    /// \return The four gathered doubles.
+    ///
+    
+    static inline __m256d gatherPD(const double* base_ptr, __m128i idx)
+    {
+        return _mm256_mask_i32gather_pd(
+            _mm256_setzero_pd(),
+            base_ptr,
+            idx,
+            _mm256_castsi256_pd(_mm256_set1_epi64x(-1)),
+            8
+        );
+    }   /* gatherPD() */
+#endif  /* __AVX2__ */
 
 
 
@@ -118,20 +148,25 @@ void Interpolator :: __checkDataKey2D(int data_key)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Interpolator :: __checkBounds1D(int data_key, double interp_x)
+/// \fn int Interpolator :: __getHandleIdx1D(int data_key)
 ///
-/// \brief Helper method to check that the given 1D interpolation value is contained 
-///     within the given corresponding data domain. Also checks that the data key has
-///     been registered.
+/// \brief Helper method to get the handle index associated with the given 1D data key
+///     (in a single map lookup, once a handle has been issued). Issues a handle if
+///     there is none yet, and checks that the data key has been registered.
 ///
 /// \param data_key A key associated with the given interpolation data.
 ///
-/// \param interp_x The query value to be interpolated.
+/// \return The associated handle index.
 ///
 
-void Interpolator :: __checkBounds1D(int data_key, double interp_x)
+int Interpolator :: __getHandleIdx1D(int data_key)
 {
-    //  1. key error
+    std::map<int, int>::iterator iter = this->handle_map_1D.find(data_key);
+    
+    if (iter != this->handle_map_1D.end()) {
+        return iter->second;
+    }
+    
     if (this->interp_map_1D.count(data_key) == 0) {
         std::string error_str = "ERROR:  Interpolator::interp1D()  ";
         error_str += "data key ";
@@ -145,18 +180,153 @@ void Interpolator :: __checkBounds1D(int data_key, double interp_x)
         throw std::invalid_argument(error_str);
     }
     
-    //  2. bounds error
+    return this->getHandle1D(data_key).idx;
+}   /* __getHandleIdx1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn int Interpolator :: __getHandleIdx2D(int data_key)
+///
+/// \brief Helper method to get the handle index associated with the given 2D data key
+///     (in a single map lookup, once a handle has been issued). Issues a handle if
+///     there is none yet, and checks that the data key has been registered.
+///
+/// \param data_key A key associated with the given interpolation data.
+///
+/// \return The associated handle index.
+///
+
+int Interpolator :: __getHandleIdx2D(int data_key)
+{
+    std::map<int, int>::iterator iter = this->handle_map_2D.find(data_key);
+    
+    if (iter != this->handle_map_2D.end()) {
+        return iter->second;
+    }
+    
+    if (this->interp_map_2D.count(data_key) == 0) {
+        std::string error_str = "ERROR:  Interpolator::interp2D()  ";
+        error_str += "data key ";
+        error_str += std::to_string(data_key);
+        error_str += " has not been registered";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    return this->getHandle2D(data_key).idx;
+}   /* __getHandleIdx2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: __checkHandle1D(InterpolatorHandle1D handle)
+///
+/// \brief Helper method to check that the given 1D handle was issued by this
+///     Interpolator (or by the Interpolator it was copied from).
+///
+/// \param handle A handle to the given interpolation data.
+///
+
+void Interpolator :: __checkHandle1D(InterpolatorHandle1D handle)
+{
+    if (handle.idx < 0 or handle.idx >= (int)this->handle_ptr_vec_1D.size()) {
+        std::string error_str = "ERROR:  Interpolator::interp1D()  ";
+        error_str += "handle (1D) ";
+        error_str += std::to_string(handle.idx);
+        error_str += " has not been issued";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    return;
+}   /* __checkHandle1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: __checkHandle2D(InterpolatorHandle2D handle)
+///
+/// \brief Helper method to check that the given 2D handle was issued by this
+///     Interpolator (or by the Interpolator it was copied from).
+///
+/// \param handle A handle to the given interpolation data.
+///
+
+void Interpolator :: __checkHandle2D(InterpolatorHandle2D handle)
+{
+    if (handle.idx < 0 or handle.idx >= (int)this->handle_ptr_vec_2D.size()) {
+        std::string error_str = "ERROR:  Interpolator::interp2D()  ";
+        error_str += "handle (2D) ";
+        error_str += std::to_string(handle.idx);
+        error_str += " has not been issued";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    return;
+}   /* __checkHandle2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: __checkBounds1D(
+///         const InterpolatorStruct1D* interp_struct_1D_ptr,
+///         double interp_x
+///     )
+///
+/// \brief Helper method to check that the given 1D interpolation value is contained 
+///     within the given corresponding data domain.
+///
+/// \param interp_struct_1D_ptr A pointer to the given interpolation data.
+///
+/// \param interp_x The query value to be interpolated.
+///
+
+void Interpolator :: __checkBounds1D(
+    const InterpolatorStruct1D* interp_struct_1D_ptr,
+    double interp_x
+)
+{
     if (
-        interp_x < this->interp_map_1D[data_key].min_x or
-        interp_x > this->interp_map_1D[data_key].max_x
+        interp_x < interp_struct_1D_ptr->min_x or
+        interp_x > interp_struct_1D_ptr->max_x
     ) {
         std::string error_str = "ERROR:  Interpolator::interp1D()  ";
         error_str += "interpolation value ";
         error_str += std::to_string(interp_x);
         error_str += " is outside of the given interpolation data domain [";
-        error_str += std::to_string(this->interp_map_1D[data_key].min_x);
+        error_str += std::to_string(interp_struct_1D_ptr->min_x);
         error_str += " , ";
-        error_str += std::to_string(this->interp_map_1D[data_key].max_x);
+        error_str += std::to_string(interp_struct_1D_ptr->max_x);
         error_str += "]";
         
         #ifdef _WIN32
@@ -176,47 +346,40 @@ void Interpolator :: __checkBounds1D(int data_key, double interp_x)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Interpolator :: __checkBounds2D(int data_key, double interp_x, double interp_y)
+/// \fn void Interpolator :: __checkBounds2D(
+///         const InterpolatorStruct2D* interp_struct_2D_ptr,
+///         double interp_x,
+///         double interp_y
+///     )
 ///
 /// \brief Helper method to check that the given 2D interpolation value is contained 
-///     within the given corresponding data domain. Also checks that the data key has
-///     been registered.
+///     within the given corresponding data domain.
 ///
-/// \param data_key A key associated with the given interpolation data.
+/// \param interp_struct_2D_ptr A pointer to the given interpolation data.
 ///
 /// \param interp_x The first query value to be interpolated.
 ///
 /// \param interp_y The second query value to be interpolated.
 ///
 
-void Interpolator :: __checkBounds2D(int data_key, double interp_x, double interp_y)
+void Interpolator :: __checkBounds2D(
+    const InterpolatorStruct2D* interp_struct_2D_ptr,
+    double interp_x,
+    double interp_y
+)
 {
-    //  1. key error
-    if (this->interp_map_2D.count(data_key) == 0) {
-        std::string error_str = "ERROR:  Interpolator::interp2D()  ";
-        error_str += "data key ";
-        error_str += std::to_string(data_key);
-        error_str += " has not been registered";
-        
-        #ifdef _WIN32
-            std::cout << error_str << std::endl;
-        #endif
-
-        throw std::invalid_argument(error_str);
-    }
-    
-    //  2. bounds error (x_interp)
+    //  1. bounds error (x_interp)
     if (
-        interp_x < this->interp_map_2D[data_key].min_x or
-        interp_x > this->interp_map_2D[data_key].max_x
+        interp_x < interp_struct_2D_ptr->min_x or
+        interp_x > interp_struct_2D_ptr->max_x
     ) {
         std::string error_str = "ERROR:  Interpolator::interp2D()  ";
         error_str += "interpolation value interp_x = ";
         error_str += std::to_string(interp_x);
         error_str += " is outside of the given interpolation data domain [";
-        error_str += std::to_string(this->interp_map_2D[data_key].min_x);
+        error_str += std::to_string(interp_struct_2D_ptr->min_x);
         error_str += " , ";
-        error_str += std::to_string(this->interp_map_2D[data_key].max_x);
+        error_str += std::to_string(interp_struct_2D_ptr->max_x);
         error_str += "]";
         
         #ifdef _WIN32
@@ -228,16 +391,16 @@ void Interpolator :: __checkBounds2D(int data_key, double interp_x, double inter
     
     //  2. bounds error (y_interp)
     if (
-        interp_y < this->interp_map_2D[data_key].min_y or
-        interp_y > this->interp_map_2D[data_key].max_y
+        interp_y < interp_struct_2D_ptr->min_y or
+        interp_y > interp_struct_2D_ptr->max_y
     ) {
         std::string error_str = "ERROR:  Interpolator::interp2D()  ";
         error_str += "interpolation value interp_y = ";
         error_str += std::to_string(interp_y);
         error_str += " is outside of the given interpolation data domain [";
-        error_str += std::to_string(this->interp_map_2D[data_key].min_y);
+        error_str += std::to_string(interp_struct_2D_ptr->min_y);
         error_str += " , ";
-        error_str += std::to_string(this->interp_map_2D[data_key].max_y);
+        error_str += std::to_string(interp_struct_2D_ptr->max_y);
         error_str += "]";
         
         #ifdef _WIN32
@@ -275,8 +438,8 @@ void Interpolator :: __throwReadError(std::string path_2_data, int dimensions)
     error_str += "D()  ";
     error_str += " failed to read ";
     error_str += path_2_data;
-    error_str += " (this is probably a std::stod() error; is there non-numeric ";
-    error_str += "data where only numeric data should be?)";
+    error_str += " (this is probably a parse error; is there non-numeric data, or ";
+    error_str += "a missing cell, where only numeric data should be?)";
 
     #ifdef _WIN32
         std::cout << error_str << std::endl;
@@ -294,26 +457,57 @@ void Interpolator :: __throwReadError(std::string path_2_data, int dimensions)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn bool Interpolator :: __isNonNumeric(std::string str)
+/// \fn InterpolatorAxis Interpolator :: __getInterpolatorAxis(
+///         std::vector<double>* x_vec_ptr
+///     )
 ///
-/// \brief Helper method to determine if given string is non-numeric (i.e., contains
-//      one or more alpha characters).
+/// \brief Helper method to determine the search properties of the given axis (i.e.,
+///     whether it is strictly increasing, and whether it is uniformly spaced).
 ///
-/// \param str The string being tested.
+/// \param x_vec_ptr A pointer to the given vector of interpolation data.
 ///
-/// \return A boolean indicating if the given string is non-numeric.
+/// \return The search properties of the given axis.
 ///
 
-bool Interpolator :: __isNonNumeric(std::string str)
+InterpolatorAxis Interpolator :: __getInterpolatorAxis(std::vector<double>* x_vec_ptr)
 {
-    for (size_t i = 0; i < str.size(); i++) {;
-        if (isalpha(str[i])) {
-            return true;
+    InterpolatorAxis axis;
+    
+    int n_points = x_vec_ptr->size();
+    
+    if (n_points < 2) {
+        return axis;
+    }
+    
+    //  1. check strictly increasing
+    axis.is_increasing = true;
+    
+    for (int i = 0; i < n_points - 1; i++) {
+        if (not ((*x_vec_ptr)[i] < (*x_vec_ptr)[i + 1])) {
+            axis.is_increasing = false;
+            return axis;
+        }
+    }
+    
+    //  2. check uniformly spaced
+    double min_x = (*x_vec_ptr)[0];
+    double dx = ((*x_vec_ptr)[n_points - 1] - min_x) / (n_points - 1);
+    
+    axis.is_uniform = true;
+    
+    for (int i = 1; i < n_points - 1; i++) {
+        if (fabs((*x_vec_ptr)[i] - (min_x + i * dx)) > 1e-6 * dx) {
+            axis.is_uniform = false;
+            break;
         }
     }
     
-    return false;
-}   /* __isAlpha() */
+    if (axis.is_uniform) {
+        axis.inverse_dx = 1 / dx;
+    }
+    
+    return axis;
+}   /* __getInterpolatorAxis() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -324,30 +518,106 @@ bool Interpolator :: __isNonNumeric(std::string str)
 ///
 /// \fn int Interpolator :: __getInterpolationIndex(
 ///         double interp_x,
-///         std::vector<double>* x_vec_ptr
+///         const std::vector<double>* x_vec_ptr,
+///         const InterpolatorAxis* axis_ptr,
+///         int* hint_idx_ptr
 ///     )
 ///
-/// \brief Helper method to get appropriate interpolation index into given vector.
+/// \brief Helper method to get appropriate interpolation index into given vector;
+///     that is, the smallest index idx such that interp_x is in
+///     [x_vec[idx], x_vec[idx + 1]].
+///
+/// On a uniform axis, the index is computed directly (and then nudged to absorb any
+/// floating point rounding). Otherwise, the previous index (and its successor) is
+/// checked first, and only then is a binary search done. Either way, the index is
+/// exactly that found by a linear scan, which is still used for axes which are not
+/// strictly increasing (and for NaN queries).
 ///
 /// \param interp_x The query value to be interpolated.
 ///
 /// \param x_vec_ptr A pointer to the given vector of interpolation data.
 ///
+/// \param axis_ptr A pointer to the search properties of the given vector.
+///
+/// \param hint_idx_ptr A pointer to the search hint (i.e., the index found by the
+///     previous search) to use, and update. Hints are held per Interpolator (not in the
+///     data), since the data may be shared.
+///
 /// \return The appropriate interpolation index into the given vector.
 ///
 
 int Interpolator :: __getInterpolationIndex(
     double interp_x,
-    std::vector<double>* x_vec_ptr
+    const std::vector<double>* x_vec_ptr,
+    const InterpolatorAxis* axis_ptr,
+    int* hint_idx_ptr
 )
 {
-    int idx = 0;
-    while (
-        not (interp_x >= x_vec_ptr->at(idx) and interp_x <= x_vec_ptr->at(idx + 1))
-    ) {
+    //  1. linear scan (if axis not strictly increasing, or query is NaN)
+    if (not axis_ptr->is_increasing or std::isnan(interp_x)) {
+        int idx = 0;
+        while (
+            not (interp_x >= x_vec_ptr->at(idx) and interp_x <= x_vec_ptr->at(idx + 1))
+        ) {
+            idx++;
+        }
+        
+        return idx;
+    }
+    
+    const double* x_ptr = x_vec_ptr->data();
+    int max_idx = x_vec_ptr->size() - 2;
+    
+    //  2. uniform axis, compute index directly
+    if (axis_ptr->is_uniform) {
+        double guess = std::ceil((interp_x - x_ptr[0]) * axis_ptr->inverse_dx) - 1;
+        
+        int idx = 0;
+        
+        if (guess > max_idx) {
+            idx = max_idx;
+        }
+        
+        else if (guess > 0) {
+            idx = (int)guess;
+        }
+        
+        while (idx > 0 and interp_x <= x_ptr[idx]) {
+            idx--;
+        }
+        
+        while (idx < max_idx and interp_x > x_ptr[idx + 1]) {
+            idx++;
+        }
+        
+        return idx;
+    }
+    
+    //  3. non-uniform axis, check hint (and its successor)
+    int idx = *hint_idx_ptr;
+    
+    for (int i = 0; i < 2; i++) {
+        if (
+            idx <= max_idx and
+            interp_x <= x_ptr[idx + 1] and
+            (idx == 0 or interp_x > x_ptr[idx])
+        ) {
+            *hint_idx_ptr = idx;
+            return idx;
+        }
+        
         idx++;
     }
     
+    //  4. non-uniform axis, binary search
+    idx = std::lower_bound(x_ptr + 1, x_ptr + max_idx + 2, interp_x) - (x_ptr + 1);
+    
+    if (idx > max_idx) {
+        idx = max_idx;
+    }
+    
+    *hint_idx_ptr = idx;
+    
     return idx;
 }   /* __getInterpolationIndex() */
 
@@ -358,46 +628,52 @@ int Interpolator :: __getInterpolationIndex(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn std::vector<std::string> Interpolator :: __splitCommaSeparatedString(
-///         std::string str,
-///         std::string break_str
-///     )
-///
-/// \brief Helper method to split a comma-separated string into a vector of substrings.
+/// \fn std::string Interpolator :: __readDataBuffer(std::string path_2_data)
 ///
-/// \param str The string to be split.
+/// \brief Helper method to read the whole of the given data file into a single
+///     contiguous buffer (which is then parsed in place, see __parseDataLine()).
 ///
-/// \param break_str A string which triggers the function to break. What has been split
-///     up to the point of the break is then returned.
+/// \param path_2_data The path (either relative or absolute) to the given interpolation
+///     data.
 ///
-/// \return A vector of substrings, which follows from splitting the given string in a
-///     comma separated manner.
+/// \return A string holding the raw contents of the given data file.
 ///
 
-std::vector<std::string> Interpolator :: __splitCommaSeparatedString(
-    std::string str,
-    std::string break_str
-)
+std::string Interpolator :: __readDataBuffer(std::string path_2_data)
 {
-    std::vector<std::string> str_split_vec;
-    
-    size_t idx = 0;
-    std::string substr;
+    //  1. create input file stream
+    std::ifstream ifs;
+    ifs.open(path_2_data, std::ios::binary);
     
-    while ((idx = str.find(',')) != std::string::npos) {
-        substr = str.substr(0, idx);
-        
-        if (substr == break_str) {
-            break;
-        }
-        
-        str_split_vec.push_back(substr);
+    //  2. check that open() worked
+    if (not ifs.is_open()) {
+        std::string error_str = "ERROR:  Interpolator::__readDataBuffer()  ";
+        error_str += " failed to open ";
+        error_str += path_2_data;
         
-        str.erase(0, idx + 1);
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  3. read file into buffer (one allocation, sized from the stream)
+    ifs.seekg(0, std::ios::end);
+    std::streamoff n_bytes = ifs.tellg();
+    ifs.seekg(0, std::ios::beg);
+    
+    std::string buffer;
+    
+    if (n_bytes > 0) {
+        buffer.resize(n_bytes);
+        ifs.read(&(buffer[0]), n_bytes);
+        buffer.resize(ifs.gcount());
     }
     
-    return str_split_vec;
-}   /* __splitCommaSeparatedString() */
+    ifs.close();
+    return buffer;
+}   /* __readDataBuffer() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -406,65 +682,124 @@ std::vector<std::string> Interpolator :: __splitCommaSeparatedString(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn std::vector<std::vector<std::string>> Interpolator :: __getDataStringMatrix(
-///         std::string path_2_data
+/// \fn bool Interpolator :: __parseNumber(
+///         const char* first_ptr,
+///         const char* last_ptr,
+///         double* value_ptr
 ///     )
 ///
-/// \brief Helper method to read data into a string matrix (delimiters are commas and
-///     newlines).
+/// \brief Helper method to parse a single numeric cell in place, using
+///     std::from_chars(). Mirrors what std::stod() accepts in a data file (i.e.,
+///     leading whitespace and an optional leading '+' are skipped, and trailing
+///     characters after the number are ignored).
 ///
-/// \param path_2_data The path (either relative or absolute) to the given interpolation
-///     data.
+/// \param first_ptr A pointer to the first character of the cell.
+///
+/// \param last_ptr A pointer to one past the last character of the cell.
 ///
-/// \return A matrix of string values. Each cell corresponds to a single cell (or
-///     element) of a comma separated data file.
+/// \param value_ptr A pointer to where the parsed value is to be written.
+///
+/// \return A boolean indicating whether or not the cell was successfully parsed.
 ///
 
-std::vector<std::vector<std::string>> Interpolator :: __getDataStringMatrix(
-    std::string path_2_data
+bool Interpolator :: __parseNumber(
+    const char* first_ptr,
+    const char* last_ptr,
+    double* value_ptr
 )
 {
-    //  1. create input file stream
-    std::ifstream ifs;
-    ifs.open(path_2_data);
+    while (first_ptr < last_ptr and isspace((unsigned char)(*first_ptr))) {
+        first_ptr++;
+    }
     
-    //  2. check that open() worked
-    if (not ifs.is_open()) {
-        std::string error_str = "ERROR:  Interpolator::__getDataStringMatrix()  ";
-        error_str += " failed to open ";
-        error_str += path_2_data;
-        
-        #ifdef _WIN32
-            std::cout << error_str << std::endl;
-        #endif
-
-        throw std::invalid_argument(error_str);
+    if (
+        first_ptr + 1 < last_ptr and
+        *first_ptr == '+' and
+        *(first_ptr + 1) != '-'
+    ) {
+        first_ptr++;
     }
     
-    //  3. read file line by line
-    bool is_header = true;
-    std::string line;
-    std::vector<std::string> line_split_vec;
-    std::vector<std::vector<std::string>> string_matrix;
+    std::from_chars_result result = std::from_chars(first_ptr, last_ptr, *value_ptr);
+    
+    return result.ec == std::errc();
+}   /* __parseNumber() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn int Interpolator :: __parseDataLine(
+///         const char* line_ptr,
+///         const char* line_end_ptr,
+///         double* label_ptr,
+///         double* value_ptr,
+///         int n_values
+///     )
+///
+/// \brief Helper method to parse a single line of a data file in place. A cell is any
+///     text followed by a comma; the line ends at the first "||" cell (or at the last
+///     comma). Cell 0 is written to label_ptr, and cells 1, ..., n_values are written
+///     to value_ptr[0, ..., n_values - 1]. All other cells are counted, but not parsed.
+///
+/// \param line_ptr A pointer to the first character of the line.
+///
+/// \param line_end_ptr A pointer to one past the last character of the line.
+///
+/// \param label_ptr A pointer to where cell 0 is to be written (NULL to skip).
+///
+/// \param value_ptr A pointer to where cells 1, ..., n_values are to be written (NULL
+///     to skip).
+///
+/// \param n_values The number of cells (after cell 0) to write to value_ptr.
+///
+/// \return The number of cells in the line, or -1 if any parsed cell is non-numeric.
+///
+
+int Interpolator :: __parseDataLine(
+    const char* line_ptr,
+    const char* line_end_ptr,
+    double* label_ptr,
+    double* value_ptr,
+    int n_values
+)
+{
+    int n_cells = 0;
+    const char* cell_ptr = line_ptr;
+    const char* comma_ptr = NULL;
     
-    while (not ifs.eof()) {
-        std::getline(ifs, line);
+    while (cell_ptr < line_end_ptr) {
+        comma_ptr = (const char*)memchr(cell_ptr, ',', line_end_ptr - cell_ptr);
+        
+        if (comma_ptr == NULL) {
+            break;
+        }
         
-        if (is_header) {
-            is_header = false;
-            continue;
+        if (comma_ptr - cell_ptr == 2 and cell_ptr[0] == '|' and cell_ptr[1] == '|') {
+            break;
         }
         
-        line_split_vec = this->__splitCommaSeparatedString(line);
+        if (n_cells == 0 and label_ptr != NULL) {
+            if (not this->__parseNumber(cell_ptr, comma_ptr, label_ptr)) {
+                return -1;
+            }
+        }
         
-        if (not line_split_vec.empty()) {
-            string_matrix.push_back(line_split_vec);
+        else if (n_cells > 0 and n_cells <= n_values and value_ptr != NULL) {
+            if (not this->__parseNumber(cell_ptr, comma_ptr, value_ptr + n_cells - 1)) {
+                return -1;
+            }
         }
+        
+        n_cells++;
+        cell_ptr = comma_ptr + 1;
     }
     
-    ifs.close();
-    return string_matrix;
-}   /* __getDataStringMatrix() */
+    return n_cells;
+}   /* __parseDataLine() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -485,34 +820,88 @@ std::vector<std::vector<std::string>> Interpolator :: __getDataStringMatrix(
 
 void Interpolator :: __readData1D(int data_key, std::string path_2_data)
 {
-    //  1. get string matrix
-    std::vector<std::vector<std::string>> string_matrix =
-        this->__getDataStringMatrix(path_2_data);
+    //  1. read data file into a single buffer
+    std::string buffer = this->__readDataBuffer(path_2_data);
+    
+    //  2. check table cache, keyed on the buffer (if hit, share cached table)
+    InterpolatorTableCache& table_cache = InterpolatorTableCache :: getInstance();
+    
+    std::string table_key = table_cache.getTableKey(path_2_data, buffer);
+    std::shared_ptr<const InterpolatorStruct1D> table_ptr = table_cache.get1D(table_key);
+    
+    if (table_ptr) {
+        this->interp_map_1D.insert(
+            std::pair<int, std::shared_ptr<const InterpolatorStruct1D>>(
+                data_key,
+                table_ptr
+            )
+        );
+        
+        return;
+    }
+    
+    //  3. skip header line
+    const char* line_ptr = buffer.data();
+    const char* buffer_end_ptr = buffer.data() + buffer.size();
+    const char* line_end_ptr = NULL;
+    
+    line_end_ptr = (const char*)memchr(line_ptr, '\n', buffer_end_ptr - line_ptr);
+    line_ptr = (line_end_ptr == NULL) ? buffer_end_ptr : line_end_ptr + 1;
 
-    //  2. read string matrix contents into 1D interpolation struct
+    //  4. parse buffer line by line, straight into 1D interpolation struct
     InterpolatorStruct1D interp_struct_1D;
     
-    interp_struct_1D.n_points = string_matrix.size();
-    interp_struct_1D.x_vec.resize(interp_struct_1D.n_points, 0);
-    interp_struct_1D.y_vec.resize(interp_struct_1D.n_points, 0);
+    size_t n_lines = std::count(line_ptr, buffer_end_ptr, '\n') + 1;
+    interp_struct_1D.x_vec.reserve(n_lines);
+    interp_struct_1D.y_vec.reserve(n_lines);
     
-    for (int i = 0; i < interp_struct_1D.n_points; i++) {
-        try {
-            interp_struct_1D.x_vec[i] = std::stod(string_matrix[i][0]);
-            interp_struct_1D.y_vec[i] = std::stod(string_matrix[i][1]);
+    int n_cells = 0;
+    double x = 0;
+    double y = 0;
+    
+    while (line_ptr < buffer_end_ptr) {
+        line_end_ptr = (const char*)memchr(line_ptr, '\n', buffer_end_ptr - line_ptr);
+        
+        if (line_end_ptr == NULL) {
+            line_end_ptr = buffer_end_ptr;
         }
         
-        catch (...) {
+        n_cells = this->__parseDataLine(line_ptr, line_end_ptr, &x, &y, 1);
+        
+        if (n_cells < 0 or n_cells == 1) {
             this->__throwReadError(path_2_data, 1);
         }
+        
+        if (n_cells > 0) {
+            interp_struct_1D.x_vec.push_back(x);
+            interp_struct_1D.y_vec.push_back(y);
+        }
+        
+        line_ptr = line_end_ptr + 1;
+    }
+    
+    interp_struct_1D.n_points = interp_struct_1D.x_vec.size();
+    
+    if (interp_struct_1D.n_points <= 0) {
+        this->__throwReadError(path_2_data, 1);
     }
     
     interp_struct_1D.min_x = interp_struct_1D.x_vec[0];
     interp_struct_1D.max_x = interp_struct_1D.x_vec[interp_struct_1D.n_points - 1];
     
-    //  3. write struct to map
-    this->interp_map_1D.insert(
-        std::pair<int, InterpolatorStruct1D>(data_key, interp_struct_1D)
+    interp_struct_1D.x_axis = this->__getInterpolatorAxis(&(interp_struct_1D.x_vec));
+    
+    //  5. write struct to table cache and map
+    table_ptr = table_cache.insert1D(
+        table_key,
+        std::make_shared<const InterpolatorStruct1D>(std::move(interp_struct_1D))
+    );
+    
+    this->interp_map_1D.insert(
+        std::pair<int, std::shared_ptr<const InterpolatorStruct1D>>(
+            data_key,
+            table_ptr
+        )
     );
     
     /*
@@ -521,25 +910,25 @@ void Interpolator :: __readData1D(int data_key, std::string path_2_data)
     std::cout << path_2_data << std::endl;
     std::cout << "--------" << std::endl;
     
-    std::cout << "n_points: " << this->interp_map_1D[data_key].n_points << std::endl;
+    std::cout << "n_points: " << this->interp_map_1D[data_key]->n_points << std::endl;
     
     std::cout << "x_vec: [";
     for (
         int i = 0;
-        i < this->interp_map_1D[data_key].n_points;
+        i < this->interp_map_1D[data_key]->n_points;
         i++
     ) {
-        std::cout << this->interp_map_1D[data_key].x_vec[i] << ", ";
+        std::cout << this->interp_map_1D[data_key]->x_vec[i] << ", ";
     }
     std::cout << "]" << std::endl;
     
     std::cout << "y_vec: [";
     for (
         int i = 0;
-        i < this->interp_map_1D[data_key].n_points;
+        i < this->interp_map_1D[data_key]->n_points;
         i++
     ) {
-        std::cout << this->interp_map_1D[data_key].y_vec[i] << ", ";
+        std::cout << this->interp_map_1D[data_key]->y_vec[i] << ", ";
     }
     std::cout << "]" << std::endl;
     
@@ -569,66 +958,140 @@ void Interpolator :: __readData1D(int data_key, std::string path_2_data)
 
 void Interpolator :: __readData2D(int data_key, std::string path_2_data)
 {
-    //  1. get string matrix
-    std::vector<std::vector<std::string>> string_matrix =
-        this->__getDataStringMatrix(path_2_data);
-
-    //  2. read string matrix contents into 2D interpolation map
-    InterpolatorStruct2D interp_struct_2D;
+    //  1. read data file into a single buffer
+    std::string buffer = this->__readDataBuffer(path_2_data);
+    
+    //  2. check table cache, keyed on the buffer (if hit, share cached table)
+    InterpolatorTableCache& table_cache = InterpolatorTableCache :: getInstance();
+    
+    std::string table_key = table_cache.getTableKey(path_2_data, buffer);
+    std::shared_ptr<const InterpolatorStruct2D> table_ptr = table_cache.get2D(table_key);
+    
+    if (table_ptr) {
+        this->interp_map_2D.insert(
+            std::pair<int, std::shared_ptr<const InterpolatorStruct2D>>(
+                data_key,
+                table_ptr
+            )
+        );
+        
+        return;
+    }
+    
+    //  3. skip header line
+    const char* line_ptr = buffer.data();
+    const char* buffer_end_ptr = buffer.data() + buffer.size();
+    const char* line_end_ptr = NULL;
     
-    interp_struct_2D.n_rows = string_matrix.size() - 1;
-    interp_struct_2D.n_cols = string_matrix[0].size() - 1;
+    line_end_ptr = (const char*)memchr(line_ptr, '\n', buffer_end_ptr - line_ptr);
+    line_ptr = (line_end_ptr == NULL) ? buffer_end_ptr : line_end_ptr + 1;
     
-    interp_struct_2D.x_vec.resize(interp_struct_2D.n_cols, 0);
-    interp_struct_2D.y_vec.resize(interp_struct_2D.n_rows, 0);
+    //  4. parse buffer line by line, straight into 2D interpolation struct
+    //     (first non-empty line is the x row, subsequent lines are y and z rows)
+    InterpolatorStruct2D interp_struct_2D;
     
-    interp_struct_2D.z_matrix.resize(interp_struct_2D.n_rows, {});
+    interp_struct_2D.n_rows = 0;
+    interp_struct_2D.n_cols = 0;
     
-    for (int i = 0; i < interp_struct_2D.n_rows; i++) {
-        interp_struct_2D.z_matrix[i].resize(interp_struct_2D.n_cols, 0);
-    }
+    size_t n_lines = std::count(line_ptr, buffer_end_ptr, '\n') + 1;
+    interp_struct_2D.y_vec.reserve(n_lines);
     
-    for (size_t i = 1; i < string_matrix[0].size(); i++) {
-        try {
-            interp_struct_2D.x_vec[i - 1] = std::stod(string_matrix[0][i]);
+    bool is_x_row = true;
+    int n_cells = 0;
+    double y = 0;
+    size_t z_idx = 0;
+    
+    while (line_ptr < buffer_end_ptr) {
+        line_end_ptr = (const char*)memchr(line_ptr, '\n', buffer_end_ptr - line_ptr);
+        
+        if (line_end_ptr == NULL) {
+            line_end_ptr = buffer_end_ptr;
         }
         
-        catch (...) {
-            this->__throwReadError(path_2_data, 2);
+        //  3.1. x row (count cells, then parse straight into x_vec)
+        if (is_x_row) {
+            n_cells = this->__parseDataLine(line_ptr, line_end_ptr, NULL, NULL, 0);
+            
+            if (n_cells > 0) {
+                if (n_cells == 1) {
+                    this->__throwReadError(path_2_data, 2);
+                }
+                
+                interp_struct_2D.n_cols = n_cells - 1;
+                interp_struct_2D.x_vec.resize(interp_struct_2D.n_cols, 0);
+                interp_struct_2D.z_vec.reserve(n_lines * interp_struct_2D.n_cols);
+                
+                n_cells = this->__parseDataLine(
+                    line_ptr,
+                    line_end_ptr,
+                    NULL,
+                    interp_struct_2D.x_vec.data(),
+                    interp_struct_2D.n_cols
+                );
+                
+                if (n_cells < 0) {
+                    this->__throwReadError(path_2_data, 2);
+                }
+                
+                is_x_row = false;
+            }
         }
+        
+        //  3.2. y and z rows (parse straight into the end of z_vec)
+        else {
+            z_idx = interp_struct_2D.z_vec.size();
+            interp_struct_2D.z_vec.resize(z_idx + interp_struct_2D.n_cols, 0);
+            
+            n_cells = this->__parseDataLine(
+                line_ptr,
+                line_end_ptr,
+                &y,
+                interp_struct_2D.z_vec.data() + z_idx,
+                interp_struct_2D.n_cols
+            );
+            
+            if (n_cells < 0 or (n_cells > 0 and n_cells <= interp_struct_2D.n_cols)) {
+                this->__throwReadError(path_2_data, 2);
+            }
+            
+            if (n_cells == 0) {
+                interp_struct_2D.z_vec.resize(z_idx);
+            }
+            
+            else {
+                interp_struct_2D.y_vec.push_back(y);
+                interp_struct_2D.n_rows++;
+            }
+        }
+        
+        line_ptr = line_end_ptr + 1;
+    }
+    
+    if (interp_struct_2D.n_rows <= 0 or interp_struct_2D.n_cols <= 0) {
+        this->__throwReadError(path_2_data, 2);
     }
     
     interp_struct_2D.min_x = interp_struct_2D.x_vec[0];
     interp_struct_2D.max_x = interp_struct_2D.x_vec[interp_struct_2D.n_cols - 1];
     
-    for (size_t i = 1; i < string_matrix.size(); i++) {
-        try {
-            interp_struct_2D.y_vec[i - 1] = std::stod(string_matrix[i][0]);
-        }
-        
-        catch (...) {
-            this->__throwReadError(path_2_data, 2);
-        }
-    }
+    interp_struct_2D.x_axis = this->__getInterpolatorAxis(&(interp_struct_2D.x_vec));
     
     interp_struct_2D.min_y = interp_struct_2D.y_vec[0];
     interp_struct_2D.max_y = interp_struct_2D.y_vec[interp_struct_2D.n_rows - 1];
     
-    for (size_t i = 1; i < string_matrix.size(); i++) {
-        for (size_t j = 1; j < string_matrix[0].size(); j++) {
-            try {
-                interp_struct_2D.z_matrix[i - 1][j - 1] = std::stod(string_matrix[i][j]);
-            }
-            
-            catch (...) {
-                this->__throwReadError(path_2_data, 2);
-            }
-        }
-    }
+    interp_struct_2D.y_axis = this->__getInterpolatorAxis(&(interp_struct_2D.y_vec));
+    
+    //  5. write struct to table cache and map
+    table_ptr = table_cache.insert2D(
+        table_key,
+        std::make_shared<const InterpolatorStruct2D>(std::move(interp_struct_2D))
+    );
     
-    //  3. write struct to map
     this->interp_map_2D.insert(
-        std::pair<int, InterpolatorStruct2D>(data_key, interp_struct_2D)
+        std::pair<int, std::shared_ptr<const InterpolatorStruct2D>>(
+            data_key,
+            table_ptr
+        )
     );
     
     /*
@@ -637,43 +1100,45 @@ void Interpolator :: __readData2D(int data_key, std::string path_2_data)
     std::cout << path_2_data << std::endl;
     std::cout << "--------" << std::endl;
     
-    std::cout << "n_rows: " << this->interp_map_2D[data_key].n_rows << std::endl;
-    std::cout << "n_cols: " << this->interp_map_2D[data_key].n_cols << std::endl;
+    std::cout << "n_rows: " << this->interp_map_2D[data_key]->n_rows << std::endl;
+    std::cout << "n_cols: " << this->interp_map_2D[data_key]->n_cols << std::endl;
     
     std::cout << "x_vec: [";
     for (
         int i = 0;
-        i < this->interp_map_2D[data_key].n_cols;
+        i < this->interp_map_2D[data_key]->n_cols;
         i++
     ) {
-        std::cout << this->interp_map_2D[data_key].x_vec[i] << ", ";
+        std::cout << this->interp_map_2D[data_key]->x_vec[i] << ", ";
     }
     std::cout << "]" << std::endl;
     
     std::cout << "y_vec: [";
     for (
         int i = 0;
-        i < this->interp_map_2D[data_key].n_rows;
+        i < this->interp_map_2D[data_key]->n_rows;
         i++
     ) {
-        std::cout << this->interp_map_2D[data_key].y_vec[i] << ", ";
+        std::cout << this->interp_map_2D[data_key]->y_vec[i] << ", ";
     }
     std::cout << "]" << std::endl;
     
     std::cout << "z_matrix:" << std::endl;
     for (
         int i = 0;
-        i < this->interp_map_2D[data_key].n_rows;
+        i < this->interp_map_2D[data_key]->n_rows;
         i++
     ) {
         std::cout << "\t[";
         
         for (
             int j = 0;
-            j < this->interp_map_2D[data_key].n_cols;
+            j < this->interp_map_2D[data_key]->n_cols;
             j++
         ) {
-            std::cout << this->interp_map_2D[data_key].z_matrix[i][j] << ", ";
+            std::cout << this->interp_map_2D[data_key]->z_vec[
+                i * this->interp_map_2D[data_key]->n_cols + j
+            ] << ", ";
         }
         
         std::cout << "]" << std::endl;
@@ -689,6 +1154,399 @@ void Interpolator :: __readData2D(int data_key, std::string path_2_data)
 
 // ---------------------------------------------------------------------------------- //
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Interpolator :: __interp1D(
+///         const InterpolatorStruct1D* interp_struct_1D_ptr,
+///         double interp_x
+///     )
+///
+/// \brief Helper method to perform a 1D interpolation on the given data.
+///
+/// \param handle_idx The (checked) index of a handle to the given interpolation data.
+///
+/// \param interp_x The query value to be interpolated.
+///
+/// \return An interpolation of the given query value.
+///
+
+double Interpolator :: __interp1D(int handle_idx, double interp_x)
+{
+    const InterpolatorStruct1D* interp_struct_1D_ptr =
+        this->handle_ptr_vec_1D[handle_idx].get();
+    
+    //  1. check bounds
+    this->__checkBounds1D(interp_struct_1D_ptr, interp_x);
+    
+    //  2. get interpolation index
+    int idx = this->__getInterpolationIndex(
+        interp_x,
+        &(interp_struct_1D_ptr->x_vec),
+        &(interp_struct_1D_ptr->x_axis),
+        &(this->hint_vec_1D[handle_idx])
+    );
+    
+    //  3. perform interpolation
+    const double* x_ptr = interp_struct_1D_ptr->x_vec.data();
+    const double* y_ptr = interp_struct_1D_ptr->y_vec.data();
+    
+    double x_0 = x_ptr[idx];
+    double x_1 = x_ptr[idx + 1];
+    
+    double y_0 = y_ptr[idx];
+    double y_1 = y_ptr[idx + 1];
+    
+    double interp_y = ((y_1 - y_0) / (x_1 - x_0)) * (interp_x - x_0) + y_0;
+    
+    return interp_y;
+}   /* __interp1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Interpolator :: __interp2D(
+///         const InterpolatorStruct2D* interp_struct_2D_ptr,
+///         double interp_x,
+///         double interp_y
+///     )
+///
+/// \brief Helper method to perform a 2D interpolation on the given data.
+///
+/// \param handle_idx The (checked) index of a handle to the given interpolation data.
+///
+/// \param interp_x The first query value to be interpolated.
+///
+/// \param interp_y The second query value to be interpolated.
+///
+/// \return An interpolation of the given query values.
+///
+
+double Interpolator :: __interp2D(
+    int handle_idx,
+    double interp_x,
+    double interp_y
+)
+{
+    const InterpolatorStruct2D* interp_struct_2D_ptr =
+        this->handle_ptr_vec_2D[handle_idx].get();
+    
+    //  1. check bounds
+    this->__checkBounds2D(interp_struct_2D_ptr, interp_x, interp_y);
+    
+    //  2. get interpolation indices
+    int idx_x = this->__getInterpolationIndex(
+        interp_x,
+        &(interp_struct_2D_ptr->x_vec),
+        &(interp_struct_2D_ptr->x_axis),
+        &(this->hint_x_vec_2D[handle_idx])
+    );
+    
+    int idx_y = this->__getInterpolationIndex(
+        interp_y,
+        &(interp_struct_2D_ptr->y_vec),
+        &(interp_struct_2D_ptr->y_axis),
+        &(this->hint_y_vec_2D[handle_idx])
+    );
+    
+    const double* x_ptr = interp_struct_2D_ptr->x_vec.data();
+    const double* y_ptr = interp_struct_2D_ptr->y_vec.data();
+    const double* z_row_0_ptr =
+        interp_struct_2D_ptr->z_vec.data() + idx_y * interp_struct_2D_ptr->n_cols;
+    const double* z_row_1_ptr = z_row_0_ptr + interp_struct_2D_ptr->n_cols;
+    
+    //  3. perform first horizontal interpolation
+    double x_0 = x_ptr[idx_x];
+    double x_1 = x_ptr[idx_x + 1];
+    
+    double z_0 = z_row_0_ptr[idx_x];
+    double z_1 = z_row_0_ptr[idx_x + 1];
+    
+    double interp_z_0 = ((z_1 - z_0) / (x_1 - x_0)) * (interp_x - x_0) + z_0;
+    
+    //  4. perform second horizontal interpolation
+    z_0 = z_row_1_ptr[idx_x];
+    z_1 = z_row_1_ptr[idx_x + 1];
+    
+    double interp_z_1 = ((z_1 - z_0) / (x_1 - x_0)) * (interp_x - x_0) + z_0;
+    
+    //  5. perform vertical interpolation
+    double y_0 = y_ptr[idx_y];
+    double y_1 = y_ptr[idx_y + 1];
+    
+    double interp_z =
+        ((interp_z_1 - interp_z_0) / (y_1 - y_0)) * (interp_y - y_0) + interp_z_0;
+    
+    return interp_z;
+}   /* __interp2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: __interp1DBatch(
+///         const InterpolatorStruct1D* interp_struct_1D_ptr,
+///         const double* interp_x_ptr,
+///         double* interp_y_ptr,
+///         size_t n
+///     )
+///
+/// \brief Helper method to perform a batch of 1D interpolations on the given data.
+///
+/// This is done in two passes: first, all queries are bounds checked and their
+/// interpolation indices found (in order, so the search hint behaves exactly as it
+/// would for repeated calls to __interp1D()), and then the interpolation arithmetic is
+/// done over the whole batch. If built with AVX2 enabled (e.g., -mavx2), the second
+/// pass gathers and interpolates four queries at a time. Either way, the arithmetic is
+/// that of __interp1D() (no fused multiply-add), so results are bit-for-bit the same.
+///
+/// \param handle_idx The (checked) index of a handle to the given interpolation data.
+///
+/// \param interp_x_ptr A pointer to the first of n query values.
+///
+/// \param interp_y_ptr A pointer to the first of n interpolated values (output).
+///
+/// \param n The number of queries.
+///
+
+void Interpolator :: __interp1DBatch(
+    int handle_idx,
+    const double* interp_x_ptr,
+    double* interp_y_ptr,
+    size_t n
+)
+{
+    const InterpolatorStruct1D* interp_struct_1D_ptr =
+        this->handle_ptr_vec_1D[handle_idx].get();
+    
+    //  1. check bounds and get interpolation indices
+    std::vector<int> idx_vec(n, 0);
+    
+    for (size_t i = 0; i < n; i++) {
+        this->__checkBounds1D(interp_struct_1D_ptr, interp_x_ptr[i]);
+        
+        idx_vec[i] = this->__getInterpolationIndex(
+            interp_x_ptr[i],
+            &(interp_struct_1D_ptr->x_vec),
+            &(interp_struct_1D_ptr->x_axis),
+            &(this->hint_vec_1D[handle_idx])
+        );
+    }
+    
+    //  2. perform interpolations
+    const int* idx_ptr = idx_vec.data();
+    const double* x_ptr = interp_struct_1D_ptr->x_vec.data();
+    const double* y_ptr = interp_struct_1D_ptr->y_vec.data();
+    
+    size_t i = 0;
+    
+    #ifdef __AVX2__
+        for (; i + 4 <= n; i += 4) {
+            __m128i idx = _mm_loadu_si128((const __m128i*)(idx_ptr + i));
+            
+            __m256d x_0 = gatherPD(x_ptr, idx);
+            __m256d x_1 = gatherPD(x_ptr + 1, idx);
+            
+            __m256d y_0 = gatherPD(y_ptr, idx);
+            __m256d y_1 = gatherPD(y_ptr + 1, idx);
+            
+            __m256d slope = _mm256_div_pd(
+                _mm256_sub_pd(y_1, y_0),
+                _mm256_sub_pd(x_1, x_0)
+            );
+            
+            __m256d interp_y = _mm256_add_pd(
+                _mm256_mul_pd(
+                    slope,
+                    _mm256_sub_pd(_mm256_loadu_pd(interp_x_ptr + i), x_0)
+                ),
+                y_0
+            );
+            
+            _mm256_storeu_pd(interp_y_ptr + i, interp_y);
+        }
+    #endif  /* __AVX2__ */
+    
+    for (; i < n; i++) {
+        int idx = idx_ptr[i];
+        
+        double x_0 = x_ptr[idx];
+        double x_1 = x_ptr[idx + 1];
+        
+        double y_0 = y_ptr[idx];
+        double y_1 = y_ptr[idx + 1];
+        
+        interp_y_ptr[i] = ((y_1 - y_0) / (x_1 - x_0)) * (interp_x_ptr[i] - x_0) + y_0;
+    }
+    
+    return;
+}   /* __interp1DBatch() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: __interp2DBatch(
+///         const InterpolatorStruct2D* interp_struct_2D_ptr,
+///         const double* interp_x_ptr,
+///         const double* interp_y_ptr,
+///         double* interp_z_ptr,
+///         size_t n
+///     )
+///
+/// \brief Helper method to perform a batch of 2D interpolations on the given data.
+///
+/// As for __interp1DBatch(), this is done in an index pass and then an arithmetic pass
+/// (four queries at a time if built with AVX2 enabled), and the results are bit-for-bit
+/// the same as those of __interp2D().
+///
+/// \param handle_idx The (checked) index of a handle to the given interpolation data.
+///
+/// \param interp_x_ptr A pointer to the first of n first query values.
+///
+/// \param interp_y_ptr A pointer to the first of n second query values.
+///
+/// \param interp_z_ptr A pointer to the first of n interpolated values (output).
+///
+/// \param n The number of queries.
+///
+
+void Interpolator :: __interp2DBatch(
+    int handle_idx,
+    const double* interp_x_ptr,
+    const double* interp_y_ptr,
+    double* interp_z_ptr,
+    size_t n
+)
+{
+    const InterpolatorStruct2D* interp_struct_2D_ptr =
+        this->handle_ptr_vec_2D[handle_idx].get();
+    
+    //  1. check bounds and get interpolation indices
+    std::vector<int> idx_x_vec(n, 0);
+    std::vector<int> idx_y_vec(n, 0);
+    
+    for (size_t i = 0; i < n; i++) {
+        this->__checkBounds2D(interp_struct_2D_ptr, interp_x_ptr[i], interp_y_ptr[i]);
+        
+        idx_x_vec[i] = this->__getInterpolationIndex(
+            interp_x_ptr[i],
+            &(interp_struct_2D_ptr->x_vec),
+            &(interp_struct_2D_ptr->x_axis),
+            &(this->hint_x_vec_2D[handle_idx])
+        );
+        
+        idx_y_vec[i] = this->__getInterpolationIndex(
+            interp_y_ptr[i],
+            &(interp_struct_2D_ptr->y_vec),
+            &(interp_struct_2D_ptr->y_axis),
+            &(this->hint_y_vec_2D[handle_idx])
+        );
+    }
+    
+    //  2. perform interpolations
+    const int* idx_x_ptr = idx_x_vec.data();
+    const int* idx_y_ptr = idx_y_vec.data();
+    const double* x_ptr = interp_struct_2D_ptr->x_vec.data();
+    const double* y_ptr = interp_struct_2D_ptr->y_vec.data();
+    const double* z_ptr = interp_struct_2D_ptr->z_vec.data();
+    int n_cols = interp_struct_2D_ptr->n_cols;
+    
+    size_t i = 0;
+    
+    #ifdef __AVX2__
+        __m128i n_cols_4 = _mm_set1_epi32(n_cols);
+        
+        for (; i + 4 <= n; i += 4) {
+            __m128i idx_x = _mm_loadu_si128((const __m128i*)(idx_x_ptr + i));
+            __m128i idx_y = _mm_loadu_si128((const __m128i*)(idx_y_ptr + i));
+            __m128i idx_z = _mm_add_epi32(_mm_mullo_epi32(idx_y, n_cols_4), idx_x);
+            
+            __m256d interp_x = _mm256_loadu_pd(interp_x_ptr + i);
+            __m256d interp_y = _mm256_loadu_pd(interp_y_ptr + i);
+            
+            __m256d x_0 = gatherPD(x_ptr, idx_x);
+            __m256d x_1 = gatherPD(x_ptr + 1, idx_x);
+            __m256d dx = _mm256_sub_pd(x_1, x_0);
+            __m256d delta_x = _mm256_sub_pd(interp_x, x_0);
+            
+            //  2.1. first horizontal interpolation
+            __m256d z_0 = gatherPD(z_ptr, idx_z);
+            __m256d z_1 = gatherPD(z_ptr + 1, idx_z);
+            
+            __m256d interp_z_0 = _mm256_add_pd(
+                _mm256_mul_pd(_mm256_div_pd(_mm256_sub_pd(z_1, z_0), dx), delta_x),
+                z_0
+            );
+            
+            //  2.2. second horizontal interpolation
+            z_0 = gatherPD(z_ptr + n_cols, idx_z);
+            z_1 = gatherPD(z_ptr + n_cols + 1, idx_z);
+            
+            __m256d interp_z_1 = _mm256_add_pd(
+                _mm256_mul_pd(_mm256_div_pd(_mm256_sub_pd(z_1, z_0), dx), delta_x),
+                z_0
+            );
+            
+            //  2.3. vertical interpolation
+            __m256d y_0 = gatherPD(y_ptr, idx_y);
+            __m256d y_1 = gatherPD(y_ptr + 1, idx_y);
+            
+            __m256d interp_z = _mm256_add_pd(
+                _mm256_mul_pd(
+                    _mm256_div_pd(
+                        _mm256_sub_pd(interp_z_1, interp_z_0),
+                        _mm256_sub_pd(y_1, y_0)
+                    ),
+                    _mm256_sub_pd(interp_y, y_0)
+                ),
+                interp_z_0
+            );
+            
+            _mm256_storeu_pd(interp_z_ptr + i, interp_z);
+        }
+    #endif  /* __AVX2__ */
+    
+    for (; i < n; i++) {
+        int idx_x = idx_x_ptr[i];
+        int idx_y = idx_y_ptr[i];
+        
+        const double* z_row_0_ptr = z_ptr + idx_y * n_cols;
+        const double* z_row_1_ptr = z_row_0_ptr + n_cols;
+        
+        double x_0 = x_ptr[idx_x];
+        double x_1 = x_ptr[idx_x + 1];
+        
+        double z_0 = z_row_0_ptr[idx_x];
+        double z_1 = z_row_0_ptr[idx_x + 1];
+        
+        double interp_z_0 = ((z_1 - z_0) / (x_1 - x_0)) * (interp_x_ptr[i] - x_0) + z_0;
+        
+        z_0 = z_row_1_ptr[idx_x];
+        z_1 = z_row_1_ptr[idx_x + 1];
+        
+        double interp_z_1 = ((z_1 - z_0) / (x_1 - x_0)) * (interp_x_ptr[i] - x_0) + z_0;
+        
+        double y_0 = y_ptr[idx_y];
+        double y_1 = y_ptr[idx_y + 1];
+        
+        interp_z_ptr[i] = ((interp_z_1 - interp_z_0) / (y_1 - y_0)) *
+            (interp_y_ptr[i] - y_0) + interp_z_0;
+    }
+    
+    return;
+}   /* __interp2DBatch() */
+
+// ---------------------------------------------------------------------------------- //
+
 // ======== END PRIVATE ============================================================= //
 
 
@@ -779,39 +1637,223 @@ void Interpolator :: addData2D(int data_key, std::string path_2_data)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Interpolator :: interp1D(int data_key, double interp_x)
+/// \fn void Interpolator :: addData1D(
+///         int data_key,
+///         InterpolatorStruct1D interp_struct_1D
+///     )
 ///
-/// \brief Method to perform a 1D interpolation.
+/// \brief Method to add 1D interpolation data, given directly (rather than read from
+///     file), to the Interpolator. The search properties of the data are computed here.
+///     Data given directly is not shared with other Interpolators.
 ///
 /// \param data_key A key used to index into the Interpolator.
 ///
-/// \param interp_x The query value to be interpolated. If this value is outside the
-///     domain of the associated interpolation data, then an error will occur.
+/// \param interp_struct_1D The given 1D interpolation data.
 ///
-/// \return An interpolation of the given query value.
+
+void Interpolator :: addData1D(int data_key, InterpolatorStruct1D interp_struct_1D)
+{
+    //  1. check key
+    this->__checkDataKey1D(data_key);
+    
+    //  2. get search properties
+    interp_struct_1D.x_axis = this->__getInterpolatorAxis(&(interp_struct_1D.x_vec));
+    
+    //  3. write struct to map
+    this->interp_map_1D.insert(
+        std::pair<int, std::shared_ptr<const InterpolatorStruct1D>>(
+            data_key,
+            std::make_shared<const InterpolatorStruct1D>(std::move(interp_struct_1D))
+        )
+    );
+    
+    return;
+}   /* addData1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: addData2D(
+///         int data_key,
+///         InterpolatorStruct2D interp_struct_2D
+///     )
+///
+/// \brief Method to add 2D interpolation data, given directly (rather than read from
+///     file), to the Interpolator. The search properties of the data are computed here.
+///     Data given directly is not shared with other Interpolators.
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param interp_struct_2D The given 2D interpolation data.
 ///
 
-double Interpolator :: interp1D(int data_key, double interp_x)
+void Interpolator :: addData2D(int data_key, InterpolatorStruct2D interp_struct_2D)
 {
-    //  1. check bounds
-    this->__checkBounds1D(data_key, interp_x);
+    //  1. check key
+    this->__checkDataKey2D(data_key);
     
-    //  2. get interpolation index
-    int idx = this->__getInterpolationIndex(
-        interp_x,
-        &(this->interp_map_1D[data_key].x_vec)
+    //  2. get search properties
+    interp_struct_2D.x_axis = this->__getInterpolatorAxis(&(interp_struct_2D.x_vec));
+    interp_struct_2D.y_axis = this->__getInterpolatorAxis(&(interp_struct_2D.y_vec));
+    
+    //  3. write struct to map
+    this->interp_map_2D.insert(
+        std::pair<int, std::shared_ptr<const InterpolatorStruct2D>>(
+            data_key,
+            std::make_shared<const InterpolatorStruct2D>(std::move(interp_struct_2D))
+        )
     );
     
-    //  3. perform interpolation
-    double x_0 = this->interp_map_1D[data_key].x_vec[idx];
-    double x_1 = this->interp_map_1D[data_key].x_vec[idx + 1];
+    return;
+}   /* addData2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorHandle1D Interpolator :: getHandle1D(int data_key)
+///
+/// \brief Method to resolve the given 1D interpolation data to a handle, through which
+///     it can then be interpolated with no map lookups. Requesting a handle for the
+///     same data key more than once returns the same handle.
+///
+/// A handle holds (a reference to) the data that the data key refers to when the
+/// handle is first issued, along with its own search hints.
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \return A handle to the given 1D interpolation data.
+///
+
+InterpolatorHandle1D Interpolator :: getHandle1D(int data_key)
+{
+    //  1. return existing handle, if any
+    InterpolatorHandle1D handle;
     
-    double y_0 = this->interp_map_1D[data_key].y_vec[idx];
-    double y_1 = this->interp_map_1D[data_key].y_vec[idx + 1];
+    std::map<int, int>::iterator handle_iter = this->handle_map_1D.find(data_key);
     
-    double interp_y = ((y_1 - y_0) / (x_1 - x_0)) * (interp_x - x_0) + y_0;
+    if (handle_iter != this->handle_map_1D.end()) {
+        handle.idx = handle_iter->second;
+        return handle;
+    }
     
-    return interp_y;
+    //  2. check key
+    std::map<int, std::shared_ptr<const InterpolatorStruct1D>>::iterator data_iter =
+        this->interp_map_1D.find(data_key);
+    
+    if (data_iter == this->interp_map_1D.end()) {
+        std::string error_str = "ERROR:  Interpolator::getHandle1D()  ";
+        error_str += "data key ";
+        error_str += std::to_string(data_key);
+        error_str += " has not been registered";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  3. issue new handle
+    handle.idx = this->handle_ptr_vec_1D.size();
+    
+    this->handle_map_1D.insert(std::pair<int, int>(data_key, handle.idx));
+    this->handle_ptr_vec_1D.push_back(data_iter->second);
+    this->hint_vec_1D.push_back(0);
+    
+    return handle;
+}   /* getHandle1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorHandle2D Interpolator :: getHandle2D(int data_key)
+///
+/// \brief Method to resolve the given 2D interpolation data to a handle, through which
+///     it can then be interpolated with no map lookups. Requesting a handle for the
+///     same data key more than once returns the same handle.
+///
+/// A handle holds (a reference to) the data that the data key refers to when the
+/// handle is first issued, along with its own search hints.
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \return A handle to the given 2D interpolation data.
+///
+
+InterpolatorHandle2D Interpolator :: getHandle2D(int data_key)
+{
+    //  1. return existing handle, if any
+    InterpolatorHandle2D handle;
+    
+    std::map<int, int>::iterator handle_iter = this->handle_map_2D.find(data_key);
+    
+    if (handle_iter != this->handle_map_2D.end()) {
+        handle.idx = handle_iter->second;
+        return handle;
+    }
+    
+    //  2. check key
+    std::map<int, std::shared_ptr<const InterpolatorStruct2D>>::iterator data_iter =
+        this->interp_map_2D.find(data_key);
+    
+    if (data_iter == this->interp_map_2D.end()) {
+        std::string error_str = "ERROR:  Interpolator::getHandle2D()  ";
+        error_str += "data key ";
+        error_str += std::to_string(data_key);
+        error_str += " has not been registered";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  3. issue new handle
+    handle.idx = this->handle_ptr_vec_2D.size();
+    
+    this->handle_map_2D.insert(std::pair<int, int>(data_key, handle.idx));
+    this->handle_ptr_vec_2D.push_back(data_iter->second);
+    this->hint_x_vec_2D.push_back(0);
+    this->hint_y_vec_2D.push_back(0);
+    
+    return handle;
+}   /* getHandle2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Interpolator :: interp1D(int data_key, double interp_x)
+///
+/// \brief Method to perform a 1D interpolation.
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param interp_x The query value to be interpolated. If this value is outside the
+///     domain of the associated interpolation data, then an error will occur.
+///
+/// \return An interpolation of the given query value.
+///
+
+double Interpolator :: interp1D(int data_key, double interp_x)
+{
+    return this->__interp1D(this->__getHandleIdx1D(data_key), interp_x);
 }   /* interp1D() */
 
 // ---------------------------------------------------------------------------------- //
@@ -838,44 +1880,261 @@ double Interpolator :: interp1D(int data_key, double interp_x)
 
 double Interpolator :: interp2D(int data_key, double interp_x, double interp_y)
 {
-    //  1. check bounds
-    this->__checkBounds2D(data_key, interp_x, interp_y);
-    
-    //  2. get interpolation indices
-    int idx_x = this->__getInterpolationIndex(
-        interp_x,
-        &(this->interp_map_2D[data_key].x_vec)
-    );
-    
-    int idx_y = this->__getInterpolationIndex(
-        interp_y,
-        &(this->interp_map_2D[data_key].y_vec)
-    );
-    
-    //  3. perform first horizontal interpolation
-    double x_0 = this->interp_map_2D[data_key].x_vec[idx_x];
-    double x_1 = this->interp_map_2D[data_key].x_vec[idx_x + 1];
+    return this->__interp2D(this->__getHandleIdx2D(data_key), interp_x, interp_y);
+}   /* interp2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Interpolator :: interp1D(InterpolatorHandle1D handle, double interp_x)
+///
+/// \brief Method to perform a 1D interpolation through a handle (see getHandle1D()).
+///
+/// \param handle A handle to the given 1D interpolation data.
+///
+/// \param interp_x The query value to be interpolated. If this value is outside the
+///     domain of the associated interpolation data, then an error will occur.
+///
+/// \return An interpolation of the given query value.
+///
+
+double Interpolator :: interp1D(InterpolatorHandle1D handle, double interp_x)
+{
+    this->__checkHandle1D(handle);
     
-    double z_0 = this->interp_map_2D[data_key].z_matrix[idx_y][idx_x];
-    double z_1 = this->interp_map_2D[data_key].z_matrix[idx_y][idx_x + 1];
+    return this->__interp1D(handle.idx, interp_x);
+}   /* interp1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Interpolator :: interp2D(
+///         InterpolatorHandle2D handle,
+///         double interp_x,
+///         double interp_y
+///     )
+///
+/// \brief Method to perform a 2D interpolation through a handle (see getHandle2D()).
+///
+/// \param handle A handle to the given 2D interpolation data.
+///
+/// \param interp_x The first query value to be interpolated. If this value is outside
+///     the domain of the associated interpolation data, then an error will occur.
+///
+/// \param interp_y The second query value to be interpolated. If this value is outside
+///     the domain of the associated interpolation data, then an error will occur.
+///
+/// \return An interpolation of the given query values.
+///
+
+double Interpolator :: interp2D(
+    InterpolatorHandle2D handle,
+    double interp_x,
+    double interp_y
+)
+{
+    this->__checkHandle2D(handle);
     
-    double interp_z_0 = ((z_1 - z_0) / (x_1 - x_0)) * (interp_x - x_0) + z_0;
+    return this->__interp2D(handle.idx, interp_x, interp_y);
+}   /* interp2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: interp1DBatch(
+///         int data_key,
+///         const double* interp_x_ptr,
+///         double* interp_y_ptr,
+///         size_t n
+///     )
+///
+/// \brief Method to perform a batch of 1D interpolations (e.g., over a whole time
+///     series). Results are bit-for-bit the same as those of repeated calls to
+///     interp1D().
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param interp_x_ptr A pointer to the first of n query values. If any of these is
+///     outside the domain of the associated interpolation data, then an error will
+///     occur (before any interpolated values are written).
+///
+/// \param interp_y_ptr A pointer to the first of n interpolated values (output).
+///
+/// \param n The number of queries.
+///
+
+void Interpolator :: interp1DBatch(
+    int data_key,
+    const double* interp_x_ptr,
+    double* interp_y_ptr,
+    size_t n
+)
+{
+    this->__interp1DBatch(this->__getHandleIdx1D(data_key), interp_x_ptr, interp_y_ptr, n);
     
-    //  4. perform second horizontal interpolation
-    z_0 = this->interp_map_2D[data_key].z_matrix[idx_y + 1][idx_x];
-    z_1 = this->interp_map_2D[data_key].z_matrix[idx_y + 1][idx_x + 1];
+    return;
+}   /* interp1DBatch() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: interp2DBatch(
+///         int data_key,
+///         const double* interp_x_ptr,
+///         const double* interp_y_ptr,
+///         double* interp_z_ptr,
+///         size_t n
+///     )
+///
+/// \brief Method to perform a batch of 2D interpolations (e.g., over a whole time
+///     series). Results are bit-for-bit the same as those of repeated calls to
+///     interp2D().
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param interp_x_ptr A pointer to the first of n first query values. If any of
+///     these is outside the domain of the associated interpolation data, then an error
+///     will occur (before any interpolated values are written).
+///
+/// \param interp_y_ptr A pointer to the first of n second query values. If any of
+///     these is outside the domain of the associated interpolation data, then an error
+///     will occur (before any interpolated values are written).
+///
+/// \param interp_z_ptr A pointer to the first of n interpolated values (output).
+///
+/// \param n The number of queries.
+///
+
+void Interpolator :: interp2DBatch(
+    int data_key,
+    const double* interp_x_ptr,
+    const double* interp_y_ptr,
+    double* interp_z_ptr,
+    size_t n
+)
+{
+    this->__interp2DBatch(
+        this->__getHandleIdx2D(data_key),
+        interp_x_ptr,
+        interp_y_ptr,
+        interp_z_ptr,
+        n
+    );
     
-    double interp_z_1 = ((z_1 - z_0) / (x_1 - x_0)) * (interp_x - x_0) + z_0;
+    return;
+}   /* interp2DBatch() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: interp1DBatch(
+///         InterpolatorHandle1D handle,
+///         const double* interp_x_ptr,
+///         double* interp_y_ptr,
+///         size_t n
+///     )
+///
+/// \brief Method to perform a batch of 1D interpolations through a handle (see
+///     getHandle1D()).
+///
+/// \param handle A handle to the given 1D interpolation data.
+///
+/// \param interp_x_ptr A pointer to the first of n query values. If any of these is
+///     outside the domain of the associated interpolation data, then an error will
+///     occur (before any interpolated values are written).
+///
+/// \param interp_y_ptr A pointer to the first of n interpolated values (output).
+///
+/// \param n The number of queries.
+///
+
+void Interpolator :: interp1DBatch(
+    InterpolatorHandle1D handle,
+    const double* interp_x_ptr,
+    double* interp_y_ptr,
+    size_t n
+)
+{
+    this->__checkHandle1D(handle);
     
-    //  5. perform vertical interpolation
-    double y_0 = this->interp_map_2D[data_key].y_vec[idx_y];
-    double y_1 = this->interp_map_2D[data_key].y_vec[idx_y + 1];
+    this->__interp1DBatch(handle.idx, interp_x_ptr, interp_y_ptr, n);
     
-    double interp_z =
-        ((interp_z_1 - interp_z_0) / (y_1 - y_0)) * (interp_y - y_0) + interp_z_0;
+    return;
+}   /* interp1DBatch() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: interp2DBatch(
+///         InterpolatorHandle2D handle,
+///         const double* interp_x_ptr,
+///         const double* interp_y_ptr,
+///         double* interp_z_ptr,
+///         size_t n
+///     )
+///
+/// \brief Method to perform a batch of 2D interpolations through a handle (see
+///     getHandle2D()).
+///
+/// \param handle A handle to the given 2D interpolation data.
+///
+/// \param interp_x_ptr A pointer to the first of n first query values. If any of
+///     these is outside the domain of the associated interpolation data, then an error
+///     will occur (before any interpolated values are written).
+///
+/// \param interp_y_ptr A pointer to the first of n second query values. If any of
+///     these is outside the domain of the associated interpolation data, then an error
+///     will occur (before any interpolated values are written).
+///
+/// \param interp_z_ptr A pointer to the first of n interpolated values (output).
+///
+/// \param n The number of queries.
+///
+
+void Interpolator :: interp2DBatch(
+    InterpolatorHandle2D handle,
+    const double* interp_x_ptr,
+    const double* interp_y_ptr,
+    double* interp_z_ptr,
+    size_t n
+)
+{
+    this->__checkHandle2D(handle);
+    
+    this->__interp2DBatch(
+        handle.idx,
+        interp_x_ptr,
+        interp_y_ptr,
+        interp_z_ptr,
+        n
+    );
     
-    return interp_z;
-}   /* interp2D() */
+    return;
+}   /* interp2DBatch() */
 
 // ---------------------------------------------------------------------------------- //
 
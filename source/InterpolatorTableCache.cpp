@@ -0,0 +1,324 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file InterpolatorTableCache.cpp
+///
+/// \brief Implementation file for the InterpolatorTableCache class.
+///
+/// A (process-wide) class which lets Interpolators share immutable interpolation
+/// tables read from file.
+///
+
+
+#include "../header/InterpolatorTableCache.h"
+#include "../header/Hash.h"
+#include "../header/Interpolator.h"
+
+
+// ======== PRIVATE ================================================================= //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorTableCache :: InterpolatorTableCache(void)
+///
+/// \brief Constructor for the InterpolatorTableCache class. Private, since there is
+///     only ever the one (process-wide) instance; see getInstance().
+///
+
+InterpolatorTableCache :: InterpolatorTableCache(void)
+{
+    return;
+}   /* InterpolatorTableCache() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PRIVATE ============================================================= //
+
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorTableCache& InterpolatorTableCache :: getInstance(void)
+///
+/// \brief Method to get the (process-wide) InterpolatorTableCache instance.
+///
+/// \return A reference to the InterpolatorTableCache instance.
+///
+
+InterpolatorTableCache& InterpolatorTableCache :: getInstance(void)
+{
+    static InterpolatorTableCache instance;
+    
+    return instance;
+}   /* getInstance() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string InterpolatorTableCache :: getTableKey(
+///         std::string path_2_data,
+///         const std::string& contents
+///     )
+///
+/// \brief Method to get the cache key of the given interpolation data file; that is,
+///     its canonical path together with a hash (and size) of its contents. The
+///     contents are passed in (rather than read here) so that the key always
+///     describes exactly the bytes that are then parsed and cached under it.
+///
+/// \param path_2_data The path (either relative or absolute) to the given interpolation
+///     data.
+///
+/// \param contents The raw contents of the given file, as read for parsing.
+///
+/// \return The cache key of the given file.
+///
+
+std::string InterpolatorTableCache :: getTableKey(
+    std::string path_2_data,
+    const std::string& contents
+)
+{
+    //  1. get canonical path
+    std::error_code error_code;
+    std::filesystem::path canonical_path =
+        std::filesystem::weakly_canonical(path_2_data, error_code);
+    
+    if (error_code) {
+        canonical_path = std::filesystem::absolute(path_2_data);
+    }
+    
+    //  2. build key
+    std::stringstream key_ss;
+    
+    key_ss << canonical_path.string() << "#" << contents.size() << "#" << std::hex
+        << hashBytes(contents.data(), contents.size());
+    
+    return key_ss.str();
+}   /* getTableKey() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::shared_ptr<const InterpolatorStruct1D> InterpolatorTableCache :: get1D(
+///         std::string table_key
+///     )
+///
+/// \brief Method to get the cached 1D table with the given key (if any).
+///
+/// \param table_key The key of the given table (see getTableKey()).
+///
+/// \return A shared pointer to the cached table, or an empty shared pointer if there
+///     is none.
+///
+
+std::shared_ptr<const InterpolatorStruct1D> InterpolatorTableCache :: get1D(
+    std::string table_key
+)
+{
+    return this->table_cache_1D.get(table_key);
+}   /* get1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::shared_ptr<const InterpolatorStruct2D> InterpolatorTableCache :: get2D(
+///         std::string table_key
+///     )
+///
+/// \brief Method to get the cached 2D table with the given key (if any).
+///
+/// \param table_key The key of the given table (see getTableKey()).
+///
+/// \return A shared pointer to the cached table, or an empty shared pointer if there
+///     is none.
+///
+
+std::shared_ptr<const InterpolatorStruct2D> InterpolatorTableCache :: get2D(
+    std::string table_key
+)
+{
+    return this->table_cache_2D.get(table_key);
+}   /* get2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::shared_ptr<const InterpolatorStruct1D> InterpolatorTableCache :: insert1D(
+///         std::string table_key,
+///         std::shared_ptr<const InterpolatorStruct1D> table_ptr
+///     )
+///
+/// \brief Method to insert the given 1D table into the cache. If another thread has
+///     inserted a (live) table under the same key in the meantime, then that table is
+///     kept, and returned instead.
+///
+/// \param table_key The key of the given table (see getTableKey()).
+///
+/// \param table_ptr A shared pointer to the given table.
+///
+/// \return A shared pointer to the table now cached under the given key.
+///
+
+std::shared_ptr<const InterpolatorStruct1D> InterpolatorTableCache :: insert1D(
+    std::string table_key,
+    std::shared_ptr<const InterpolatorStruct1D> table_ptr
+)
+{
+    if (table_key.empty()) {
+        return table_ptr;
+    }
+    
+    return this->table_cache_1D.insert(table_key, table_ptr);
+}   /* insert1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::shared_ptr<const InterpolatorStruct2D> InterpolatorTableCache :: insert2D(
+///         std::string table_key,
+///         std::shared_ptr<const InterpolatorStruct2D> table_ptr
+///     )
+///
+/// \brief Method to insert the given 2D table into the cache. If another thread has
+///     inserted a (live) table under the same key in the meantime, then that table is
+///     kept, and returned instead.
+///
+/// \param table_key The key of the given table (see getTableKey()).
+///
+/// \param table_ptr A shared pointer to the given table.
+///
+/// \return A shared pointer to the table now cached under the given key.
+///
+
+std::shared_ptr<const InterpolatorStruct2D> InterpolatorTableCache :: insert2D(
+    std::string table_key,
+    std::shared_ptr<const InterpolatorStruct2D> table_ptr
+)
+{
+    if (table_key.empty()) {
+        return table_ptr;
+    }
+    
+    return this->table_cache_2D.insert(table_key, table_ptr);
+}   /* insert2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn size_t InterpolatorTableCache :: size(void)
+///
+/// \brief Method to get the number of (live) tables in the cache.
+///
+/// \return The number of (live) tables in the cache.
+///
+
+size_t InterpolatorTableCache :: size(void)
+{
+    return this->table_cache_1D.size() + this->table_cache_2D.size();
+}   /* size() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void InterpolatorTableCache :: clear(void)
+///
+/// \brief Method to clear the cache. Tables already held by Interpolators are
+///     unaffected (they are only freed once no longer held), but will no longer be
+///     shared with subsequent reads.
+///
+
+void InterpolatorTableCache :: clear(void)
+{
+    this->table_cache_1D.clear();
+    this->table_cache_2D.clear();
+    
+    return;
+}   /* clear() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorTableCache :: ~InterpolatorTableCache(void)
+///
+/// \brief Destructor for the InterpolatorTableCache class.
+///
+
+InterpolatorTableCache :: ~InterpolatorTableCache(void)
+{
+    return;
+}   /* ~InterpolatorTableCache() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PUBLIC ============================================================== //
@@ -204,7 +204,8 @@ void Model :: __computeNetPresentCost(void)
     //     increment total dispatch
     for (size_t i = 0; i < this->combustion_ptr_vec.size(); i++) {
         this->combustion_ptr_vec[i]->computeEconomics(
-            &(this->electrical_load.time_vec_hrs)
+            &(this->electrical_load_ptr->time_vec_hrs),
+            this->discount_factor_cache_ptr
         );
         
         this->net_present_cost += this->combustion_ptr_vec[i]->net_present_cost;
@@ -220,7 +221,8 @@ void Model :: __computeNetPresentCost(void)
     //     increment total dispatch
     for (size_t i = 0; i < this->noncombustion_ptr_vec.size(); i++) {
         this->noncombustion_ptr_vec[i]->computeEconomics(
-            &(this->electrical_load.time_vec_hrs)
+            &(this->electrical_load_ptr->time_vec_hrs),
+            this->discount_factor_cache_ptr
         );
         
         this->net_present_cost += this->noncombustion_ptr_vec[i]->net_present_cost;
@@ -239,7 +241,8 @@ void Model :: __computeNetPresentCost(void)
     //     increment total dispatch
     for (size_t i = 0; i < this->renewable_ptr_vec.size(); i++) {
         this->renewable_ptr_vec[i]->computeEconomics(
-            &(this->electrical_load.time_vec_hrs)
+            &(this->electrical_load_ptr->time_vec_hrs),
+            this->discount_factor_cache_ptr
         );
         
         this->net_present_cost += this->renewable_ptr_vec[i]->net_present_cost;
@@ -258,7 +261,8 @@ void Model :: __computeNetPresentCost(void)
     //     increment total dispatch
     for (size_t i = 0; i < this->storage_ptr_vec.size(); i++) {
         this->storage_ptr_vec[i]->computeEconomics(
-            &(this->electrical_load.time_vec_hrs)
+            &(this->electrical_load_ptr->time_vec_hrs),
+            this->discount_factor_cache_ptr
         );
         
         this->net_present_cost += this->storage_ptr_vec[i]->net_present_cost;
@@ -378,12 +382,12 @@ void Model :: __writeSummary(std::string write_path)
     ofs << "## Electrical Load\n";
     ofs << "\n";
     ofs << "Path: " <<
-        this->electrical_load.path_2_electrical_load_time_series << "  \n";
-    ofs << "Data Points: " << this->electrical_load.n_points << "  \n";
-    ofs << "Years: " << this->electrical_load.n_years << "  \n";
-    ofs << "Min: " << this->electrical_load.min_load_kW << " kW  \n";
-    ofs << "Mean: " << this->electrical_load.mean_load_kW << " kW  \n";
-    ofs << "Max: " << this->electrical_load.max_load_kW << " kW  \n";
+        this->electrical_load_ptr->path_2_electrical_load_time_series << "  \n";
+    ofs << "Data Points: " << this->electrical_load_ptr->n_points << "  \n";
+    ofs << "Years: " << this->electrical_load_ptr->n_years << "  \n";
+    ofs << "Min: " << this->electrical_load_ptr->min_load_kW << " kW  \n";
+    ofs << "Mean: " << this->electrical_load_ptr->mean_load_kW << " kW  \n";
+    ofs << "Max: " << this->electrical_load_ptr->max_load_kW << " kW  \n";
     ofs << "\n--------\n\n";
     
     //  3.2. Controller
@@ -408,13 +412,13 @@ void Model :: __writeSummary(std::string write_path)
     ofs << "\n";
     
     std::map<int, std::string>::iterator string_map_1D_iter =
-        this->resources.string_map_1D.begin();
+        this->resources_ptr->string_map_1D.begin();
     std::map<int, std::string>::iterator path_map_1D_iter =
-        this->resources.path_map_1D.begin();
+        this->resources_ptr->path_map_1D.begin();
     
     while (
-        string_map_1D_iter != this->resources.string_map_1D.end() and
-        path_map_1D_iter != this->resources.path_map_1D.end()
+        string_map_1D_iter != this->resources_ptr->string_map_1D.end() and
+        path_map_1D_iter != this->resources_ptr->path_map_1D.end()
     ) {
         ofs << "Resource Key: " << string_map_1D_iter->first << "  \n";
         ofs << "Type: " << string_map_1D_iter->second << "  \n";
@@ -432,13 +436,13 @@ void Model :: __writeSummary(std::string write_path)
     ofs << "\n";
     
     std::map<int, std::string>::iterator string_map_2D_iter =
-        this->resources.string_map_2D.begin();
+        this->resources_ptr->string_map_2D.begin();
     std::map<int, std::string>::iterator path_map_2D_iter =
-        this->resources.path_map_2D.begin();
+        this->resources_ptr->path_map_2D.begin();
     
     while (
-        string_map_2D_iter != this->resources.string_map_2D.end() and
-        path_map_2D_iter != this->resources.path_map_2D.end()
+        string_map_2D_iter != this->resources_ptr->string_map_2D.end() and
+        path_map_2D_iter != this->resources_ptr->path_map_2D.end()
     ) {
         ofs << "Resource Key: " << string_map_2D_iter->first << "  \n";
         ofs << "Type: " << string_map_2D_iter->second << "  \n";
@@ -553,7 +557,7 @@ void Model :: __writeSummary(std::string write_path)
     
     ofs << "Total Fuel Consumed: " << this->total_fuel_consumed_L << " L "
         << "(Annual Average: " <<
-            this->total_fuel_consumed_L / this->electrical_load.n_years
+            this->total_fuel_consumed_L / this->electrical_load_ptr->n_years
         << " L/yr)  \n";
     ofs << "\n";
 
@@ -568,36 +572,36 @@ void Model :: __writeSummary(std::string write_path)
     ofs << "Total Carbon Dioxide (CO2) Emissions: " <<
         this->total_emissions.CO2_kg << " kg "
         << "(Annual Average: " << 
-            this->total_emissions.CO2_kg / this->electrical_load.n_years
+            this->total_emissions.CO2_kg / this->electrical_load_ptr->n_years
         << " kg/yr)  \n";
         
     ofs << "Total Carbon Monoxide (CO) Emissions: " <<
         this->total_emissions.CO_kg << " kg "
         << "(Annual Average: " << 
-            this->total_emissions.CO_kg / this->electrical_load.n_years
+            this->total_emissions.CO_kg / this->electrical_load_ptr->n_years
         << " kg/yr)  \n";
         
     ofs << "Total Nitrogen Oxides (NOx) Emissions: " <<
         this->total_emissions.NOx_kg << " kg "
         << "(Annual Average: " << 
-            this->total_emissions.NOx_kg / this->electrical_load.n_years
+            this->total_emissions.NOx_kg / this->electrical_load_ptr->n_years
         << " kg/yr)  \n";
         
     ofs << "Total Sulfur Oxides (SOx) Emissions: " <<
         this->total_emissions.SOx_kg << " kg "
         << "(Annual Average: " << 
-            this->total_emissions.SOx_kg / this->electrical_load.n_years
+            this->total_emissions.SOx_kg / this->electrical_load_ptr->n_years
         << " kg/yr)  \n";
         
     ofs << "Total Methane (CH4) Emissions: " << this->total_emissions.CH4_kg << " kg "
         << "(Annual Average: " << 
-            this->total_emissions.CH4_kg / this->electrical_load.n_years
+            this->total_emissions.CH4_kg / this->electrical_load_ptr->n_years
         << " kg/yr)  \n";
         
     ofs << "Total Particulate Matter (PM) Emissions: " <<
         this->total_emissions.PM_kg << " kg "
         << "(Annual Average: " << 
-            this->total_emissions.PM_kg / this->electrical_load.n_years
+            this->total_emissions.PM_kg / this->electrical_load_ptr->n_years
         << " kg/yr)  \n";
         
     ofs << "\n--------\n\n";
@@ -627,7 +631,7 @@ void Model :: __writeTimeSeries(std::string write_path, int max_lines)
 {
     //  1. create filestream
     write_path += "Model/time_series_results.csv";
-    std::ofstream ofs;
+    BufferedWriter ofs;
     ofs.open(write_path, std::ofstream::out);
     
     //  2. write time series results header (comma separated value)
@@ -661,31 +665,38 @@ void Model :: __writeTimeSeries(std::string write_path, int max_lines)
     
     ofs << "\n";
     
-    //  3. write time series results values (comma separated value)
+    //  3. gather result columns (so that each line is a flat walk over columns)
+    std::vector<std::vector<double>*> column_ptr_vec = {
+        &(this->electrical_load_ptr->time_vec_hrs),
+        &(this->electrical_load_ptr->load_vec_kW),
+        &(this->controller.net_load_vec_kW),
+        &(this->controller.missed_load_vec_kW),
+        &(this->controller.missed_firm_dispatch_vec_kW),
+        &(this->controller.missed_spinning_reserve_vec_kW)
+    };
+    
+    for (size_t j = 0; j < this->renewable_ptr_vec.size(); j++) {
+        column_ptr_vec.push_back(&(this->renewable_ptr_vec[j]->dispatch_vec_kW));
+    }
+    
+    for (size_t j = 0; j < this->storage_ptr_vec.size(); j++) {
+        column_ptr_vec.push_back(
+            &(this->storage_ptr_vec[j]->discharging_power_vec_kW)
+        );
+    }
+    
+    for (size_t j = 0; j < this->noncombustion_ptr_vec.size(); j++) {
+        column_ptr_vec.push_back(&(this->noncombustion_ptr_vec[j]->dispatch_vec_kW));
+    }
+    
+    for (size_t j = 0; j < this->combustion_ptr_vec.size(); j++) {
+        column_ptr_vec.push_back(&(this->combustion_ptr_vec[j]->dispatch_vec_kW));
+    }
+    
+    //  4. write time series results values (comma separated value)
     for (int i = 0; i < max_lines; i++) {
-        //  3.1. load values
-        ofs << this->electrical_load.time_vec_hrs[i] << ",";
-        ofs << this->electrical_load.load_vec_kW[i] << ",";
-        ofs << this->controller.net_load_vec_kW[i] << ",";
-        ofs << this->controller.missed_load_vec_kW[i] << ",";
-        ofs << this->controller.missed_firm_dispatch_vec_kW[i] << ",";
-        ofs << this->controller.missed_spinning_reserve_vec_kW[i] << ",";
-        
-        //  3.2. asset-wise dispatch/discharge
-        for (size_t j = 0; j < this->renewable_ptr_vec.size(); j++) {
-            ofs << this->renewable_ptr_vec[j]->dispatch_vec_kW[i] << ",";
-        }
-        
-        for (size_t j = 0; j < this->storage_ptr_vec.size(); j++) {
-            ofs << this->storage_ptr_vec[j]->discharging_power_vec_kW[i] << ",";
-        }
-        
-        for (size_t j = 0; j < this->noncombustion_ptr_vec.size(); j++) {
-            ofs << this->noncombustion_ptr_vec[j]->dispatch_vec_kW[i] << ",";
-        }
-        
-        for (size_t j = 0; j < this->combustion_ptr_vec.size(); j++) {
-            ofs << this->combustion_ptr_vec[j]->dispatch_vec_kW[i] << ",";
+        for (size_t j = 0; j < column_ptr_vec.size(); j++) {
+            ofs << (*(column_ptr_vec[j]))[i] << ",";
         }
         
         ofs << "\n";
@@ -697,48 +708,137 @@ void Model :: __writeTimeSeries(std::string write_path, int max_lines)
 
 // ---------------------------------------------------------------------------------- //
 
-// ======== END PRIVATE ============================================================= //
 
 
-
-// ======== PUBLIC ================================================================== //
-
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn Model :: Model(void)
+/// \fn void Model :: __writeColumnar(
+///         std::string write_path,
+///         int max_lines,
+///         ColumnarFormat columnar_format
+///     )
 ///
-/// \brief Constructor (dummy) for the Model class.
+/// \brief Helper method to write the time series results of the Model, and of every
+///     asset, to a single binary columnar results file (see ColumnarWriter).
+///
+/// \param write_path A path (either relative or absolute) to the directory location 
+///     where results are to be written. If already exists, will overwrite.
+///
+/// \param max_lines The maximum number of lines (i.e., rows) of output to write.
+///
+/// \param columnar_format The format in which to write the columns.
 ///
 
-Model :: Model(void)
+void Model :: __writeColumnar(
+    std::string write_path,
+    int max_lines,
+    ColumnarFormat columnar_format
+)
 {
+    ColumnarWriter columnar_writer;
+    
+    //  1. add Model columns
+    columnar_writer.addColumn(
+        "Time (since start of data)",
+        "hrs",
+        &(this->electrical_load_ptr->time_vec_hrs)
+    );
+    
+    columnar_writer.addColumn(
+        "Electrical Load",
+        "kW",
+        &(this->electrical_load_ptr->load_vec_kW)
+    );
+    
+    columnar_writer.addColumn("Net Load", "kW", &(this->controller.net_load_vec_kW));
+    
+    columnar_writer.addColumn(
+        "Missed Load",
+        "kW",
+        &(this->controller.missed_load_vec_kW)
+    );
+    
+    columnar_writer.addColumn(
+        "Missed Firm Dispatch Requirement",
+        "kW",
+        &(this->controller.missed_firm_dispatch_vec_kW)
+    );
+    
+    columnar_writer.addColumn(
+        "Missed Spinning Reserve Requirement",
+        "kW",
+        &(this->controller.missed_spinning_reserve_vec_kW)
+    );
+    
+    //  2. add asset columns
+    for (size_t i = 0; i < this->combustion_ptr_vec.size(); i++) {
+        columnar_writer.setAsset(
+            "Combustion",
+            this->combustion_ptr_vec[i]->type_str,
+            i,
+            this->combustion_ptr_vec[i]->capacity_kW
+        );
+        
+        this->combustion_ptr_vec[i]->addResultColumns(&columnar_writer);
+    }
+    
+    for (size_t i = 0; i < this->noncombustion_ptr_vec.size(); i++) {
+        columnar_writer.setAsset(
+            "Noncombustion",
+            this->noncombustion_ptr_vec[i]->type_str,
+            i,
+            this->noncombustion_ptr_vec[i]->capacity_kW
+        );
+        
+        this->noncombustion_ptr_vec[i]->addResultColumns(&columnar_writer);
+    }
+    
+    for (size_t i = 0; i < this->renewable_ptr_vec.size(); i++) {
+        columnar_writer.setAsset(
+            "Renewable",
+            this->renewable_ptr_vec[i]->type_str,
+            i,
+            this->renewable_ptr_vec[i]->capacity_kW
+        );
+        
+        this->renewable_ptr_vec[i]->addResultColumns(&columnar_writer);
+    }
+    
+    for (size_t i = 0; i < this->storage_ptr_vec.size(); i++) {
+        columnar_writer.setAsset(
+            "Storage",
+            this->storage_ptr_vec[i]->type_str,
+            i,
+            this->storage_ptr_vec[i]->power_capacity_kW
+        );
+        
+        this->storage_ptr_vec[i]->addResultColumns(&columnar_writer);
+    }
+    
+    //  3. write
+    write_path += "time_series_results.pgmcol";
+    columnar_writer.write(write_path, max_lines, columnar_format);
+    
     return;
-}   /* Model() */
+}   /* __writeColumnar() */
 
 // ---------------------------------------------------------------------------------- //
 
-
-
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn Model :: Model(ModelInputs model_inputs)
+/// \fn void Model :: __init(ModelInputs model_inputs)
 ///
-/// \brief Constructor (intended) for the Model class.
+/// \brief Helper method (private) to set Controller and public attributes on
+///     construction.
 ///
 /// \param model_inputs A structure of Model constructor inputs.
 ///
 
-Model :: Model(ModelInputs model_inputs)
+void Model :: __init(ModelInputs model_inputs)
 {
-    //  1. check inputs
-    this->__checkInputs(model_inputs);
-    
-    //  2. read in electrical load data
-    this->electrical_load.readLoadData(model_inputs.path_2_electrical_load_time_series);
-    
-    //  3. set controller attributes
+    //  1. set controller attributes
     this->controller.setControlMode(model_inputs.control_mode);
     // DEPRECATED
     /*
@@ -747,10 +847,59 @@ Model :: Model(ModelInputs model_inputs)
     */
     this->controller.setFirmDispatchRatio(model_inputs.firm_dispatch_ratio);
     this->controller.setLoadReserveRatio(model_inputs.load_reserve_ratio);
+    this->controller.setSummaryOnly(model_inputs.summary_only);
+    this->controller.setNThreads(model_inputs.n_threads);
+    
+    this->thermal_model_ptr = NULL;
+    
+    //  2. set public attributes
+    this->summary_only = model_inputs.summary_only;
+    
+    this->total_fuel_consumed_L = 0;
+    this->net_present_cost = 0;
+    
+    this->total_renewable_noncombustion_dispatch_kWh = 0;
+    this->total_renewable_noncombustion_charge_kWh = 0;
+    this->total_combustion_charge_kWh = 0;
+    this->total_discharge_kWh = 0;
+    this->total_dispatch_kWh = 0;
+    this->renewable_penetration = 0;
+    
+    this->levellized_cost_of_energy_kWh = 0;
+    
+    this->next_timestep = 0;
+    
+    return;
+}   /* __init() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ======== END PRIVATE ============================================================= //
+
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn Model :: Model(void)
+///
+/// \brief Constructor (dummy) for the Model class.
+///
+
+Model :: Model(void)
+{
+    this->electrical_load_ptr = &(this->electrical_load);
+    this->resources_ptr = &(this->resources);
+    this->discount_factor_cache_ptr = &(this->discount_factor_cache);
     
     this->thermal_model_ptr = NULL;
     
-    //  4. set public attributes
+    this->summary_only = false;
+    
     this->total_fuel_consumed_L = 0;
     this->net_present_cost = 0;
     
@@ -763,6 +912,121 @@ Model :: Model(ModelInputs model_inputs)
     
     this->levellized_cost_of_energy_kWh = 0;
     
+    this->next_timestep = 0;
+    
+    return;
+}   /* Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn Model :: Model(ModelInputs model_inputs)
+///
+/// \brief Constructor (intended) for the Model class.
+///
+/// \param model_inputs A structure of Model constructor inputs.
+///
+
+Model :: Model(ModelInputs model_inputs)
+{
+    //  1. check inputs
+    this->__checkInputs(model_inputs);
+    
+    //  2. read in electrical load data
+    this->electrical_load_ptr = &(this->electrical_load);
+    this->resources_ptr = &(this->resources);
+    
+    this->electrical_load_ptr->readLoadData(model_inputs.path_2_electrical_load_time_series);
+    
+    this->discount_factor_cache_ptr = &(this->discount_factor_cache);
+    this->discount_factor_cache_ptr->setTimeVec(&(this->electrical_load_ptr->time_vec_hrs));
+    
+    //  3. init
+    this->__init(model_inputs);
+    
+    return;
+}   /* Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn Model :: Model(
+///         ModelInputs model_inputs,
+///         ElectricalLoad* electrical_load_ptr,
+///         Resources* resources_ptr,
+///         DiscountFactorCache* discount_factor_cache_ptr
+///     )
+///
+/// \brief Constructor (shared) for the Model class. Rather than reading in its own
+///     electrical load and resource data, the Model refers to the given ElectricalLoad
+///     and Resources objects, which can then be shared (read only) between any number
+///     of Model objects (see Sweep). The shared objects must outlive the Model. Note
+///     that ModelInputs::path_2_electrical_load_time_series is ignored in this case,
+///     and that resources cannot be added to the Model (add them to the shared
+///     Resources object instead).
+///
+/// \param model_inputs A structure of Model constructor inputs.
+///
+/// \param electrical_load_ptr A pointer to the shared ElectricalLoad object.
+///
+/// \param resources_ptr A pointer to the shared Resources object.
+///
+/// \param discount_factor_cache_ptr A pointer to a shared DiscountFactorCache object
+///     (defaults to NULL), which must be built over the time vector of the shared
+///     ElectricalLoad. If NULL, then the Model uses its own discount_factor_cache
+///     component.
+///
+
+Model :: Model(
+    ModelInputs model_inputs,
+    ElectricalLoad* electrical_load_ptr,
+    Resources* resources_ptr,
+    DiscountFactorCache* discount_factor_cache_ptr
+)
+{
+    //  1. check inputs
+    if (electrical_load_ptr == NULL or resources_ptr == NULL) {
+        std::string error_str = "ERROR:  Model():  ";
+        error_str += "shared ElectricalLoad and Resources pointers cannot be NULL";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    model_inputs.path_2_electrical_load_time_series =
+        electrical_load_ptr->path_2_electrical_load_time_series;
+    
+    this->__checkInputs(model_inputs);
+    
+    //  2. refer to shared electrical load and resource data
+    this->electrical_load_ptr = electrical_load_ptr;
+    this->resources_ptr = resources_ptr;
+    
+    if (discount_factor_cache_ptr == NULL) {
+        this->discount_factor_cache_ptr = &(this->discount_factor_cache);
+        this->discount_factor_cache_ptr->setTimeVec(
+            &(this->electrical_load_ptr->time_vec_hrs)
+        );
+    }
+    
+    else {
+        this->discount_factor_cache_ptr = discount_factor_cache_ptr;
+    }
+    
+    //  3. init
+    this->__init(model_inputs);
+    
     return;
 }   /* Model() */
 
@@ -782,11 +1046,13 @@ Model :: Model(ModelInputs model_inputs)
 
 void Model :: addDiesel(DieselInputs diesel_inputs)
 {
+    diesel_inputs.combustion_inputs.production_inputs.summary_only = this->summary_only;
+    
     Combustion* diesel_ptr = new Diesel(
-        this->electrical_load.n_points,
-        this->electrical_load.n_years,
+        this->electrical_load_ptr->n_points,
+        this->electrical_load_ptr->n_years,
         diesel_inputs,
-        &(this->electrical_load.time_vec_hrs)
+        &(this->electrical_load_ptr->time_vec_hrs)
     );
     
     this->combustion_ptr_vec.push_back(diesel_ptr);
@@ -822,11 +1088,23 @@ void Model :: addResource(
     int resource_key
 )
 {
-    resources.addResource(
+    if (this->resources_ptr != &(this->resources)) {
+        std::string error_str = "ERROR:  Model::addResource():  ";
+        error_str += "cannot add a resource to a Model with shared Resources; add it ";
+        error_str += "to the shared Resources object instead";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::runtime_error(error_str);
+    }
+    
+    this->resources_ptr->addResource(
         noncombustion_type,
         path_2_resource_data,
         resource_key,
-        &(this->electrical_load)
+        this->electrical_load_ptr
     );
     
     return;
@@ -860,11 +1138,23 @@ void Model :: addResource(
     int resource_key
 )
 {
-    resources.addResource(
+    if (this->resources_ptr != &(this->resources)) {
+        std::string error_str = "ERROR:  Model::addResource():  ";
+        error_str += "cannot add a resource to a Model with shared Resources; add it ";
+        error_str += "to the shared Resources object instead";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::runtime_error(error_str);
+    }
+    
+    this->resources_ptr->addResource(
         renewable_type,
         path_2_resource_data,
         resource_key,
-        &(this->electrical_load)
+        this->electrical_load_ptr
     );
     
     return;
@@ -874,6 +1164,53 @@ void Model :: addResource(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Model :: addResources(
+///         std::vector<ResourceInputs> resource_inputs_vec,
+///         int n_threads
+///     )
+///
+/// \brief A method to add a batch of resource time series to the Model, read and
+///     checked concurrently (see Resources::addResources()).
+///
+/// \param resource_inputs_vec A vector of structures, each describing one resource.
+///
+/// \param n_threads The number of worker threads to use. If <= 0, then all available
+///     hardware threads are used.
+///
+
+void Model :: addResources(
+    std::vector<ResourceInputs> resource_inputs_vec,
+    int n_threads
+)
+{
+    if (this->resources_ptr != &(this->resources)) {
+        std::string error_str = "ERROR:  Model::addResources():  ";
+        error_str += "cannot add resources to a Model with shared Resources; add them ";
+        error_str += "to the shared Resources object instead";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::runtime_error(error_str);
+    }
+    
+    this->resources_ptr->addResources(
+        resource_inputs_vec,
+        this->electrical_load_ptr,
+        n_threads
+    );
+    
+    return;
+}   /* addResources() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -886,11 +1223,14 @@ void Model :: addResource(
 
 void Model :: addHydro(HydroInputs hydro_inputs)
 {
+    hydro_inputs.noncombustion_inputs.production_inputs.summary_only =
+        this->summary_only;
+    
     Noncombustion* hydro_ptr = new Hydro(
-        this->electrical_load.n_points,
-        this->electrical_load.n_years,
+        this->electrical_load_ptr->n_points,
+        this->electrical_load_ptr->n_years,
         hydro_inputs,
-        &(this->electrical_load.time_vec_hrs)
+        &(this->electrical_load_ptr->time_vec_hrs)
     );
     
     this->noncombustion_ptr_vec.push_back(hydro_ptr);
@@ -914,11 +1254,13 @@ void Model :: addHydro(HydroInputs hydro_inputs)
 
 void Model :: addSolar(SolarInputs solar_inputs)
 {
+    solar_inputs.renewable_inputs.production_inputs.summary_only = this->summary_only;
+    
     Renewable* solar_ptr = new Solar(
-        this->electrical_load.n_points,
-        this->electrical_load.n_years,
+        this->electrical_load_ptr->n_points,
+        this->electrical_load_ptr->n_years,
         solar_inputs,
-        &(this->electrical_load.time_vec_hrs)
+        &(this->electrical_load_ptr->time_vec_hrs)
     );
     
     this->renewable_ptr_vec.push_back(solar_ptr);
@@ -942,11 +1284,13 @@ void Model :: addSolar(SolarInputs solar_inputs)
 
 void Model :: addTidal(TidalInputs tidal_inputs)
 {
+    tidal_inputs.renewable_inputs.production_inputs.summary_only = this->summary_only;
+    
     Renewable* tidal_ptr = new Tidal(
-        this->electrical_load.n_points,
-        this->electrical_load.n_years,
+        this->electrical_load_ptr->n_points,
+        this->electrical_load_ptr->n_years,
         tidal_inputs,
-        &(this->electrical_load.time_vec_hrs)
+        &(this->electrical_load_ptr->time_vec_hrs)
     );
     
     this->renewable_ptr_vec.push_back(tidal_ptr);
@@ -970,11 +1314,13 @@ void Model :: addTidal(TidalInputs tidal_inputs)
 
 void Model :: addWave(WaveInputs wave_inputs)
 {
+    wave_inputs.renewable_inputs.production_inputs.summary_only = this->summary_only;
+    
     Renewable* wave_ptr = new Wave(
-        this->electrical_load.n_points,
-        this->electrical_load.n_years,
+        this->electrical_load_ptr->n_points,
+        this->electrical_load_ptr->n_years,
         wave_inputs,
-        &(this->electrical_load.time_vec_hrs)
+        &(this->electrical_load_ptr->time_vec_hrs)
     );
     
     this->renewable_ptr_vec.push_back(wave_ptr);
@@ -998,11 +1344,13 @@ void Model :: addWave(WaveInputs wave_inputs)
 
 void Model :: addWind(WindInputs wind_inputs)
 {
+    wind_inputs.renewable_inputs.production_inputs.summary_only = this->summary_only;
+    
     Renewable* wind_ptr = new Wind(
-        this->electrical_load.n_points,
-        this->electrical_load.n_years,
+        this->electrical_load_ptr->n_points,
+        this->electrical_load_ptr->n_years,
         wind_inputs,
-        &(this->electrical_load.time_vec_hrs)
+        &(this->electrical_load_ptr->time_vec_hrs)
     );
     
     this->renewable_ptr_vec.push_back(wind_ptr);
@@ -1026,9 +1374,11 @@ void Model :: addWind(WindInputs wind_inputs)
 
 void Model :: addLiIon(LiIonInputs liion_inputs)
 {
+    liion_inputs.storage_inputs.summary_only = this->summary_only;
+    
     Storage* liion_ptr = new LiIon(
-        this->electrical_load.n_points,
-        this->electrical_load.n_years,
+        this->electrical_load_ptr->n_points,
+        this->electrical_load_ptr->n_years,
         liion_inputs
     );
     
@@ -1051,9 +1401,11 @@ void Model :: addLiIon(LiIonInputs liion_inputs)
 
 void Model :: addH2(H2Inputs h2_inputs)
 {
+    h2_inputs.storage_inputs.summary_only = this->summary_only;
+    
     Storage* h2_ptr = new H2(
-        this->electrical_load.n_points,
-        this->electrical_load.n_years,
+        this->electrical_load_ptr->n_points,
+        this->electrical_load_ptr->n_years,
         h2_inputs
     );
     
@@ -1091,37 +1443,22 @@ void Model :: addThermalModel(ThermalModelInputs thermal_model_inputs)
 ///
 /// \fn void Model :: run(void)
 ///
-/// \brief A method to run the Model.
+/// \brief A method to run the Model. If the Model has already been advanced part way
+///     (see runUntil()), then dispatch picks up where it left off.
 ///
 
 void Model :: run(void)
 {
-    // 1. init Controller
-    this->controller.init(
-        &(this->electrical_load),
-        &(this->renewable_ptr_vec),
-        &(this->resources),
-        &(this->combustion_ptr_vec)
-    );
+    //  1. init Controller (if applicable), apply dispatch control
+    this->runUntil(this->electrical_load_ptr->n_points);
     
-    //  2. apply dispatch control
-    this->controller.applyDispatchControl(
-        &(this->electrical_load),
-        &(this->resources),
-        &(this->combustion_ptr_vec),
-        &(this->noncombustion_ptr_vec),
-        &(this->renewable_ptr_vec),
-        &(this->storage_ptr_vec),
-        this->thermal_model_ptr
-    );
-    
-    //  3. compute total fuel consumption and emissions
+    //  2. compute total fuel consumption and emissions
     this->__computeFuelAndEmissions();
     
-    //  4. compute key economic metrics
+    //  3. compute key economic metrics
     this->__computeEconomics();
     
-    //  5. compute renewable penetration
+    //  4. compute renewable penetration
     this->renewable_penetration +=
         this->total_renewable_noncombustion_dispatch_kWh;
     
@@ -1151,6 +1488,430 @@ void Model :: run(void)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Model :: runUntil(int timestep)
+///
+/// \brief A method to advance the Model run up to (but not including) the given time
+///     step. That is, dispatch is applied to every time step in
+///     [next_timestep, timestep). The Controller is initialized on the first call. Fuel,
+///     emissions, and economics are not computed until run() completes the Model run.
+///
+/// \param timestep The time step to run until. Clamped to n_points.
+///
+
+void Model :: runUntil(int timestep)
+{
+    //  1. check input
+    if (timestep > this->electrical_load_ptr->n_points) {
+        timestep = this->electrical_load_ptr->n_points;
+    }
+    
+    if (timestep < this->next_timestep) {
+        std::string error_str = "ERROR:  Model::runUntil():  ";
+        error_str += "cannot run until time step ";
+        error_str += std::to_string(timestep);
+        error_str += ", the Model has already been run to time step ";
+        error_str += std::to_string(this->next_timestep);
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    if (timestep == this->next_timestep) {
+        return;
+    }
+    
+    //  2. init Controller (if applicable)
+    if (this->next_timestep == 0) {
+        this->controller.init(
+            this->electrical_load_ptr,
+            &(this->renewable_ptr_vec),
+            this->resources_ptr,
+            &(this->combustion_ptr_vec),
+            &(this->noncombustion_ptr_vec)
+        );
+    }
+    
+    //  3. apply dispatch control
+    this->controller.applyDispatchControl(
+        this->electrical_load_ptr,
+        this->resources_ptr,
+        &(this->combustion_ptr_vec),
+        &(this->noncombustion_ptr_vec),
+        &(this->renewable_ptr_vec),
+        &(this->storage_ptr_vec),
+        this->thermal_model_ptr,
+        this->next_timestep,
+        timestep
+    );
+    
+    this->next_timestep = timestep;
+    
+    return;
+}   /* runUntil() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Model :: recomputeEconomics(CostInputs cost_inputs)
+///
+/// \brief A method to recompute the economic metrics of a completed Model run under
+///     new economic inputs, without re-running dispatch. Dispatch does not depend on
+///     the economic inputs, so the recorded cost time series are reused as is; only the
+///     net present costs and levellized costs of energy are recomputed (with the
+///     discount factors of any new rates computed once, by the DiscountFactorCache).
+///     The cost scalars are also applied to the (actual) cost time series as written by
+///     writeResults(), so that written costs remain consistent with the recomputed net
+///     present costs.
+///
+/// \param cost_inputs A structure of economic inputs (see CostInputs).
+///
+
+void Model :: recomputeEconomics(CostInputs cost_inputs)
+{
+    //  1. check Model state
+    if (this->summary_only) {
+        std::string error_str = "ERROR:  Model::recomputeEconomics():  ";
+        error_str += "economics cannot be recomputed if only summary results are ";
+        error_str += "recorded (no cost time series are kept)";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    if (this->next_timestep < this->electrical_load_ptr->n_points) {
+        std::string error_str = "ERROR:  Model::recomputeEconomics():  ";
+        error_str += "the Model has not been run (dispatch is complete up to time ";
+        error_str += "step ";
+        error_str += std::to_string(this->next_timestep);
+        error_str += " of ";
+        error_str += std::to_string(this->electrical_load_ptr->n_points);
+        error_str += ")";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  2. apply economic inputs to assets
+    for (size_t i = 0; i < this->combustion_ptr_vec.size(); i++) {
+        Combustion* combustion_ptr = this->combustion_ptr_vec[i];
+        
+        combustion_ptr->resetEconomics(
+            cost_inputs.nominal_inflation_annual,
+            cost_inputs.nominal_discount_annual
+        );
+        
+        combustion_ptr->capital_cost_scalar = cost_inputs.capital_cost_scalar;
+        combustion_ptr->operation_maintenance_cost_scalar =
+            cost_inputs.operation_maintenance_cost_scalar;
+        combustion_ptr->fuel_cost_scalar = cost_inputs.fuel_cost_scalar;
+    }
+    
+    for (size_t i = 0; i < this->noncombustion_ptr_vec.size(); i++) {
+        Noncombustion* noncombustion_ptr = this->noncombustion_ptr_vec[i];
+        
+        noncombustion_ptr->resetEconomics(
+            cost_inputs.nominal_inflation_annual,
+            cost_inputs.nominal_discount_annual
+        );
+        
+        noncombustion_ptr->capital_cost_scalar = cost_inputs.capital_cost_scalar;
+        noncombustion_ptr->operation_maintenance_cost_scalar =
+            cost_inputs.operation_maintenance_cost_scalar;
+    }
+    
+    for (size_t i = 0; i < this->renewable_ptr_vec.size(); i++) {
+        Renewable* renewable_ptr = this->renewable_ptr_vec[i];
+        
+        renewable_ptr->resetEconomics(
+            cost_inputs.nominal_inflation_annual,
+            cost_inputs.nominal_discount_annual
+        );
+        
+        renewable_ptr->capital_cost_scalar = cost_inputs.capital_cost_scalar;
+        renewable_ptr->operation_maintenance_cost_scalar =
+            cost_inputs.operation_maintenance_cost_scalar;
+    }
+    
+    for (size_t i = 0; i < this->storage_ptr_vec.size(); i++) {
+        Storage* storage_ptr = this->storage_ptr_vec[i];
+        
+        storage_ptr->resetEconomics(
+            cost_inputs.nominal_inflation_annual,
+            cost_inputs.nominal_discount_annual
+        );
+        
+        storage_ptr->capital_cost_scalar = cost_inputs.capital_cost_scalar;
+        storage_ptr->operation_maintenance_cost_scalar =
+            cost_inputs.operation_maintenance_cost_scalar;
+    }
+    
+    //  3. reset economic metrics and the totals tallied alongside them
+    this->net_present_cost = 0;
+    this->levellized_cost_of_energy_kWh = 0;
+    
+    this->total_renewable_noncombustion_dispatch_kWh = 0;
+    this->total_renewable_noncombustion_charge_kWh = 0;
+    this->total_combustion_charge_kWh = 0;
+    this->total_discharge_kWh = 0;
+    this->total_dispatch_kWh = 0;
+    
+    //  4. recompute key economic metrics
+    this->__computeEconomics();
+    
+    return;
+}   /* recomputeEconomics() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn Model* Model :: clone(void)
+///
+/// \brief A method to make a copy of the Model. Every asset (along with its full
+///     state), the Controller, and the ThermalModel (if any) are deep copied, while
+///     the electrical load and resource data (and discount factors) are shared with
+///     this Model (read only), so this Model (or the shared ElectricalLoad, Resources,
+///     and DiscountFactorCache objects it refers to) must outlive the copy. The copy is independent otherwise, and can be freely
+///     altered, run, or continued (if cloned part way through a run).
+///
+/// \return A pointer to the copy (owned by the caller).
+///
+
+Model* Model :: clone(void)
+{
+    //  1. construct, share electrical load, resources, and discount factors
+    Model* model_ptr = new Model();
+    
+    model_ptr->electrical_load_ptr = this->electrical_load_ptr;
+    model_ptr->resources_ptr = this->resources_ptr;
+    model_ptr->discount_factor_cache_ptr = this->discount_factor_cache_ptr;
+    
+    //  2. copy components and attributes
+    model_ptr->controller = this->controller;
+    
+    model_ptr->total_fuel_consumed_L = this->total_fuel_consumed_L;
+    model_ptr->total_emissions = this->total_emissions;
+    
+    model_ptr->net_present_cost = this->net_present_cost;
+    
+    model_ptr->total_renewable_noncombustion_dispatch_kWh =
+        this->total_renewable_noncombustion_dispatch_kWh;
+    model_ptr->total_renewable_noncombustion_charge_kWh =
+        this->total_renewable_noncombustion_charge_kWh;
+    model_ptr->total_combustion_charge_kWh = this->total_combustion_charge_kWh;
+    model_ptr->total_discharge_kWh = this->total_discharge_kWh;
+    model_ptr->total_dispatch_kWh = this->total_dispatch_kWh;
+    model_ptr->renewable_penetration = this->renewable_penetration;
+    
+    model_ptr->levellized_cost_of_energy_kWh = this->levellized_cost_of_energy_kWh;
+    
+    model_ptr->summary_only = this->summary_only;
+    model_ptr->next_timestep = this->next_timestep;
+    
+    if (this->thermal_model_ptr != NULL) {
+        model_ptr->thermal_model_ptr = new ThermalModel(*(this->thermal_model_ptr));
+    }
+    
+    //  3. copy Combustion assets
+    for (size_t i = 0; i < this->combustion_ptr_vec.size(); i++) {
+        switch (this->combustion_ptr_vec[i]->type) {
+            case (CombustionType :: DIESEL): {
+                model_ptr->combustion_ptr_vec.push_back(
+                    new Diesel(*((Diesel*)(this->combustion_ptr_vec[i])))
+                );
+                
+                break;
+            }
+            
+            default: {
+                std::string error_str = "ERROR:  Model::clone():  ";
+                error_str += "CombustionType ";
+                error_str += std::to_string(this->combustion_ptr_vec[i]->type);
+                error_str += " not recognized";
+                
+                #ifdef _WIN32
+                    std::cout << error_str << std::endl;
+                #endif
+                
+                delete model_ptr;
+                throw std::runtime_error(error_str);
+                
+                break;
+            }
+        }
+    }
+    
+    //  4. copy Noncombustion assets
+    for (size_t i = 0; i < this->noncombustion_ptr_vec.size(); i++) {
+        switch (this->noncombustion_ptr_vec[i]->type) {
+            case (NoncombustionType :: HYDRO): {
+                model_ptr->noncombustion_ptr_vec.push_back(
+                    new Hydro(*((Hydro*)(this->noncombustion_ptr_vec[i])))
+                );
+                
+                break;
+            }
+            
+            default: {
+                std::string error_str = "ERROR:  Model::clone():  ";
+                error_str += "NoncombustionType ";
+                error_str += std::to_string(this->noncombustion_ptr_vec[i]->type);
+                error_str += " not recognized";
+                
+                #ifdef _WIN32
+                    std::cout << error_str << std::endl;
+                #endif
+                
+                delete model_ptr;
+                throw std::runtime_error(error_str);
+                
+                break;
+            }
+        }
+    }
+    
+    //  5. copy Renewable assets
+    for (size_t i = 0; i < this->renewable_ptr_vec.size(); i++) {
+        switch (this->renewable_ptr_vec[i]->type) {
+            case (RenewableType :: SOLAR): {
+                model_ptr->renewable_ptr_vec.push_back(
+                    new Solar(*((Solar*)(this->renewable_ptr_vec[i])))
+                );
+                
+                break;
+            }
+            
+            case (RenewableType :: TIDAL): {
+                model_ptr->renewable_ptr_vec.push_back(
+                    new Tidal(*((Tidal*)(this->renewable_ptr_vec[i])))
+                );
+                
+                break;
+            }
+            
+            case (RenewableType :: WAVE): {
+                model_ptr->renewable_ptr_vec.push_back(
+                    new Wave(*((Wave*)(this->renewable_ptr_vec[i])))
+                );
+                
+                break;
+            }
+            
+            case (RenewableType :: WIND): {
+                model_ptr->renewable_ptr_vec.push_back(
+                    new Wind(*((Wind*)(this->renewable_ptr_vec[i])))
+                );
+                
+                break;
+            }
+            
+            default: {
+                std::string error_str = "ERROR:  Model::clone():  ";
+                error_str += "RenewableType ";
+                error_str += std::to_string(this->renewable_ptr_vec[i]->type);
+                error_str += " not recognized";
+                
+                #ifdef _WIN32
+                    std::cout << error_str << std::endl;
+                #endif
+                
+                delete model_ptr;
+                throw std::runtime_error(error_str);
+                
+                break;
+            }
+        }
+    }
+    
+    //  6. copy Storage assets
+    for (size_t i = 0; i < this->storage_ptr_vec.size(); i++) {
+        switch (this->storage_ptr_vec[i]->type) {
+            case (StorageType :: LIION): {
+                model_ptr->storage_ptr_vec.push_back(
+                    new LiIon(*((LiIon*)(this->storage_ptr_vec[i])))
+                );
+                
+                break;
+            }
+            
+            case (StorageType :: H2_SYS): {
+                model_ptr->storage_ptr_vec.push_back(
+                    new H2(*((H2*)(this->storage_ptr_vec[i])))
+                );
+                
+                break;
+            }
+            
+            default: {
+                std::string error_str = "ERROR:  Model::clone():  ";
+                error_str += "StorageType ";
+                error_str += std::to_string(this->storage_ptr_vec[i]->type);
+                error_str += " not recognized";
+                
+                #ifdef _WIN32
+                    std::cout << error_str << std::endl;
+                #endif
+                
+                delete model_ptr;
+                throw std::runtime_error(error_str);
+                
+                break;
+            }
+        }
+    }
+    
+    return model_ptr;
+}   /* clone() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn Model* Model :: fork(int timestep)
+///
+/// \brief A method to advance the Model run up to (but not including) the given time
+///     step, and then return a copy of it (see clone()). Both this Model and the copy
+///     can then be continued independently (e.g., under different control modes) by
+///     way of run() or runUntil(), without re-running the common time steps.
+///
+/// \param timestep The time step at which to fork.
+///
+/// \return A pointer to the forked copy (owned by the caller).
+///
+
+Model* Model :: fork(int timestep)
+{
+    this->runUntil(timestep);
+    
+    return this->clone();
+}   /* fork() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -1191,6 +1952,7 @@ void Model :: reset(void)
     // 5. reset thermal model 
     if (this->thermal_model_ptr != NULL){
         delete this->thermal_model_ptr;
+        this->thermal_model_ptr = NULL;
     };
 
     //  6. reset components and attributes
@@ -1216,6 +1978,8 @@ void Model :: reset(void)
     
     this->levellized_cost_of_energy_kWh = 0;
     
+    this->next_timestep = 0;
+    
     return;
 }   /* reset() */
 
@@ -1240,6 +2004,7 @@ void Model :: clear(void)
     controller.clear();
     electrical_load.clear();
     resources.clear();
+    discount_factor_cache.clear();
     
     return;
 }   /* clear() */
@@ -1253,11 +2018,13 @@ void Model :: clear(void)
 ///
 /// \fn void Model :: writeResults(
 ///         std::string write_path,
-///         int max_lines
+///         int max_lines,
+///         ColumnarFormat columnar_format
 ///     )
 ///
 /// \brief Method which writes Model results to an output directory. Also calls out to
-///     writeResults() for each contained asset.
+///     writeResults() for each contained asset. The Model time series and each asset's
+///     results are written in parallel (on a TaskRunner), each to their own files.
 ///
 /// \param write_path A path (either relative or absolute) to the directory location 
 ///     where results are to be written. If already exists, will overwrite.
@@ -1265,15 +2032,25 @@ void Model :: clear(void)
 /// \param max_lines The maximum number of lines of output to write. If <0, then all
 ///     available lines are written. If =0, then only summary results are written.
 ///
+/// \param columnar_format The format of the (optional) binary columnar results file,
+///     time_series_results.pgmcol, which holds the time series results of the Model
+///     and every asset in a single file (see ColumnarWriter). Defaults to
+///     COLUMNAR_NONE (i.e., no such file is written).
+///
 
 void Model :: writeResults(
     std::string write_path,
-    int max_lines
+    int max_lines,
+    ColumnarFormat columnar_format
 )
 {
-    //  1. handle sentinel
+    //  1. handle sentinel (only summary results are written if summary only)
     if (max_lines < 0) {
-        max_lines = this->electrical_load.n_points;
+        max_lines = this->electrical_load_ptr->n_points;
+    }
+    
+    if (this->summary_only) {
+        max_lines = 0;
     }
     
     //  2. check for pre-existing, warn (and remove), then create
@@ -1296,64 +2073,103 @@ void Model :: writeResults(
     //  3. write summary
     this->__writeSummary(write_path);
     
-    //  4. write time series
-    if (max_lines > this->electrical_load.n_points) {
-        max_lines = this->electrical_load.n_points;
+    //  4. clamp max_lines
+    if (max_lines > this->electrical_load_ptr->n_points) {
+        max_lines = this->electrical_load_ptr->n_points;
     }
     
-    if (max_lines > 0) {
-        this->__writeTimeSeries(write_path, max_lines);
-    }
-    
-    //  5. call out to Combustion :: writeResults()
-    for (size_t i = 0; i < this->combustion_ptr_vec.size(); i++) {
-        this->combustion_ptr_vec[i]->writeResults(
-            write_path,
-            &(this->electrical_load.time_vec_hrs),
-            i,
-            max_lines
-        );
-    }
-    
-    //  6. call out to Noncombustion :: writeResults()
-    for (size_t i = 0; i < this->noncombustion_ptr_vec.size(); i++) {
-        this->noncombustion_ptr_vec[i]->writeResults(
-            write_path,
-            &(this->electrical_load.time_vec_hrs),
-            i,
-            max_lines
-        );
-    }
+    //  5. write time series, and call out to asset writeResults(), in parallel (task
+    //     order is Model, Combustion, Noncombustion, Renewable, Storage, ThermalModel,
+    //     and every task writes to its own files)
+    size_t n_combustion = this->combustion_ptr_vec.size();
+    size_t n_noncombustion = this->noncombustion_ptr_vec.size();
+    size_t n_renewable = this->renewable_ptr_vec.size();
+    size_t n_storage = this->storage_ptr_vec.size();
+    
+    size_t n_tasks = 1 + n_combustion + n_noncombustion + n_renewable + n_storage + 1;
+    
+    auto write_task = [&](size_t task) {
+        if (task == 0) {
+            if (max_lines > 0) {
+                this->__writeTimeSeries(write_path, max_lines);
+            }
+            
+            return;
+        }
+        
+        task -= 1;
+        
+        if (task < n_combustion) {
+            this->combustion_ptr_vec[task]->writeResults(
+                write_path,
+                &(this->electrical_load_ptr->time_vec_hrs),
+                task,
+                max_lines
+            );
+            
+            return;
+        }
+        
+        task -= n_combustion;
+        
+        if (task < n_noncombustion) {
+            this->noncombustion_ptr_vec[task]->writeResults(
+                write_path,
+                &(this->electrical_load_ptr->time_vec_hrs),
+                task,
+                max_lines
+            );
+            
+            return;
+        }
+        
+        task -= n_noncombustion;
+        
+        if (task < n_renewable) {
+            this->renewable_ptr_vec[task]->writeResults(
+                write_path,
+                &(this->electrical_load_ptr->time_vec_hrs),
+                &(this->resources_ptr->resource_map_1D),
+                &(this->resources_ptr->resource_map_2D),
+                task,
+                max_lines
+            );
+            
+            return;
+        }
+        
+        task -= n_renewable;
+        
+        if (task < n_storage) {
+            this->storage_ptr_vec[task]->writeResults(
+                write_path,
+                &(this->electrical_load_ptr->time_vec_hrs),
+                task,
+                max_lines
+            );
+            
+            return;
+        }
+        
+        // call on thermal energy model to write results and summary... 
+        if (this->thermal_model_ptr != NULL) {
+            this->thermal_model_ptr->__writeTimeSeries(
+                write_path,
+                &(this->electrical_load_ptr->time_vec_hrs),
+                max_lines
+            );
+        }
+        
+        return;
+    };
     
-    //  7. call out to Renewable :: writeResults()
-    for (size_t i = 0; i < this->renewable_ptr_vec.size(); i++) {
-        this->renewable_ptr_vec[i]->writeResults(
-            write_path,
-            &(this->electrical_load.time_vec_hrs),
-            &(this->resources.resource_map_1D),
-            &(this->resources.resource_map_2D),
-            i,
-            max_lines
-        );
-    }
+    TaskRunner task_runner;
+    task_runner.run(n_tasks, write_task);
     
-    //  8. call out to Storage :: writeResults()
-    for (size_t i = 0; i < this->storage_ptr_vec.size(); i++) {
-        this->storage_ptr_vec[i]->writeResults(
-            write_path,
-            &(this->electrical_load.time_vec_hrs),
-            i,
-            max_lines
-        );
+    //  6. write columnar results (if applicable)
+    if (columnar_format != ColumnarFormat :: COLUMNAR_NONE and max_lines > 0) {
+        this->__writeColumnar(write_path, max_lines, columnar_format);
     }
-
-    // call on thermal energy model to write results and summary... 
-    this->thermal_model_ptr->__writeTimeSeries(
-        write_path,
-        &(this->electrical_load.time_vec_hrs),
-        max_lines
-    );
-
     
     return;
 }   /* writeResults() */
@@ -99,6 +99,92 @@ void Combustion :: __checkInputs(CombustionInputs combustion_inputs)
 
 // ---------------------------------------------------------------------------------- //
 
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Combustion :: __compileFuelCurve(void)
+///
+/// \brief Helper method to compile the fuel consumption interpolation data into a
+///     piecewise linear table (see FuelCurveTable), so that fuel consumption lookups
+///     need neither a search nor a bounds check in the dispatch loop. If the load
+///     ratios of the data are not strictly increasing, then the table is left empty
+///     and lookups fall back on the interpolator.
+///
+
+void Combustion :: __compileFuelCurve(void)
+{
+    const InterpolatorStruct1D* data_ptr = this->interpolator.interp_map_1D[0].get();
+    FuelCurveTable* table_ptr = &(this->fuel_curve_table);
+    
+    *table_ptr = FuelCurveTable();
+    
+    if (data_ptr->n_points < 2 or not data_ptr->x_axis.is_increasing) {
+        return;
+    }
+    
+    //  1. compute slope and intercept of each segment
+    int n_segments = data_ptr->n_points - 1;
+    double min_dx = data_ptr->max_x - data_ptr->min_x;
+    
+    for (int i = 0; i < n_segments; i++) {
+        double x_0 = data_ptr->x_vec[i];
+        double x_1 = data_ptr->x_vec[i + 1];
+        double y_0 = data_ptr->y_vec[i];
+        double y_1 = data_ptr->y_vec[i + 1];
+        
+        double slope = (y_1 - y_0) / (x_1 - x_0);
+        
+        table_ptr->segment_max_load_ratio_vec.push_back(x_1);
+        table_ptr->slope_vec_Lhr.push_back(slope);
+        table_ptr->intercept_vec_Lhr.push_back(y_0 - slope * x_0);
+        
+        if (x_1 - x_0 < min_dx) {
+            min_dx = x_1 - x_0;
+        }
+    }
+    
+    //  2. size bins to the narrowest segment (up to FUEL_CURVE_MAX_BINS)
+    double span = data_ptr->max_x - data_ptr->min_x;
+    int n_bins = int(ceil(span / min_dx));
+    
+    if (n_bins > FUEL_CURVE_MAX_BINS) {
+        n_bins = FUEL_CURVE_MAX_BINS;
+    }
+    
+    if (n_bins < 1) {
+        n_bins = 1;
+    }
+    
+    table_ptr->n_bins = n_bins;
+    table_ptr->min_load_ratio = data_ptr->min_x;
+    table_ptr->max_load_ratio = data_ptr->max_x;
+    table_ptr->inverse_bin_width = n_bins / span;
+    
+    //  3. record the first segment overlapped by each bin
+    table_ptr->bin_segment_vec.resize(n_bins, 0);
+    
+    int segment = 0;
+    
+    for (int i = 0; i < n_bins; i++) {
+        double bin_min_load_ratio = data_ptr->min_x + (i * span) / n_bins;
+        
+        while (
+            segment < n_segments - 1 and
+            table_ptr->segment_max_load_ratio_vec[segment] <= bin_min_load_ratio
+        ) {
+            segment++;
+        }
+        
+        table_ptr->bin_segment_vec[i] = segment;
+    }
+    
+    return;
+}   /* __compileFuelCurve() */
+
+// ---------------------------------------------------------------------------------- //
+
 // ======== END PRIVATE ============================================================= //
 
 
@@ -177,6 +263,9 @@ Production(
                 combustion_inputs.path_2_fuel_interp_data
             );
             
+            this->fuel_interp_handle = this->interpolator.getHandle1D(0);
+            this->__compileFuelCurve();
+            
             break;
         }
         
@@ -205,6 +294,8 @@ Production(
         combustion_inputs.production_inputs.nominal_discount_annual
     );
     
+    this->fuel_cost_scalar = 1;
+    
     this->linear_fuel_slope_LkWh = 0;
     this->linear_fuel_intercept_LkWh = 0;
     
@@ -219,15 +310,14 @@ Production(
     
     this->total_fuel_consumed_L = 0;
     
-    this->fuel_consumption_vec_L.resize(this->n_points, 0);
-    this->fuel_cost_vec.resize(this->n_points, 0);
+    int n_record_points = this->n_points;
     
-    this->CO2_emissions_vec_kg.resize(this->n_points, 0);
-    this->CO_emissions_vec_kg.resize(this->n_points, 0);
-    this->NOx_emissions_vec_kg.resize(this->n_points, 0);
-    this->SOx_emissions_vec_kg.resize(this->n_points, 0);
-    this->CH4_emissions_vec_kg.resize(this->n_points, 0);
-    this->PM_emissions_vec_kg.resize(this->n_points, 0);
+    if (this->summary_only) {
+        n_record_points = 1;
+    }
+    
+    this->fuel_consumption_vec_L.resize(n_record_points, 0);
+    this->fuel_cost_vec.resize(n_record_points, 0);
     
     //  3. construction print
     if (this->print_flag) {
@@ -273,22 +363,24 @@ void Combustion :: handleReplacement(int timestep)
 /// \fn void Combustion :: computeFuelAndEmissions(void)
 ///
 /// \brief Helper method to compute the total fuel consumption and emissions over the
-///     Model run.
+///     Model run. If only summary results are recorded, then the total fuel consumption
+///     has already been accumulated over the Model run (see summarizeTimestep()).
+///     Since emissions are linear in fuel consumed, total emissions are computed
+///     directly from total fuel consumption.
 ///
 
 void Combustion :: computeFuelAndEmissions(void)
 {
-    for (int i = 0; i < n_points; i++) {
-        this->total_fuel_consumed_L += this->fuel_consumption_vec_L[i];
-        
-        this->total_emissions.CO2_kg += this->CO2_emissions_vec_kg[i];
-        this->total_emissions.CO_kg += this->CO_emissions_vec_kg[i];
-        this->total_emissions.NOx_kg += this->NOx_emissions_vec_kg[i];
-        this->total_emissions.SOx_kg += this->SOx_emissions_vec_kg[i];
-        this->total_emissions.CH4_kg += this->CH4_emissions_vec_kg[i];
-        this->total_emissions.PM_kg += this->PM_emissions_vec_kg[i];
+    //  1. total fuel consumption
+    if (not this->summary_only) {
+        for (int i = 0; i < n_points; i++) {
+            this->total_fuel_consumed_L += this->fuel_consumption_vec_L[i];
+        }
     }
     
+    //  2. total emissions
+    this->total_emissions = this->getEmissionskg(this->total_fuel_consumed_L);
+    
     return;
 }   /* computeFuelAndEmissions() */
 
@@ -299,7 +391,49 @@ void Combustion :: computeFuelAndEmissions(void)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Combustion :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
+/// \fn void Combustion :: computeEmissionsSeries(void)
+///
+/// \brief Method to materialize the emissions time series (one per species) from the
+///     recorded fuel consumption. Emissions are not recorded during the Model run, so
+///     this is only done on demand (e.g., when writing results).
+///
+
+void Combustion :: computeEmissionsSeries(void)
+{
+    size_t n_record_points = this->fuel_consumption_vec_L.size();
+    
+    this->CO2_emissions_vec_kg.resize(n_record_points);
+    this->CO_emissions_vec_kg.resize(n_record_points);
+    this->NOx_emissions_vec_kg.resize(n_record_points);
+    this->SOx_emissions_vec_kg.resize(n_record_points);
+    this->CH4_emissions_vec_kg.resize(n_record_points);
+    this->PM_emissions_vec_kg.resize(n_record_points);
+    
+    for (size_t i = 0; i < n_record_points; i++) {
+        Emissions emissions = this->getEmissionskg(this->fuel_consumption_vec_L[i]);
+        
+        this->CO2_emissions_vec_kg[i] = emissions.CO2_kg;
+        this->CO_emissions_vec_kg[i] = emissions.CO_kg;
+        this->NOx_emissions_vec_kg[i] = emissions.NOx_kg;
+        this->SOx_emissions_vec_kg[i] = emissions.SOx_kg;
+        this->CH4_emissions_vec_kg[i] = emissions.CH4_kg;
+        this->PM_emissions_vec_kg[i] = emissions.PM_kg;
+    }
+    
+    return;
+}   /* computeEmissionsSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Combustion :: computeEconomics(
+///         std::vector<double>* time_vec_hrs_ptr,
+///         DiscountFactorCache* discount_factor_cache_ptr
+///     )
 ///
 /// \brief Helper method to compute key economic metrics for the Model run.
 ///
@@ -307,26 +441,49 @@ void Combustion :: computeFuelAndEmissions(void)
 ///
 /// \param time_vec_hrs_ptr A pointer to the time_vec_hrs attribute of the ElectricalLoad.
 ///
+/// \param discount_factor_cache_ptr A pointer to a shared DiscountFactorCache (defaults
+///     to NULL), passed on to Production::computeEconomics().
+///
 
-void Combustion :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
+void Combustion :: computeEconomics(
+    std::vector<double>* time_vec_hrs_ptr,
+    DiscountFactorCache* discount_factor_cache_ptr
+)
 {
-    //  1. account for fuel costs in net present cost
+    //  1. account for fuel costs in net present cost (if summary only, then this has
+    //     already been accumulated over the Model run, see summarizeTimestep())
     double t_hrs = 0;
     double real_fuel_escalation_scalar = 0;
     
-    for (int i = 0; i < this->n_points; i++) {
-        t_hrs = time_vec_hrs_ptr->at(i);
-        
-        real_fuel_escalation_scalar = 1.0 / pow(
-            1 + this->real_fuel_escalation_annual,
-            t_hrs / 8760
-        );
-        
-        this->net_present_cost += real_fuel_escalation_scalar * this->fuel_cost_vec[i];
+    if (this->summary_only) {
+        // pass
+    }
+    
+    else if (discount_factor_cache_ptr != NULL) {
+        this->net_present_cost +=
+            this->fuel_cost_scalar *
+            discount_factor_cache_ptr->computePresentValue(
+                this->real_fuel_escalation_annual,
+                &(this->fuel_cost_vec)
+            );
+    }
+    
+    else {
+        for (int i = 0; i < this->n_points; i++) {
+            t_hrs = time_vec_hrs_ptr->at(i);
+            
+            real_fuel_escalation_scalar = 1.0 / pow(
+                1 + this->real_fuel_escalation_annual,
+                t_hrs / 8760
+            );
+            
+            this->net_present_cost += real_fuel_escalation_scalar *
+                this->fuel_cost_scalar * this->fuel_cost_vec[i];
+        }
     }
     
     //  2. invoke base class method
-    Production :: computeEconomics(time_vec_hrs_ptr);
+    Production :: computeEconomics(time_vec_hrs_ptr, discount_factor_cache_ptr);
     
     return;
 }   /* computeEconomics() */
@@ -335,6 +492,45 @@ void Combustion :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Combustion :: resetEconomics(
+///         double nominal_inflation_annual,
+///         double nominal_discount_annual
+///     )
+///
+/// \brief Method to apply new nominal inflation and discount rates (and so a new real
+///     fuel escalation rate), and to reset the economic metrics of the asset.
+///
+/// \param nominal_inflation_annual The nominal, annual inflation rate to use in
+///     computing model economics.
+///
+/// \param nominal_discount_annual The nominal, annual discount rate to use in
+///     computing model economics.
+///
+
+void Combustion :: resetEconomics(
+    double nominal_inflation_annual,
+    double nominal_discount_annual
+)
+{
+    //  1. invoke base class method
+    Production :: resetEconomics(nominal_inflation_annual, nominal_discount_annual);
+    
+    //  2. apply real fuel escalation rate
+    this->real_fuel_escalation_annual = this->computeRealDiscountAnnual(
+        this->nominal_fuel_escalation_annual,
+        nominal_discount_annual
+    );
+    
+    return;
+}   /* resetEconomics() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -376,21 +572,14 @@ double Combustion :: commit(
     
     
     if (this->is_running) {
+        int record_index = this->getRecordIndex(timestep);
+        
         //  2. compute and record fuel consumption
         double fuel_consumed_L = this->getFuelConsumptionL(dt_hrs, production_kW);
-        this->fuel_consumption_vec_L[timestep] = fuel_consumed_L;
+        this->fuel_consumption_vec_L[record_index] = fuel_consumed_L;
         
-        //  3. compute and record emissions
-        Emissions emissions = this->getEmissionskg(fuel_consumed_L);
-        this->CO2_emissions_vec_kg[timestep] = emissions.CO2_kg;
-        this->CO_emissions_vec_kg[timestep] = emissions.CO_kg;
-        this->NOx_emissions_vec_kg[timestep] = emissions.NOx_kg;
-        this->SOx_emissions_vec_kg[timestep] = emissions.SOx_kg;
-        this->CH4_emissions_vec_kg[timestep] = emissions.CH4_kg;
-        this->PM_emissions_vec_kg[timestep] = emissions.PM_kg;
-        
-        //  4. incur fuel costs
-        this->fuel_cost_vec[timestep] = fuel_consumed_L * this->fuel_cost_L;
+        //  3. incur fuel costs (emissions are derived from fuel consumption on demand)
+        this->fuel_cost_vec[record_index] = fuel_consumed_L * this->fuel_cost_L;
     }
     
     return load_kW;
@@ -400,6 +589,77 @@ double Combustion :: commit(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Combustion :: summarizeTimestep(int timestep, double t_hrs)
+///
+/// \brief Method to fold the fuel consumption and fuel costs of the given
+///     (completed) timestep into the running totals, and then clear the record, if only
+///     summary results are being recorded. Otherwise, does nothing.
+///
+/// Ref: \cite HOMER_discount_factor\n
+///
+/// \param timestep The timestep (i.e., time series index) to summarize.
+///
+/// \param t_hrs The point in time [hrs] associated with the timestep.
+///
+
+void Combustion :: summarizeTimestep(int timestep, double t_hrs)
+{
+    if (not this->summary_only) {
+        return;
+    }
+    
+    //  1. accumulate fuel consumption (emissions follow from the total, see
+    //     computeFuelAndEmissions())
+    this->total_fuel_consumed_L += this->fuel_consumption_vec_L[0];
+    
+    //  2. accumulate escalated fuel costs
+    double real_fuel_escalation_scalar = 1.0 / pow(
+        1 + this->real_fuel_escalation_annual,
+        t_hrs / 8760
+    );
+    
+    this->net_present_cost += real_fuel_escalation_scalar * this->fuel_cost_vec[0];
+    
+    //  3. clear record
+    this->fuel_consumption_vec_L[0] = 0;
+    this->fuel_cost_vec[0] = 0;
+    
+    //  4. invoke base class method
+    Production :: summarizeTimestep(timestep, t_hrs);
+    
+    return;
+}   /* summarizeTimestep() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Combustion :: getFuelCost(int timestep)
+///
+/// \brief Method to get the fuel cost incurred in the given timestep, as written to
+///     results.
+///
+/// \param timestep The timestep (i.e., time series index) of interest.
+///
+/// \return The (actual) fuel cost incurred in the given timestep, scaled by
+///     fuel_cost_scalar (see Model::recomputeEconomics()).
+///
+
+double Combustion :: getFuelCost(int timestep)
+{
+    return this->fuel_cost_scalar * this->fuel_cost_vec[timestep];
+}   /* getFuelCost() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -431,8 +691,42 @@ double Combustion :: getFuelConsumptionL(double dt_hrs, double production_kW)
         
         case (FuelMode :: FUEL_MODE_LOOKUP): {
             double load_ratio = production_kW / this->capacity_kW;
+            const FuelCurveTable* table_ptr = &(this->fuel_curve_table);
+            
+            //  fall back on the interpolator if the fuel curve is not compiled, or if
+            //  out of bounds (so that it can report the error)
+            if (
+                table_ptr->n_bins == 0 or
+                not (load_ratio >= table_ptr->min_load_ratio) or
+                not (load_ratio <= table_ptr->max_load_ratio)
+            ) {
+                fuel_consumed_L = this->interpolator.interp1D(
+                    this->fuel_interp_handle,
+                    load_ratio
+                ) * dt_hrs;
+                
+                break;
+            }
+            
+            int bin = int(
+                (load_ratio - table_ptr->min_load_ratio) *
+                table_ptr->inverse_bin_width
+            );
+            
+            if (bin >= table_ptr->n_bins) {
+                bin = table_ptr->n_bins - 1;
+            }
+            
+            int segment = table_ptr->bin_segment_vec[bin];
             
-            fuel_consumed_L = this->interpolator.interp1D(0, load_ratio) * dt_hrs;
+            while (load_ratio > table_ptr->segment_max_load_ratio_vec[segment]) {
+                segment++;
+            }
+            
+            fuel_consumed_L = (
+                table_ptr->slope_vec_Lhr[segment] * load_ratio +
+                table_ptr->intercept_vec_Lhr[segment]
+            ) * dt_hrs;
             
             break;
         }
@@ -521,11 +815,15 @@ void Combustion :: writeResults(
     int max_lines
 )
 {
-    //  1. handle sentinel
+    //  1. handle sentinel (no time series are recorded if summary only)
     if (max_lines < 0) {
         max_lines = this->n_points;
     }
     
+    if (this->summary_only) {
+        max_lines = 0;
+    }
+    
     //  2. create subdirectories
     write_path += "Production/";
     if (not std::filesystem::is_directory(write_path)) {
@@ -554,6 +852,7 @@ void Combustion :: writeResults(
     }
     
     if (max_lines > 0) {
+        this->computeEmissionsSeries();
         this->__writeTimeSeries(write_path, time_vec_hrs_ptr, max_lines);
     }
     
@@ -564,6 +863,97 @@ void Combustion :: writeResults(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Combustion :: addResultColumns(ColumnarWriter* columnar_writer_ptr)
+///
+/// \brief Method to add the time series results of the Combustion asset to a
+///     columnar results file (see ColumnarWriter).
+///
+/// \param columnar_writer_ptr A pointer to the ColumnarWriter to add columns to.
+///
+
+void Combustion :: addResultColumns(ColumnarWriter* columnar_writer_ptr)
+{
+    //  1. invoke base class method
+    Production :: addResultColumns(columnar_writer_ptr);
+    
+    //  2. materialize emissions series
+    this->computeEmissionsSeries();
+    
+    //  3. add fuel and emissions columns
+    columnar_writer_ptr->addColumn(
+        "Fuel Consumption",
+        "L",
+        &(this->fuel_consumption_vec_L)
+    );
+    
+    if (this->fuel_cost_scalar == 1) {
+        columnar_writer_ptr->addColumn(
+            "Fuel Cost (actual)",
+            "",
+            &(this->fuel_cost_vec)
+        );
+    }
+    
+    else {
+        std::vector<double> fuel_cost_vec(this->fuel_cost_vec);
+        
+        for (size_t i = 0; i < fuel_cost_vec.size(); i++) {
+            fuel_cost_vec[i] *= this->fuel_cost_scalar;
+        }
+        
+        columnar_writer_ptr->addColumn(
+            "Fuel Cost (actual)",
+            "",
+            std::move(fuel_cost_vec)
+        );
+    }
+    
+    columnar_writer_ptr->addColumn(
+        "Carbon Dioxide (CO2) Emissions",
+        "kg",
+        &(this->CO2_emissions_vec_kg)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Carbon Monoxide (CO) Emissions",
+        "kg",
+        &(this->CO_emissions_vec_kg)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Nitrogen Oxides (NOx) Emissions",
+        "kg",
+        &(this->NOx_emissions_vec_kg)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Sulfur Oxides (SOx) Emissions",
+        "kg",
+        &(this->SOx_emissions_vec_kg)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Methane (CH4) Emissions",
+        "kg",
+        &(this->CH4_emissions_vec_kg)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Particulate Matter (PM) Emissions",
+        "kg",
+        &(this->PM_emissions_vec_kg)
+    );
+    
+    return;
+}   /* addResultColumns() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
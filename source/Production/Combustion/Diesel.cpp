@@ -566,7 +566,7 @@ void Diesel :: __writeTimeSeries(
 {
     //  1. create filestream
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
+    BufferedWriter ofs;
     ofs.open(write_path, std::ofstream::out);
     
     //  2. write time series results (comma separated value)
@@ -588,6 +588,8 @@ void Diesel :: __writeTimeSeries(
     ofs << "Operation and Maintenance Cost (actual),";
     ofs << "\n";
     
+    size_t capital_cost_event_idx = 0;
+    
     for (int i = 0; i < max_lines; i++) {
         ofs << time_vec_hrs_ptr->at(i) << ",";
         ofs << this->production_vec_kW[i] << ",";
@@ -596,15 +598,15 @@ void Diesel :: __writeTimeSeries(
         ofs << this->curtailment_vec_kW[i] << ",";
         ofs << this->is_running_vec[i] << ",";
         ofs << this->fuel_consumption_vec_L[i] << ",";
-        ofs << this->fuel_cost_vec[i] << ",";
+        ofs << this->getFuelCost(i) << ",";
         ofs << this->CO2_emissions_vec_kg[i] << ",";
         ofs << this->CO_emissions_vec_kg[i] << ",";
         ofs << this->NOx_emissions_vec_kg[i] << ",";
         ofs << this->SOx_emissions_vec_kg[i] << ",";
         ofs << this->CH4_emissions_vec_kg[i] << ",";
         ofs << this->PM_emissions_vec_kg[i] << ",";
-        ofs << this->capital_cost_vec[i] << ",";
-        ofs << this->operation_maintenance_cost_vec[i] << ",";
+        ofs << this->getCapitalCost(i, &capital_cost_event_idx) << ",";
+        ofs << this->getOperationMaintenanceCost(i) << ",";
         ofs << "\n";
     }
 
@@ -723,7 +725,11 @@ Combustion(
     }
     
     if (not this->is_sunk) {
-        this->capital_cost_vec[0] = this->capital_cost;
+        this->incurCapitalCost(
+            0,
+            this->capital_cost,
+            CapitalCostReason :: CAPITAL_COST_INITIAL
+        );
     }
     
     //  3. construction print
@@ -874,7 +880,8 @@ double Diesel :: commit(
         
             double operation_maintenance_cost =
                 this->operation_maintenance_cost_kWh * produced_kWh;
-            this->operation_maintenance_cost_vec[timestep] = operation_maintenance_cost;
+            this->operation_maintenance_cost_vec[this->getRecordIndex(timestep)] =
+                operation_maintenance_cost;
         }
     }
     
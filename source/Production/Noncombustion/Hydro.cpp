@@ -148,11 +148,13 @@ void Hydro :: __initInterpolator(void)
         0.953, 0.954, 0.956, 0.958
     };
     
-    this->interpolator.interp_map_1D.insert(
-        std::pair<int, InterpolatorStruct1D>(
-            HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY,
-            generator_interp_struct_1D
-        )
+    this->interpolator.addData1D(
+        HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY,
+        generator_interp_struct_1D
+    );
+    
+    this->generator_efficiency_handle = this->interpolator.getHandle1D(
+        HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY
     );
     
     //  2. set up turbine efficiency interpolation
@@ -219,11 +221,13 @@ void Hydro :: __initInterpolator(void)
     
     turbine_interp_struct_1D.y_vec = efficiency_vec;
     
-    this->interpolator.interp_map_1D.insert(
-        std::pair<int, InterpolatorStruct1D>(
-            HydroInterpKeys :: TURBINE_EFFICIENCY_INTERP_KEY,
-            turbine_interp_struct_1D
-        )
+    this->interpolator.addData1D(
+        HydroInterpKeys :: TURBINE_EFFICIENCY_INTERP_KEY,
+        turbine_interp_struct_1D
+    );
+    
+    this->turbine_efficiency_handle = this->interpolator.getHandle1D(
+        HydroInterpKeys :: TURBINE_EFFICIENCY_INTERP_KEY
     );
     
     //  3. set up flow to power interpolation
@@ -269,11 +273,13 @@ void Hydro :: __initInterpolator(void)
     
     flow_to_power_interp_struct_1D.y_vec = power_vec_kW;
     
-    this->interpolator.interp_map_1D.insert(
-        std::pair<int, InterpolatorStruct1D>(
-            HydroInterpKeys :: FLOW_TO_POWER_INTERP_KEY,
-            flow_to_power_interp_struct_1D
-        )
+    this->interpolator.addData1D(
+        HydroInterpKeys :: FLOW_TO_POWER_INTERP_KEY,
+        flow_to_power_interp_struct_1D
+    );
+    
+    this->flow_to_power_handle = this->interpolator.getHandle1D(
+        HydroInterpKeys :: FLOW_TO_POWER_INTERP_KEY
     );
     
     return;
@@ -367,13 +373,13 @@ double Hydro :: __getEfficiencyFactor(double power_kW)
     
     //  3. init efficiency factor to the turbine efficiency
     double efficiency_factor = this->interpolator.interp1D(
-        HydroInterpKeys :: TURBINE_EFFICIENCY_INTERP_KEY,
+        this->turbine_efficiency_handle,
         power_ratio
     );
     
     //  4. include generator efficiency
     efficiency_factor *= this->interpolator.interp1D(
-        HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY,
+        this->generator_efficiency_handle,
         power_ratio
     );
     
@@ -457,7 +463,7 @@ double Hydro :: __flowToPower(double flow_m3hr)
     
     //  2. interpolate flow to power
     double power_kW = this->interpolator.interp1D(
-        HydroInterpKeys :: FLOW_TO_POWER_INTERP_KEY,
+        this->flow_to_power_handle,
         flow_m3hr
     );
     
@@ -609,7 +615,7 @@ void Hydro :: __updateState(
         flow_m3hr = available_flow_m3hr;
     }
     
-    this->turbine_flow_vec_m3hr[timestep] = flow_m3hr;
+    this->turbine_flow_vec_m3hr[this->getRecordIndex(timestep)] = flow_m3hr;
     
     //  3. compute net reservoir flow
     double net_flow_m3hr = hydro_resource_m3hr - flow_m3hr;
@@ -625,11 +631,12 @@ void Hydro :: __updateState(
         net_flow_m3hr = acceptable_flow_m3hr;
     }
     
-    this->spill_rate_vec_m3hr[timestep] = spill_m3hr;
+    this->spill_rate_vec_m3hr[this->getRecordIndex(timestep)] = spill_m3hr;
     
     //  6. update reservoir state, log
     this->stored_volume_m3 += net_flow_m3hr * dt_hrs;
-    this->stored_volume_vec_m3[timestep] = this->stored_volume_m3;
+    this->stored_volume_vec_m3[this->getRecordIndex(timestep)] =
+        this->stored_volume_m3;
     
     return;
 }   /* __updateState() */
@@ -803,7 +810,7 @@ void Hydro :: __writeTimeSeries(
 {
     //  1. create filestream
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
+    BufferedWriter ofs;
     ofs.open(write_path, std::ofstream::out);
     
     //  2. write time series results (comma separated value)
@@ -820,6 +827,8 @@ void Hydro :: __writeTimeSeries(
     ofs << "Operation and Maintenance Cost (actual),";
     ofs << "\n";
     
+    size_t capital_cost_event_idx = 0;
+    
     for (int i = 0; i < max_lines; i++) {
         ofs << time_vec_hrs_ptr->at(i) << ",";
         ofs << this->production_vec_kW[i] << ",";
@@ -830,8 +839,8 @@ void Hydro :: __writeTimeSeries(
         ofs << this->turbine_flow_vec_m3hr[i] << ",";
         ofs << this->spill_rate_vec_m3hr[i] << ",";
         ofs << this->stored_volume_vec_m3[i] << ",";
-        ofs << this->capital_cost_vec[i] << ",";
-        ofs << this->operation_maintenance_cost_vec[i] << ",";
+        ofs << this->getCapitalCost(i, &capital_cost_event_idx) << ",";
+        ofs << this->getOperationMaintenanceCost(i) << ",";
         ofs << "\n";
     }
 
@@ -924,9 +933,15 @@ Noncombustion(
     this->minimum_flow_m3hr = this->__getMinimumFlowm3hr();
     this->maximum_flow_m3hr = this->__getMaximumFlowm3hr();
     
-    this->turbine_flow_vec_m3hr.resize(this->n_points, 0);
-    this->spill_rate_vec_m3hr.resize(this->n_points, 0);
-    this->stored_volume_vec_m3.resize(this->n_points, 0);
+    int n_record_points = this->n_points;
+    
+    if (this->summary_only) {
+        n_record_points = 1;
+    }
+    
+    this->turbine_flow_vec_m3hr.resize(n_record_points, 0);
+    this->spill_rate_vec_m3hr.resize(n_record_points, 0);
+    this->stored_volume_vec_m3.resize(n_record_points, 0);
     
     if (hydro_inputs.capital_cost < 0) {
         this->capital_cost = this->__getGenericCapitalCost();
@@ -944,7 +959,11 @@ Noncombustion(
     }
     
     if (not this->is_sunk) {
-        this->capital_cost_vec[0] = this->capital_cost;
+        this->incurCapitalCost(
+            0,
+            this->capital_cost,
+            CapitalCostReason :: CAPITAL_COST_INITIAL
+        );
     }
     
     return;
@@ -1113,6 +1132,39 @@ double Hydro :: commit(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Hydro :: addResultColumns(ColumnarWriter* columnar_writer_ptr)
+///
+/// \brief Method to add the time series results of the Hydro asset to a
+///     columnar results file (see ColumnarWriter).
+///
+/// \param columnar_writer_ptr A pointer to the ColumnarWriter to add columns to.
+///
+
+void Hydro :: addResultColumns(ColumnarWriter* columnar_writer_ptr)
+{
+    //  1. invoke base class method
+    Production :: addResultColumns(columnar_writer_ptr);
+    
+    //  2. add flow and reservoir columns
+    columnar_writer_ptr->addColumn(
+        "Turbine Flow",
+        "m3/hr",
+        &(this->turbine_flow_vec_m3hr)
+    );
+    
+    columnar_writer_ptr->addColumn("Spill Rate", "m3/hr", &(this->spill_rate_vec_m3hr));
+    columnar_writer_ptr->addColumn("Stored Volume", "m3", &(this->stored_volume_vec_m3));
+    
+    return;
+}   /* addResultColumns() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
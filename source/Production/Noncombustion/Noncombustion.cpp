@@ -213,7 +213,10 @@ void Noncombustion :: handleReplacement(int timestep)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Noncombustion :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
+/// \fn void Noncombustion :: computeEconomics(
+///         std::vector<double>* time_vec_hrs_ptr,
+///         DiscountFactorCache* discount_factor_cache_ptr
+///     )
 ///
 /// \brief Helper method to compute key economic metrics for the Model run.
 ///
@@ -221,11 +224,17 @@ void Noncombustion :: handleReplacement(int timestep)
 ///
 /// \param time_vec_hrs_ptr A pointer to the time_vec_hrs attribute of the ElectricalLoad.
 ///
+/// \param discount_factor_cache_ptr A pointer to a shared DiscountFactorCache (defaults
+///     to NULL), passed on to Production::computeEconomics().
+///
 
-void Noncombustion :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
+void Noncombustion :: computeEconomics(
+    std::vector<double>* time_vec_hrs_ptr,
+    DiscountFactorCache* discount_factor_cache_ptr
+)
 {
     //  1. invoke base class method
-    Production :: computeEconomics(time_vec_hrs_ptr);
+    Production :: computeEconomics(time_vec_hrs_ptr, discount_factor_cache_ptr);
     
     return;
 }   /* computeEconomics() */
@@ -317,11 +326,15 @@ void Noncombustion :: writeResults(
     int max_lines
 )
 {
-    //  1. handle sentinel
+    //  1. handle sentinel (no time series are recorded if summary only)
     if (max_lines < 0) {
         max_lines = this->n_points;
     }
     
+    if (this->summary_only) {
+        max_lines = 0;
+    }
+    
     //  2. create subdirectories
     write_path += "Production/";
     if (not std::filesystem::is_directory(write_path)) {
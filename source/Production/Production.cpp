@@ -348,6 +348,7 @@ Production :: Production(
     this->is_running = false;
     this->is_sunk = production_inputs.is_sunk;
     this->normalized_production_series_given = false;
+    this->summary_only = production_inputs.summary_only;
     
     this->n_points = n_points;
     this->n_starts = 0;
@@ -370,6 +371,8 @@ Production :: Production(
     
     this->capital_cost = 0;
     this->operation_maintenance_cost_kWh = 0;
+    this->capital_cost_scalar = 1;
+    this->operation_maintenance_cost_scalar = 1;
     this->net_present_cost = 0;
     this->total_dispatch_kWh = 0;
     this->total_stored_kWh = 0;
@@ -378,16 +381,21 @@ Production :: Production(
     
     this->path_2_normalized_production_time_series = "";
     
-    this->is_running_vec.resize(this->n_points, 0);
+    int n_record_points = this->n_points;
+    
+    if (this->summary_only) {
+        n_record_points = 1;
+    }
+    
+    this->is_running_vec.resize(n_record_points, 0);
     
     this->normalized_production_vec.resize(this->n_points, 0);
-    this->production_vec_kW.resize(this->n_points, 0);
-    this->dispatch_vec_kW.resize(this->n_points, 0);
-    this->storage_vec_kW.resize(this->n_points, 0);
-    this->curtailment_vec_kW.resize(this->n_points, 0);
+    this->production_vec_kW.resize(n_record_points, 0);
+    this->dispatch_vec_kW.resize(n_record_points, 0);
+    this->storage_vec_kW.resize(n_record_points, 0);
+    this->curtailment_vec_kW.resize(n_record_points, 0);
     
-    this->capital_cost_vec.resize(this->n_points, 0);
-    this->operation_maintenance_cost_vec.resize(this->n_points, 0);
+    this->operation_maintenance_cost_vec.resize(n_record_points, 0);
     
     //  3. read in normalized production time series (if given)
     if (not production_inputs.path_2_normalized_production_time_series.empty()) {
@@ -431,7 +439,11 @@ void Production :: handleReplacement(int timestep)
     this->n_replacements++;
     
     //  3. incur capital cost in timestep
-    this->capital_cost_vec[timestep] = this->capital_cost;
+    this->incurCapitalCost(
+        timestep,
+        this->capital_cost,
+        CapitalCostReason :: CAPITAL_COST_REPLACEMENT
+    );
     
     return;
 }   /* __handleReplacement() */
@@ -440,6 +452,164 @@ void Production :: handleReplacement(int timestep)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Production :: incurCapitalCost(
+///         int timestep,
+///         double cost,
+///         CapitalCostReason reason
+///     )
+///
+/// \brief Method to log a capital cost incurred by the asset. Costs must be logged in
+///     time order (as they are over a Model run).
+///
+/// \param timestep The timestep (i.e., time series index) in which the cost is incurred.
+///
+/// \param cost The capital cost incurred (undefined currency).
+///
+/// \param reason The reason for which the cost is incurred.
+///
+
+void Production :: incurCapitalCost(
+    int timestep,
+    double cost,
+    CapitalCostReason reason
+)
+{
+    //  1. check time order
+    if (
+        not this->capital_cost_event_vec.empty() and
+        timestep < this->capital_cost_event_vec.back().timestep
+    ) {
+        std::string error_str = "ERROR:  Production::incurCapitalCost():  ";
+        error_str += "capital costs must be logged in time order";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+        
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  2. log event
+    CapitalCostEvent capital_cost_event;
+    
+    capital_cost_event.timestep = timestep;
+    capital_cost_event.cost = cost;
+    capital_cost_event.reason = reason;
+    
+    this->capital_cost_event_vec.push_back(capital_cost_event);
+    
+    return;
+}   /* incurCapitalCost() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Production :: getCapitalCost(int timestep, size_t* event_idx_ptr)
+///
+/// \brief Method to get the capital cost incurred in the given timestep, by walking the
+///     (time ordered) capital cost event log from the given cursor. Intended for
+///     writing results over ascending timesteps, so that no dense time series of
+///     capital costs need be held.
+///
+/// \param timestep The timestep (i.e., time series index) of interest.
+///
+/// \param event_idx_ptr A pointer to the index of the next unread event in the log
+///     (cursor). Should start at 0, and is advanced past all events up to and including
+///     the given timestep.
+///
+/// \return The (actual) capital cost incurred in the given timestep, scaled by
+///     capital_cost_scalar (see Model::recomputeEconomics()).
+///
+
+double Production :: getCapitalCost(int timestep, size_t* event_idx_ptr)
+{
+    double capital_cost = 0;
+    
+    while (
+        *event_idx_ptr < this->capital_cost_event_vec.size() and
+        this->capital_cost_event_vec[*event_idx_ptr].timestep <= timestep
+    ) {
+        if (this->capital_cost_event_vec[*event_idx_ptr].timestep == timestep) {
+            capital_cost += this->capital_cost_event_vec[*event_idx_ptr].cost;
+        }
+        
+        (*event_idx_ptr)++;
+    }
+    
+    return this->capital_cost_scalar * capital_cost;
+}   /* getCapitalCost() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::vector<double> Production :: getCapitalCostSeries(void)
+///
+/// \brief Method to expand the capital cost event log into a time series of (actual)
+///     capital costs. The series is returned by value, and so is held only as long as
+///     the caller needs it (e.g., while writing columnar results).
+///
+/// \return A time series of the capital costs incurred over each modelling time step
+///     (scaled by capital_cost_scalar), or an empty vector if only summary results are
+///     recorded.
+///
+
+std::vector<double> Production :: getCapitalCostSeries(void)
+{
+    std::vector<double> capital_cost_vec;
+    
+    if (this->summary_only) {
+        return capital_cost_vec;
+    }
+    
+    capital_cost_vec.resize(this->n_points, 0);
+    
+    for (size_t i = 0; i < this->capital_cost_event_vec.size(); i++) {
+        capital_cost_vec[this->capital_cost_event_vec[i].timestep] +=
+            this->capital_cost_scalar * this->capital_cost_event_vec[i].cost;
+    }
+    
+    return capital_cost_vec;
+}   /* getCapitalCostSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Production :: getOperationMaintenanceCost(int timestep)
+///
+/// \brief Method to get the operation and maintenance cost incurred in the given
+///     timestep, as written to results.
+///
+/// \param timestep The timestep (i.e., time series index) of interest.
+///
+/// \return The (actual) operation and maintenance cost incurred in the given timestep,
+///     scaled by operation_maintenance_cost_scalar (see Model::recomputeEconomics()).
+///
+
+double Production :: getOperationMaintenanceCost(int timestep)
+{
+    return this->operation_maintenance_cost_scalar *
+        this->operation_maintenance_cost_vec[timestep];
+}   /* getOperationMaintenanceCost() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -480,7 +650,10 @@ double Production :: computeRealDiscountAnnual(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Production :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
+/// \fn void Production :: computeEconomics(
+///         std::vector<double>* time_vec_hrs_ptr,
+///         DiscountFactorCache* discount_factor_cache_ptr
+///     )
 ///
 /// \brief Helper method to compute key economic metrics for the Model run.
 ///
@@ -491,28 +664,76 @@ double Production :: computeRealDiscountAnnual(
 ///
 /// \param time_vec_hrs_ptr A pointer to the time_vec_hrs attribute of the ElectricalLoad.
 ///
+/// \param discount_factor_cache_ptr A pointer to a shared DiscountFactorCache (defaults
+///     to NULL). If given, then net present cost is computed as a dot product of cached
+///     discount factors with the cost vectors, rather than by computing the discount
+///     factors anew.
+///
 
-void Production :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
+void Production :: computeEconomics(
+    std::vector<double>* time_vec_hrs_ptr,
+    DiscountFactorCache* discount_factor_cache_ptr
+)
 {
-    //  1. compute net present cost
+    //  1. account for capital costs in net present cost (over the capital cost events)
     double t_hrs = 0;
     double real_discount_scalar = 0;
     
-    for (int i = 0; i < this->n_points; i++) {
-        t_hrs = time_vec_hrs_ptr->at(i);
-        
-        real_discount_scalar = 1.0 / pow(
-            1 + this->real_discount_annual,
-            t_hrs / 8760
-        );
-        
-        this->net_present_cost += real_discount_scalar * this->capital_cost_vec[i];
-        
+    if (discount_factor_cache_ptr != NULL) {
+        this->net_present_cost +=
+            this->capital_cost_scalar *
+            discount_factor_cache_ptr->computePresentValue(
+                this->real_discount_annual,
+                &(this->capital_cost_event_vec)
+            );
+    }
+    
+    else {
+        for (size_t i = 0; i < this->capital_cost_event_vec.size(); i++) {
+            t_hrs = time_vec_hrs_ptr->at(this->capital_cost_event_vec[i].timestep);
+            
+            real_discount_scalar = 1.0 / pow(
+                1 + this->real_discount_annual,
+                t_hrs / 8760
+            );
+            
+            this->net_present_cost += real_discount_scalar *
+                this->capital_cost_scalar * this->capital_cost_event_vec[i].cost;
+        }
+    }
+    
+    //  2. account for operation and maintenance costs in net present cost (if summary
+    //     only, then this has already been accumulated over the Model run, see
+    //     summarizeTimestep())
+    if (this->summary_only) {
+        // pass
+    }
+    
+    else if (discount_factor_cache_ptr != NULL) {
         this->net_present_cost +=
-            real_discount_scalar * this->operation_maintenance_cost_vec[i];
+            this->operation_maintenance_cost_scalar *
+            discount_factor_cache_ptr->computePresentValue(
+                this->real_discount_annual,
+                &(this->operation_maintenance_cost_vec)
+            );
     }
     
-    /// 2. compute levellized cost of energy (per unit dispatched)
+    else {
+        for (int i = 0; i < this->n_points; i++) {
+            t_hrs = time_vec_hrs_ptr->at(i);
+            
+            real_discount_scalar = 1.0 / pow(
+                1 + this->real_discount_annual,
+                t_hrs / 8760
+            );
+            
+            this->net_present_cost += real_discount_scalar *
+                this->operation_maintenance_cost_scalar *
+                this->operation_maintenance_cost_vec[i];
+        }
+    }
+    
+    /// 3. compute levellized cost of energy (per unit dispatched)
     //     assuming 8,760 hours per year
     if (this->total_dispatch_kWh <= 0) {
         this->levellized_cost_of_energy_kWh = this->net_present_cost;
@@ -540,6 +761,50 @@ void Production :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Production :: resetEconomics(
+///         double nominal_inflation_annual,
+///         double nominal_discount_annual
+///     )
+///
+/// \brief Method to apply new nominal inflation and discount rates, and to reset the
+///     economic metrics of the asset, so that they can be recomputed from the recorded
+///     time series (see Model::recomputeEconomics()).
+///
+/// \param nominal_inflation_annual The nominal, annual inflation rate to use in
+///     computing model economics.
+///
+/// \param nominal_discount_annual The nominal, annual discount rate to use in
+///     computing model economics.
+///
+
+void Production :: resetEconomics(
+    double nominal_inflation_annual,
+    double nominal_discount_annual
+)
+{
+    //  1. apply rates
+    this->nominal_inflation_annual = nominal_inflation_annual;
+    this->nominal_discount_annual = nominal_discount_annual;
+    
+    this->real_discount_annual = this->computeRealDiscountAnnual(
+        nominal_inflation_annual,
+        nominal_discount_annual
+    );
+    
+    //  2. reset economic metrics
+    this->net_present_cost = 0;
+    this->levellized_cost_of_energy_kWh = 0;
+    
+    return;
+}   /* resetEconomics() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -597,7 +862,8 @@ double Production :: commit(
 )
 {
     //  1. record production
-    this->production_vec_kW[timestep] = production_kW;
+    int record_index = this->getRecordIndex(timestep);
+    this->production_vec_kW[record_index] = production_kW;
     
     //  2. compute and record dispatch and curtailment
     double dispatch_kW = 0;
@@ -612,9 +878,9 @@ double Production :: commit(
         dispatch_kW = production_kW;
     }
     
-    this->dispatch_vec_kW[timestep] = dispatch_kW;
+    this->dispatch_vec_kW[record_index] = dispatch_kW;
     this->total_dispatch_kWh += dispatch_kW * dt_hrs;
-    this->curtailment_vec_kW[timestep] = curtailment_kW;
+    this->curtailment_vec_kW[record_index] = curtailment_kW;
     this->curtailment_total_kWh += curtailment_kW * dt_hrs;
     
     //  3. update load
@@ -623,7 +889,7 @@ double Production :: commit(
     //  4. update and log running attributes
     if (this->is_running) {
         //  4.1. log running state, running hours
-        this->is_running_vec[timestep] = this->is_running;
+        this->is_running_vec[record_index] = this->is_running;
         this->running_hours += dt_hrs;
         
         //  4.2. incur operation and maintenance costs
@@ -631,7 +897,8 @@ double Production :: commit(
         
         double operation_maintenance_cost =
             this->operation_maintenance_cost_kWh * produced_kWh;
-        this->operation_maintenance_cost_vec[timestep] = operation_maintenance_cost;
+        this->operation_maintenance_cost_vec[record_index] =
+            operation_maintenance_cost;
     }
     
     //  5. trigger replacement, if applicable
@@ -646,6 +913,141 @@ double Production :: commit(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn int Production :: getRecordIndex(int timestep)
+///
+/// \brief Method to get the index into the per-timestep result vectors at which the
+///     given timestep is recorded. This is simply the timestep, unless only summary
+///     results are being recorded, in which case the result vectors hold only the
+///     current time step.
+///
+/// \param timestep The timestep (i.e., time series index) for the request.
+///
+/// \return The index into the per-timestep result vectors for the given timestep.
+///
+
+int Production :: getRecordIndex(int timestep)
+{
+    if (this->summary_only) {
+        return 0;
+    }
+    
+    return timestep;
+}   /* getRecordIndex() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Production :: summarizeTimestep(int timestep, double t_hrs)
+///
+/// \brief Method to fold the results of the given (completed) timestep into the
+///     running totals, and then clear the record, if only summary results are being
+///     recorded. Otherwise, does nothing (the full result vectors are processed after
+///     the Model run instead).
+///
+/// Ref: \cite HOMER_discount_factor\n
+///
+/// \param timestep The timestep (i.e., time series index) to summarize.
+///
+/// \param t_hrs The point in time [hrs] associated with the timestep.
+///
+
+void Production :: summarizeTimestep(int timestep, double t_hrs)
+{
+    if (not this->summary_only) {
+        return;
+    }
+    
+    //  1. accumulate discounted costs incurred in timestep (capital costs are logged
+    //     as events, see computeEconomics())
+    double real_discount_scalar = 1.0 / pow(
+        1 + this->real_discount_annual,
+        t_hrs / 8760
+    );
+    
+    this->net_present_cost +=
+        real_discount_scalar * this->operation_maintenance_cost_vec[0];
+    
+    //  2. clear record
+    this->is_running_vec[0] = false;
+    
+    this->production_vec_kW[0] = 0;
+    this->dispatch_vec_kW[0] = 0;
+    this->storage_vec_kW[0] = 0;
+    this->curtailment_vec_kW[0] = 0;
+    
+    this->operation_maintenance_cost_vec[0] = 0;
+    
+    return;
+}   /* summarizeTimestep() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Production :: addResultColumns(ColumnarWriter* columnar_writer_ptr)
+///
+/// \brief Method to add the time series results of the Production asset to a
+///     columnar results file (see ColumnarWriter).
+///
+/// \param columnar_writer_ptr A pointer to the ColumnarWriter to add columns to.
+///
+
+void Production :: addResultColumns(ColumnarWriter* columnar_writer_ptr)
+{
+    columnar_writer_ptr->addColumn("Production", "kW", &(this->production_vec_kW));
+    columnar_writer_ptr->addColumn("Dispatch", "kW", &(this->dispatch_vec_kW));
+    columnar_writer_ptr->addColumn("Storage", "kW", &(this->storage_vec_kW));
+    columnar_writer_ptr->addColumn("Curtailment", "kW", &(this->curtailment_vec_kW));
+    columnar_writer_ptr->addColumn("Is Running", "", &(this->is_running_vec));
+    
+    columnar_writer_ptr->addColumn(
+        "Capital Cost (actual)",
+        "",
+        this->getCapitalCostSeries()
+    );
+    
+    if (this->operation_maintenance_cost_scalar == 1) {
+        columnar_writer_ptr->addColumn(
+            "Operation and Maintenance Cost (actual)",
+            "",
+            &(this->operation_maintenance_cost_vec)
+        );
+    }
+    
+    else {
+        std::vector<double> operation_maintenance_cost_vec(
+            this->operation_maintenance_cost_vec
+        );
+        
+        for (size_t i = 0; i < operation_maintenance_cost_vec.size(); i++) {
+            operation_maintenance_cost_vec[i] *=
+                this->operation_maintenance_cost_scalar;
+        }
+        
+        columnar_writer_ptr->addColumn(
+            "Operation and Maintenance Cost (actual)",
+            "",
+            std::move(operation_maintenance_cost_vec)
+        );
+    }
+    
+    return;
+}   /* addResultColumns() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -213,17 +213,26 @@ void Renewable :: handleReplacement(int timestep)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Renewable :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
+/// \fn void Renewable :: computeEconomics(
+///         std::vector<double>* time_vec_hrs_ptr,
+///         DiscountFactorCache* discount_factor_cache_ptr
+///     )
 ///
 /// \brief Helper method to compute key economic metrics for the Model run.
 ///
 /// \param time_vec_hrs_ptr A pointer to the time_vec_hrs attribute of the ElectricalLoad.
 ///
+/// \param discount_factor_cache_ptr A pointer to a shared DiscountFactorCache (defaults
+///     to NULL), passed on to Production::computeEconomics().
+///
 
-void Renewable :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
+void Renewable :: computeEconomics(
+    std::vector<double>* time_vec_hrs_ptr,
+    DiscountFactorCache* discount_factor_cache_ptr
+)
 {
     //  1. invoke base class method
-    Production :: computeEconomics(time_vec_hrs_ptr);
+    Production :: computeEconomics(time_vec_hrs_ptr, discount_factor_cache_ptr);
     
     return;
 }   /* computeEconomics() */
@@ -232,6 +241,176 @@ void Renewable :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Renewable :: computeProductionkWBatch(
+///         int n_points,
+///         const double* dt_vec_hrs,
+///         const double* resource_vec,
+///         double* production_vec_kW
+///     )
+///
+/// \brief Method to compute production over a whole series of timesteps [0, n_points)
+///     in one call. Equivalent to calling computeProductionkW() for each timestep in
+///     turn (without committing in between). Derived classes may override with a
+///     whole-series kernel.
+///
+/// \param n_points The number of timesteps to compute.
+///
+/// \param dt_vec_hrs A pointer to the intervals of time [hrs] associated with each
+///     timestep.
+///
+/// \param resource_vec A pointer to the resource value at each timestep. Not read (and
+///     so may be NULL) if a normalized production time series was given.
+///
+/// \param production_vec_kW A pointer to the production [kW] at each timestep (output).
+///
+
+void Renewable :: computeProductionkWBatch(
+    int n_points,
+    const double* dt_vec_hrs,
+    const double* resource_vec,
+    double* production_vec_kW
+)
+{
+    //  1. given production time series override
+    if (this->normalized_production_series_given) {
+        for (int i = 0; i < n_points; i++) {
+            production_vec_kW[i] = Production :: getProductionkW(i);
+        }
+        
+        return;
+    }
+    
+    //  2. compute production at each timestep
+    for (int i = 0; i < n_points; i++) {
+        production_vec_kW[i] = this->computeProductionkW(
+            i,
+            dt_vec_hrs[i],
+            resource_vec[i]
+        );
+    }
+    
+    return;
+}   /* computeProductionkWBatch() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Renewable :: computeProductionkWBatch(
+///         int n_points,
+///         const double* dt_vec_hrs,
+///         const double* resource_vec_1,
+///         const double* resource_vec_2,
+///         double* production_vec_kW
+///     )
+///
+/// \brief Method to compute production over a whole series of timesteps [0, n_points)
+///     in one call, for assets with a two-channel (2D) resource. Equivalent to calling
+///     computeProductionkW() for each timestep in turn (without committing in
+///     between). Derived classes may override with a whole-series kernel.
+///
+/// \param n_points The number of timesteps to compute.
+///
+/// \param dt_vec_hrs A pointer to the intervals of time [hrs] associated with each
+///     timestep.
+///
+/// \param resource_vec_1 A pointer to the first resource channel at each timestep. Not
+///     read (and so may be NULL) if a normalized production time series was given.
+///
+/// \param resource_vec_2 A pointer to the second resource channel at each timestep. Not
+///     read (and so may be NULL) if a normalized production time series was given.
+///
+/// \param production_vec_kW A pointer to the production [kW] at each timestep (output).
+///
+
+void Renewable :: computeProductionkWBatch(
+    int n_points,
+    const double* dt_vec_hrs,
+    const double* resource_vec_1,
+    const double* resource_vec_2,
+    double* production_vec_kW
+)
+{
+    //  1. given production time series override
+    if (this->normalized_production_series_given) {
+        for (int i = 0; i < n_points; i++) {
+            production_vec_kW[i] = Production :: getProductionkW(i);
+        }
+        
+        return;
+    }
+    
+    //  2. compute production at each timestep
+    for (int i = 0; i < n_points; i++) {
+        production_vec_kW[i] = this->computeProductionkW(
+            i,
+            dt_vec_hrs[i],
+            resource_vec_1[i],
+            resource_vec_2[i]
+        );
+    }
+    
+    return;
+}   /* computeProductionkWBatch() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Renewable :: computeProductionkWBatch(
+///         int n_points,
+///         const double* dt_vec_hrs,
+///         const ResourceBinding* resource_binding_ptr,
+///         double* production_vec_kW
+///     )
+///
+/// \brief Method to compute production over a whole series of timesteps [0, n_points)
+///     in one call, reading the resource from the given binding. This is the entry
+///     point used by the Controller, so that it need not know how many resource
+///     channels an asset reads. By default, the 1D resource is passed on to the
+///     one-channel overload; assets with a two-channel (2D) resource override this to
+///     pull both channels from the binding.
+///
+/// \param n_points The number of timesteps to compute.
+///
+/// \param dt_vec_hrs A pointer to the intervals of time [hrs] associated with each
+///     timestep.
+///
+/// \param resource_binding_ptr A pointer to the resource binding of the asset.
+///
+/// \param production_vec_kW A pointer to the production [kW] at each timestep (output).
+///
+
+void Renewable :: computeProductionkWBatch(
+    int n_points,
+    const double* dt_vec_hrs,
+    const ResourceBinding* resource_binding_ptr,
+    double* production_vec_kW
+)
+{
+    this->computeProductionkWBatch(
+        n_points,
+        dt_vec_hrs,
+        resource_binding_ptr->resource_span.data_ptr,
+        production_vec_kW
+    );
+    
+    return;
+}   /* computeProductionkWBatch() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -291,7 +470,7 @@ double Renewable :: commit(
 ///         std::string write_path,
 ///         std::vector<double>* time_vec_hrs_ptr,
 ///         std::map<int, std::vector<double>>* resource_map_1D_ptr,
-///         std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
+///         std::map<int, ResourceStruct2D>* resource_map_2D_ptr,
 ///         int renewable_index,
 ///         int max_lines
 ///     )
@@ -318,16 +497,20 @@ void Renewable :: writeResults(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
     std::map<int, std::vector<double>>* resource_map_1D_ptr,
-    std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
+    std::map<int, ResourceStruct2D>* resource_map_2D_ptr,
     int renewable_index,
     int max_lines
 )
 {
-    //  1. handle sentinel
+    //  1. handle sentinel (no time series are recorded if summary only)
     if (max_lines < 0) {
         max_lines = this->n_points;
     }
     
+    if (this->summary_only) {
+        max_lines = 0;
+    }
+    
     //  2. create subdirectories
     write_path += "Production/";
     if (not std::filesystem::is_directory(write_path)) {
@@ -227,20 +227,23 @@ double Solar :: __getGenericOpMaintCost(void)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Solar :: __getMeanLongitudeDeg(void)
+/// \fn double Solar :: __getMeanLongitudeDeg(double julian_day)
 ///
 /// \brief Method to compute and return the mean longitude [deg], bound to the half-open
 ///     interval [0, 360). From eqn (4.7) of Gilman.
 ///
 /// Ref: \cite Gilman_2018\n
 ///
+/// \param julian_day The number of days (including partial days) since 12:00 on
+///     1 Jan 2000.
+///
 /// \return The mean longitude [deg], bound to the half-open interval [0, 360).
 ///
 
-double Solar :: __getMeanLongitudeDeg(void)
+double Solar :: __getMeanLongitudeDeg(double julian_day)
 {
     // compute mean longitude
-    double mean_longitude_deg = 280.46 + 0.9856474 * this->julian_day;
+    double mean_longitude_deg = 280.46 + 0.9856474 * julian_day;
     
     // bound to the half-open interval [0, 360) deg
     int mean_longitude_deg_int = int(mean_longitude_deg);
@@ -259,20 +262,23 @@ double Solar :: __getMeanLongitudeDeg(void)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// double Solar :: __getMeanAnomalyRad(void)
+/// double Solar :: __getMeanAnomalyRad(double julian_day)
 ///
 /// \brief Method to compute and return the mean anomaly [rad], bound to the half-open 
 ///     interval [0, 2pi). From eqn (4.8) of Gilman.
 ///
 /// Ref: \cite Gilman_2018\n
 ///
+/// \param julian_day The number of days (including partial days) since 12:00 on
+///     1 Jan 2000.
+///
 /// \return The mean anomaly [rad], bound to the half-open interval [0, 2pi).
 ///
 
-double Solar :: __getMeanAnomalyRad(void)
+double Solar :: __getMeanAnomalyRad(double julian_day)
 {
     // compute mean anomaly
-    double mean_anomaly_deg = 357.528 + 0.9856003 * this->julian_day;
+    double mean_anomaly_deg = 357.528 + 0.9856003 * julian_day;
     
     // bound to the half-open interval [0, 360) deg.
     int mean_anomaly_deg_int = int(mean_anomaly_deg);
@@ -344,20 +350,23 @@ double Solar :: __getEclipticLongitudeRad(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Solar :: __getObliquityOfEclipticRad(void)
+/// \fn double Solar :: __getObliquityOfEclipticRad(double julian_day)
 ///
 /// \brief Method to compute and return the obliquity of the ecliptic [rad], bound to 
 ///     the half-open interval [0, 2pi). From eqn (4.10) of Gilman.
 ///
 /// Ref: \cite Gilman_2018\n
 ///
+/// \param julian_day The number of days (including partial days) since 12:00 on
+///     1 Jan 2000.
+///
 /// \return The obliquity of the ecliptic [rad], bound to the half-open interval [0, 2pi).
 ///
 
-double Solar :: __getObliquityOfEclipticRad(void)
+double Solar :: __getObliquityOfEclipticRad(double julian_day)
 {
     // compute obliquity of ecliptic
-    double obleq_deg = 23.439 - 0.0000004 * this->julian_day;
+    double obleq_deg = 23.439 - 0.0000004 * julian_day;
     
     // bound to half-open interval [0, 360) deg
     int obleq_deg_int = int(obleq_deg);
@@ -379,22 +388,25 @@ double Solar :: __getObliquityOfEclipticRad(void)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Solar :: __getGreenwichMeanSiderialTimeHrs(void)
+/// \fn double Solar :: __getGreenwichMeanSiderialTimeHrs(double julian_day)
 ///
 /// \brief Method to compute the Greenwich mean siderial time [hrs], bound to the 
 ///     half-open interval [0, 24) hrs. From eqn (4.13) of Gilman.
 ///
 /// Ref: \cite Gilman_2018\n
 ///
+/// \param julian_day The number of days (including partial days) since 12:00 on
+///     1 Jan 2000.
+///
 /// \return Greenwich mean siderial time [hrs], bound to the half-open interval 
 ///     [0, 24) hrs.
 ///
 
-double Solar :: __getGreenwichMeanSiderialTimeHrs(void)
+double Solar :: __getGreenwichMeanSiderialTimeHrs(double julian_day)
 {
     // compute Greenwich mean siderial time
     double Greenwich_mean_siderial_time_hrs = 6.697375 + 
-        0.0657098242 * this->julian_day -
+        0.0657098242 * julian_day -
         (this->longitude_deg / 15);
     
     // bound to the half-open interval [0, 24) hrs
@@ -789,6 +801,161 @@ double Solar :: __getSolarZenithRad(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Solar :: __computeSolarGeometry(
+///         double julian_day,
+///         double* solar_zenith_rad_ptr,
+///         double* solar_azimuth_rad_ptr
+///     )
+///
+/// \brief Helper method to compute the position of the sun (zenith and azimuth) at the
+///     given Julian day, for the site of this array. From eqns (4.7) through (4.17) of
+///     Gilman.
+///
+/// Ref: \cite Gilman_2018\n
+///
+/// \param julian_day The number of days (including partial days) since 12:00 on
+///     1 Jan 2000.
+///
+/// \param solar_zenith_rad_ptr A pointer to the solar zenith [rad] (output).
+///
+/// \param solar_azimuth_rad_ptr A pointer to the solar azimuth [rad] (output).
+///
+
+void Solar :: __computeSolarGeometry(
+    double julian_day,
+    double* solar_zenith_rad_ptr,
+    double* solar_azimuth_rad_ptr
+)
+{
+    //  1. get mean longitude and mean anomaly
+    double mean_longitude_deg = this->__getMeanLongitudeDeg(julian_day);
+    double mean_anomaly_rad = this->__getMeanAnomalyRad(julian_day);
+    
+    
+    //  2. get ecliptic longitude and obliquity of the ecliptic
+    double eclong_rad = this->__getEclipticLongitudeRad(
+        mean_longitude_deg,
+        mean_anomaly_rad
+    );
+    
+    double obleq_rad = this->__getObliquityOfEclipticRad(julian_day);
+    
+    
+    //  3. get local mean siderial time
+    double Greenwich_mean_siderial_time_hrs =
+        this->__getGreenwichMeanSiderialTimeHrs(julian_day);
+    
+    double local_mean_siderial_time_hrs = this->__getLocalMeanSiderialTimeHrs(
+        Greenwich_mean_siderial_time_hrs
+    );
+    
+    
+    //  4. get right ascension, declination, and hour angle
+    double right_ascension_rad = this->__getRightAscensionRad(eclong_rad, obleq_rad);
+    double declination_rad = this->__getDeclinationRad(eclong_rad, obleq_rad);
+    
+    double hour_angle_rad = this->__getHourAngleRad(
+        local_mean_siderial_time_hrs,
+        right_ascension_rad
+    );
+    
+    
+    //  5. get solar zenith and azimuth
+    *solar_zenith_rad_ptr = this->__getSolarZenithRad(
+        declination_rad,
+        hour_angle_rad
+    );
+    
+    *solar_azimuth_rad_ptr = this->__getSolarAzimuthRad(
+        declination_rad,
+        hour_angle_rad
+    );
+    
+    return;
+}   /* __computeSolarGeometry() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Solar :: __bindSolarGeometry(std::vector<double>* time_vec_hrs_ptr)
+///
+/// \brief Helper method to bind this array to the position of the sun over the
+///     modelling time series. The geometry is looked up in the (process-wide)
+///     SolarGeometryCache, and only computed (and then cached) if no other Solar asset
+///     at the same site, and over the same time series, holds one already.
+///
+/// \param time_vec_hrs_ptr A pointer to the vector containing the modelling time series.
+///
+
+void Solar :: __bindSolarGeometry(std::vector<double>* time_vec_hrs_ptr)
+{
+    if (time_vec_hrs_ptr == NULL or time_vec_hrs_ptr->empty()) {
+        return;
+    }
+    
+    //  1. look up geometry
+    SolarGeometryCache& solar_geometry_cache = SolarGeometryCache :: getInstance();
+    
+    std::string geometry_key = solar_geometry_cache.getGeometryKey(
+        this->latitude_deg,
+        this->longitude_deg,
+        this->julian_day,
+        time_vec_hrs_ptr
+    );
+    
+    this->solar_geometry_ptr = solar_geometry_cache.get(geometry_key);
+    
+    if (this->solar_geometry_ptr) {
+        return;
+    }
+    
+    //  2. compute geometry (Julian day advances with the modelling time series)
+    std::shared_ptr<SolarGeometryStruct> geometry_ptr =
+        std::make_shared<SolarGeometryStruct>();
+    
+    size_t n_points = time_vec_hrs_ptr->size();
+    double start_time_hrs = time_vec_hrs_ptr->front();
+    
+    geometry_ptr->solar_zenith_vec_rad.resize(n_points, 0);
+    geometry_ptr->solar_azimuth_vec_rad.resize(n_points, 0);
+    
+    geometry_ptr->tan_solar_zenith_vec.resize(n_points, 0);
+    geometry_ptr->cos_solar_azimuth_vec.resize(n_points, 0);
+    geometry_ptr->sin_solar_azimuth_vec.resize(n_points, 0);
+    
+    for (size_t i = 0; i < n_points; i++) {
+        this->__computeSolarGeometry(
+            this->julian_day + (time_vec_hrs_ptr->at(i) - start_time_hrs) / 24,
+            &(geometry_ptr->solar_zenith_vec_rad[i]),
+            &(geometry_ptr->solar_azimuth_vec_rad[i])
+        );
+        
+        geometry_ptr->tan_solar_zenith_vec[i] =
+            tan(geometry_ptr->solar_zenith_vec_rad[i]);
+        
+        geometry_ptr->cos_solar_azimuth_vec[i] =
+            cos(geometry_ptr->solar_azimuth_vec_rad[i]);
+        geometry_ptr->sin_solar_azimuth_vec[i] =
+            sin(geometry_ptr->solar_azimuth_vec_rad[i]);
+    }
+    
+    //  3. cache geometry (if another asset got there first, share theirs instead)
+    this->solar_geometry_ptr = solar_geometry_cache.insert(geometry_key, geometry_ptr);
+    
+    return;
+}   /* __bindSolarGeometry() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -1030,48 +1197,27 @@ double Solar :: __getPlaneOfArrayIrradiancekWm2(
     double solar_resource_kWm2
 )
 {
-    // get mean longitude and mean anomaly
-    double mean_longitude_deg = this->__getMeanLongitudeDeg();
-    double mean_anomaly_rad = this->__getMeanAnomalyRad();
-    
-    
-    // get ecliptic longitude and obliquity of the ecliptic
-    double eclong_rad = this->__getEclipticLongitudeRad(
-        mean_longitude_deg,
-        mean_anomaly_rad
-    );
-    
-    double obleq_rad = this->__getObliquityOfEclipticRad();
-    
-    
-    // get local mean siderial time
-    double Greenwich_mean_siderial_time_hrs = this->__getGreenwichMeanSiderialTimeHrs();
+    // get solar zenith and azimuth (shared, if bound; else computed on the fly at the
+    // current Julian day)
+    double solar_zenith_rad = 0;
+    double solar_azimuth_rad = 0;
     
-    double local_mean_siderial_time_hrs = this->__getLocalMeanSiderialTimeHrs(
-        Greenwich_mean_siderial_time_hrs
-    );
-    
-    
-    // get right ascension, declination, and hour angle
-    double right_ascension_rad = this->__getRightAscensionRad(eclong_rad, obleq_rad);
-    double declination_rad = this->__getDeclinationRad(eclong_rad, obleq_rad);
-    
-    double hour_angle_rad = this->__getHourAngleRad(
-        local_mean_siderial_time_hrs,
-        right_ascension_rad
-    );
-    
-    
-    // get solar azimuth and zenith
-    double solar_azimuth_rad = this->__getSolarAzimuthRad(
-        declination_rad,
-        hour_angle_rad
-    );
+    if (
+        this->solar_geometry_ptr and
+        timestep >= 0 and
+        (size_t)timestep < this->solar_geometry_ptr->size()
+    ) {
+        solar_zenith_rad = this->solar_geometry_ptr->solar_zenith_vec_rad[timestep];
+        solar_azimuth_rad = this->solar_geometry_ptr->solar_azimuth_vec_rad[timestep];
+    }
     
-    double solar_zenith_rad = this->__getSolarZenithRad(
-        declination_rad,
-        hour_angle_rad
-    );
+    else {
+        this->__computeSolarGeometry(
+            this->julian_day,
+            &solar_zenith_rad,
+            &solar_azimuth_rad
+        );
+    }
     
     
     // get diffuse horizontal irradiance (DHI) and direct normal irradiance (DNI)
@@ -1214,6 +1360,108 @@ double Solar :: __computeDetailedProductionkW(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Solar :: __computeDetailedProductionkWBatch(
+///         int n_points,
+///         const double* solar_resource_vec_kWm2,
+///         double* production_vec_kW
+///     )
+///
+/// \brief Helper method to apply the detailed, "PVWatts/SAM-like" model over a whole
+///     series of timesteps [0, n_points) in a single pass. Assumes that the solar
+///     geometry is bound over (at least) the series.
+///
+/// All of the transcendental work (position of the sun, and its trigonometric terms)
+/// is held by the shared solar geometry, so that the plane of array irradiance reduces
+/// to arithmetic over parallel arrays. The loop is also free of branches and
+/// comparisons (max/min are written in terms of fabs()), so that the compiler can
+/// vectorize it under the default (trapping) floating point model. Equivalent (to
+/// within rounding) to __computeDetailedProductionkW() at each timestep; note that
+/// the angle of incidence needs no bounding here, since acos() is never taken.
+///
+/// Ref: \cite Gilman_2018\n
+///
+/// \param n_points The number of timesteps to compute.
+///
+/// \param solar_resource_vec_kWm2 A pointer to the solar resource (i.e. global
+///     horizontal irradiance) [kW/m2] at each timestep.
+///
+/// \param production_vec_kW A pointer to the production [kW] of the solar PV array at
+///     each timestep (output).
+///
+
+void Solar :: __computeDetailedProductionkWBatch(
+    int n_points,
+    const double* solar_resource_vec_kWm2,
+    double* production_vec_kW
+)
+{
+    //  1. get solar geometry
+    const double* tan_solar_zenith_ptr =
+        this->solar_geometry_ptr->tan_solar_zenith_vec.data();
+    const double* cos_solar_azimuth_ptr =
+        this->solar_geometry_ptr->cos_solar_azimuth_vec.data();
+    const double* sin_solar_azimuth_ptr =
+        this->solar_geometry_ptr->sin_solar_azimuth_vec.data();
+    
+    
+    //  2. get array constants (per unit global horizontal irradiance, where applicable)
+    double cos_panel_tilt = cos(this->panel_tilt_rad);
+    double sin_panel_tilt = sin(this->panel_tilt_rad);
+    
+    double cos_panel_azimuth = cos(this->panel_azimuth_rad);
+    double sin_panel_azimuth = sin(this->panel_azimuth_rad);
+    
+    double GHI_2_DHI = this->__getDiffuseHorizontalIrradiancekWm2(1);
+    
+    double beam_factor = 1 - GHI_2_DHI;
+    double diffuse_factor = this->__getDiffuseIrradiancekWm2(GHI_2_DHI);
+    double ground_reflected_factor = this->__getGroundReflectedIrradiancekWm2(1);
+    
+    double production_factor = this->derating * this->capacity_kW;
+    double capacity_kW = this->capacity_kW;
+    
+    
+    //  3. compute production (plane of array irradiance -> production)
+    for (int i = 0; i < n_points; i++) {
+        // no resource -> no production; max(GHI, 0) as (GHI + |GHI|) / 2 (exact)
+        double solar_resource_kWm2 = 0.5 * (
+            solar_resource_vec_kWm2[i] + fabs(solar_resource_vec_kWm2[i])
+        );
+        
+        // beam irradiance per unit direct normal irradiance, over the cosine of the
+        // zenith; that is, cos(angle of incidence) / cos(zenith)
+        double beam_ratio =
+            tan_solar_zenith_ptr[i] * (
+                cos_solar_azimuth_ptr[i] * cos_panel_azimuth +
+                sin_solar_azimuth_ptr[i] * sin_panel_azimuth
+            ) * sin_panel_tilt +
+            cos_panel_tilt;
+        
+        // plane of array irradiance (beam + diffuse + ground reflected)
+        double plane_of_array_irradiance_kWm2 = solar_resource_kWm2 * (
+            beam_factor * beam_ratio +
+            diffuse_factor +
+            ground_reflected_factor
+        );
+        
+        // production, capped at capacity; min(production, capacity) as
+        // production - max(production - capacity, 0)
+        double production_kW = production_factor * plane_of_array_irradiance_kWm2;
+        double excess_kW = production_kW - capacity_kW;
+        
+        production_vec_kW[i] = production_kW - 0.5 * (excess_kW + fabs(excess_kW));
+    }
+    
+    return;
+}   /* __computeDetailedProductionkWBatch() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -1322,7 +1570,7 @@ void Solar :: __writeSummary(std::string write_path)
 ///         std::string write_path,
 ///         std::vector<double>* time_vec_hrs_ptr,
 ///         std::map<int, std::vector<double>>* resource_map_1D_ptr,
-///         std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
+///         std::map<int, ResourceStruct2D>* resource_map_2D_ptr,
 ///         int max_lines
 ///     )
 ///
@@ -1344,13 +1592,13 @@ void Solar :: __writeTimeSeries(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
     std::map<int, std::vector<double>>* resource_map_1D_ptr,
-    std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
+    std::map<int, ResourceStruct2D>* resource_map_2D_ptr,
     int max_lines
 )
 {
     //  1. create filestream
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
+    BufferedWriter ofs;
     ofs.open(write_path, std::ofstream::out);
     
     //  2. write time series results (comma separated value)
@@ -1364,6 +1612,8 @@ void Solar :: __writeTimeSeries(
     ofs << "Operation and Maintenance Cost (actual),";
     ofs << "\n";
     
+    size_t capital_cost_event_idx = 0;
+    
     for (int i = 0; i < max_lines; i++) {
         ofs << time_vec_hrs_ptr->at(i) << ",";
         
@@ -1379,8 +1629,8 @@ void Solar :: __writeTimeSeries(
         ofs << this->dispatch_vec_kW[i] << ",";
         ofs << this->storage_vec_kW[i] << ",";
         ofs << this->curtailment_vec_kW[i] << ",";
-        ofs << this->capital_cost_vec[i] << ",";
-        ofs << this->operation_maintenance_cost_vec[i] << ",";
+        ofs << this->getCapitalCost(i, &capital_cost_event_idx) << ",";
+        ofs << this->getOperationMaintenanceCost(i) << ",";
         ofs << "\n";
     }
     
@@ -1525,7 +1775,18 @@ Renewable(
     }
     
     if (not this->is_sunk) {
-        this->capital_cost_vec[0] = this->capital_cost;
+        this->incurCapitalCost(
+            0,
+            this->capital_cost,
+            CapitalCostReason :: CAPITAL_COST_INITIAL
+        );
+    }
+    
+    if (
+        this->power_model == SolarPowerProductionModel :: SOLAR_POWER_DETAILED and
+        not this->normalized_production_series_given
+    ) {
+        this->__bindSolarGeometry(time_vec_hrs_ptr);
     }
     
     //  3. construction print
@@ -1652,6 +1913,71 @@ double Solar :: computeProductionkW(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Solar :: computeProductionkWBatch(
+///         int n_points,
+///         const double* dt_vec_hrs,
+///         const double* solar_resource_vec_kWm2,
+///         double* production_vec_kW
+///     )
+///
+/// \brief Method to compute solar PV production over a whole series of timesteps
+///     [0, n_points) in one call. For the detailed model (with the solar geometry bound
+///     over the series), this applies a single whole-series kernel; otherwise, it
+///     falls back to computeProductionkW() at each timestep.
+///
+/// \param n_points The number of timesteps to compute.
+///
+/// \param dt_vec_hrs A pointer to the intervals of time [hrs] associated with each
+///     timestep.
+///
+/// \param solar_resource_vec_kWm2 A pointer to the solar resource (i.e. global
+///     horizontal irradiance) [kW/m2] at each timestep.
+///
+/// \param production_vec_kW A pointer to the production [kW] of the solar PV array at
+///     each timestep (output).
+///
+
+void Solar :: computeProductionkWBatch(
+    int n_points,
+    const double* dt_vec_hrs,
+    const double* solar_resource_vec_kWm2,
+    double* production_vec_kW
+)
+{
+    //  1. detailed model, whole-series kernel
+    if (
+        not this->normalized_production_series_given and
+        this->power_model == SolarPowerProductionModel :: SOLAR_POWER_DETAILED and
+        this->solar_geometry_ptr and
+        (size_t)n_points <= this->solar_geometry_ptr->size()
+    ) {
+        this->__computeDetailedProductionkWBatch(
+            n_points,
+            solar_resource_vec_kWm2,
+            production_vec_kW
+        );
+        
+        return;
+    }
+    
+    //  2. otherwise, compute production at each timestep
+    Renewable :: computeProductionkWBatch(
+        n_points,
+        dt_vec_hrs,
+        solar_resource_vec_kWm2,
+        production_vec_kW
+    );
+    
+    return;
+}   /* computeProductionkWBatch() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
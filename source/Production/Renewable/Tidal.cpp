@@ -412,7 +412,7 @@ void Tidal :: __writeSummary(std::string write_path)
 ///         std::string write_path,
 ///         std::vector<double>* time_vec_hrs_ptr,
 ///         std::map<int, std::vector<double>>* resource_map_1D_ptr,
-///         std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
+///         std::map<int, ResourceStruct2D>* resource_map_2D_ptr,
 ///         int max_lines
 ///     )
 ///
@@ -434,13 +434,13 @@ void Tidal :: __writeTimeSeries(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
     std::map<int, std::vector<double>>* resource_map_1D_ptr,
-    std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
+    std::map<int, ResourceStruct2D>* resource_map_2D_ptr,
     int max_lines
 )
 {
     //  1. create filestream
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
+    BufferedWriter ofs;
     ofs.open(write_path, std::ofstream::out);
     
     //  2. write time series results (comma separated value)
@@ -454,6 +454,8 @@ void Tidal :: __writeTimeSeries(
     ofs << "Operation and Maintenance Cost (actual),";
     ofs << "\n";
     
+    size_t capital_cost_event_idx = 0;
+    
     for (int i = 0; i < max_lines; i++) {
         ofs << time_vec_hrs_ptr->at(i) << ",";
         
@@ -469,8 +471,8 @@ void Tidal :: __writeTimeSeries(
         ofs << this->dispatch_vec_kW[i] << ",";
         ofs << this->storage_vec_kW[i] << ",";
         ofs << this->curtailment_vec_kW[i] << ",";
-        ofs << this->capital_cost_vec[i] << ",";
-        ofs << this->operation_maintenance_cost_vec[i] << ",";
+        ofs << this->getCapitalCost(i, &capital_cost_event_idx) << ",";
+        ofs << this->getOperationMaintenanceCost(i) << ",";
         ofs << "\n";
     }
     
@@ -602,7 +604,11 @@ Renewable(
     }
     
     if (not this->is_sunk) {
-        this->capital_cost_vec[0] = this->capital_cost;
+        this->incurCapitalCost(
+            0,
+            this->capital_cost,
+            CapitalCostReason :: CAPITAL_COST_INITIAL
+        );
     }
     
     //  3. construction print
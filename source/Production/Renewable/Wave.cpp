@@ -332,7 +332,7 @@ double Wave:: __computeLookupProductionkW(
 )
 {
     double prod = this->interpolator.interp2D(
-        0,
+        this->performance_interp_handle,
         significant_wave_height_m,
         energy_period_s
     );
@@ -472,7 +472,7 @@ void Wave :: __writeSummary(std::string write_path)
 ///         std::string write_path,
 ///         std::vector<double>* time_vec_hrs_ptr,
 ///         std::map<int, std::vector<double>>* resource_map_1D_ptr,
-///         std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
+///         std::map<int, ResourceStruct2D>* resource_map_2D_ptr,
 ///         int max_lines
 ///     )
 ///
@@ -494,13 +494,13 @@ void Wave :: __writeTimeSeries(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
     std::map<int, std::vector<double>>* resource_map_1D_ptr,
-    std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
+    std::map<int, ResourceStruct2D>* resource_map_2D_ptr,
     int max_lines
 )
 {
     //  1. create filestream
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
+    BufferedWriter ofs;
     ofs.open(write_path, std::ofstream::out);
     
     //  2. write time series results (comma separated value)
@@ -515,12 +515,14 @@ void Wave :: __writeTimeSeries(
     ofs << "Operation and Maintenance Cost (actual),";
     ofs << "\n";
     
+    size_t capital_cost_event_idx = 0;
+    
     for (int i = 0; i < max_lines; i++) {
         ofs << time_vec_hrs_ptr->at(i) << ",";
         
         if (not this->normalized_production_series_given) {
-            ofs << resource_map_2D_ptr->at(this->resource_key)[i][0] << ",";
-            ofs << resource_map_2D_ptr->at(this->resource_key)[i][1] << ",";
+            ofs << resource_map_2D_ptr->at(this->resource_key).channel_vec[0][i] << ",";
+            ofs << resource_map_2D_ptr->at(this->resource_key).channel_vec[1][i] << ",";
         }
         
         else {
@@ -532,8 +534,8 @@ void Wave :: __writeTimeSeries(
         ofs << this->dispatch_vec_kW[i] << ",";
         ofs << this->storage_vec_kW[i] << ",";
         ofs << this->curtailment_vec_kW[i] << ",";
-        ofs << this->capital_cost_vec[i] << ",";
-        ofs << this->operation_maintenance_cost_vec[i] << ",";
+        ofs << this->getCapitalCost(i, &capital_cost_event_idx) << ",";
+        ofs << this->getOperationMaintenanceCost(i) << ",";
         ofs << "\n";
     }
     
@@ -636,6 +638,8 @@ Renewable(
                 wave_inputs.path_2_normalized_performance_matrix
             );
             
+            this->performance_interp_handle = this->interpolator.getHandle2D(0);
+            
             break;
         }
         
@@ -671,7 +675,11 @@ Renewable(
     }
     
     if (not this->is_sunk) {
-        this->capital_cost_vec[0] = this->capital_cost;
+        this->incurCapitalCost(
+            0,
+            this->capital_cost,
+            CapitalCostReason :: CAPITAL_COST_INITIAL
+        );
     }
     
     //  3. construction print
@@ -815,6 +823,153 @@ double Wave :: computeProductionkW(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Wave :: computeProductionkWBatch(
+///         int n_points,
+///         const double* dt_vec_hrs,
+///         const double* significant_wave_height_vec_m,
+///         const double* energy_period_vec_s,
+///         double* production_vec_kW
+///     )
+///
+/// \brief Method to compute wave energy converter production over a whole series of
+///     timesteps [0, n_points) in one call. For the lookup model, the sea states with
+///     resource are gathered and then interpolated in a single batch (see
+///     Interpolator::interp2DBatch()); otherwise, this falls back to
+///     computeProductionkW() at each timestep. Either way, results are the same as
+///     those of computeProductionkW() at each timestep.
+///
+/// \param n_points The number of timesteps to compute.
+///
+/// \param dt_vec_hrs A pointer to the intervals of time [hrs] associated with each
+///     timestep.
+///
+/// \param significant_wave_height_vec_m A pointer to the significant wave height [m]
+///     at each timestep.
+///
+/// \param energy_period_vec_s A pointer to the energy period [s] at each timestep.
+///
+/// \param production_vec_kW A pointer to the production [kW] of the wave energy
+///     converter at each timestep (output).
+///
+
+void Wave :: computeProductionkWBatch(
+    int n_points,
+    const double* dt_vec_hrs,
+    const double* significant_wave_height_vec_m,
+    const double* energy_period_vec_s,
+    double* production_vec_kW
+)
+{
+    //  1. lookup model, single batch of interpolations
+    if (
+        not this->normalized_production_series_given and
+        this->power_model == WavePowerProductionModel :: WAVE_POWER_LOOKUP
+    ) {
+        //  1.1. gather sea states with resource (no resource -> no production)
+        std::vector<int> timestep_vec;
+        std::vector<double> significant_wave_height_vec;
+        std::vector<double> energy_period_vec;
+        
+        timestep_vec.reserve(n_points);
+        significant_wave_height_vec.reserve(n_points);
+        energy_period_vec.reserve(n_points);
+        
+        for (int i = 0; i < n_points; i++) {
+            production_vec_kW[i] = 0;
+            
+            if (significant_wave_height_vec_m[i] <= 0 or energy_period_vec_s[i] <= 0) {
+                continue;
+            }
+            
+            timestep_vec.push_back(i);
+            significant_wave_height_vec.push_back(significant_wave_height_vec_m[i]);
+            energy_period_vec.push_back(energy_period_vec_s[i]);
+        }
+        
+        //  1.2. interpolate, scatter
+        std::vector<double> prod_vec(timestep_vec.size(), 0);
+        
+        this->interpolator.interp2DBatch(
+            this->performance_interp_handle,
+            significant_wave_height_vec.data(),
+            energy_period_vec.data(),
+            prod_vec.data(),
+            prod_vec.size()
+        );
+        
+        for (size_t i = 0; i < timestep_vec.size(); i++) {
+            production_vec_kW[timestep_vec[i]] = prod_vec[i] * this->capacity_kW;
+        }
+        
+        return;
+    }
+    
+    //  2. otherwise, compute production at each timestep
+    Renewable :: computeProductionkWBatch(
+        n_points,
+        dt_vec_hrs,
+        significant_wave_height_vec_m,
+        energy_period_vec_s,
+        production_vec_kW
+    );
+    
+    return;
+}   /* computeProductionkWBatch() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Wave :: computeProductionkWBatch(
+///         int n_points,
+///         const double* dt_vec_hrs,
+///         const ResourceBinding* resource_binding_ptr,
+///         double* production_vec_kW
+///     )
+///
+/// \brief Method to compute wave energy converter production over a whole series of
+///     timesteps [0, n_points) in one call, reading significant wave height and energy
+///     period from channels 0 and 1 (respectively) of the given binding.
+///
+/// \param n_points The number of timesteps to compute.
+///
+/// \param dt_vec_hrs A pointer to the intervals of time [hrs] associated with each
+///     timestep.
+///
+/// \param resource_binding_ptr A pointer to the resource binding of the asset.
+///
+/// \param production_vec_kW A pointer to the production [kW] of the wave energy
+///     converter at each timestep (output).
+///
+
+void Wave :: computeProductionkWBatch(
+    int n_points,
+    const double* dt_vec_hrs,
+    const ResourceBinding* resource_binding_ptr,
+    double* production_vec_kW
+)
+{
+    this->computeProductionkWBatch(
+        n_points,
+        dt_vec_hrs,
+        resource_binding_ptr->resource_span.data_ptr,
+        resource_binding_ptr->resource_span_2D.data_ptr,
+        production_vec_kW
+    );
+    
+    return;
+}   /* computeProductionkWBatch() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -228,94 +228,108 @@ void Resources :: __checkResourceKey2D(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Resources :: __checkTimePoint(
-///         double time_received_hrs,
-///         double time_expected_hrs,
-///         std::string path_2_resource_data,
-///         ElectricalLoad* electrical_load_ptr
-///     )
+/// \fn bool Resources :: __checkResourceKey(ResourceInputs resource_inputs)
 ///
-/// \brief Helper method to check received time point against expected time point. The
-///     given time series should align point-wise with the previously given electrical
-///     load time series.
+/// \brief Helper method to check the type of the given resource, and that its resource
+///     key (1D or 2D, as appropriate) is not already in use.
 ///
-/// \param time_received_hrs The point in time received from the given data.
+/// \param resource_inputs A structure describing the given resource.
 ///
-/// \param time_expected_hrs The point in time expected (this comes from the electrical
-///     load time series).
-///
-/// \param path_2_resource_data The path (either relative or absolute) to the given 
-///     resource time series.
-///
-/// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
+/// \return A boolean indicating whether the given resource is 2D (true) or 1D (false).
 ///
 
-void Resources :: __checkTimePoint(
-    double time_received_hrs,
-    double time_expected_hrs,
-    std::string path_2_resource_data,
-    ElectricalLoad* electrical_load_ptr
-)
+bool Resources :: __checkResourceKey(ResourceInputs resource_inputs)
 {
-    if (time_received_hrs != time_expected_hrs) {
-        std::string error_str = "ERROR:  Resources::addResource():  ";
-        error_str += "the given resource time series at ";
-        error_str += path_2_resource_data;
-        error_str += " does not align with the ";
-        error_str += "previously given electrical load time series at ";
-        error_str += electrical_load_ptr->path_2_electrical_load_time_series;
+    //  1. check that exactly one type is given
+    bool is_noncombustion =
+        resource_inputs.noncombustion_type != NoncombustionType :: N_NONCOMBUSTION_TYPES;
+    bool is_renewable =
+        resource_inputs.renewable_type != RenewableType :: N_RENEWABLE_TYPES;
+    
+    if (is_noncombustion and is_renewable) {
+        std::string error_str = "ERROR:  Resources::addResources():  ";
+        error_str += "resource at ";
+        error_str += resource_inputs.path_2_resource_data;
+        error_str += " has both a renewable type and a noncombustion type";
         
         #ifdef _WIN32
             std::cout << error_str << std::endl;
         #endif
 
-        throw std::runtime_error(error_str);
+        throw std::invalid_argument(error_str);
     }
     
-    return;
-}   /* __checkTimePoint() */
-
-// ---------------------------------------------------------------------------------- //
-
-
-
-// ---------------------------------------------------------------------------------- //
-
-///
-/// \fn void Resources :: __throwLengthError(
-///         std::string path_2_resource_data,
-///         ElectricalLoad* electrical_load_ptr
-///     )
-///
-/// \brief Helper method to throw data length error (if not the same as the given 
-///     electrical load time series).
-///
-/// \param path_2_resource_data The path (either relative or absolute) to the given 
-///     resource time series.
-///
-/// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
-///
+    //  2. Noncombustion resources
+    if (is_noncombustion) {
+        switch (resource_inputs.noncombustion_type) {
+            case (NoncombustionType :: HYDRO): {
+                this->__checkResourceKey1D(
+                    resource_inputs.resource_key,
+                    resource_inputs.noncombustion_type
+                );
+                
+                break;
+            }
+            
+            default: {
+                std::string error_str = "ERROR:  Resources :: addResource(:  ";
+                error_str += "noncombustion type ";
+                error_str += std::to_string(resource_inputs.noncombustion_type);
+                error_str += " has no associated resource";
+                
+                #ifdef _WIN32
+                    std::cout << error_str << std::endl;
+                #endif
 
-void Resources :: __throwLengthError(
-    std::string path_2_resource_data,
-    ElectricalLoad* electrical_load_ptr
-)
-{
-    std::string error_str = "ERROR:  Resources::addResource():  ";
-    error_str += "the given resource time series at ";
-    error_str += path_2_resource_data;
-    error_str += " is not the same length as the previously given electrical";
-    error_str += " load time series at ";
-    error_str += electrical_load_ptr->path_2_electrical_load_time_series;
+                throw std::runtime_error(error_str);
+                
+                break;
+            }
+        }
+        
+        return false;
+    }
     
-    #ifdef _WIN32
-        std::cout << error_str << std::endl;
-    #endif
+    //  3. renewable resources
+    switch (resource_inputs.renewable_type) {
+        case (RenewableType :: SOLAR):
+        case (RenewableType :: TIDAL):
+        case (RenewableType :: WIND): {
+            this->__checkResourceKey1D(
+                resource_inputs.resource_key,
+                resource_inputs.renewable_type
+            );
+            
+            return false;
+        }
+        
+        case (RenewableType :: WAVE): {
+            this->__checkResourceKey2D(
+                resource_inputs.resource_key,
+                resource_inputs.renewable_type
+            );
+            
+            return true;
+        }
+        
+        default: {
+            std::string error_str = "ERROR:  Resources :: addResource(:  ";
+            error_str += "renewable type ";
+            error_str += std::to_string(resource_inputs.renewable_type);
+            error_str += " not recognized";
+            
+            #ifdef _WIN32
+                std::cout << error_str << std::endl;
+            #endif
 
-    throw std::runtime_error(error_str);
+            throw std::runtime_error(error_str);
+            
+            break;
+        }
+    }
     
-    return;
-}   /* __throwLengthError() */
+    return false;
+}   /* __checkResourceKey() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -324,81 +338,68 @@ void Resources :: __throwLengthError(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Resources :: __readHydroResource(
+/// \fn void Resources :: __checkTimeSeries(
+///         std::vector<double>* time_vec_hrs_ptr,
 ///         std::string path_2_resource_data,
-///         int resource_key,
 ///         ElectricalLoad* electrical_load_ptr
 ///     )
 ///
-/// \brief Helper method to handle reading a hydro resource time series into Resources.
+/// \brief Helper method to check a received time series against the expected time
+///     series. The given time series should be the same length as, and align
+///     point-wise with, the previously given electrical load time series.
+///
+/// The point-wise check is done as a single memcmp over the whole series, falling back
+/// to an element-wise comparison only if the bytes differ (so that, e.g., -0 and 0
+/// still compare equal, as they would point-wise).
+///
+/// \param time_vec_hrs_ptr A pointer to the time series received from the given data.
 ///
 /// \param path_2_resource_data The path (either relative or absolute) to the given 
 ///     resource time series.
 ///
-/// \param resource_key The key associated with the given renewable resource.
-///
 /// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
 ///
 
-void Resources :: __readHydroResource(
+void Resources :: __checkTimeSeries(
+    std::vector<double>* time_vec_hrs_ptr,
     std::string path_2_resource_data,
-    int resource_key,
     ElectricalLoad* electrical_load_ptr
 )
 {
-    //  1. init CSV reader, record path and type
-    io::CSVReader<2> CSV(path_2_resource_data);
-    
-    CSV.read_header(
-        io::ignore_extra_column,
-        "Time (since start of data) [hrs]",
-        "Hydro Inflow [m3/hr]"
-    );
-    
-    this->path_map_1D.insert(
-        std::pair<int, std::string>(resource_key, path_2_resource_data)
-    );
-    
-    this->string_map_1D.insert(std::pair<int, std::string>(resource_key, "HYDRO"));
-    
-    //  2. init map element
-    this->resource_map_1D.insert(
-        std::pair<int, std::vector<double>>(resource_key, {})
-    );
-    this->resource_map_1D[resource_key].resize(electrical_load_ptr->n_points, 0);
-    
-    
-    //  3. read in resource data, check against time series (point-wise and length)
-    int n_points = 0;
-    double time_hrs = 0;
-    double time_expected_hrs = 0;
-    double hydro_resource_m3hr = 0;
-    
-    while (CSV.read_row(time_hrs, hydro_resource_m3hr)) {
-        if (n_points > electrical_load_ptr->n_points) {
-            this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
-        }
-        
-        time_expected_hrs = electrical_load_ptr->time_vec_hrs[n_points];
-        this->__checkTimePoint(
-            time_hrs,
-            time_expected_hrs,
-            path_2_resource_data,
-            electrical_load_ptr
-        );
-        
-        this->resource_map_1D[resource_key][n_points] = hydro_resource_m3hr;
-        
-        n_points++;
+    //  1. check length
+    if ((int)time_vec_hrs_ptr->size() != electrical_load_ptr->n_points) {
+        this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
     }
     
-    //  4. check data length
-    if (n_points != electrical_load_ptr->n_points) {
-        this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
+    //  2. check alignment
+    if (
+        electrical_load_ptr->n_points > 0 and
+        std::memcmp(
+            time_vec_hrs_ptr->data(),
+            electrical_load_ptr->time_vec_hrs.data(),
+            electrical_load_ptr->n_points * sizeof(double)
+        ) != 0
+    ) {
+        for (int i = 0; i < electrical_load_ptr->n_points; i++) {
+            if ((*time_vec_hrs_ptr)[i] != electrical_load_ptr->time_vec_hrs[i]) {
+                std::string error_str = "ERROR:  Resources::addResource():  ";
+                error_str += "the given resource time series at ";
+                error_str += path_2_resource_data;
+                error_str += " does not align with the ";
+                error_str += "previously given electrical load time series at ";
+                error_str += electrical_load_ptr->path_2_electrical_load_time_series;
+                
+                #ifdef _WIN32
+                    std::cout << error_str << std::endl;
+                #endif
+
+                throw std::runtime_error(error_str);
+            }
+        }
     }
     
     return;
-}   /* __readHydroResource() */
+}   /* __checkTimeSeries() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -407,81 +408,40 @@ void Resources :: __readHydroResource(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Resources :: __readSolarResource(
+/// \fn void Resources :: __throwLengthError(
 ///         std::string path_2_resource_data,
-///         int resource_key,
 ///         ElectricalLoad* electrical_load_ptr
 ///     )
 ///
-/// \brief Helper method to handle reading a solar resource time series into Resources.
+/// \brief Helper method to throw data length error (if not the same as the given 
+///     electrical load time series).
 ///
 /// \param path_2_resource_data The path (either relative or absolute) to the given 
 ///     resource time series.
 ///
-/// \param resource_key The key associated with the given renewable resource.
-///
 /// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
 ///
 
-void Resources :: __readSolarResource(
+void Resources :: __throwLengthError(
     std::string path_2_resource_data,
-    int resource_key,
     ElectricalLoad* electrical_load_ptr
 )
 {
-    //  1. init CSV reader, record path and type
-    io::CSVReader<2> CSV(path_2_resource_data);
-    
-    CSV.read_header(
-        io::ignore_extra_column,
-        "Time (since start of data) [hrs]",
-        "Solar GHI [kW/m2]"
-    );
-    
-    this->path_map_1D.insert(
-        std::pair<int, std::string>(resource_key, path_2_resource_data)
-    );
-    
-    this->string_map_1D.insert(std::pair<int, std::string>(resource_key, "SOLAR"));
-    
-    //  2. init map element
-    this->resource_map_1D.insert(
-        std::pair<int, std::vector<double>>(resource_key, {})
-    );
-    this->resource_map_1D[resource_key].resize(electrical_load_ptr->n_points, 0);
-    
-    
-    //  3. read in resource data, check against time series (point-wise and length)
-    int n_points = 0;
-    double time_hrs = 0;
-    double time_expected_hrs = 0;
-    double solar_resource_kWm2 = 0;
-    
-    while (CSV.read_row(time_hrs, solar_resource_kWm2)) {
-        if (n_points > electrical_load_ptr->n_points) {
-            this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
-        }
-        
-        time_expected_hrs = electrical_load_ptr->time_vec_hrs[n_points];
-        this->__checkTimePoint(
-            time_hrs,
-            time_expected_hrs,
-            path_2_resource_data,
-            electrical_load_ptr
-        );
-        
-        this->resource_map_1D[resource_key][n_points] = solar_resource_kWm2;
-        
-        n_points++;
-    }
+    std::string error_str = "ERROR:  Resources::addResource():  ";
+    error_str += "the given resource time series at ";
+    error_str += path_2_resource_data;
+    error_str += " is not the same length as the previously given electrical";
+    error_str += " load time series at ";
+    error_str += electrical_load_ptr->path_2_electrical_load_time_series;
     
-    //  4. check data length
-    if (n_points != electrical_load_ptr->n_points) {
-        this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
-    }
+    #ifdef _WIN32
+        std::cout << error_str << std::endl;
+    #endif
+
+    throw std::runtime_error(error_str);
     
     return;
-}   /* __readSolarResource() */
+}   /* __throwLengthError() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -490,81 +450,80 @@ void Resources :: __readSolarResource(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Resources :: __readTidalResource(
-///         std::string path_2_resource_data,
-///         int resource_key,
-///         ElectricalLoad* electrical_load_ptr
+/// \fn void Resources :: __getResourceHeaders(
+///         ResourceInputs resource_inputs,
+///         std::vector<std::string>* header_vec_ptr,
+///         std::string* type_str_ptr
 ///     )
 ///
-/// \brief Helper method to handle reading a tidal resource time series into Resources.
+/// \brief Helper method to get the CSV column headers (time first) and type descriptor
+///     of the given resource. A resource with three columns is 2D.
 ///
-/// \param path_2_resource_data The path (either relative or absolute) to the given 
-///     resource time series.
+/// \param resource_inputs A structure describing the given resource.
 ///
-/// \param resource_key The key associated with the given renewable resource.
+/// \param header_vec_ptr A pointer to the vector of CSV column headers to populate.
 ///
-/// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
+/// \param type_str_ptr A pointer to the type descriptor to populate.
 ///
 
-void Resources :: __readTidalResource(
-    std::string path_2_resource_data,
-    int resource_key,
-    ElectricalLoad* electrical_load_ptr
+void Resources :: __getResourceHeaders(
+    ResourceInputs resource_inputs,
+    std::vector<std::string>* header_vec_ptr,
+    std::string* type_str_ptr
 )
 {
-    //  1. init CSV reader, record path and type
-    io::CSVReader<2> CSV(path_2_resource_data);
-    
-    CSV.read_header(
-        io::ignore_extra_column,
-        "Time (since start of data) [hrs]",
-        "Tidal Speed (hub depth) [m/s]"
-    );
-    
-    this->path_map_1D.insert(
-        std::pair<int, std::string>(resource_key, path_2_resource_data)
-    );
-    
-    this->string_map_1D.insert(std::pair<int, std::string>(resource_key, "TIDAL"));
-    
-    //  2. init map element
-    this->resource_map_1D.insert(
-        std::pair<int, std::vector<double>>(resource_key, {})
-    );
-    this->resource_map_1D[resource_key].resize(electrical_load_ptr->n_points, 0);
-    
+    header_vec_ptr->clear();
+    header_vec_ptr->push_back("Time (since start of data) [hrs]");
     
-    //  3. read in resource data, check against time series (point-wise and length)
-    int n_points = 0;
-    double time_hrs = 0;
-    double time_expected_hrs = 0;
-    double tidal_resource_ms = 0;
+    //  1. Noncombustion resources
+    if (resource_inputs.noncombustion_type == NoncombustionType :: HYDRO) {
+        header_vec_ptr->push_back("Hydro Inflow [m3/hr]");
+        *type_str_ptr = "HYDRO";
+        
+        return;
+    }
     
-    while (CSV.read_row(time_hrs, tidal_resource_ms)) {
-        if (n_points > electrical_load_ptr->n_points) {
-            this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
+    //  2. renewable resources
+    switch (resource_inputs.renewable_type) {
+        case (RenewableType :: SOLAR): {
+            header_vec_ptr->push_back("Solar GHI [kW/m2]");
+            *type_str_ptr = "SOLAR";
+            
+            break;
         }
         
-        time_expected_hrs = electrical_load_ptr->time_vec_hrs[n_points];
-        this->__checkTimePoint(
-            time_hrs,
-            time_expected_hrs,
-            path_2_resource_data,
-            electrical_load_ptr
-        );
+        case (RenewableType :: TIDAL): {
+            header_vec_ptr->push_back("Tidal Speed (hub depth) [m/s]");
+            *type_str_ptr = "TIDAL";
+            
+            break;
+        }
         
-        this->resource_map_1D[resource_key][n_points] = tidal_resource_ms;
+        case (RenewableType :: WAVE): {
+            header_vec_ptr->push_back("Significant Wave Height [m]");
+            header_vec_ptr->push_back("Energy Period [s]");
+            *type_str_ptr = "WAVE";
+            
+            break;
+        }
         
-        n_points++;
-    }
-    
-    //  4. check data length
-    if (n_points != electrical_load_ptr->n_points) {
-        this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
+        case (RenewableType :: WIND): {
+            header_vec_ptr->push_back("Wind Speed (hub height) [m/s]");
+            *type_str_ptr = "WIND";
+            
+            break;
+        }
+        
+        default: {
+            //  resource types are checked beforehand (see __checkResourceKey())
+            *type_str_ptr = "UNDEFINED_TYPE";
+            
+            break;
+        }
     }
     
     return;
-}   /* __readTidalResource() */
+}   /* __getResourceHeaders() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -573,84 +532,55 @@ void Resources :: __readTidalResource(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Resources :: __readWaveResource(
-///         std::string path_2_resource_data,
-///         int resource_key,
-///         ElectricalLoad* electrical_load_ptr
+/// \fn void Resources :: __parseResource(
+///         ResourceInputs resource_inputs,
+///         ElectricalLoad* electrical_load_ptr,
+///         TimeSeriesCache* time_series_cache_ptr,
+///         std::vector<std::vector<double>>* column_vec_ptr
 ///     )
 ///
-/// \brief Helper method to handle reading a wave resource time series into Resources.
-///
-/// \param path_2_resource_data The path (either relative or absolute) to the given 
-///     resource time series.
+/// \brief Helper method to read the given resource time series (through the given time
+///     series cache) and check it against the electrical load time series. Does not
+///     modify Resources, so may be called concurrently (given distinct time series
+///     caches).
 ///
-/// \param resource_key The key associated with the given renewable resource.
+/// \param resource_inputs A structure describing the given resource.
 ///
 /// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
 ///
+/// \param time_series_cache_ptr A pointer to the time series cache to read through.
+///
+/// \param column_vec_ptr A pointer to the vector of columns to populate (time first).
+///
 
-void Resources :: __readWaveResource(
-    std::string path_2_resource_data,
-    int resource_key,
-    ElectricalLoad* electrical_load_ptr
+void Resources :: __parseResource(
+    ResourceInputs resource_inputs,
+    ElectricalLoad* electrical_load_ptr,
+    TimeSeriesCache* time_series_cache_ptr,
+    std::vector<std::vector<double>>* column_vec_ptr
 )
 {
-    //  1. init CSV reader, record path and type
-    io::CSVReader<3> CSV(path_2_resource_data);
-    
-    CSV.read_header(
-        io::ignore_extra_column,
-        "Time (since start of data) [hrs]",
-        "Significant Wave Height [m]",
-        "Energy Period [s]"
-    );
+    //  1. read in time and resource data (through time series cache)
+    std::vector<std::string> header_vec;
+    std::string type_str;
     
-    this->path_map_2D.insert(
-        std::pair<int, std::string>(resource_key, path_2_resource_data)
-    );
+    this->__getResourceHeaders(resource_inputs, &header_vec, &type_str);
     
-    this->string_map_2D.insert(std::pair<int, std::string>(resource_key, "WAVE"));
-    
-    //  2. init map element
-    this->resource_map_2D.insert(
-        std::pair<int, std::vector<std::vector<double>>>(resource_key, {})
+    time_series_cache_ptr->read(
+        resource_inputs.path_2_resource_data,
+        header_vec,
+        column_vec_ptr
     );
-    this->resource_map_2D[resource_key].resize(electrical_load_ptr->n_points, {0, 0});
-    
-    
-    //  3. read in resource data, check against time series (point-wise and length)
-    int n_points = 0;
-    double time_hrs = 0;
-    double time_expected_hrs = 0;
-    double significant_wave_height_m = 0;
-    double energy_period_s = 0;
-    
-    while (CSV.read_row(time_hrs, significant_wave_height_m, energy_period_s)) {
-        if (n_points > electrical_load_ptr->n_points) {
-            this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
-        }
-        
-        time_expected_hrs = electrical_load_ptr->time_vec_hrs[n_points];
-        this->__checkTimePoint(
-            time_hrs,
-            time_expected_hrs,
-            path_2_resource_data,
-            electrical_load_ptr
-        );
-        
-        this->resource_map_2D[resource_key][n_points][0] = significant_wave_height_m;
-        this->resource_map_2D[resource_key][n_points][1] = energy_period_s;
-        
-        n_points++;
-    }
     
-    //  4. check data length
-    if (n_points != electrical_load_ptr->n_points) {
-        this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
-    }
+    //  2. check against time series (length and point-wise)
+    this->__checkTimeSeries(
+        &((*column_vec_ptr)[0]),
+        resource_inputs.path_2_resource_data,
+        electrical_load_ptr
+    );
     
     return;
-}   /* __readWaveResource() */
+}   /* __parseResource() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -659,81 +589,75 @@ void Resources :: __readWaveResource(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Resources :: __readWindResource(
-///         std::string path_2_resource_data,
-///         int resource_key,
-///         ElectricalLoad* electrical_load_ptr
+/// \fn void Resources :: __recordResource(
+///         ResourceInputs resource_inputs,
+///         std::vector<std::vector<double>>* column_vec_ptr
 ///     )
 ///
-/// \brief Helper method to handle reading a wind resource time series into Resources.
+/// \brief Helper method to record a parsed (and checked) resource time series, along
+///     with its path and type, into the appropriate Resources maps. The columns are
+///     moved out of the given vector.
 ///
-/// \param path_2_resource_data The path (either relative or absolute) to the given 
-///     resource time series.
-///
-/// \param resource_key The key associated with the given renewable resource.
+/// \param resource_inputs A structure describing the given resource.
 ///
-/// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
+/// \param column_vec_ptr A pointer to the vector of parsed columns (time first).
 ///
 
-void Resources :: __readWindResource(
-    std::string path_2_resource_data,
-    int resource_key,
-    ElectricalLoad* electrical_load_ptr
+void Resources :: __recordResource(
+    ResourceInputs resource_inputs,
+    std::vector<std::vector<double>>* column_vec_ptr
 )
 {
-    //  1. init CSV reader, record path and type
-    io::CSVReader<2> CSV(path_2_resource_data);
+    std::vector<std::string> header_vec;
+    std::string type_str;
     
-    CSV.read_header(
-        io::ignore_extra_column,
-        "Time (since start of data) [hrs]",
-        "Wind Speed (hub height) [m/s]"
-    );
+    this->__getResourceHeaders(resource_inputs, &header_vec, &type_str);
     
-    this->path_map_1D.insert(
-        std::pair<int, std::string>(resource_key, path_2_resource_data)
-    );
-    
-    this->string_map_1D.insert(std::pair<int, std::string>(resource_key, "WIND"));
-    
-    //  2. init map element
-    this->resource_map_1D.insert(
-        std::pair<int, std::vector<double>>(resource_key, {})
-    );
-    this->resource_map_1D[resource_key].resize(electrical_load_ptr->n_points, 0);
+    int resource_key = resource_inputs.resource_key;
     
-    
-    //  3. read in resource data, check against time series (point-wise and length)
-    int n_points = 0;
-    double time_hrs = 0;
-    double time_expected_hrs = 0;
-    double wind_resource_ms = 0;
-    
-    while (CSV.read_row(time_hrs, wind_resource_ms)) {
-        if (n_points > electrical_load_ptr->n_points) {
-            this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
-        }
-        
-        time_expected_hrs = electrical_load_ptr->time_vec_hrs[n_points];
-        this->__checkTimePoint(
-            time_hrs,
-            time_expected_hrs,
-            path_2_resource_data,
-            electrical_load_ptr
+    //  1. 1D resource
+    if (header_vec.size() == 2) {
+        this->path_map_1D.insert(
+            std::pair<int, std::string>(
+                resource_key,
+                resource_inputs.path_2_resource_data
+            )
         );
         
-        this->resource_map_1D[resource_key][n_points] = wind_resource_ms;
+        this->string_map_1D.insert(std::pair<int, std::string>(resource_key, type_str));
+        
+        this->resource_map_1D.insert(
+            std::pair<int, std::vector<double>>(resource_key, {})
+        );
         
-        n_points++;
+        this->resource_map_1D[resource_key].swap((*column_vec_ptr)[1]);
     }
     
-    //  4. check data length
-    if (n_points != electrical_load_ptr->n_points) {
-        this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
+    //  2. 2D resource (one contiguous array per channel)
+    else {
+        this->path_map_2D.insert(
+            std::pair<int, std::string>(
+                resource_key,
+                resource_inputs.path_2_resource_data
+            )
+        );
+        
+        this->string_map_2D.insert(std::pair<int, std::string>(resource_key, type_str));
+        
+        this->resource_map_2D.insert(
+            std::pair<int, ResourceStruct2D>(resource_key, ResourceStruct2D())
+        );
+        
+        ResourceStruct2D& resource_2D = this->resource_map_2D[resource_key];
+        resource_2D.n_points = (*column_vec_ptr)[0].size();
+        
+        for (int channel = 0; channel < 2; channel++) {
+            resource_2D.channel_vec[channel].swap((*column_vec_ptr)[channel + 1]);
+        }
     }
     
     return;
-}   /* __readWindResource() */
+}   /* __recordResource() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -792,34 +716,25 @@ void Resources :: addResource(
     ElectricalLoad* electrical_load_ptr
 )
 {
-    switch (noncombustion_type) {
-        case (NoncombustionType :: HYDRO): {
-            this->__checkResourceKey1D(resource_key, noncombustion_type);
-            
-            this->__readHydroResource(
-                path_2_resource_data,
-                resource_key,
-                electrical_load_ptr
-            );
-            
-            break;
-        }
-        
-        default: {
-            std::string error_str = "ERROR:  Resources :: addResource(:  ";
-            error_str += "noncombustion type ";
-            error_str += std::to_string(noncombustion_type);
-            error_str += " has no associated resource";
-            
-            #ifdef _WIN32
-                std::cout << error_str << std::endl;
-            #endif
-
-            throw std::runtime_error(error_str);
-            
-            break;
-        }
-    }
+    //  1. check type and resource key
+    ResourceInputs resource_inputs;
+    resource_inputs.noncombustion_type = noncombustion_type;
+    resource_inputs.path_2_resource_data = path_2_resource_data;
+    resource_inputs.resource_key = resource_key;
+    
+    this->__checkResourceKey(resource_inputs);
+    
+    //  2. read (through time series cache) and check against time series, record
+    std::vector<std::vector<double>> column_vec;
+    
+    this->__parseResource(
+        resource_inputs,
+        electrical_load_ptr,
+        &(this->time_series_cache),
+        &column_vec
+    );
+    
+    this->__recordResource(resource_inputs, &column_vec);
     
     return;
 }   /* addResource() */
@@ -860,73 +775,212 @@ void Resources :: addResource(
     ElectricalLoad* electrical_load_ptr
 )
 {
-    switch (renewable_type) {
-        case (RenewableType :: SOLAR): {
-            this->__checkResourceKey1D(resource_key, renewable_type);
-            
-            this->__readSolarResource(
-                path_2_resource_data,
-                resource_key,
-                electrical_load_ptr
-            );
-            
-            break;
-        }
-        
-        case (RenewableType :: TIDAL): {
-            this->__checkResourceKey1D(resource_key, renewable_type);
-            
-            this->__readTidalResource(
-                path_2_resource_data,
-                resource_key,
-                electrical_load_ptr
-            );
-            
-            break;
-        }
-        
-        case (RenewableType :: WAVE): {
-            this->__checkResourceKey2D(resource_key, renewable_type);
-            
-            this->__readWaveResource(
-                path_2_resource_data,
-                resource_key,
-                electrical_load_ptr
-            );
-            
-            break;
-        }
+    //  1. check type and resource key
+    ResourceInputs resource_inputs;
+    resource_inputs.renewable_type = renewable_type;
+    resource_inputs.path_2_resource_data = path_2_resource_data;
+    resource_inputs.resource_key = resource_key;
+    
+    this->__checkResourceKey(resource_inputs);
+    
+    //  2. read (through time series cache) and check against time series, record
+    std::vector<std::vector<double>> column_vec;
+    
+    this->__parseResource(
+        resource_inputs,
+        electrical_load_ptr,
+        &(this->time_series_cache),
+        &column_vec
+    );
+    
+    this->__recordResource(resource_inputs, &column_vec);
+    
+    return;
+}   /* addResource() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Resources :: addResources(
+///         std::vector<ResourceInputs> resource_inputs_vec,
+///         ElectricalLoad* electrical_load_ptr,
+///         int n_threads
+///     )
+///
+/// \brief A method to add a batch of resource time series to Resources. All files are
+///     read (through the time series cache) and checked against the electrical load
+///     time series concurrently, and then recorded together, in the given order.
+///
+/// The batch is all or nothing: if any resource fails (bad type, key in use or
+/// repeated within the batch, missing file, misaligned time series, etc.), then no
+/// resource in the batch is added. Errors are deterministic; the error reported is
+/// that of the first failing resource in the given order, regardless of scheduling.
+///
+/// \param resource_inputs_vec A vector of structures, each describing one resource.
+///
+/// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
+///
+/// \param n_threads The number of worker threads to use. If <= 0, then all available
+///     hardware threads are used.
+///
+
+void Resources :: addResources(
+    std::vector<ResourceInputs> resource_inputs_vec,
+    ElectricalLoad* electrical_load_ptr,
+    int n_threads
+)
+{
+    //  1. check types and resource keys (against Resources, and within batch)
+    std::map<int, size_t> batch_key_map_1D;
+    std::map<int, size_t> batch_key_map_2D;
+    
+    for (size_t i = 0; i < resource_inputs_vec.size(); i++) {
+        bool is_2D = this->__checkResourceKey(resource_inputs_vec[i]);
         
-        case (RenewableType :: WIND): {
-            this->__checkResourceKey1D(resource_key, renewable_type);
-            
-            this->__readWindResource(
-                path_2_resource_data,
-                resource_key,
-                electrical_load_ptr
-            );
-            
-            break;
-        }
+        std::map<int, size_t>& batch_key_map = is_2D ? batch_key_map_2D : batch_key_map_1D;
+        int resource_key = resource_inputs_vec[i].resource_key;
         
-        default: {
-            std::string error_str = "ERROR:  Resources :: addResource(:  ";
-            error_str += "renewable type ";
-            error_str += std::to_string(renewable_type);
-            error_str += " not recognized";
+        if (batch_key_map.count(resource_key) > 0) {
+            std::string error_str = "ERROR:  Resources::addResources():  ";
+            error_str += is_2D ? "resource key (2D) " : "resource key (1D) ";
+            error_str += std::to_string(resource_key);
+            error_str += " is repeated in the batch (entries ";
+            error_str += std::to_string(batch_key_map[resource_key]);
+            error_str += " and ";
+            error_str += std::to_string(i);
+            error_str += ")";
             
             #ifdef _WIN32
                 std::cout << error_str << std::endl;
             #endif
 
-            throw std::runtime_error(error_str);
+            throw std::invalid_argument(error_str);
+        }
+        
+        batch_key_map[resource_key] = i;
+    }
+    
+    //  2. read and check against time series, concurrently (each task reads through
+    //     its own copy of the time series cache, so that no state is shared)
+    std::vector<std::vector<std::vector<double>>> column_vec_vec(
+        resource_inputs_vec.size()
+    );
+    
+    TaskRunner task_runner(n_threads);
+    
+    task_runner.run(
+        resource_inputs_vec.size(),
+        [&](size_t i) {
+            TimeSeriesCache time_series_cache = this->time_series_cache;
             
-            break;
+            this->__parseResource(
+                resource_inputs_vec[i],
+                electrical_load_ptr,
+                &time_series_cache,
+                &(column_vec_vec[i])
+            );
         }
+    );
+    
+    //  3. record, in the given order
+    for (size_t i = 0; i < resource_inputs_vec.size(); i++) {
+        this->__recordResource(resource_inputs_vec[i], &(column_vec_vec[i]));
     }
     
     return;
-}   /* addResource() */
+}   /* addResources() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn ResourceSpan Resources :: getResourceSpan1D(int resource_key)
+///
+/// \brief Method to get a read-only, contiguous view of the given 1D resource time
+///     series.
+///
+/// \param resource_key The key associated with the given renewable resource.
+///
+/// \return A ResourceSpan over the given resource. Remains valid until the resource is
+///     cleared.
+///
+
+ResourceSpan Resources :: getResourceSpan1D(int resource_key)
+{
+    if (this->resource_map_1D.count(resource_key) == 0) {
+        std::string error_str = "ERROR:  Resources::getResourceSpan1D():  ";
+        error_str += "resource key (1D) ";
+        error_str += std::to_string(resource_key);
+        error_str += " is not recognized";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    std::vector<double>& resource_vec = this->resource_map_1D[resource_key];
+    
+    return ResourceSpan{resource_vec.data(), resource_vec.size()};
+}   /* getResourceSpan1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn ResourceSpan Resources :: getResourceSpan2D(int resource_key, int channel)
+///
+/// \brief Method to get a read-only, contiguous view of one channel of the given 2D
+///     resource time series (e.g., for wave resources, channel 0 is significant wave
+///     height [m] and channel 1 is energy period [s]).
+///
+/// \param resource_key The key associated with the given renewable resource.
+///
+/// \param channel The channel of the given renewable resource.
+///
+/// \return A ResourceSpan over the given channel. Remains valid until the resource is
+///     cleared.
+///
+
+ResourceSpan Resources :: getResourceSpan2D(int resource_key, int channel)
+{
+    if (this->resource_map_2D.count(resource_key) == 0) {
+        std::string error_str = "ERROR:  Resources::getResourceSpan2D():  ";
+        error_str += "resource key (2D) ";
+        error_str += std::to_string(resource_key);
+        error_str += " is not recognized";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    if (channel < 0 or channel >= 2) {
+        std::string error_str = "ERROR:  Resources::getResourceSpan2D():  ";
+        error_str += "channel ";
+        error_str += std::to_string(channel);
+        error_str += " is out of range (2D resources have channels 0 and 1)";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    return this->resource_map_2D[resource_key].getSpan(channel);
+}   /* getResourceSpan2D() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -0,0 +1,257 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file SolarGeometryCache.cpp
+///
+/// \brief Implementation file for the SolarGeometryCache class.
+///
+/// A (process-wide) class which lets Solar assets share the position of the sun over
+/// the modelling time series.
+///
+
+
+#include "../header/SolarGeometryCache.h"
+#include "../header/Hash.h"
+
+
+// ======== PRIVATE ================================================================= //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn SolarGeometryCache :: SolarGeometryCache(void)
+///
+/// \brief Constructor for the SolarGeometryCache class. Private, since there is only
+///     ever the one (process-wide) instance; see getInstance().
+///
+
+SolarGeometryCache :: SolarGeometryCache(void)
+{
+    return;
+}   /* SolarGeometryCache() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PRIVATE ============================================================= //
+
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn SolarGeometryCache& SolarGeometryCache :: getInstance(void)
+///
+/// \brief Method to get the (process-wide) SolarGeometryCache instance.
+///
+/// \return A reference to the SolarGeometryCache instance.
+///
+
+SolarGeometryCache& SolarGeometryCache :: getInstance(void)
+{
+    static SolarGeometryCache instance;
+    
+    return instance;
+}   /* getInstance() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string SolarGeometryCache :: getGeometryKey(
+///         double latitude_deg,
+///         double longitude_deg,
+///         double julian_day,
+///         std::vector<double>* time_vec_hrs_ptr
+///     )
+///
+/// \brief Method to get the cache key of the given site and modelling time series.
+///     Site coordinates and starting Julian day are keyed exactly (as hexadecimal
+///     floats), and the time vector by its size and a hash of its contents.
+///
+/// \param latitude_deg The latitude of the site [deg].
+///
+/// \param longitude_deg The longitude of the site [deg].
+///
+/// \param julian_day The Julian day at the start of the modelling time series.
+///
+/// \param time_vec_hrs_ptr A pointer to the vector containing the modelling time series.
+///
+/// \return The cache key of the given site and modelling time series.
+///
+
+std::string SolarGeometryCache :: getGeometryKey(
+    double latitude_deg,
+    double longitude_deg,
+    double julian_day,
+    std::vector<double>* time_vec_hrs_ptr
+)
+{
+    std::stringstream key_ss;
+    
+    key_ss << std::hexfloat << latitude_deg << "#" << longitude_deg << "#"
+        << julian_day << "#" << std::dec << time_vec_hrs_ptr->size() << "#"
+        << std::hex << hashBytes(
+            time_vec_hrs_ptr->data(),
+            time_vec_hrs_ptr->size() * sizeof(double)
+        );
+    
+    return key_ss.str();
+}   /* getGeometryKey() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::shared_ptr<const SolarGeometryStruct> SolarGeometryCache :: get(
+///         std::string geometry_key
+///     )
+///
+/// \brief Method to get the cached geometry with the given key (if any).
+///
+/// \param geometry_key The key of the given geometry (see getGeometryKey()).
+///
+/// \return A shared pointer to the cached geometry, or an empty shared pointer if
+///     there is none.
+///
+
+std::shared_ptr<const SolarGeometryStruct> SolarGeometryCache :: get(
+    std::string geometry_key
+)
+{
+    return this->geometry_cache.get(geometry_key);
+}   /* get() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::shared_ptr<const SolarGeometryStruct> SolarGeometryCache :: insert(
+///         std::string geometry_key,
+///         std::shared_ptr<const SolarGeometryStruct> geometry_ptr
+///     )
+///
+/// \brief Method to insert the given geometry into the cache. If another thread has
+///     inserted a (live) geometry under the same key in the meantime, then that
+///     geometry is kept, and returned instead.
+///
+/// \param geometry_key The key of the given geometry (see getGeometryKey()).
+///
+/// \param geometry_ptr A shared pointer to the given geometry.
+///
+/// \return A shared pointer to the geometry now cached under the given key.
+///
+
+std::shared_ptr<const SolarGeometryStruct> SolarGeometryCache :: insert(
+    std::string geometry_key,
+    std::shared_ptr<const SolarGeometryStruct> geometry_ptr
+)
+{
+    return this->geometry_cache.insert(geometry_key, geometry_ptr);
+}   /* insert() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn size_t SolarGeometryCache :: size(void)
+///
+/// \brief Method to get the number of (live) geometries in the cache.
+///
+/// \return The number of (live) geometries in the cache.
+///
+
+size_t SolarGeometryCache :: size(void)
+{
+    return this->geometry_cache.size();
+}   /* size() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void SolarGeometryCache :: clear(void)
+///
+/// \brief Method to clear the cache. Geometries already held by Solar assets are
+///     unaffected (they are only freed once no longer held), but will no longer be
+///     shared with subsequently constructed assets.
+///
+
+void SolarGeometryCache :: clear(void)
+{
+    this->geometry_cache.clear();
+    
+    return;
+}   /* clear() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn SolarGeometryCache :: ~SolarGeometryCache(void)
+///
+/// \brief Destructor for the SolarGeometryCache class.
+///
+
+SolarGeometryCache :: ~SolarGeometryCache(void)
+{
+    return;
+}   /* ~SolarGeometryCache() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PUBLIC ============================================================== //
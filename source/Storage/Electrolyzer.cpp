@@ -108,13 +108,15 @@ void Electrolyzer :: commitCharge(
     double el_capacity_kW
 )
 {
+    int record_index = this->getRecordIndex(timestep);
+    
     //  1. record electrolyzer output (kg)
     double n_100_capacity = 33.3 / el_spec_consumption_kWh;
     double n_capacity_factor = n_100_capacity*(1+(this->B_capacity_factor*(1-(charging_kW/el_capacity_kW))));
     el_output_kg = (charging_kW / el_spec_consumption_kWh) * (n_capacity_factor/n_100_capacity) * dt_hrs;
 
-    n_cap_vec[timestep] = n_capacity_factor;
-    this->el_output_vec_kg[timestep] = el_output_kg;
+    n_cap_vec[record_index] = n_capacity_factor;
+    this->el_output_vec_kg[record_index] = el_output_kg;
 
 }   /* commitCharge() */ 
 
@@ -136,7 +138,7 @@ void Electrolyzer :: commitDraw(
 )   
 {
     //  2. record electrolyzer power consumption
-    this->el_draw_vec_kW[timestep] = charging_kW;  
+    this->el_draw_vec_kW[this->getRecordIndex(timestep)] = charging_kW;  
 
 }   /* commitDraw() */ 
 // ---------------------------------------------------------------------------------- //
@@ -166,9 +168,11 @@ double Electrolyzer :: getQ_el(
 
     }
 
-    this->Q_el_vec_kW[timestep] = Q_el;
+    int record_index = this->getRecordIndex(timestep);
+    
+    this->Q_el_vec_kW[record_index] = Q_el;
 
-    return Q_el_vec_kW[timestep];
+    return Q_el_vec_kW[record_index];
 }   /* getQ_el() */ 
 
 // ---------------------------------------------------------------------------------- //
@@ -226,22 +230,23 @@ double Electrolyzer :: el_degradation(int timestep, double dt_hrs, double runtim
 {
 
     double dD_dt = 0;
+    int record_index = this->getRecordIndex(timestep);
 
-    if(this->el_draw_vec_kW[timestep] > 0){
+    if(this->el_draw_vec_kW[record_index] > 0){
         
-        // Check for startup
-        if(this->el_draw_vec_kW[timestep-1] == 0){
+        // Check for startup (the first start is counted by N_start_stop = 1)
+        if(timestep > 0 and this->el_draw_vec_kW[this->getRecordIndex(timestep-1)] == 0){
         this->N_start_stop += 1;
         }
 
         // Get average operating capacity
-        double operating_capacity_ratio = this->el_draw_vec_kW[timestep] / el_capacity_kW; 
+        double operating_capacity_ratio = this->el_draw_vec_kW[record_index] / el_capacity_kW; 
         this->sum_capacity_ratio += operating_capacity_ratio;
-        this->avg_operating_capacity_ratio_vec[timestep] = (this->sum_capacity_ratio / (runtime_hrs + 1));
+        this->avg_operating_capacity_ratio_vec[record_index] = (this->sum_capacity_ratio / (runtime_hrs + (1 * dt_hrs)));
 
-        this->N_start_stop_vec[timestep] = this->N_start_stop;
+        this->N_start_stop_vec[record_index] = this->N_start_stop;
 
-        dD_dt = (runtime_hrs + 1)*this->k1 + this->N_start_stop_vec[timestep]*this->k2 + (1 - this->avg_operating_capacity_ratio_vec[timestep])*this->k3;
+        dD_dt = (runtime_hrs + (1 * dt_hrs))*this->k1 + this->N_start_stop_vec[record_index]*this->k2 + (1 - this->avg_operating_capacity_ratio_vec[record_index])*this->k3;
 
         this->el_SOH = 1 - dD_dt;
     }
@@ -249,3 +254,56 @@ double Electrolyzer :: el_degradation(int timestep, double dt_hrs, double runtim
     return this->el_SOH;
 
 }   // __getGenericCapitalCost() 
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn int Electrolyzer :: getRecordIndex(int timestep)
+///
+/// \brief Method to get the index into the per-timestep vectors at which the given
+///     timestep is recorded. The vectors hold n_points records; if these span the
+///     modelling time series, this is simply the timestep, otherwise the records are
+///     reused in turn (see H2 summary_only).
+///
+/// \param timestep The timestep (i.e., time series index) for the request.
+///
+/// \return The index into the per-timestep vectors for the given timestep.
+///
+
+int Electrolyzer :: getRecordIndex(int timestep)
+{
+    return timestep % int(this->n_points);
+}   /* getRecordIndex() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Electrolyzer :: clearRecord(int timestep)
+///
+/// \brief Method to clear (i.e., zero) the record of the given timestep, so that it
+///     may be reused.
+///
+/// \param timestep The timestep (i.e., time series index) to clear.
+///
+
+void Electrolyzer :: clearRecord(int timestep)
+{
+    int record_index = this->getRecordIndex(timestep);
+    
+    this->el_output_vec_kg[record_index] = 0;
+    this->Q_el_vec_kW[record_index] = 0;
+    this->el_draw_vec_kW[record_index] = 0;
+    this->N_start_stop_vec[record_index] = 0;
+    this->operating_capacity_ratio_vec[record_index] = 0;
+    this->avg_operating_capacity_ratio_vec[record_index] = 0;
+    this->n_cap_vec[record_index] = 0;
+    
+    return;
+}   /* clearRecord() */
+
+// ---------------------------------------------------------------------------------- //
@@ -115,10 +115,12 @@ void FuelCell :: commitDischarge(
     double fc_power_capacity
 )
 {
+    int record_index = this->getRecordIndex(timestep);
+    
     //  1. record ouput power
     fc_output_kW = discharging_kW; 
-    this->fc_output_vec_kW[timestep] = fc_output_kW;
-    this->fc_operation_capacity_vec[timestep] = fc_output_kW / (fc_power_capacity);
+    this->fc_output_vec_kW[record_index] = fc_output_kW;
+    this->fc_operation_capacity_vec[record_index] = fc_output_kW / (fc_power_capacity);
     
     return; 
 }   /* commitDischarge() */ 
@@ -146,14 +148,16 @@ void FuelCell :: commitDraw(
     double fc_capacity
 )
 {
+    int record_index = this->getRecordIndex(timestep);
+    
     double fc_capacity_factor = fc_output_kW / fc_capacity;
     double n_100_capacity = (1/33.3)/fc_spec_consumption_kg;
     double n_capacity_factor = n_100_capacity * (1 + (this->B_capacity_factor * (1 - fc_capacity_factor)));
     double consumption_factor = (n_capacity_factor - n_100_capacity) / n_100_capacity;
 
-    n_cap_vec[timestep] = n_capacity_factor;
+    n_cap_vec[record_index] = n_capacity_factor;
     fc_consumption_kg = fc_spec_consumption_kg*fc_quantity*fc_output_kW*(1-consumption_factor)*dt_hrs; 
-    this->fc_consumption_vec_kg[timestep] = fc_consumption_kg;
+    this->fc_consumption_vec_kg[record_index] = fc_consumption_kg;
     
     return; 
 }   /* commitDraw() */
@@ -182,9 +186,11 @@ double FuelCell :: getQ_fc(
         Q_fc = fc_consumption_kg * 33.3 / dt_hrs * (1 - n_fc);
     }
 
-    this->Q_fc_vec_kW[timestep] = Q_fc;
+    int record_index = this->getRecordIndex(timestep);
+    
+    this->Q_fc_vec_kW[record_index] = Q_fc;
 
-    return Q_fc_vec_kW[timestep];
+    return Q_fc_vec_kW[record_index];
 }   /* getQ_fc() */ 
 
 // ---------------------------------------------------------------------------------- //
@@ -242,21 +248,22 @@ double FuelCell :: fc_degradation(int timestep, double dt_hrs, double runtime_hr
 {
 
     double dD_dt = 0;
+    int record_index = this->getRecordIndex(timestep);
 
-    if(this->fc_output_vec_kW[timestep] > 0){
+    if(this->fc_output_vec_kW[record_index] > 0){
         
-        // Check for startup
-        if(this->fc_output_vec_kW[timestep-1] == 0){
+        // Check for startup (the first start is counted by N_start_stop = 1)
+        if(timestep > 0 and this->fc_output_vec_kW[this->getRecordIndex(timestep-1)] == 0){
         this->N_start_stop += 1;
         }
 
         // Get average operating capacity
-        this->sum_capacity_ratio += this->fc_operation_capacity_vec[timestep];
-        this->avg_operating_capacity_ratio_vec[timestep] = (this->sum_capacity_ratio / (runtime_hrs + (1 * dt_hrs)));
+        this->sum_capacity_ratio += this->fc_operation_capacity_vec[record_index];
+        this->avg_operating_capacity_ratio_vec[record_index] = (this->sum_capacity_ratio / (runtime_hrs + (1 * dt_hrs)));
 
-        this->N_start_stop_vec[timestep] = this->N_start_stop;
+        this->N_start_stop_vec[record_index] = this->N_start_stop;
 
-        dD_dt = (runtime_hrs + (1 * dt_hrs)) * this->k1 + this->N_start_stop_vec[timestep] * this->k2 + (1 - this->avg_operating_capacity_ratio_vec[timestep]) * this->k3;
+        dD_dt = (runtime_hrs + (1 * dt_hrs)) * this->k1 + this->N_start_stop_vec[record_index] * this->k2 + (1 - this->avg_operating_capacity_ratio_vec[record_index]) * this->k3;
 
         this->fc_SOH = 1 - dD_dt;
     }
@@ -265,3 +272,56 @@ double FuelCell :: fc_degradation(int timestep, double dt_hrs, double runtime_hr
 
 }   // __getGenericCapitalCost() 
 
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn int FuelCell :: getRecordIndex(int timestep)
+///
+/// \brief Method to get the index into the per-timestep vectors at which the given
+///     timestep is recorded. The vectors hold n_points records; if these span the
+///     modelling time series, this is simply the timestep, otherwise the records are
+///     reused in turn (see H2 summary_only).
+///
+/// \param timestep The timestep (i.e., time series index) for the request.
+///
+/// \return The index into the per-timestep vectors for the given timestep.
+///
+
+int FuelCell :: getRecordIndex(int timestep)
+{
+    return timestep % int(this->n_points);
+}   /* getRecordIndex() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void FuelCell :: clearRecord(int timestep)
+///
+/// \brief Method to clear (i.e., zero) the record of the given timestep, so that it
+///     may be reused.
+///
+/// \param timestep The timestep (i.e., time series index) to clear.
+///
+
+void FuelCell :: clearRecord(int timestep)
+{
+    int record_index = this->getRecordIndex(timestep);
+    
+    this->fc_output_vec_kW[record_index] = 0;
+    this->fc_draw_vec_kW[record_index] = 0;
+    this->fc_consumption_vec_kg[record_index] = 0;
+    this->fc_operation_capacity_vec[record_index] = 0;
+    this->Q_fc_vec_kW[record_index] = 0;
+    this->N_start_stop_vec[record_index] = 0;
+    this->avg_operating_capacity_ratio_vec[record_index] = 0;
+    this->n_cap_vec[record_index] = 0;
+    
+    return;
+}   /* clearRecord() */
+
+// ---------------------------------------------------------------------------------- //
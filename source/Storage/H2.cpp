@@ -87,8 +87,6 @@ void H2 :: __checkInputs(H2Inputs h2_inputs)
 
         throw std::invalid_argument(error_str);
     }
-
-    
     
     return;
 }   /* __checkInputs() */
@@ -209,12 +207,14 @@ void H2 :: __handleDegradation(
     double dt_hrs
 )
 {
+    int record_index = this->getRecordIndex(timestep);
+    
     //  1. model degradation
     this->__modelDegradation(timestep,dt_hrs);
     
     //  2. update and record
-    this->SOH_el_vec[timestep] = this->SOH_el;
-    this->SOH_fc_vec[timestep] = this->SOH_fc;
+    this->SOH_el_vec[record_index] = this->SOH_el;
+    this->SOH_fc_vec[record_index] = this->SOH_fc;
 
     if (this->SOH_el <= this->replace_SOH_el) {
         this->handleReplacement_el(timestep);
@@ -413,7 +413,7 @@ void H2 :: __writeTimeSeries(
 {
     //  1. create filestream
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
+    BufferedWriter ofs;
     ofs.open(write_path, std::ofstream::out);
     
     //  2. write time series results (comma separated value)
@@ -437,6 +437,8 @@ void H2 :: __writeTimeSeries(
     ofs << "Operation and Maintenance Cost (actual),";
     ofs << "\n";
     
+    size_t capital_cost_event_idx = 0;
+    
     for (int i = 0; i < max_lines; i++) {
         ofs << time_vec_hrs_ptr->at(i) << ",";
         ofs << this->fuelcell.fc_output_vec_kW[i] << ","; 
@@ -454,8 +456,8 @@ void H2 :: __writeTimeSeries(
         ofs << this->SOH_fc_vec[i] << ","; 
         ofs << this->n_electrolyzer_vec[i] << ","; 
         ofs << this->n_fuelcell_vec[i] << ","; 
-        ofs << this->capital_cost_vec[i] << ",";
-        ofs << this->operation_maintenance_cost_vec[i] << ",";
+        ofs << this->getCapitalCost(i, &capital_cost_event_idx) << ",";
+        ofs << this->getOperationMaintenanceCost(i) << ",";
         ofs << "\n";
     }
     
@@ -530,10 +532,12 @@ Storage(
     this->type = StorageType :: H2_SYS; 
     this->type_str = "H2_SYS"; 
 
+    //  electrolyzer and fuel cell records match those of the asset (i.e., the modelling
+    //  time series, or just the current and previous time steps if summary only)
+    h2_inputs.electrolyzer_inputs.n_points = this->n_record_points;
+    h2_inputs.fuelcell_inputs.n_points = this->n_record_points;
     this->electrolyzer = Electrolyzer(h2_inputs.electrolyzer_inputs);
     this->fuelcell = FuelCell(h2_inputs.fuelcell_inputs);
-    h2_inputs.electrolyzer_inputs.n_points = n_points;
-    h2_inputs.fuelcell_inputs.n_points = n_points;
 
     this->external_hydrogen_load_included = h2_inputs.external_hydrogen_load_included;
 
@@ -542,16 +546,17 @@ Storage(
         this->getExternalHydrogenLoadkg(path_2_external_hydrogen_load_time_series);
     }
 
-    this->tank_level_vec_kg.resize(this->n_points, 0);
-    this->compression_power_vec_kW.resize(this->n_points, 0);
-    this->water_demand_vec_kg.resize(this->n_points, 0);
     this->hydrogen_load_vec_kg.resize(this->n_points);
-    this->curtailed_hydrogen_vec_kg.resize(this->n_points, 0);
-    this->SOH_el_vec.resize(this->n_points, 0);
-    this->SOH_fc_vec.resize(this->n_points, 0);
-    this->n_fuelcell_vec.resize(this->n_points, 0);
-    this->n_electrolyzer_vec.resize(this->n_points, 0);
-    this->compression_Q_vec_kW.resize(this->n_points, 0);
+
+    this->tank_level_vec_kg.resize(this->n_record_points, 0);
+    this->compression_power_vec_kW.resize(this->n_record_points, 0);
+    this->water_demand_vec_kg.resize(this->n_record_points, 0);
+    this->curtailed_hydrogen_vec_kg.resize(this->n_record_points, 0);
+    this->SOH_el_vec.resize(this->n_record_points, 0);
+    this->SOH_fc_vec.resize(this->n_record_points, 0);
+    this->n_fuelcell_vec.resize(this->n_record_points, 0);
+    this->n_electrolyzer_vec.resize(this->n_record_points, 0);
+    this->compression_Q_vec_kW.resize(this->n_record_points, 0);
 
     this->capital_cost = h2_inputs.capital_cost;
     this->operation_maintenance_cost_kWh = h2_inputs.operation_maintenance_cost_kWh;
@@ -628,6 +633,14 @@ Storage(
     this->el_runtime_enforced_total = 0;
     this->fc_runtime_enforced_total = 0;
     this->total_curtailed_hydrogen_potential = 0;
+    this->total_water_demand_kg = 0;
+    this->total_h2_produced_kg = 0;
+    this->total_el_consumption_kWh = 0;
+    this->el_output_kg = 0;
+    this->fc_output_kW = 0;
+    this->fc_consumption_kg = 0;
+    this->el_min_runtime_enforced = false;
+    this->fc_min_runtime_enforced = false;
 
     this->charge_kWh = this->init_SOC * this->energy_capacity_kWh;
     this->tank_level_kg = this->init_SOC * this->h2_tank_capacity_kg;
@@ -648,7 +661,11 @@ Storage(
     }
     
     if (not this->is_sunk) {
-        this->capital_cost_vec[0] = this->capital_cost;
+        this->incurCapitalCost(
+            0,
+            this->capital_cost,
+            CapitalCostReason :: CAPITAL_COST_INITIAL
+        );
     }
     
     //  4. construction print
@@ -686,6 +703,13 @@ void H2 :: handleReplacement_el(int timestep)
     this->charge_kWh = this->init_SOC * this->dynamic_h2_energy_capacity_kWh;
     this->is_depleted = false;
     
+    //  3. log replacement (the electrolyzer replacement cost is not modelled separately)
+    this->incurCapitalCost(
+        timestep,
+        0,
+        CapitalCostReason :: CAPITAL_COST_ELECTROLYZER_REPLACEMENT
+    );
+    
     return;
 }   /* __handleReplacement_el() */
 
@@ -714,6 +738,13 @@ void H2 :: handleReplacement_fc(int timestep)
     this->charge_kWh = this->init_SOC * this->dynamic_h2_energy_capacity_kWh;
     this->is_depleted = false;
     
+    //  3. log replacement (the fuel cell replacement cost is not modelled separately)
+    this->incurCapitalCost(
+        timestep,
+        0,
+        CapitalCostReason :: CAPITAL_COST_FUEL_CELL_REPLACEMENT
+    );
+    
     return;
 }   /* __handleReplacement_fc() */
 
@@ -739,7 +770,7 @@ bool H2 :: EL_minruntime(int timestep)
     el_min_runtime_enforced = false;
 
     if(timestep > 1){
-        if (this->charging_power_vec_kW[timestep-1] > 0){
+        if (this->charging_power_vec_kW[this->getRecordIndex(timestep-1)] > 0){
             // if yes, update el_is_running indicator 
             this->el_is_running = true;
         } else {
@@ -781,7 +812,7 @@ bool H2 :: FC_minruntime(int timestep)
     fc_min_runtime_enforced = false;
 
     if (timestep > 1){
-        if (this->fuelcell.fc_output_vec_kW[timestep-1] > 0){
+        if (this->fuelcell.fc_output_vec_kW[this->fuelcell.getRecordIndex(timestep-1)] > 0){
             // if yes, update fc_is_running indicator 
             this->fc_is_running = true;
         } else {
@@ -957,47 +988,53 @@ void H2 :: commitElectrolysis(
     double charging_kW
 )
 {
+    int record_index = this->getRecordIndex(timestep);
+    
     //  1. get additional power input needed for compression 
     double compression_consumption_kW = this->getCompressorPowerkW(dt_hrs);
 
     //  2. record power left available to make hydrogen; charging power - compression requirement
     //  NEEDS WORK: What if the charging power is greater than the charge power and charging_power_vec_kW becomes negative?
     if(charging_kW>0){
-        this->compression_power_vec_kW[timestep] = compression_consumption_kW;
-        this->charging_power_vec_kW[timestep] = charging_kW - compression_consumption_kW;
+        this->compression_power_vec_kW[record_index] = compression_consumption_kW;
+        this->charging_power_vec_kW[record_index] = charging_kW - compression_consumption_kW;
     }
     else{
-        this->charging_power_vec_kW[timestep] = charging_kW;
+        this->charging_power_vec_kW[record_index] = charging_kW;
     }
 
     //  3. compute efficiency lost in ramping up of Electrolysis
-    //      get previous timestep power capacity 
-    double previous_power_capacity_kW = this->charging_power_vec_kW[timestep - 1];
+    //      get previous timestep power capacity (none before the first timestep)
+    double previous_power_capacity_kW = 0;
+    if (timestep > 0) {
+        previous_power_capacity_kW =
+            this->charging_power_vec_kW[this->getRecordIndex(timestep - 1)];
+    }
     //      check if electrolyzer is ramping up 
-    if(this->charging_power_vec_kW[timestep] > previous_power_capacity_kW){
+    if(this->charging_power_vec_kW[record_index] > previous_power_capacity_kW){
         // computer % capacity ramp 
-        double ramping_ratio = (this->charging_power_vec_kW[timestep] - previous_power_capacity_kW) / (this->el_capacity_kW * this->el_quantity);
+        double ramping_ratio = (this->charging_power_vec_kW[record_index] - previous_power_capacity_kW) / (this->el_capacity_kW * this->el_quantity);
         double ramping_loss = this->el_ramp_loss * ramping_ratio; 
-        this->charging_power_vec_kW[timestep] = this->charging_power_vec_kW[timestep] - (this->charging_power_vec_kW[timestep] * ramping_loss);
+        this->charging_power_vec_kW[record_index] = this->charging_power_vec_kW[record_index] - (this->charging_power_vec_kW[record_index] * ramping_loss);
     }
 
     // 5. initate electrolysis methods and record 
-    this->electrolyzer.commitCharge(timestep,dt_hrs,this->el_spec_consumption_kWh,this->charging_power_vec_kW[timestep],this->el_capacity_kW); 
-    this->el_output_kg = this->electrolyzer.el_output_vec_kg[timestep];
-    this->electrolyzer.commitDraw(timestep,dt_hrs,this->charging_power_vec_kW[timestep]);
+    this->electrolyzer.commitCharge(timestep,dt_hrs,this->el_spec_consumption_kWh,this->charging_power_vec_kW[record_index],this->el_capacity_kW); 
+    this->el_output_kg = this->electrolyzer.el_output_vec_kg[record_index];
+    this->electrolyzer.commitDraw(timestep,dt_hrs,this->charging_power_vec_kW[record_index]);
 
-    this->electrolyzer.getQ_el(timestep,dt_hrs,this->electrolyzer.el_draw_vec_kW[timestep],this->el_output_kg);
+    this->electrolyzer.getQ_el(timestep,dt_hrs,this->electrolyzer.el_draw_vec_kW[record_index],this->el_output_kg);
     this->getWaterDemand(timestep,this->el_output_kg);
 
     // 6. model degradation and compute current operational efficiency
     this->__handleDegradation(timestep,dt_hrs);
     if (charging_kW>0){
-        this->n_electrolyzer_vec[timestep] = (this->kWh_kg_conversion/this->el_spec_consumption_kWh); 
+        this->n_electrolyzer_vec[record_index] = (this->kWh_kg_conversion/this->el_spec_consumption_kWh); 
     }
     // 7. update totals
     this->total_h2_produced_kg += this->el_output_kg;
     if (charging_kW>0){
-        this->total_el_consumption_kWh += this->electrolyzer.el_draw_vec_kW[timestep]*dt_hrs;
+        this->total_el_consumption_kWh += this->electrolyzer.el_draw_vec_kW[record_index]*dt_hrs;
     }
     if (charging_kW>0){
         this->el_runtime_hrs += dt_hrs;
@@ -1015,18 +1052,18 @@ void H2 :: commitElectrolysis(
         this->tank_level_kg = this->h2_tank_capacity_kg;
     }
 
-    this->tank_level_vec_kg[timestep] = this->tank_level_kg;
+    this->tank_level_vec_kg[record_index] = this->tank_level_kg;
 
     // 9. update charge and record
-    this->charge_kWh = this->tank_level_vec_kg[timestep]* kWh_kg_conversion;
-    this->charge_vec_kWh[timestep] = this->charge_kWh;
+    this->charge_kWh = this->tank_level_vec_kg[record_index]* kWh_kg_conversion;
+    this->charge_vec_kWh[record_index] = this->charge_kWh;
     
     // 10. toggle depleted flag (if applicable)
     this->__toggleDepleted();
     
     //  11. capture operation and maintenance costs (if applicable)
     if (charging_kW > 0) {
-        this->operation_maintenance_cost_vec[timestep] = charging_kW * dt_hrs *
+        this->operation_maintenance_cost_vec[record_index] = charging_kW * dt_hrs *
             this->operation_maintenance_cost_kWh;
     }
 
@@ -1067,8 +1104,10 @@ double H2 :: commitFuelCell(
     double load_kW
 )
 {
+    int record_index = this->getRecordIndex(timestep);
+    
     //  1. record discharging power
-    this->discharging_power_vec_kW[timestep] = discharging_kW;
+    this->discharging_power_vec_kW[record_index] = discharging_kW;
     this->total_discharge_kWh += discharging_kW * dt_hrs;
     
     // check that minimum operating cap is not being exceeded - to be removed later
@@ -1079,16 +1118,16 @@ double H2 :: commitFuelCell(
 
     // 2. initiate fuel cell methods
     this->fuelcell.commitDischarge(timestep,dt_hrs,discharging_kW,this->dynamic_h2_power_capacity_kW); 
-    this->fc_output_kW = this->fuelcell.fc_output_vec_kW[timestep];
+    this->fc_output_kW = this->fuelcell.fc_output_vec_kW[record_index];
     this->fuelcell.commitDraw(timestep,dt_hrs,this->fc_spec_consumption_kg, this->fc_quantity,this->fc_output_kW,this->fc_capacity_kW); 
-    this->fc_consumption_kg = this->fuelcell.fc_consumption_vec_kg[timestep]; 
+    this->fc_consumption_kg = this->fuelcell.fc_consumption_vec_kg[record_index]; 
 
     this->fuelcell.getQ_fc(timestep,dt_hrs,this->fc_consumption_kg,this->fc_output_kW);
 
     // 3. model degradation and compute current operational efficiency
     this->__handleDegradation(timestep,dt_hrs);
     if(discharging_kW>0){
-        this->n_fuelcell_vec[timestep] = (1/(this->kWh_kg_conversion*this->fc_spec_consumption_kg)); 
+        this->n_fuelcell_vec[record_index] = (1/(this->kWh_kg_conversion*this->fc_spec_consumption_kg)); 
     }
     // 4. update totals
     
@@ -1104,11 +1143,11 @@ double H2 :: commitFuelCell(
 
     // 5. update tank level and record
     this->tank_level_kg -= this->fc_consumption_kg;
-    this->tank_level_vec_kg[timestep] = this->tank_level_kg;
+    this->tank_level_vec_kg[record_index] = this->tank_level_kg;
 
     // 6. update charge and record
     this->charge_kWh = this->tank_level_kg * kWh_kg_conversion;
-    this->charge_vec_kWh[timestep] = this->charge_kWh;
+    this->charge_vec_kWh[record_index] = this->charge_kWh;
     
     //  7. update load
     load_kW -= discharging_kW;
@@ -1118,7 +1157,7 @@ double H2 :: commitFuelCell(
     
     //  9. capture operation and maintenance costs (if applicable)
     if (discharging_kW > 0) {
-        this->operation_maintenance_cost_vec[timestep] = discharging_kW * dt_hrs *
+        this->operation_maintenance_cost_vec[record_index] = discharging_kW * dt_hrs *
             this->operation_maintenance_cost_kWh;
     }
     
@@ -1146,13 +1185,15 @@ double H2 :: getThermalOutput(
     double dt_hrs
 ) 
 {
+    int record_index = this->getRecordIndex(timestep);
+    
     // get  fuel cell thermal energy output for thermal energy modelling
-    double thermal_output_kW  = this->fuelcell.Q_fc_vec_kW[timestep] + this->electrolyzer.Q_el_vec_kW[timestep];
+    double thermal_output_kW  = this->fuelcell.Q_fc_vec_kW[record_index] + this->electrolyzer.Q_el_vec_kW[record_index];
 
-    if(this->compression_included && this->electrolyzer.Q_el_vec_kW[timestep] > 0){
+    if(this->compression_included && this->electrolyzer.Q_el_vec_kW[record_index] > 0){
         double compression_Q_kW = (compressor_spec_consumption_kWh * (this->el_capacity_kW/this->el_spec_consumption_kWh)) / (1 + (1 - this->n_compressor));
         thermal_output_kW += compression_Q_kW;
-        compression_Q_vec_kW[timestep] = compression_Q_kW;
+        compression_Q_vec_kW[record_index] = compression_Q_kW;
     }
 
 
@@ -1249,6 +1290,8 @@ void H2 :: getExternalHydrogenLoadkg(std::string path_2_external_hydrogen_load_t
 
 double H2 :: commitExternalHydrogenLoadkg(int timestep, double dt_hrs)
 {
+    int record_index = this->getRecordIndex(timestep);
+    
     double charging_kW = 0;
     this->making_hydrogen_for_external_load = false;
 
@@ -1258,7 +1301,7 @@ double H2 :: commitExternalHydrogenLoadkg(int timestep, double dt_hrs)
             // if yes, deplete tank amount meet hydrogen load
             this->tank_level_kg -= this->hydrogen_load_vec_kg[timestep];
             // update tank vector
-            this->tank_level_vec_kg[timestep] = this->tank_level_kg;
+            this->tank_level_vec_kg[record_index] = this->tank_level_kg;
         }
 
         else { 
@@ -1273,7 +1316,7 @@ double H2 :: commitExternalHydrogenLoadkg(int timestep, double dt_hrs)
 
             // initiate electrolyzer methods to make hydrogen for external load
             this->electrolyzer.commitCharge(timestep,dt_hrs,this->el_spec_consumption_kWh,charging_kW,this->el_capacity_kW);
-            this->el_output_kg = this->electrolyzer.el_output_vec_kg[timestep];
+            this->el_output_kg = this->electrolyzer.el_output_vec_kg[record_index];
             this->electrolyzer.getQ_el(timestep,dt_hrs,charging_kW,this->el_output_kg);
             this->getWaterDemand(timestep,this->el_output_kg);
             this->__handleDegradation(timestep,dt_hrs);
@@ -1302,6 +1345,8 @@ double H2 :: commitExternalHydrogenLoadkg(int timestep, double dt_hrs)
 void H2 :: commitCurtailmentHydrogen(int timestep, double dt_hrs, double unused_curtailment)
 {
 
+    int record_index = this->getRecordIndex(timestep);
+    
     // run electrolysis methods if we are considering curtailment hydrogen potential AND Tank is already full
     if(excess_hydrogen_potential_included && (this->tank_level_kg >= (this->max_SOC * this->h2_tank_capacity_kg))){
 
@@ -1317,13 +1362,13 @@ void H2 :: commitCurtailmentHydrogen(int timestep, double dt_hrs, double unused_
 
         // run electrolysis methods 
         this->electrolyzer.commitCharge(timestep,dt_hrs,this->el_spec_consumption_kWh,charging_kW,this->el_capacity_kW);
-        this->el_output_kg = this->electrolyzer.el_output_vec_kg[timestep];
+        this->el_output_kg = this->electrolyzer.el_output_vec_kg[record_index];
         this->electrolyzer.getQ_el(timestep,dt_hrs,charging_kW,this->el_output_kg);
         this->getWaterDemand(timestep,this->el_output_kg);
         this->__handleDegradation(timestep,dt_hrs); 
         
         // update vector and total
-        curtailed_hydrogen_vec_kg[timestep] = this->el_output_kg;
+        curtailed_hydrogen_vec_kg[record_index] = this->el_output_kg;
         this->total_curtailed_hydrogen_potential += this->el_output_kg;
 
     } 
@@ -1347,13 +1392,164 @@ void H2 :: getWaterDemand(
     double el_output_kg
     )
 {
+    int record_index = this->getRecordIndex(timestep);
+    
     double water_demand_kg = el_output_kg*this->water_demand_L;
-    this->water_demand_vec_kg[timestep] = water_demand_kg;
+    this->water_demand_vec_kg[record_index] = water_demand_kg;
     this->total_water_demand_kg += water_demand_kg;
     
     return;
 }   /* getTemperature() */
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void H2 :: summarizeTimestep(int timestep, double t_hrs)
+///
+/// \brief Method to fold the costs of the given (completed) timestep into the net
+///     present cost, and then clear the records (including those of the electrolyzer
+///     and fuel cell) to be used by the next timestep, if only summary results are
+///     being recorded. Otherwise, does nothing.
+///
+/// \param timestep The timestep (i.e., time series index) to summarize.
+///
+/// \param t_hrs The point in time [hrs] associated with the timestep.
+///
+
+void H2 :: summarizeTimestep(int timestep, double t_hrs)
+{
+    if (not this->summary_only) {
+        return;
+    }
+    
+    //  1. invoke base class method
+    Storage :: summarizeTimestep(timestep, t_hrs);
+    
+    //  2. clear records of next timestep
+    int record_index = this->getRecordIndex(timestep + 1);
+    
+    this->tank_level_vec_kg[record_index] = 0;
+    this->compression_power_vec_kW[record_index] = 0;
+    this->water_demand_vec_kg[record_index] = 0;
+    this->curtailed_hydrogen_vec_kg[record_index] = 0;
+    this->SOH_el_vec[record_index] = 0;
+    this->SOH_fc_vec[record_index] = 0;
+    this->n_fuelcell_vec[record_index] = 0;
+    this->n_electrolyzer_vec[record_index] = 0;
+    this->compression_Q_vec_kW[record_index] = 0;
+    
+    this->electrolyzer.clearRecord(timestep + 1);
+    this->fuelcell.clearRecord(timestep + 1);
+    
+    return;
+}   /* summarizeTimestep() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void H2 :: addResultColumns(ColumnarWriter* columnar_writer_ptr)
+///
+/// \brief Method to add the time series results of the H2 asset to a
+///     columnar results file (see ColumnarWriter).
+///
+/// \param columnar_writer_ptr A pointer to the ColumnarWriter to add columns to.
+///
+
+void H2 :: addResultColumns(ColumnarWriter* columnar_writer_ptr)
+{
+    //  1. invoke base class method
+    Storage :: addResultColumns(columnar_writer_ptr);
+    
+    //  2. add fuel cell, electrolyzer, and tank columns
+    columnar_writer_ptr->addColumn(
+        "Fuel Cell Production",
+        "kW",
+        &(this->fuelcell.fc_output_vec_kW)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Stored Hydrogen",
+        "kg",
+        &(this->tank_level_vec_kg)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "External Hydrogen Load",
+        "kg",
+        &(this->hydrogen_load_vec_kg)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Curtailed Hydrogen Potential",
+        "kg",
+        &(this->curtailed_hydrogen_vec_kg)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Compression Power",
+        "kW",
+        &(this->compression_power_vec_kW)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Compression Thermal Output",
+        "kW",
+        &(this->compression_Q_vec_kW)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Water Demand",
+        "kg",
+        &(this->water_demand_vec_kg)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Electrolyzer H2 Production",
+        "kg",
+        &(this->electrolyzer.el_output_vec_kg)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Fuel Cell Consumption",
+        "kg",
+        &(this->fuelcell.fc_consumption_vec_kg)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Electrolyzer State of Health (at end of timestep)",
+        "",
+        &(this->SOH_el_vec)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Fuel Cell State of Health (at end of timestep)",
+        "",
+        &(this->SOH_fc_vec)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Electrolyzer Operational Efficiency",
+        "",
+        &(this->n_electrolyzer_vec)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Fuel Cell Operational Efficiency",
+        "",
+        &(this->n_fuelcell_vec)
+    );
+    
+    return;
+}   /* addResultColumns() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
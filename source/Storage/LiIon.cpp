@@ -375,7 +375,7 @@ void LiIon :: __handleDegradation(
     this->__modelDegradation(dt_hrs, charging_discharging_kW);
     
     //  2. update and record
-    this->SOH_vec[timestep] = this->SOH;
+    this->SOH_vec[this->getRecordIndex(timestep)] = this->SOH;
     this->dynamic_energy_capacity_kWh = this->SOH * this->energy_capacity_kWh;
     
     if (this->power_degradation_flag) {
@@ -626,7 +626,7 @@ void LiIon :: __writeTimeSeries(
 {
     //  1. create filestream
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
+    BufferedWriter ofs;
     ofs.open(write_path, std::ofstream::out);
     
     //  2. write time series results (comma separated value)
@@ -639,14 +639,16 @@ void LiIon :: __writeTimeSeries(
     ofs << "Operation and Maintenance Cost (actual),";
     ofs << "\n";
     
+    size_t capital_cost_event_idx = 0;
+    
     for (int i = 0; i < max_lines; i++) {
         ofs << time_vec_hrs_ptr->at(i) << ",";
         ofs << this->charging_power_vec_kW[i] << ",";
         ofs << this->discharging_power_vec_kW[i] << ",";
         ofs << this->charge_vec_kWh[i] << ",";
         ofs << this->SOH_vec[i] << ",";
-        ofs << this->capital_cost_vec[i] << ",";
-        ofs << this->operation_maintenance_cost_vec[i] << ",";
+        ofs << this->getCapitalCost(i, &capital_cost_event_idx) << ",";
+        ofs << this->getOperationMaintenanceCost(i) << ",";
         ofs << "\n";
     }
     
@@ -761,10 +763,14 @@ Storage(
     }
     
     if (not this->is_sunk) {
-        this->capital_cost_vec[0] = this->capital_cost;
+        this->incurCapitalCost(
+            0,
+            this->capital_cost,
+            CapitalCostReason :: CAPITAL_COST_INITIAL
+        );
     }
     
-    this->SOH_vec.resize(this->n_points, 0);
+    this->SOH_vec.resize(this->n_record_points, 0);
     
     //  3. construction print
     if (this->print_flag) {
@@ -824,7 +830,7 @@ void LiIon :: commit_SelfDischarge(int timestep, double dt_hrs)
 {
     //  account for self-discharge if asset is not discharging or charging 
     this->charge_kWh -= (this->charge_kWh * this->self_discharge_rate / 720 * dt_hrs);
-    this->charge_vec_kWh[timestep] = this->charge_kWh;
+    this->charge_vec_kWh[this->getRecordIndex(timestep)] = this->charge_kWh;
     
     return;
 }   /* getAvailablekW() */
@@ -945,11 +951,12 @@ void LiIon :: commitCharge(
 )
 {
     //  1. record charging power
-    this->charging_power_vec_kW[timestep] = charging_kW;
+    int record_index = this->getRecordIndex(timestep);
+    this->charging_power_vec_kW[record_index] = charging_kW;
     
     //  2. update charge and record
     this->charge_kWh += this->charging_efficiency * charging_kW * dt_hrs;
-    this->charge_vec_kWh[timestep] = this->charge_kWh;
+    this->charge_vec_kWh[record_index] = this->charge_kWh;
     
     //  3. toggle depleted flag (if applicable)
     this->__toggleDepleted();
@@ -964,7 +971,7 @@ void LiIon :: commitCharge(
     
     //  6. capture operation and maintenance costs (if applicable)
     if (charging_kW > 0) {
-        this->operation_maintenance_cost_vec[timestep] = charging_kW * dt_hrs *
+        this->operation_maintenance_cost_vec[record_index] = charging_kW * dt_hrs *
             this->operation_maintenance_cost_kWh;
     }
     
@@ -1008,12 +1015,13 @@ double LiIon :: commitDischarge(
 )
 {
     //  1. record discharging power, update total
-    this->discharging_power_vec_kW[timestep] = discharging_kW;
+    int record_index = this->getRecordIndex(timestep);
+    this->discharging_power_vec_kW[record_index] = discharging_kW;
     this->total_discharge_kWh += discharging_kW * dt_hrs;
     
     //  2. update charge and record
     this->charge_kWh -= (discharging_kW * dt_hrs) / this->discharging_efficiency;
-    this->charge_vec_kWh[timestep] = this->charge_kWh;
+    this->charge_vec_kWh[record_index] = this->charge_kWh;
     
     //  3. update load
     load_kW -= discharging_kW;
@@ -1031,7 +1039,7 @@ double LiIon :: commitDischarge(
     
     //  7. capture operation and maintenance costs (if applicable)
     if (discharging_kW > 0) {
-        this->operation_maintenance_cost_vec[timestep] = discharging_kW * dt_hrs *
+        this->operation_maintenance_cost_vec[record_index] = discharging_kW * dt_hrs *
             this->operation_maintenance_cost_kWh;
     }
     
@@ -1059,13 +1067,14 @@ double LiIon :: getThermalOutput(
 ) 
 {
     double thermal_output_kWh = 0;
+    int record_index = this->getRecordIndex(timestep);
     // get  fuel cell thermal energy output for thermal energy modelling
-    if (this->charging_power_vec_kW[timestep] > 0){
-        thermal_output_kWh = this->charging_power_vec_kW[timestep] * (1 - this->charging_efficiency);
+    if (this->charging_power_vec_kW[record_index] > 0){
+        thermal_output_kWh = this->charging_power_vec_kW[record_index] * (1 - this->charging_efficiency);
     }
 
-    if (this->discharging_power_vec_kW[timestep] > 0){
-        thermal_output_kWh = this->discharging_power_vec_kW[timestep] * (1 - this->discharging_efficiency);
+    if (this->discharging_power_vec_kW[record_index] > 0){
+        thermal_output_kWh = this->discharging_power_vec_kW[record_index] * (1 - this->discharging_efficiency);
     }
 
     return thermal_output_kWh;
@@ -1093,6 +1102,36 @@ double LiIon :: getMcp(
     return mcp;
 }
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void LiIon :: addResultColumns(ColumnarWriter* columnar_writer_ptr)
+///
+/// \brief Method to add the time series results of the LiIon asset to a
+///     columnar results file (see ColumnarWriter).
+///
+/// \param columnar_writer_ptr A pointer to the ColumnarWriter to add columns to.
+///
+
+void LiIon :: addResultColumns(ColumnarWriter* columnar_writer_ptr)
+{
+    //  1. invoke base class method
+    Storage :: addResultColumns(columnar_writer_ptr);
+    
+    //  2. add state of health column
+    columnar_writer_ptr->addColumn(
+        "State of Health (at end of timestep)",
+        "",
+        &(this->SOH_vec)
+    );
+    
+    return;
+}   /* addResultColumns() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
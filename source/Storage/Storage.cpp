@@ -212,6 +212,9 @@ Storage :: Storage(
     this->print_flag = storage_inputs.print_flag;
     this->is_depleted = false;
     this->is_sunk = storage_inputs.is_sunk;
+    this->summary_only = storage_inputs.summary_only;
+    this->external_hydrogen_load_included = false;
+    this->making_hydrogen_for_external_load = false;
     
     this->n_points = n_points;
     this->n_replacements = 0;
@@ -234,16 +237,23 @@ Storage :: Storage(
     
     this->capital_cost = 0;
     this->operation_maintenance_cost_kWh = 0;
+    this->capital_cost_scalar = 1;
+    this->operation_maintenance_cost_scalar = 1;
     this->net_present_cost = 0;
     this->total_discharge_kWh = 0;
     this->levellized_cost_of_energy_kWh = 0;
     
-    this->charge_vec_kWh.resize(this->n_points, 0);
-    this->charging_power_vec_kW.resize(this->n_points, 0);
-    this->discharging_power_vec_kW.resize(this->n_points, 0);
+    this->n_record_points = this->n_points;
     
-    this->capital_cost_vec.resize(this->n_points, 0);
-    this->operation_maintenance_cost_vec.resize(this->n_points, 0);
+    if (this->summary_only) {
+        this->n_record_points = 2;
+    }
+    
+    this->charge_vec_kWh.resize(this->n_record_points, 0);
+    this->charging_power_vec_kW.resize(this->n_record_points, 0);
+    this->discharging_power_vec_kW.resize(this->n_record_points, 0);
+    
+    this->operation_maintenance_cost_vec.resize(this->n_record_points, 0);
     
     //  3. construction print
     if (this->print_flag) {
@@ -278,7 +288,11 @@ void Storage :: handleReplacement(int timestep)
     this->n_replacements++;
     
     //  3. incur capital cost in timestep
-    this->capital_cost_vec[timestep] = this->capital_cost;
+    this->incurCapitalCost(
+        timestep,
+        this->capital_cost,
+        CapitalCostReason :: CAPITAL_COST_REPLACEMENT
+    );
     
     return;
 }   /* __handleReplacement() */
@@ -290,7 +304,168 @@ void Storage :: handleReplacement(int timestep)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Storage :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
+/// \fn void Storage :: incurCapitalCost(
+///         int timestep,
+///         double cost,
+///         CapitalCostReason reason
+///     )
+///
+/// \brief Method to log a capital cost incurred by the asset. Costs must be logged in
+///     time order (as they are over a Model run).
+///
+/// \param timestep The timestep (i.e., time series index) in which the cost is incurred.
+///
+/// \param cost The capital cost incurred (undefined currency).
+///
+/// \param reason The reason for which the cost is incurred.
+///
+
+void Storage :: incurCapitalCost(
+    int timestep,
+    double cost,
+    CapitalCostReason reason
+)
+{
+    //  1. check time order
+    if (
+        not this->capital_cost_event_vec.empty() and
+        timestep < this->capital_cost_event_vec.back().timestep
+    ) {
+        std::string error_str = "ERROR:  Storage::incurCapitalCost():  ";
+        error_str += "capital costs must be logged in time order";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+        
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  2. log event
+    CapitalCostEvent capital_cost_event;
+    
+    capital_cost_event.timestep = timestep;
+    capital_cost_event.cost = cost;
+    capital_cost_event.reason = reason;
+    
+    this->capital_cost_event_vec.push_back(capital_cost_event);
+    
+    return;
+}   /* incurCapitalCost() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Storage :: getCapitalCost(int timestep, size_t* event_idx_ptr)
+///
+/// \brief Method to get the capital cost incurred in the given timestep, by walking the
+///     (time ordered) capital cost event log from the given cursor. Intended for
+///     writing results over ascending timesteps, so that no dense time series of
+///     capital costs need be held.
+///
+/// \param timestep The timestep (i.e., time series index) of interest.
+///
+/// \param event_idx_ptr A pointer to the index of the next unread event in the log
+///     (cursor). Should start at 0, and is advanced past all events up to and including
+///     the given timestep.
+///
+/// \return The (actual) capital cost incurred in the given timestep, scaled by
+///     capital_cost_scalar (see Model::recomputeEconomics()).
+///
+
+double Storage :: getCapitalCost(int timestep, size_t* event_idx_ptr)
+{
+    double capital_cost = 0;
+    
+    while (
+        *event_idx_ptr < this->capital_cost_event_vec.size() and
+        this->capital_cost_event_vec[*event_idx_ptr].timestep <= timestep
+    ) {
+        if (this->capital_cost_event_vec[*event_idx_ptr].timestep == timestep) {
+            capital_cost += this->capital_cost_event_vec[*event_idx_ptr].cost;
+        }
+        
+        (*event_idx_ptr)++;
+    }
+    
+    return this->capital_cost_scalar * capital_cost;
+}   /* getCapitalCost() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::vector<double> Storage :: getCapitalCostSeries(void)
+///
+/// \brief Method to expand the capital cost event log into a time series of (actual)
+///     capital costs. The series is returned by value, and so is held only as long as
+///     the caller needs it (e.g., while writing columnar results).
+///
+/// \return A time series of the capital costs incurred over each modelling time step
+///     (scaled by capital_cost_scalar), or an empty vector if only summary results are
+///     recorded.
+///
+
+std::vector<double> Storage :: getCapitalCostSeries(void)
+{
+    std::vector<double> capital_cost_vec;
+    
+    if (this->summary_only) {
+        return capital_cost_vec;
+    }
+    
+    capital_cost_vec.resize(this->n_points, 0);
+    
+    for (size_t i = 0; i < this->capital_cost_event_vec.size(); i++) {
+        capital_cost_vec[this->capital_cost_event_vec[i].timestep] +=
+            this->capital_cost_scalar * this->capital_cost_event_vec[i].cost;
+    }
+    
+    return capital_cost_vec;
+}   /* getCapitalCostSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Storage :: getOperationMaintenanceCost(int timestep)
+///
+/// \brief Method to get the operation and maintenance cost incurred in the given
+///     timestep, as written to results.
+///
+/// \param timestep The timestep (i.e., time series index) of interest.
+///
+/// \return The (actual) operation and maintenance cost incurred in the given timestep,
+///     scaled by operation_maintenance_cost_scalar (see Model::recomputeEconomics()).
+///
+
+double Storage :: getOperationMaintenanceCost(int timestep)
+{
+    return this->operation_maintenance_cost_scalar *
+        this->operation_maintenance_cost_vec[timestep];
+}   /* getOperationMaintenanceCost() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Storage :: computeEconomics(
+///         std::vector<double>* time_vec_hrs_ptr,
+///         DiscountFactorCache* discount_factor_cache_ptr
+///     )
 ///
 /// \brief Helper method to compute key economic metrics for the Model run.
 ///
@@ -302,28 +477,76 @@ void Storage :: handleReplacement(int timestep)
 /// \param time_vec_hrs_ptr A pointer to the time_vec_hrs attribute of the
 ///     ElectricalLoad.
 ///
+/// \param discount_factor_cache_ptr A pointer to a shared DiscountFactorCache (defaults
+///     to NULL). If given, then net present cost is computed as a dot product of cached
+///     discount factors with the cost vectors, rather than by computing the discount
+///     factors anew.
+///
 
-void Storage :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
+void Storage :: computeEconomics(
+    std::vector<double>* time_vec_hrs_ptr,
+    DiscountFactorCache* discount_factor_cache_ptr
+)
 {
-    //  1. compute net present cost
+    //  1. account for capital costs in net present cost (over the capital cost events)
     double t_hrs = 0;
     double real_discount_scalar = 0;
     
-    for (int i = 0; i < this->n_points; i++) {
-        t_hrs = time_vec_hrs_ptr->at(i);
-        
-        real_discount_scalar = 1.0 / pow(
-            1 + this->real_discount_annual,
-            t_hrs / 8760
-        );
-        
-        this->net_present_cost += real_discount_scalar * this->capital_cost_vec[i];
-        
+    if (discount_factor_cache_ptr != NULL) {
         this->net_present_cost +=
-            real_discount_scalar * this->operation_maintenance_cost_vec[i];
+            this->capital_cost_scalar *
+            discount_factor_cache_ptr->computePresentValue(
+                this->real_discount_annual,
+                &(this->capital_cost_event_vec)
+            );
     }
     
-    /// 2. compute levellized cost of energy (per unit discharged)
+    else {
+        for (size_t i = 0; i < this->capital_cost_event_vec.size(); i++) {
+            t_hrs = time_vec_hrs_ptr->at(this->capital_cost_event_vec[i].timestep);
+            
+            real_discount_scalar = 1.0 / pow(
+                1 + this->real_discount_annual,
+                t_hrs / 8760
+            );
+            
+            this->net_present_cost += real_discount_scalar *
+                this->capital_cost_scalar * this->capital_cost_event_vec[i].cost;
+        }
+    }
+    
+    //  2. account for operation and maintenance costs in net present cost (if summary
+    //     only, then this has already been accumulated over the Model run, see
+    //     summarizeTimestep())
+    if (this->summary_only) {
+        // pass
+    }
+    
+    else if (discount_factor_cache_ptr != NULL) {
+        this->net_present_cost +=
+            this->operation_maintenance_cost_scalar *
+            discount_factor_cache_ptr->computePresentValue(
+                this->real_discount_annual,
+                &(this->operation_maintenance_cost_vec)
+            );
+    }
+    
+    else {
+        for (int i = 0; i < this->n_points; i++) {
+            t_hrs = time_vec_hrs_ptr->at(i);
+            
+            real_discount_scalar = 1.0 / pow(
+                1 + this->real_discount_annual,
+                t_hrs / 8760
+            );
+            
+            this->net_present_cost += real_discount_scalar *
+                this->operation_maintenance_cost_scalar *
+                this->operation_maintenance_cost_vec[i];
+        }
+    }
+    
+    /// 3. compute levellized cost of energy (per unit discharged)
     //     assuming 8,760 hours per year
     if (this->total_discharge_kWh <= 0) {
         this->levellized_cost_of_energy_kWh = this->net_present_cost;
@@ -351,6 +574,131 @@ void Storage :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Storage :: resetEconomics(
+///         double nominal_inflation_annual,
+///         double nominal_discount_annual
+///     )
+///
+/// \brief Method to apply new nominal inflation and discount rates, and to reset the
+///     economic metrics of the asset, so that they can be recomputed from the recorded
+///     time series (see Model::recomputeEconomics()).
+///
+/// \param nominal_inflation_annual The nominal, annual inflation rate to use in
+///     computing model economics.
+///
+/// \param nominal_discount_annual The nominal, annual discount rate to use in
+///     computing model economics.
+///
+
+void Storage :: resetEconomics(
+    double nominal_inflation_annual,
+    double nominal_discount_annual
+)
+{
+    //  1. apply rates
+    this->nominal_inflation_annual = nominal_inflation_annual;
+    this->nominal_discount_annual = nominal_discount_annual;
+    
+    this->real_discount_annual = this->__computeRealDiscountAnnual(
+        nominal_inflation_annual,
+        nominal_discount_annual
+    );
+    
+    //  2. reset economic metrics
+    this->net_present_cost = 0;
+    this->levellized_cost_of_energy_kWh = 0;
+    
+    return;
+}   /* resetEconomics() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn int Storage :: getRecordIndex(int timestep)
+///
+/// \brief Method to get the index into the per-timestep result vectors at which the
+///     given timestep is recorded. This is simply the timestep, unless only summary
+///     results are being recorded, in which case the result vectors hold only the
+///     current and previous time steps (so that dispatch may still refer back one
+///     time step, as H2 does), and are reused in turn.
+///
+/// \param timestep The timestep (i.e., time series index) for the request.
+///
+/// \return The index into the per-timestep result vectors for the given timestep.
+///
+
+int Storage :: getRecordIndex(int timestep)
+{
+    if (this->summary_only) {
+        return timestep % this->n_record_points;
+    }
+    
+    return timestep;
+}   /* getRecordIndex() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Storage :: summarizeTimestep(int timestep, double t_hrs)
+///
+/// \brief Method to fold the costs of the given (completed) timestep into the net
+///     present cost, and then clear the record to be used by the next timestep, if
+///     only summary results are being recorded. Otherwise, does nothing (the full
+///     result vectors are processed after the Model run instead).
+///
+/// Ref: \cite HOMER_discount_factor\n
+///
+/// \param timestep The timestep (i.e., time series index) to summarize.
+///
+/// \param t_hrs The point in time [hrs] associated with the timestep.
+///
+
+void Storage :: summarizeTimestep(int timestep, double t_hrs)
+{
+    if (not this->summary_only) {
+        return;
+    }
+    
+    //  1. accumulate discounted costs incurred in timestep (capital costs are logged
+    //     as events, see computeEconomics())
+    double real_discount_scalar = 1.0 / pow(
+        1 + this->real_discount_annual,
+        t_hrs / 8760
+    );
+    
+    int record_index = this->getRecordIndex(timestep);
+    
+    this->net_present_cost +=
+        real_discount_scalar * this->operation_maintenance_cost_vec[record_index];
+    
+    //  2. clear record of next timestep (the record of this timestep is kept, so that
+    //     the next timestep may refer back to it)
+    record_index = this->getRecordIndex(timestep + 1);
+    
+    this->charge_vec_kWh[record_index] = 0;
+    this->charging_power_vec_kW[record_index] = 0;
+    this->discharging_power_vec_kW[record_index] = 0;
+    
+    this->operation_maintenance_cost_vec[record_index] = 0;
+    
+    return;
+}   /* summarizeTimestep() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -383,11 +731,15 @@ void Storage :: writeResults(
     int max_lines
 )
 {
-    //  1. handle sentinel
+    //  1. handle sentinel (no time series are recorded if summary only)
     if (max_lines < 0) {
         max_lines = this->n_points;
     }
     
+    if (this->summary_only) {
+        max_lines = 0;
+    }
+    
     //  2. create subdirectories
     write_path += "Storage/";
     if (not std::filesystem::is_directory(write_path)) {
@@ -443,6 +795,75 @@ void Storage :: writeResults(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Storage :: addResultColumns(ColumnarWriter* columnar_writer_ptr)
+///
+/// \brief Method to add the time series results of the Storage asset to a
+///     columnar results file (see ColumnarWriter).
+///
+/// \param columnar_writer_ptr A pointer to the ColumnarWriter to add columns to.
+///
+
+void Storage :: addResultColumns(ColumnarWriter* columnar_writer_ptr)
+{
+    columnar_writer_ptr->addColumn(
+        "Charging Power",
+        "kW",
+        &(this->charging_power_vec_kW)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Discharging Power",
+        "kW",
+        &(this->discharging_power_vec_kW)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Charge (at end of timestep)",
+        "kWh",
+        &(this->charge_vec_kWh)
+    );
+    
+    columnar_writer_ptr->addColumn(
+        "Capital Cost (actual)",
+        "",
+        this->getCapitalCostSeries()
+    );
+    
+    if (this->operation_maintenance_cost_scalar == 1) {
+        columnar_writer_ptr->addColumn(
+            "Operation and Maintenance Cost (actual)",
+            "",
+            &(this->operation_maintenance_cost_vec)
+        );
+    }
+    
+    else {
+        std::vector<double> operation_maintenance_cost_vec(
+            this->operation_maintenance_cost_vec
+        );
+        
+        for (size_t i = 0; i < operation_maintenance_cost_vec.size(); i++) {
+            operation_maintenance_cost_vec[i] *=
+                this->operation_maintenance_cost_scalar;
+        }
+        
+        columnar_writer_ptr->addColumn(
+            "Operation and Maintenance Cost (actual)",
+            "",
+            std::move(operation_maintenance_cost_vec)
+        );
+    }
+    
+    return;
+}   /* addResultColumns() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
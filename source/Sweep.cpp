@@ -0,0 +1,668 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file Sweep.cpp
+///
+/// \brief Implementation file for the Sweep class.
+///
+/// A class which runs many scenarios (i.e., candidate microgrid designs) against the
+/// same electrical load and resource data, in parallel.
+///
+
+
+#include "../header/Sweep.h"
+
+
+
+// ======== PRIVATE ================================================================= //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Sweep :: __checkInputs(SweepInputs sweep_inputs)
+///
+/// \brief Helper method (private) to check inputs to the Sweep constructor.
+///
+/// \param sweep_inputs A structure of Sweep constructor inputs.
+///
+
+void Sweep :: __checkInputs(SweepInputs sweep_inputs)
+{
+    //  1. check path_2_electrical_load_time_series
+    if (sweep_inputs.path_2_electrical_load_time_series.empty()) {
+        std::string error_str = "ERROR:  Sweep():  ";
+        error_str += "SweepInputs::path_2_electrical_load_time_series cannot be empty";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    return;
+}   /* __checkInputs() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Sweep :: __checkResourceKey1D(
+///         int scenario_index,
+///         int resource_key,
+///         std::string asset_str
+///     )
+///
+/// \brief Helper method to check that the given resource key refers to a 1D resource
+///     held by the Sweep.
+///
+/// \param scenario_index The index of the scenario being checked.
+///
+/// \param resource_key The resource key to check.
+///
+/// \param asset_str A string describing the asset which refers to the resource key.
+///
+
+void Sweep :: __checkResourceKey1D(
+    int scenario_index,
+    int resource_key,
+    std::string asset_str
+)
+{
+    if (this->resources.resource_map_1D.count(resource_key) == 0) {
+        std::string error_str = "ERROR:  Sweep::run():  scenario ";
+        error_str += std::to_string(scenario_index);
+        error_str += ":  ";
+        error_str += asset_str;
+        error_str += " refers to resource key ";
+        error_str += std::to_string(resource_key);
+        error_str += ", but no 1D resource with that key has been added to the Sweep";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    return;
+}   /* __checkResourceKey1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Sweep :: __checkResourceKey2D(
+///         int scenario_index,
+///         int resource_key,
+///         std::string asset_str
+///     )
+///
+/// \brief Helper method to check that the given resource key refers to a 2D resource
+///     held by the Sweep.
+///
+/// \param scenario_index The index of the scenario being checked.
+///
+/// \param resource_key The resource key to check.
+///
+/// \param asset_str A string describing the asset which refers to the resource key.
+///
+
+void Sweep :: __checkResourceKey2D(
+    int scenario_index,
+    int resource_key,
+    std::string asset_str
+)
+{
+    if (this->resources.resource_map_2D.count(resource_key) == 0) {
+        std::string error_str = "ERROR:  Sweep::run():  scenario ";
+        error_str += std::to_string(scenario_index);
+        error_str += ":  ";
+        error_str += asset_str;
+        error_str += " refers to resource key ";
+        error_str += std::to_string(resource_key);
+        error_str += ", but no 2D resource with that key has been added to the Sweep";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    return;
+}   /* __checkResourceKey2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Sweep :: __checkScenario(int scenario_index)
+///
+/// \brief Helper method to check that every resource key referred to by the given
+///     scenario is held by the Sweep. This is done up front (and serially), since
+///     the shared Resources object must not be modified once scenarios are running.
+///
+/// \param scenario_index The index of the scenario to check.
+///
+
+void Sweep :: __checkScenario(int scenario_index)
+{
+    ScenarioInputs* scenario_inputs_ptr = &(this->scenario_inputs_vec[scenario_index]);
+    
+    for (size_t i = 0; i < scenario_inputs_ptr->hydro_inputs_vec.size(); i++) {
+        this->__checkResourceKey1D(
+            scenario_index,
+            scenario_inputs_ptr->hydro_inputs_vec[i].resource_key,
+            "Hydro asset " + std::to_string(i)
+        );
+    }
+    
+    for (size_t i = 0; i < scenario_inputs_ptr->solar_inputs_vec.size(); i++) {
+        this->__checkResourceKey1D(
+            scenario_index,
+            scenario_inputs_ptr->solar_inputs_vec[i].resource_key,
+            "Solar asset " + std::to_string(i)
+        );
+    }
+    
+    for (size_t i = 0; i < scenario_inputs_ptr->tidal_inputs_vec.size(); i++) {
+        this->__checkResourceKey1D(
+            scenario_index,
+            scenario_inputs_ptr->tidal_inputs_vec[i].resource_key,
+            "Tidal asset " + std::to_string(i)
+        );
+    }
+    
+    for (size_t i = 0; i < scenario_inputs_ptr->wave_inputs_vec.size(); i++) {
+        this->__checkResourceKey2D(
+            scenario_index,
+            scenario_inputs_ptr->wave_inputs_vec[i].resource_key,
+            "Wave asset " + std::to_string(i)
+        );
+    }
+    
+    for (size_t i = 0; i < scenario_inputs_ptr->wind_inputs_vec.size(); i++) {
+        this->__checkResourceKey1D(
+            scenario_index,
+            scenario_inputs_ptr->wind_inputs_vec[i].resource_key,
+            "Wind asset " + std::to_string(i)
+        );
+    }
+    
+    return;
+}   /* __checkScenario() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn ScenarioSummary Sweep :: __runScenario(int scenario_index)
+///
+/// \brief Helper method to build, run, and summarize a single scenario. The scenario
+///     Model refers to the shared electrical load and resource data, and is destroyed
+///     as soon as it has been summarized. Any error raised by the scenario is logged
+///     in the summary (rather than thrown), so that one bad scenario does not end the
+///     Sweep.
+///
+/// \param scenario_index The index of the scenario to run.
+///
+/// \return A summary of the scenario results.
+///
+
+ScenarioSummary Sweep :: __runScenario(int scenario_index)
+{
+    ScenarioSummary scenario_summary;
+    scenario_summary.scenario_index = scenario_index;
+    
+    ScenarioInputs* scenario_inputs_ptr = &(this->scenario_inputs_vec[scenario_index]);
+    
+    try {
+        //  1. construct Model (sharing electrical load, resources, and discount
+        //     factors; if scenarios already run in parallel, then each Model computes
+        //     its Renewable production on a single thread)
+        ModelInputs model_inputs = scenario_inputs_ptr->model_inputs;
+        
+        if (this->n_threads > 1) {
+            model_inputs.n_threads = 1;
+        }
+        
+        Model model(
+            model_inputs,
+            &(this->electrical_load),
+            &(this->resources),
+            &(this->discount_factor_cache)
+        );
+        
+        //  2. add assets
+        for (size_t i = 0; i < scenario_inputs_ptr->diesel_inputs_vec.size(); i++) {
+            model.addDiesel(scenario_inputs_ptr->diesel_inputs_vec[i]);
+        }
+        
+        for (size_t i = 0; i < scenario_inputs_ptr->hydro_inputs_vec.size(); i++) {
+            model.addHydro(scenario_inputs_ptr->hydro_inputs_vec[i]);
+        }
+        
+        for (size_t i = 0; i < scenario_inputs_ptr->solar_inputs_vec.size(); i++) {
+            model.addSolar(scenario_inputs_ptr->solar_inputs_vec[i]);
+        }
+        
+        for (size_t i = 0; i < scenario_inputs_ptr->tidal_inputs_vec.size(); i++) {
+            model.addTidal(scenario_inputs_ptr->tidal_inputs_vec[i]);
+        }
+        
+        for (size_t i = 0; i < scenario_inputs_ptr->wave_inputs_vec.size(); i++) {
+            model.addWave(scenario_inputs_ptr->wave_inputs_vec[i]);
+        }
+        
+        for (size_t i = 0; i < scenario_inputs_ptr->wind_inputs_vec.size(); i++) {
+            model.addWind(scenario_inputs_ptr->wind_inputs_vec[i]);
+        }
+        
+        for (size_t i = 0; i < scenario_inputs_ptr->liion_inputs_vec.size(); i++) {
+            model.addLiIon(scenario_inputs_ptr->liion_inputs_vec[i]);
+        }
+        
+        for (size_t i = 0; i < scenario_inputs_ptr->h2_inputs_vec.size(); i++) {
+            model.addH2(scenario_inputs_ptr->h2_inputs_vec[i]);
+        }
+        
+        //  3. run
+        model.run();
+        
+        //  4. summarize
+        scenario_summary.net_present_cost = model.net_present_cost;
+        scenario_summary.levellized_cost_of_energy_kWh =
+            model.levellized_cost_of_energy_kWh;
+        
+        scenario_summary.total_fuel_consumed_L = model.total_fuel_consumed_L;
+        scenario_summary.total_emissions = model.total_emissions;
+        
+        scenario_summary.total_dispatch_kWh = model.total_dispatch_kWh;
+        scenario_summary.total_discharge_kWh = model.total_discharge_kWh;
+        scenario_summary.renewable_penetration = model.renewable_penetration;
+        
+        scenario_summary.total_missed_load_kWh =
+            model.controller.total_missed_load_kWh;
+        
+        scenario_summary.is_complete = true;
+    }
+    
+    catch (std::exception& e) {
+        scenario_summary.error_str = e.what();
+    }
+    
+    return scenario_summary;
+}   /* __runScenario() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PRIVATE ============================================================= //
+
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn Sweep :: Sweep(void)
+///
+/// \brief Constructor (dummy) for the Sweep class.
+///
+
+Sweep :: Sweep(void)
+{
+    this->n_threads = 1;
+    
+    return;
+}   /* Sweep() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn Sweep :: Sweep(SweepInputs sweep_inputs)
+///
+/// \brief Constructor (intended) for the Sweep class.
+///
+/// \param sweep_inputs A structure of Sweep constructor inputs.
+///
+
+Sweep :: Sweep(SweepInputs sweep_inputs)
+{
+    //  1. check inputs
+    this->__checkInputs(sweep_inputs);
+    
+    //  2. read in electrical load data (once, for all scenarios)
+    this->electrical_load.readLoadData(sweep_inputs.path_2_electrical_load_time_series);
+    this->discount_factor_cache.setTimeVec(&(this->electrical_load.time_vec_hrs));
+    
+    //  3. set attributes
+    this->n_threads = TaskRunner(sweep_inputs.n_threads).n_threads;
+    
+    return;
+}   /* Sweep() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Sweep :: addResource(
+///         NoncombustionType noncombustion_type,
+///         std::string path_2_resource_data,
+///         int resource_key
+///     )
+///
+/// \brief A method to add a renewable resource time series to the Sweep (shared by
+///     all scenarios).
+///
+/// \param noncombustion_type The type of renewable resource being added to the Sweep.
+///
+/// \param path_2_resource_data A string defining the path (either relative or absolute) to the given resource time series.
+///
+/// \param resource_key A key used to index into the Resources object, used to associate Renewable assets with the corresponding resource.
+///
+
+void Sweep :: addResource(
+    NoncombustionType noncombustion_type,
+    std::string path_2_resource_data,
+    int resource_key
+)
+{
+    this->resources.addResource(
+        noncombustion_type,
+        path_2_resource_data,
+        resource_key,
+        &(this->electrical_load)
+    );
+    
+    return;
+}   /* addResource() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Sweep :: addResource(
+///         RenewableType renewable_type,
+///         std::string path_2_resource_data,
+///         int resource_key
+///     )
+///
+/// \brief A method to add a renewable resource time series to the Sweep (shared by
+///     all scenarios).
+///
+/// \param renewable_type The type of renewable resource being added to the Sweep.
+///
+/// \param path_2_resource_data A string defining the path (either relative or absolute) to the given resource time series.
+///
+/// \param resource_key A key used to index into the Resources object, used to associate Renewable assets with the corresponding resource.
+///
+
+void Sweep :: addResource(
+    RenewableType renewable_type,
+    std::string path_2_resource_data,
+    int resource_key
+)
+{
+    this->resources.addResource(
+        renewable_type,
+        path_2_resource_data,
+        resource_key,
+        &(this->electrical_load)
+    );
+    
+    return;
+}   /* addResource() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Sweep :: addScenario(ScenarioInputs scenario_inputs)
+///
+/// \brief Method to add a scenario to the Sweep.
+///
+/// \param scenario_inputs A structure defining the scenario.
+///
+
+void Sweep :: addScenario(ScenarioInputs scenario_inputs)
+{
+    this->scenario_inputs_vec.push_back(scenario_inputs);
+    
+    return;
+}   /* addScenario() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Sweep :: run(
+///         std::function<void(const ScenarioSummary&)> callback
+///     )
+///
+/// \brief A method to run every scenario of the Sweep, in parallel. Summaries are
+///     written to scenario_summary_vec (in scenario order), and are also streamed to
+///     the given callback (if any) as each scenario completes. Calls to the callback
+///     are serialized, so it need not be thread safe.
+///
+/// \param callback A function to call with each scenario summary, as it completes
+///     (completion order is not scenario order).
+///
+
+void Sweep :: run(std::function<void(const ScenarioSummary&)> callback)
+{
+    //  1. check scenarios against shared resources
+    for (size_t i = 0; i < this->scenario_inputs_vec.size(); i++) {
+        this->__checkScenario(i);
+    }
+    
+    //  2. init summaries
+    this->scenario_summary_vec.clear();
+    this->scenario_summary_vec.resize(this->scenario_inputs_vec.size());
+    
+    //  3. run scenarios on task runner
+    std::mutex callback_mutex;
+    TaskRunner task_runner(this->n_threads);
+    
+    task_runner.run(
+        this->scenario_inputs_vec.size(),
+        [&](size_t i) {
+            this->scenario_summary_vec[i] = this->__runScenario(i);
+            
+            if (callback) {
+                std::lock_guard<std::mutex> lock(callback_mutex);
+                callback(this->scenario_summary_vec[i]);
+            }
+        }
+    );
+    
+    return;
+}   /* run() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Sweep :: clear(void)
+///
+/// \brief Method to clear all attributes of the Sweep object.
+///
+
+void Sweep :: clear(void)
+{
+    this->scenario_inputs_vec.clear();
+    this->scenario_summary_vec.clear();
+    
+    this->electrical_load.clear();
+    this->resources.clear();
+    this->discount_factor_cache.clear();
+    
+    return;
+}   /* clear() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Sweep :: writeResults(std::string write_path)
+///
+/// \brief Method which writes the scenario summaries to
+///     <write_path>/sweep_results.csv (one row per scenario, in scenario order).
+///
+/// \param write_path A path (either relative or absolute) to the directory location 
+///     where results are to be written. If the results file already exists, will
+///     overwrite.
+///
+
+void Sweep :: writeResults(std::string write_path)
+{
+    //  1. create directory (if applicable), filestream
+    if (write_path.back() != '/') {
+        write_path += '/';
+    }
+    
+    if (not std::filesystem::is_directory(write_path)) {
+        std::filesystem::create_directory(write_path);
+    }
+    
+    write_path += "sweep_results.csv";
+    std::ofstream ofs;
+    ofs.open(write_path, std::ofstream::out);
+    
+    //  2. write header (comma separated value)
+    ofs << "Scenario,";
+    ofs << "Complete,";
+    ofs << "Net Present Cost,";
+    ofs << "Levellized Cost of Energy [1/kWh],";
+    ofs << "Total Fuel Consumed [L],";
+    ofs << "Total CO2 Emissions [kg],";
+    ofs << "Total CO Emissions [kg],";
+    ofs << "Total NOx Emissions [kg],";
+    ofs << "Total SOx Emissions [kg],";
+    ofs << "Total CH4 Emissions [kg],";
+    ofs << "Total PM Emissions [kg],";
+    ofs << "Total Dispatch [kWh],";
+    ofs << "Total Discharge [kWh],";
+    ofs << "Total Missed Load [kWh],";
+    ofs << "Renewable Penetration,";
+    ofs << "Error,";
+    ofs << "\n";
+    
+    //  3. write scenario summaries (comma separated value)
+    for (size_t i = 0; i < this->scenario_summary_vec.size(); i++) {
+        ScenarioSummary* summary_ptr = &(this->scenario_summary_vec[i]);
+        
+        ofs << summary_ptr->scenario_index << ",";
+        ofs << summary_ptr->is_complete << ",";
+        ofs << summary_ptr->net_present_cost << ",";
+        ofs << summary_ptr->levellized_cost_of_energy_kWh << ",";
+        ofs << summary_ptr->total_fuel_consumed_L << ",";
+        ofs << summary_ptr->total_emissions.CO2_kg << ",";
+        ofs << summary_ptr->total_emissions.CO_kg << ",";
+        ofs << summary_ptr->total_emissions.NOx_kg << ",";
+        ofs << summary_ptr->total_emissions.SOx_kg << ",";
+        ofs << summary_ptr->total_emissions.CH4_kg << ",";
+        ofs << summary_ptr->total_emissions.PM_kg << ",";
+        ofs << summary_ptr->total_dispatch_kWh << ",";
+        ofs << summary_ptr->total_discharge_kWh << ",";
+        ofs << summary_ptr->total_missed_load_kWh << ",";
+        ofs << summary_ptr->renewable_penetration << ",";
+        ofs << "\"" << summary_ptr->error_str << "\",";
+        ofs << "\n";
+    }
+    
+    ofs.close();
+    return;
+}   /* writeResults() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn Sweep :: ~Sweep(void)
+///
+/// \brief Destructor for the Sweep class.
+///
+
+Sweep :: ~Sweep(void)
+{
+    this->clear();
+    return;
+}   /* ~Sweep() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PUBLIC ============================================================== //
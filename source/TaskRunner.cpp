@@ -0,0 +1,208 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file TaskRunner.cpp
+///
+/// \brief Implementation file for the TaskRunner class.
+///
+/// A class which runs a set of independent, indexed tasks on up to a fixed number of
+/// worker threads.
+///
+
+
+#include "../header/TaskRunner.h"
+
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn TaskRunner :: TaskRunner(void)
+///
+/// \brief Constructor for the TaskRunner class. Uses all available hardware threads.
+///
+
+TaskRunner :: TaskRunner(void)
+{
+    this->n_threads = std::thread::hardware_concurrency();
+    
+    if (this->n_threads < 1) {
+        this->n_threads = 1;
+    }
+    
+    return;
+}   /* TaskRunner() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn TaskRunner :: TaskRunner(int n_threads)
+///
+/// \brief Constructor for the TaskRunner class.
+///
+/// \param n_threads The number of worker threads to use. If <= 0, then all available
+///     hardware threads are used.
+///
+
+TaskRunner :: TaskRunner(int n_threads)
+{
+    this->n_threads = n_threads;
+    
+    if (this->n_threads <= 0) {
+        this->n_threads = std::thread::hardware_concurrency();
+    }
+    
+    if (this->n_threads < 1) {
+        this->n_threads = 1;
+    }
+    
+    return;
+}   /* TaskRunner() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void TaskRunner :: run(size_t n_tasks, std::function<void(size_t)> task)
+///
+/// \brief Method to run task(0), task(1), ..., task(n_tasks - 1), distributed over
+///     worker threads started (and joined) for this call. Each worker pulls the next
+///     task index from a shared counter until all tasks are claimed, so uneven task
+///     durations balance out. Returns once every task has completed. Tasks must be
+///     independent of one another.
+///
+/// If any tasks throw, the remaining tasks still run, and then the exception thrown by
+/// the lowest task index is rethrown (so errors are reported deterministically,
+/// regardless of scheduling).
+///
+/// \param n_tasks The number of tasks to run.
+///
+/// \param task The task to run, as a function of task index.
+///
+
+void TaskRunner :: run(size_t n_tasks, std::function<void(size_t)> task)
+{
+    //  1. init
+    std::atomic<size_t> next_task(0);
+    
+    std::mutex error_mutex;
+    std::exception_ptr error_ptr = nullptr;
+    size_t error_task = n_tasks;
+    
+    auto worker = [&](void) {
+        size_t i = next_task++;
+        
+        while (i < n_tasks) {
+            try {
+                task(i);
+            }
+            
+            catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                
+                if (i < error_task) {
+                    error_task = i;
+                    error_ptr = std::current_exception();
+                }
+            }
+            
+            i = next_task++;
+        }
+    };
+    
+    //  2. run (serially, if only one worker is needed)
+    size_t n_workers = this->n_threads;
+    
+    if (n_workers > n_tasks) {
+        n_workers = n_tasks;
+    }
+    
+    if (n_workers <= 1) {
+        worker();
+    }
+    
+    else {
+        std::vector<std::thread> thread_vec;
+        thread_vec.reserve(n_workers);
+        
+        for (size_t i = 0; i < n_workers; i++) {
+            thread_vec.emplace_back(worker);
+        }
+        
+        for (size_t i = 0; i < n_workers; i++) {
+            thread_vec[i].join();
+        }
+    }
+    
+    //  3. rethrow (if applicable)
+    if (error_ptr != nullptr) {
+        std::rethrow_exception(error_ptr);
+    }
+    
+    return;
+}   /* run() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn TaskRunner :: ~TaskRunner(void)
+///
+/// \brief Destructor for the TaskRunner class.
+///
+
+TaskRunner :: ~TaskRunner(void)
+{
+    return;
+}   /* ~TaskRunner() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PUBLIC ============================================================== //
@@ -136,7 +136,7 @@ void ThermalModel :: __writeTimeSeries(
 {
     //  1. create filestream
     write_path += "thermal_model_timeseries.csv";
-    std::ofstream ofs;
+    BufferedWriter ofs;
     ofs.open(write_path, std::ofstream::out);
     
     //  2. write time series results header (comma separated value)
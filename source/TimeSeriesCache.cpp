@@ -0,0 +1,610 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file TimeSeriesCache.cpp
+///
+/// \brief Implementation file for the TimeSeriesCache class.
+///
+/// A class which reads time series data (from CSV) through a transparent, memory
+/// mapped binary cache.
+///
+
+
+#include "../header/TimeSeriesCache.h"
+#include "../header/Hash.h"
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif  /* _WIN32 */
+
+
+
+// ======== PRIVATE ================================================================= //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn uint64_t TimeSeriesCache :: __hashHeader(
+///         std::vector<std::string>* header_vec_ptr
+///     )
+///
+/// \brief Helper method to hash the given CSV column headers (so that a sidecar written
+///     for one set of columns is never served for another).
+///
+/// \param header_vec_ptr A pointer to the vector of CSV column headers.
+///
+/// \return The hash of the given CSV column headers.
+///
+
+uint64_t TimeSeriesCache :: __hashHeader(std::vector<std::string>* header_vec_ptr)
+{
+    std::string joined_str = "";
+    
+    for (size_t i = 0; i < header_vec_ptr->size(); i++) {
+        joined_str += (*header_vec_ptr)[i];
+        joined_str += '\n';
+    }
+    
+    return hashBytes(joined_str.data(), joined_str.size());
+}   /* __hashHeader() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn bool TimeSeriesCache :: __getSourceStamp(
+///         std::string path_2_csv,
+///         int64_t* mtime_ptr,
+///         uint64_t* size_ptr
+///     )
+///
+/// \brief Helper method to get the last write time and size of the given source CSV.
+///
+/// \param path_2_csv The path (either relative or absolute) to the source CSV.
+///
+/// \param mtime_ptr A pointer to the last write time (in file clock ticks).
+///
+/// \param size_ptr A pointer to the size [bytes].
+///
+/// \return A boolean which indicates whether or not the stamp could be read.
+///
+
+bool TimeSeriesCache :: __getSourceStamp(
+    std::string path_2_csv,
+    int64_t* mtime_ptr,
+    uint64_t* size_ptr
+)
+{
+    std::error_code error_code;
+    
+    std::filesystem::file_time_type mtime = std::filesystem::last_write_time(
+        path_2_csv,
+        error_code
+    );
+    
+    if (error_code) {
+        return false;
+    }
+    
+    uintmax_t size = std::filesystem::file_size(path_2_csv, error_code);
+    
+    if (error_code) {
+        return false;
+    }
+    
+    *mtime_ptr = (int64_t)mtime.time_since_epoch().count();
+    *size_ptr = (uint64_t)size;
+    
+    return true;
+}   /* __getSourceStamp() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void TimeSeriesCache :: __readCSV(
+///         std::string path_2_csv,
+///         std::vector<std::string>* header_vec_ptr,
+///         std::vector<std::vector<double>>* column_vec_ptr
+///     )
+///
+/// \brief Helper method to parse the given columns from the given CSV (two or three
+///     columns, as used by the load and resource time series).
+///
+/// \param path_2_csv The path (either relative or absolute) to the CSV.
+///
+/// \param header_vec_ptr A pointer to the vector of CSV column headers to read.
+///
+/// \param column_vec_ptr A pointer to the vector of columns to populate.
+///
+
+void TimeSeriesCache :: __readCSV(
+    std::string path_2_csv,
+    std::vector<std::string>* header_vec_ptr,
+    std::vector<std::vector<double>>* column_vec_ptr
+)
+{
+    std::vector<std::string>& header_vec = *header_vec_ptr;
+    std::vector<std::vector<double>>& column_vec = *column_vec_ptr;
+    
+    column_vec.clear();
+    column_vec.resize(header_vec.size(), {});
+    
+    switch (header_vec.size()) {
+        case (2): {
+            io::CSVReader<2> CSV(path_2_csv);
+            
+            CSV.read_header(io::ignore_extra_column, header_vec[0], header_vec[1]);
+            
+            double x_0 = 0;
+            double x_1 = 0;
+            
+            while (CSV.read_row(x_0, x_1)) {
+                column_vec[0].push_back(x_0);
+                column_vec[1].push_back(x_1);
+            }
+            
+            break;
+        }
+        
+        case (3): {
+            io::CSVReader<3> CSV(path_2_csv);
+            
+            CSV.read_header(
+                io::ignore_extra_column,
+                header_vec[0],
+                header_vec[1],
+                header_vec[2]
+            );
+            
+            double x_0 = 0;
+            double x_1 = 0;
+            double x_2 = 0;
+            
+            while (CSV.read_row(x_0, x_1, x_2)) {
+                column_vec[0].push_back(x_0);
+                column_vec[1].push_back(x_1);
+                column_vec[2].push_back(x_2);
+            }
+            
+            break;
+        }
+        
+        default: {
+            std::string error_str = "ERROR:  TimeSeriesCache::read():  ";
+            error_str += "reading ";
+            error_str += std::to_string(header_vec.size());
+            error_str += " columns is not supported (only 2 or 3)";
+            
+            #ifdef _WIN32
+                std::cout << error_str << std::endl;
+            #endif
+            
+            throw std::invalid_argument(error_str);
+            
+            break;
+        }
+    }
+    
+    return;
+}   /* __readCSV() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn bool TimeSeriesCache :: __readSidecar(
+///         std::string path_2_csv,
+///         std::vector<std::string>* header_vec_ptr,
+///         std::vector<std::vector<double>>* column_vec_ptr
+///     )
+///
+/// \brief Helper method to try to read the given columns from the sidecar of the given
+///     CSV. The sidecar is memory mapped (where supported), validated against the
+///     source CSV and its own checksum, and then copied out column by column.
+///
+/// \param path_2_csv The path (either relative or absolute) to the source CSV.
+///
+/// \param header_vec_ptr A pointer to the vector of CSV column headers to read.
+///
+/// \param column_vec_ptr A pointer to the vector of columns to populate.
+///
+/// \return A boolean which indicates whether or not the sidecar was valid (and read).
+///
+
+bool TimeSeriesCache :: __readSidecar(
+    std::string path_2_csv,
+    std::vector<std::string>* header_vec_ptr,
+    std::vector<std::vector<double>>* column_vec_ptr
+)
+{
+    //  1. get source stamp
+    int64_t source_mtime = 0;
+    uint64_t source_size = 0;
+    
+    if (not this->__getSourceStamp(path_2_csv, &source_mtime, &source_size)) {
+        return false;
+    }
+    
+    //  2. map (or, on Windows, read) sidecar
+    std::string sidecar_path = this->getSidecarPath(path_2_csv);
+    
+    const char* file_ptr = NULL;
+    size_t file_bytes = 0;
+    
+    #ifdef _WIN32
+        std::ifstream ifs(sidecar_path, std::ios::binary | std::ios::ate);
+        
+        if (not ifs.is_open()) {
+            return false;
+        }
+        
+        std::vector<char> file_vec((size_t)ifs.tellg(), 0);
+        ifs.seekg(0);
+        ifs.read(file_vec.data(), file_vec.size());
+        
+        if (not ifs) {
+            return false;
+        }
+        
+        file_ptr = file_vec.data();
+        file_bytes = file_vec.size();
+    #else
+        int file_descriptor = open(sidecar_path.c_str(), O_RDONLY);
+        
+        if (file_descriptor < 0) {
+            return false;
+        }
+        
+        struct stat file_stat;
+        
+        if (fstat(file_descriptor, &file_stat) != 0 or file_stat.st_size <= 0) {
+            close(file_descriptor);
+            return false;
+        }
+        
+        file_bytes = (size_t)file_stat.st_size;
+        
+        void* map_ptr = mmap(
+            NULL,
+            file_bytes,
+            PROT_READ,
+            MAP_PRIVATE,
+            file_descriptor,
+            0
+        );
+        close(file_descriptor);
+        
+        if (map_ptr == MAP_FAILED) {
+            return false;
+        }
+        
+        file_ptr = (const char*)map_ptr;
+    #endif  /* _WIN32 */
+    
+    //  3. validate header, size, and checksum
+    bool valid = false;
+    TimeSeriesCacheHeader header;
+    
+    if (file_bytes >= sizeof(TimeSeriesCacheHeader)) {
+        std::memcpy(&header, file_ptr, sizeof(TimeSeriesCacheHeader));
+        
+        uint64_t n_column_bytes = header.n_rows * sizeof(double);
+        
+        valid = 
+            std::memcmp(header.magic, TIME_SERIES_CACHE_MAGIC, 8) == 0 and
+            header.version == TIME_SERIES_CACHE_VERSION and
+            header.n_columns == header_vec_ptr->size() and
+            header.source_mtime == source_mtime and
+            header.source_size == source_size and
+            header.header_hash == this->__hashHeader(header_vec_ptr) and
+            file_bytes ==
+                sizeof(TimeSeriesCacheHeader) + header.n_columns * n_column_bytes;
+        
+        if (valid) {
+            valid = header.checksum == hashBytes(
+                file_ptr + sizeof(TimeSeriesCacheHeader),
+                header.n_columns * n_column_bytes
+            );
+        }
+    }
+    
+    //  4. copy out columns
+    if (valid) {
+        column_vec_ptr->clear();
+        column_vec_ptr->resize(header.n_columns, {});
+        
+        for (size_t i = 0; i < header.n_columns; i++) {
+            (*column_vec_ptr)[i].resize(header.n_rows, 0);
+            
+            std::memcpy(
+                (*column_vec_ptr)[i].data(),
+                file_ptr + sizeof(TimeSeriesCacheHeader) +
+                    i * header.n_rows * sizeof(double),
+                header.n_rows * sizeof(double)
+            );
+        }
+    }
+    
+    //  5. unmap
+    #ifndef _WIN32
+        munmap((void*)file_ptr, file_bytes);
+    #endif  /* _WIN32 */
+    
+    return valid;
+}   /* __readSidecar() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void TimeSeriesCache :: __writeSidecar(
+///         std::string path_2_csv,
+///         std::vector<std::string>* header_vec_ptr,
+///         std::vector<std::vector<double>>* column_vec_ptr
+///     )
+///
+/// \brief Helper method to write the sidecar of the given CSV. The sidecar is written
+///     to a temporary file and then renamed into place, so concurrent readers (e.g.,
+///     the Models of a Sweep) never see a partial sidecar. Any failure is silently
+///     ignored (the cache is an optimization only).
+///
+/// \param path_2_csv The path (either relative or absolute) to the source CSV.
+///
+/// \param header_vec_ptr A pointer to the vector of CSV column headers which were read.
+///
+/// \param column_vec_ptr A pointer to the vector of columns which were read.
+///
+
+void TimeSeriesCache :: __writeSidecar(
+    std::string path_2_csv,
+    std::vector<std::string>* header_vec_ptr,
+    std::vector<std::vector<double>>* column_vec_ptr
+)
+{
+    //  1. build header
+    TimeSeriesCacheHeader header;
+    
+    if (
+        not this->__getSourceStamp(
+            path_2_csv,
+            &(header.source_mtime),
+            &(header.source_size)
+        )
+    ) {
+        return;
+    }
+    
+    std::memcpy(header.magic, TIME_SERIES_CACHE_MAGIC, 8);
+    header.version = TIME_SERIES_CACHE_VERSION;
+    header.n_columns = column_vec_ptr->size();
+    header.n_rows = column_vec_ptr->empty() ? 0 : (*column_vec_ptr)[0].size();
+    header.header_hash = this->__hashHeader(header_vec_ptr);
+    
+    //  2. gather column data (contiguous, so it can be checksummed in one pass)
+    std::vector<double> data_vec;
+    data_vec.reserve(header.n_columns * header.n_rows);
+    
+    for (size_t i = 0; i < column_vec_ptr->size(); i++) {
+        if ((*column_vec_ptr)[i].size() != header.n_rows) {
+            return;
+        }
+        
+        data_vec.insert(
+            data_vec.end(),
+            (*column_vec_ptr)[i].begin(),
+            (*column_vec_ptr)[i].end()
+        );
+    }
+    
+    header.checksum = hashBytes(data_vec.data(), data_vec.size() * sizeof(double));
+    
+    //  3. write to temporary file (unique to this process and thread, so concurrent
+    //     writers, including those of other processes, do not clobber one another),
+    //     then rename into place
+    #ifdef _WIN32
+        unsigned long process_id = GetCurrentProcessId();
+    #else
+        unsigned long process_id = getpid();
+    #endif  /* _WIN32 */
+    
+    std::string sidecar_path = this->getSidecarPath(path_2_csv);
+    std::string temp_path = sidecar_path + ".tmp" + std::to_string(process_id) + "_" +
+        std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    
+    std::ofstream ofs(temp_path, std::ios::binary | std::ios::trunc);
+    
+    if (not ofs.is_open()) {
+        return;
+    }
+    
+    ofs.write((const char*)&header, sizeof(TimeSeriesCacheHeader));
+    ofs.write((const char*)data_vec.data(), data_vec.size() * sizeof(double));
+    ofs.close();
+    
+    std::error_code error_code;
+    
+    if (ofs.fail()) {
+        std::filesystem::remove(temp_path, error_code);
+        return;
+    }
+    
+    std::filesystem::rename(temp_path, sidecar_path, error_code);
+    
+    if (error_code) {
+        std::filesystem::remove(temp_path, error_code);
+    }
+    
+    return;
+}   /* __writeSidecar() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PRIVATE ============================================================= //
+
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn TimeSeriesCache :: TimeSeriesCache(void)
+///
+/// \brief Constructor for the TimeSeriesCache class.
+///
+
+TimeSeriesCache :: TimeSeriesCache(void)
+{
+    this->enabled = true;
+    this->last_read_from_cache = false;
+    
+    return;
+}   /* TimeSeriesCache() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string TimeSeriesCache :: getSidecarPath(std::string path_2_csv)
+///
+/// \brief Method to get the path of the sidecar file for the given CSV.
+///
+/// \param path_2_csv The path (either relative or absolute) to the CSV.
+///
+/// \return The path of the sidecar file for the given CSV.
+///
+
+std::string TimeSeriesCache :: getSidecarPath(std::string path_2_csv)
+{
+    return path_2_csv + TIME_SERIES_CACHE_EXTENSION;
+}   /* getSidecarPath() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void TimeSeriesCache :: read(
+///         std::string path_2_csv,
+///         std::vector<std::string> header_vec,
+///         std::vector<std::vector<double>>* column_vec_ptr
+///     )
+///
+/// \brief Method to read the given columns of the given CSV, from its sidecar if a
+///     valid one exists, and otherwise by parsing the CSV (and then writing a sidecar
+///     for next time). Errors in parsing the CSV (missing file, missing column, etc.)
+///     are thrown exactly as io::CSVReader throws them.
+///
+/// \param path_2_csv The path (either relative or absolute) to the CSV.
+///
+/// \param header_vec A vector of the CSV column headers to read (two or three).
+///
+/// \param column_vec_ptr A pointer to the vector of columns to populate (one per
+///     header, in the given order).
+///
+
+void TimeSeriesCache :: read(
+    std::string path_2_csv,
+    std::vector<std::string> header_vec,
+    std::vector<std::vector<double>>* column_vec_ptr
+)
+{
+    //  1. try sidecar
+    this->last_read_from_cache = false;
+    
+    if (
+        this->enabled and
+        this->__readSidecar(path_2_csv, &header_vec, column_vec_ptr)
+    ) {
+        this->last_read_from_cache = true;
+        return;
+    }
+    
+    //  2. parse CSV
+    this->__readCSV(path_2_csv, &header_vec, column_vec_ptr);
+    
+    //  3. write sidecar
+    if (this->enabled) {
+        this->__writeSidecar(path_2_csv, &header_vec, column_vec_ptr);
+    }
+    
+    return;
+}   /* read() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn TimeSeriesCache :: ~TimeSeriesCache(void)
+///
+/// \brief Destructor for the TimeSeriesCache class.
+///
+
+TimeSeriesCache :: ~TimeSeriesCache(void)
+{
+    return;
+}   /* ~TimeSeriesCache() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+// ======== END PUBLIC ============================================================== //
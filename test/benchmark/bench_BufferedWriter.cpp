@@ -0,0 +1,320 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+/// \file bench_BufferedWriter.cpp
+///
+/// \brief Benchmarking suite for BufferedWriter class.
+///
+/// A suite of benchmarks for the BufferedWriter class. Reports the throughput [MB/s]
+/// of writing a results-like CSV file with std::ofstream (i.e., the pre-existing
+/// result writers) versus BufferedWriter, and checks that the two files are
+/// byte-identical. Also reports the throughput of writing a set of per-asset files
+/// serially versus in parallel (on a TaskRunner).
+///
+
+
+#include <chrono>
+
+#include "../utils/testing_utils.h"
+#include "../../header/BufferedWriter.h"
+#include "../../header/TaskRunner.h"
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::vector<std::vector<double>> getColumns(int n_rows, int n_cols)
+///
+/// \brief A function to generate results-like columns of data (a mix of large and
+///     small magnitudes, integers, and zeros).
+///
+/// \param n_rows The number of rows.
+///
+/// \param n_cols The number of columns.
+///
+/// \return A vector of columns.
+///
+
+std::vector<std::vector<double>> getColumns(int n_rows, int n_cols)
+{
+    std::vector<std::vector<double>> column_vec(n_cols, std::vector<double>(n_rows, 0));
+    
+    for (int j = 0; j < n_cols; j++) {
+        for (int i = 0; i < n_rows; i++) {
+            double x = (double)rand() / RAND_MAX;
+            
+            switch (j % 4) {
+                case (0): {
+                    column_vec[j][i] = i;
+                    break;
+                }
+                
+                case (1): {
+                    column_vec[j][i] = 1000 * x;
+                    break;
+                }
+                
+                case (2): {
+                    column_vec[j][i] = (x < 0.5) ? 0 : 1e-3 * x;
+                    break;
+                }
+                
+                default: {
+                    column_vec[j][i] = -1e7 * x;
+                    break;
+                }
+            }
+        }
+    }
+    
+    return column_vec;
+}   /* getColumns() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn template <typename Stream> void writeColumns(
+///         Stream& ofs,
+///         std::vector<std::vector<double>>* column_vec_ptr
+///     )
+///
+/// \brief A function to write columns of data as CSV, in the manner of the result
+///     writers.
+///
+/// \param ofs The (open) stream to write to.
+///
+/// \param column_vec_ptr A pointer to the columns to write.
+///
+
+template <typename Stream>
+void writeColumns(Stream& ofs, std::vector<std::vector<double>>* column_vec_ptr)
+{
+    size_t n_cols = column_vec_ptr->size();
+    size_t n_rows = (*column_vec_ptr)[0].size();
+    
+    for (size_t j = 0; j < n_cols; j++) {
+        ofs << "Column " << j << " [units],";
+    }
+    
+    ofs << "\n";
+    
+    for (size_t i = 0; i < n_rows; i++) {
+        for (size_t j = 0; j < n_cols; j++) {
+            ofs << (*column_vec_ptr)[j][i] << ",";
+        }
+        
+        ofs << "\n";
+    }
+    
+    ofs.close();
+    return;
+}   /* writeColumns() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double getThroughputMBs(std::string path, double time_ms)
+///
+/// \brief A function to compute write throughput.
+///
+/// \param path The path to the file that was written.
+///
+/// \param time_ms The time taken to write it [ms].
+///
+/// \return The write throughput [MB/s].
+///
+
+double getThroughputMBs(std::string path, double time_ms)
+{
+    double n_bytes = std::filesystem::file_size(path);
+    return (n_bytes / 1e6) / (time_ms / 1e3);
+}   /* getThroughputMBs() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string readFile(std::string path)
+///
+/// \brief A function to read a file into a string.
+///
+/// \param path The path to the file.
+///
+/// \return The contents of the file.
+///
+
+std::string readFile(std::string path)
+{
+    std::ifstream ifs(path, std::ifstream::binary);
+    std::stringstream contents;
+    contents << ifs.rdbuf();
+    
+    return contents.str();
+}   /* readFile() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\tBenchmarking BufferedWriter");
+    std::cout << std::endl << std::endl;
+    
+    srand(0);
+    
+    
+    std::string write_path = "test/test_results/bench_BufferedWriter/";
+    std::filesystem::create_directories(write_path);
+    
+    int n_rows = 8760 * 25;
+    int n_cols = 16;
+    
+    std::vector<std::vector<double>> column_vec = getColumns(n_rows, n_cols);
+    
+    
+    //  1. single file, std::ofstream versus BufferedWriter
+    std::string ofstream_path = write_path + "ofstream.csv";
+    std::string buffered_path = write_path + "buffered.csv";
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    std::ofstream ofs;
+    ofs.open(ofstream_path, std::ofstream::out);
+    writeColumns(ofs, &column_vec);
+    
+    auto end = std::chrono::steady_clock::now();
+    double ofstream_time_ms =
+        std::chrono::duration<double, std::milli>(end - start).count();
+    
+    start = std::chrono::steady_clock::now();
+    
+    BufferedWriter bfw;
+    bfw.open(buffered_path, std::ofstream::out);
+    writeColumns(bfw, &column_vec);
+    
+    end = std::chrono::steady_clock::now();
+    double buffered_time_ms =
+        std::chrono::duration<double, std::milli>(end - start).count();
+    
+    if (readFile(ofstream_path) != readFile(buffered_path)) {
+        std::string error_str = "ERROR:  bench_BufferedWriter:  ";
+        error_str += "std::ofstream and BufferedWriter output differ";
+        
+        throw std::runtime_error(error_str);
+    }
+    
+    std::cout << "single file (" << n_rows << " rows x " << n_cols << " columns, "
+        << std::fixed << std::setprecision(1)
+        << std::filesystem::file_size(buffered_path) / 1e6 << " MB, byte-identical)"
+        << std::endl;
+    
+    std::cout << std::setw(16) << "writer" << std::setw(16) << "time [ms]"
+        << std::setw(16) << "MB/s" << std::endl;
+    
+    std::cout << std::setw(16) << "std::ofstream"
+        << std::setw(16) << ofstream_time_ms
+        << std::setw(16) << getThroughputMBs(ofstream_path, ofstream_time_ms)
+        << std::endl;
+    
+    std::cout << std::setw(16) << "BufferedWriter"
+        << std::setw(16) << buffered_time_ms
+        << std::setw(16) << getThroughputMBs(buffered_path, buffered_time_ms)
+        << std::endl << std::endl;
+    
+    
+    //  2. per-asset files, serial versus parallel
+    int n_assets = 8;
+    double total_MB = n_assets * std::filesystem::file_size(buffered_path) / 1e6;
+    
+    auto write_asset = [&](size_t asset) {
+        BufferedWriter asset_bfw;
+        asset_bfw.open(
+            write_path + "asset_" + std::to_string(asset) + ".csv",
+            std::ofstream::out
+        );
+        
+        writeColumns(asset_bfw, &column_vec);
+    };
+    
+    std::cout << n_assets << " asset files (" << total_MB << " MB)" << std::endl;
+    std::cout << std::setw(16) << "threads" << std::setw(16) << "time [ms]"
+        << std::setw(16) << "MB/s" << std::endl;
+    
+    std::vector<int> n_threads_vec = {1, 0};
+    
+    for (size_t k = 0; k < n_threads_vec.size(); k++) {
+        TaskRunner task_runner(n_threads_vec[k]);
+        
+        start = std::chrono::steady_clock::now();
+        task_runner.run(n_assets, write_asset);
+        end = std::chrono::steady_clock::now();
+        
+        double time_ms = std::chrono::duration<double, std::milli>(end - start).count();
+        
+        std::cout << std::setw(16) << task_runner.n_threads
+            << std::setw(16) << time_ms
+            << std::setw(16) << total_MB / (time_ms / 1e3)
+            << std::endl;
+    }
+    
+    std::filesystem::remove_all(write_path);
+    
+    std::cout << std::endl;
+    return 0;
+}   /* main() */
+
+// ---------------------------------------------------------------------------------- //
@@ -0,0 +1,446 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file bench_Controller.cpp
+///
+/// \brief Benchmarking suite for Controller class.
+///
+/// A suite of benchmarks for the Controller class. Reports the time taken to construct
+/// the Combustion map (on Controller::init()) versus fleet size, alongside the time
+/// taken by exhaustive enumeration of all 2^n operating states; then reports the time
+/// taken by the Renewable pre-pass with per time step Resources map lookups versus
+/// resource bindings resolved on Controller::init().
+///
+
+
+#include <chrono>
+
+#include "../utils/testing_utils.h"
+#include "../../header/Controller.h"
+#include "../../header/Production/Renewable/Wave.h"
+#include "../../header/Production/Renewable/Wind.h"
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double benchEnumerateCombustionStates(std::vector<double> capacity_vec_kW)
+///
+/// \brief A function to time exhaustive enumeration of all 2^n operating states of a
+///     fleet with the given capacities (i.e., the pre-existing Combustion map
+///     construction).
+///
+/// \param capacity_vec_kW A vector of asset capacities [kW].
+///
+/// \return The time taken [ms].
+///
+
+double benchEnumerateCombustionStates(std::vector<double> capacity_vec_kW)
+{
+    auto start = std::chrono::steady_clock::now();
+    
+    std::map<double, std::vector<bool>> combustion_map;
+    
+    unsigned int n_cols = capacity_vec_kW.size();
+    unsigned long int n_rows = pow(2, n_cols);
+    
+    for (unsigned long int row = 0; row < n_rows; row++) {
+        std::vector<bool> state_vec(n_cols, false);
+        
+        unsigned int asset_count = 0;
+        unsigned long int x = row;
+        double total_capacity_kW = 0;
+        
+        for (unsigned int i = 0; i < n_cols; i++) {
+            if (x <= 0) {
+                break;
+            }
+            
+            if (x % 2 != 0) {
+                state_vec[i] = true;
+                total_capacity_kW += capacity_vec_kW[i];
+                asset_count++;
+            }
+            
+            x /= 2;
+        }
+        
+        if (combustion_map.count(total_capacity_kW) == 0) {
+            combustion_map[total_capacity_kW] = state_vec;
+        }
+        
+        else {
+            unsigned int incumbent_asset_count = 0;
+            
+            for (unsigned int i = 0; i < n_cols; i++) {
+                if (combustion_map[total_capacity_kW][i]) {
+                    incumbent_asset_count++;
+                }
+            }
+            
+            if (asset_count < incumbent_asset_count) {
+                combustion_map[total_capacity_kW] = state_vec;
+            }
+        }
+    }
+    
+    auto end = std::chrono::steady_clock::now();
+    
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}   /* benchEnumerateCombustionStates() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double benchInit_Controller(
+///         ElectricalLoad* electrical_load_ptr,
+///         std::vector<double> capacity_vec_kW,
+///         size_t* n_states_ptr
+///     )
+///
+/// \brief A function to time Controller::init() for a fleet of Diesel assets with the
+///     given capacities.
+///
+/// \param electrical_load_ptr A pointer to the ElectricalLoad object.
+///
+/// \param capacity_vec_kW A vector of Diesel capacities [kW].
+///
+/// \param n_states_ptr A pointer to which the size of the resulting Combustion map
+///     is written.
+///
+/// \return The time taken [ms].
+///
+
+double benchInit_Controller(
+    ElectricalLoad* electrical_load_ptr,
+    std::vector<double> capacity_vec_kW,
+    size_t* n_states_ptr
+)
+{
+    Controller controller;
+    Resources resources;
+    std::vector<Renewable*> renewable_ptr_vec;
+    std::vector<Combustion*> combustion_ptr_vec;
+    
+    for (size_t i = 0; i < capacity_vec_kW.size(); i++) {
+        DieselInputs diesel_inputs;
+        diesel_inputs.combustion_inputs.production_inputs.capacity_kW =
+            capacity_vec_kW[i];
+        
+        combustion_ptr_vec.push_back(
+            new Diesel(
+                electrical_load_ptr->n_points,
+                electrical_load_ptr->n_years,
+                diesel_inputs,
+                &(electrical_load_ptr->time_vec_hrs)
+            )
+        );
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    controller.init(
+        electrical_load_ptr,
+        &renewable_ptr_vec,
+        &resources,
+        &combustion_ptr_vec
+    );
+    
+    auto end = std::chrono::steady_clock::now();
+    
+    *n_states_ptr = controller.combustion_map.size();
+    
+    for (size_t i = 0; i < combustion_ptr_vec.size(); i++) {
+        delete combustion_ptr_vec[i];
+    }
+    
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}   /* benchInit_Controller() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double originalComputeRenewableProduction(
+///         ElectricalLoad* electrical_load_ptr,
+///         std::vector<Renewable*>* renewable_ptr_vec_ptr,
+///         Resources* resources_ptr
+///     )
+///
+/// \brief A function which replicates the original Renewable pre-pass (a Resources map
+///     lookup per asset, per time step), for comparison.
+///
+/// \param electrical_load_ptr A pointer to the ElectricalLoad.
+///
+/// \param renewable_ptr_vec_ptr A pointer to the Renewable pointer vector.
+///
+/// \param resources_ptr A pointer to the Resources.
+///
+/// \return The time taken [ms].
+///
+
+double originalComputeRenewableProduction(
+    ElectricalLoad* electrical_load_ptr,
+    std::vector<Renewable*>* renewable_ptr_vec_ptr,
+    Resources* resources_ptr
+)
+{
+    auto start = std::chrono::steady_clock::now();
+    
+    Renewable* renewable_ptr;
+    
+    for (int timestep = 0; timestep < electrical_load_ptr->n_points; timestep++) {
+        double dt_hrs = electrical_load_ptr->dt_vec_hrs[timestep];
+        
+        for (size_t asset = 0; asset < renewable_ptr_vec_ptr->size(); asset++) {
+            renewable_ptr = renewable_ptr_vec_ptr->at(asset);
+            
+            if (renewable_ptr->type == RenewableType :: WAVE) {
+                renewable_ptr->production_vec_kW[timestep] =
+                    renewable_ptr->computeProductionkW(
+                        timestep,
+                        dt_hrs,
+                        resources_ptr->resource_map_2D[
+                            renewable_ptr->resource_key
+                        ][timestep][0],
+                        resources_ptr->resource_map_2D[
+                            renewable_ptr->resource_key
+                        ][timestep][1]
+                    );
+            }
+            
+            else {
+                renewable_ptr->production_vec_kW[timestep] =
+                    renewable_ptr->computeProductionkW(
+                        timestep,
+                        dt_hrs,
+                        resources_ptr->resource_map_1D[
+                            renewable_ptr->resource_key
+                        ][timestep]
+                    );
+            }
+        }
+    }
+    
+    auto end = std::chrono::steady_clock::now();
+    
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}   /* originalComputeRenewableProduction() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\tBenchmarking Controller");
+    std::cout << std::endl << std::endl;
+    
+    srand(0);
+    
+    
+    ElectricalLoad electrical_load(
+        "data/test/electrical_load/electrical_load_generic_peak-500kW_1yr_dt-1hr.csv"
+    );
+    
+    int max_enumeration_assets = 20;
+    
+    std::cout << std::setw(8) << "assets" << std::setw(12) << "fleet"
+        << std::setw(12) << "states" << std::setw(16) << "init [ms]"
+        << std::setw(20) << "enumeration [ms]" << std::endl;
+    
+    for (int n_assets = 5; n_assets <= 40; n_assets += 5) {
+        for (int fleet = 0; fleet < 2; fleet++) {
+            //  fleet 0: three distinct capacities, fleet 1: arbitrary capacities
+            std::vector<double> capacity_vec_kW;
+            
+            for (int i = 0; i < n_assets; i++) {
+                if (fleet == 0) {
+                    capacity_vec_kW.push_back(250 * (1 + i % 3));
+                }
+                
+                else {
+                    capacity_vec_kW.push_back(50 + 500 * ((double)rand() / RAND_MAX));
+                }
+            }
+            
+            size_t n_states = 0;
+            double init_time_ms = benchInit_Controller(
+                &electrical_load,
+                capacity_vec_kW,
+                &n_states
+            );
+            
+            std::cout << std::setw(8) << n_assets
+                << std::setw(12) << ((fleet == 0) ? "3 sizes" : "arbitrary")
+                << std::setw(12) << n_states
+                << std::setw(16) << std::fixed << std::setprecision(3) << init_time_ms;
+            
+            if (n_assets <= max_enumeration_assets) {
+                std::cout << std::setw(20)
+                    << benchEnumerateCombustionStates(capacity_vec_kW);
+            }
+            
+            else {
+                std::cout << std::setw(20) << "(skipped)";
+            }
+            
+            std::cout << std::endl;
+        }
+    }
+    
+    
+    //  2. Renewable pre-pass (map lookups versus resource bindings, on one thread and
+    //     on all hardware threads)
+    int n_renewables = 40;
+    
+    Resources resources;
+    std::vector<Renewable*> renewable_ptr_vec;
+    std::vector<Combustion*> combustion_ptr_vec;
+    
+    for (int i = 0; i < n_renewables; i++) {
+        if (i % 2 == 0) {
+            resources.addResource(
+                RenewableType :: WIND,
+                "data/test/resources/wind_speed_peak-25ms_1yr_dt-1hr.csv",
+                i,
+                &electrical_load
+            );
+            
+            WindInputs wind_inputs;
+            wind_inputs.resource_key = i;
+            
+            renewable_ptr_vec.push_back(
+                new Wind(
+                    electrical_load.n_points,
+                    1,
+                    wind_inputs,
+                    &(electrical_load.time_vec_hrs)
+                )
+            );
+        }
+        
+        else {
+            resources.addResource(
+                RenewableType :: WAVE,
+                "data/test/resources/waves_H_s_peak-8m_T_e_peak-15s_1yr_dt-1hr.csv",
+                i,
+                &electrical_load
+            );
+            
+            WaveInputs wave_inputs;
+            wave_inputs.resource_key = i;
+            
+            renewable_ptr_vec.push_back(
+                new Wave(
+                    electrical_load.n_points,
+                    1,
+                    wave_inputs,
+                    &(electrical_load.time_vec_hrs)
+                )
+            );
+        }
+    }
+    
+    int n_runs = 10;
+    int n_threads_all = TaskRunner(0).n_threads;
+    
+    auto time_init_ms = [&](int n_threads) {
+        Controller controller;
+        controller.setNThreads(n_threads);
+        
+        auto start = std::chrono::steady_clock::now();
+        
+        controller.init(
+            &electrical_load,
+            &renewable_ptr_vec,
+            &resources,
+            &combustion_ptr_vec
+        );
+        
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+    
+    double original_time_ms = 0;
+    double bound_time_ms = 0;
+    double threaded_time_ms = 0;
+    
+    for (int run = 0; run < n_runs; run++) {
+        original_time_ms += originalComputeRenewableProduction(
+            &electrical_load,
+            &renewable_ptr_vec,
+            &resources
+        );
+        
+        bound_time_ms += time_init_ms(1);
+        threaded_time_ms += time_init_ms(n_threads_all);
+    }
+    
+    std::cout << std::endl;
+    std::cout << "Renewable pre-pass (" << n_renewables << " Wind/Wave assets, "
+        << electrical_load.n_points << " time steps)" << std::endl;
+    std::cout << std::setw(20) << "map lookups [ms]" << std::setw(20)
+        << "bindings [ms]" << std::setw(20)
+        << std::to_string(n_threads_all) + " threads [ms]" << std::endl;
+    std::cout << std::setw(20) << original_time_ms / n_runs << std::setw(20)
+        << bound_time_ms / n_runs << std::setw(20) << threaded_time_ms / n_runs
+        << std::endl;
+    
+    for (size_t i = 0; i < renewable_ptr_vec.size(); i++) {
+        delete renewable_ptr_vec[i];
+    }
+    
+    std::cout << std::endl;
+    return 0;
+}   /* main() */
+
+// ---------------------------------------------------------------------------------- //
@@ -0,0 +1,698 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+///
+/// \file bench_Interpolator.cpp
+///
+/// \brief Benchmarking suite for Interpolator class.
+///
+/// A suite of benchmarks for the Interpolator class. Reports the time per query [ns]
+/// of interp1D() and interp2D(), by data key and by handle, versus a replica of the
+/// original linear scan implementations, for both temporally correlated (i.e., slowly
+/// varying) and random queries, on uniform and non-uniform axes of a few sizes. Also
+/// reports the time per query of interp1DBatch() and interp2DBatch() over a whole
+/// time series versus the scalar (handle) path, and the time to construct many
+/// Interpolators reading the same table with and without the InterpolatorTableCache.
+///
+
+
+#include <chrono>
+
+#include "../utils/testing_utils.h"
+#include "../../header/Interpolator.h"
+#include "../../header/InterpolatorTableCache.h"
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn int linearScanIndex(double x, const std::vector<double>* x_vec_ptr)
+///
+/// \brief A function to find an interpolation index by linear scan (as Interpolator did
+///     originally).
+///
+/// \param x The query value.
+///
+/// \param x_vec_ptr A pointer to the axis.
+///
+/// \return The interpolation index.
+///
+
+int linearScanIndex(double x, const std::vector<double>* x_vec_ptr)
+{
+    int idx = 0;
+    while (not (x >= x_vec_ptr->at(idx) and x <= x_vec_ptr->at(idx + 1))) {
+        idx++;
+    }
+    
+    return idx;
+}   /* linearScanIndex() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double originalInterp1D(Interpolator* interpolator_ptr, int data_key, double x)
+///
+/// \brief A function which replicates the original Interpolator::interp1D() (map
+///     lookups, bounds check, linear scan index search), as a baseline.
+///
+/// \param interpolator_ptr A pointer to the Interpolator.
+///
+/// \param data_key The data key.
+///
+/// \param x The query value.
+///
+/// \return An interpolation of the given query value.
+///
+
+double originalInterp1D(Interpolator* interpolator_ptr, int data_key, double x)
+{
+    std::map<int, std::shared_ptr<const InterpolatorStruct1D>>& interp_map_1D =
+        interpolator_ptr->interp_map_1D;
+    
+    if (
+        interp_map_1D.count(data_key) == 0 or
+        x < interp_map_1D[data_key]->min_x or
+        x > interp_map_1D[data_key]->max_x
+    ) {
+        throw std::invalid_argument("ERROR:  bench_Interpolator:  bad query");
+    }
+    
+    int idx = linearScanIndex(x, &(interp_map_1D[data_key]->x_vec));
+    
+    double x_0 = interp_map_1D[data_key]->x_vec[idx];
+    double x_1 = interp_map_1D[data_key]->x_vec[idx + 1];
+    
+    double y_0 = interp_map_1D[data_key]->y_vec[idx];
+    double y_1 = interp_map_1D[data_key]->y_vec[idx + 1];
+    
+    return ((y_1 - y_0) / (x_1 - x_0)) * (x - x_0) + y_0;
+}   /* originalInterp1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double originalInterp2D(
+///         Interpolator* interpolator_ptr,
+///         int data_key,
+///         double x,
+///         double y
+///     )
+///
+/// \brief A function which replicates the original Interpolator::interp2D() (map
+///     lookups, bounds check, linear scan index search), as a baseline.
+///
+/// \param interpolator_ptr A pointer to the Interpolator.
+///
+/// \param data_key The data key.
+///
+/// \param x The first query value.
+///
+/// \param y The second query value.
+///
+/// \return An interpolation of the given query values.
+///
+
+double originalInterp2D(Interpolator* interpolator_ptr, int data_key, double x, double y)
+{
+    std::map<int, std::shared_ptr<const InterpolatorStruct2D>>& interp_map_2D =
+        interpolator_ptr->interp_map_2D;
+    
+    if (
+        interp_map_2D.count(data_key) == 0 or
+        x < interp_map_2D[data_key]->min_x or
+        x > interp_map_2D[data_key]->max_x or
+        y < interp_map_2D[data_key]->min_y or
+        y > interp_map_2D[data_key]->max_y
+    ) {
+        throw std::invalid_argument("ERROR:  bench_Interpolator:  bad query");
+    }
+    
+    int idx_x = linearScanIndex(x, &(interp_map_2D[data_key]->x_vec));
+    int idx_y = linearScanIndex(y, &(interp_map_2D[data_key]->y_vec));
+    
+    double x_0 = interp_map_2D[data_key]->x_vec[idx_x];
+    double x_1 = interp_map_2D[data_key]->x_vec[idx_x + 1];
+    
+    int n_cols = interp_map_2D[data_key]->n_cols;
+    
+    double z_0 = interp_map_2D[data_key]->z_vec[idx_y * n_cols + idx_x];
+    double z_1 = interp_map_2D[data_key]->z_vec[idx_y * n_cols + idx_x + 1];
+    double interp_z_0 = ((z_1 - z_0) / (x_1 - x_0)) * (x - x_0) + z_0;
+    
+    z_0 = interp_map_2D[data_key]->z_vec[(idx_y + 1) * n_cols + idx_x];
+    z_1 = interp_map_2D[data_key]->z_vec[(idx_y + 1) * n_cols + idx_x + 1];
+    double interp_z_1 = ((z_1 - z_0) / (x_1 - x_0)) * (x - x_0) + z_0;
+    
+    double y_0 = interp_map_2D[data_key]->y_vec[idx_y];
+    double y_1 = interp_map_2D[data_key]->y_vec[idx_y + 1];
+    
+    return ((interp_z_1 - interp_z_0) / (y_1 - y_0)) * (y - y_0) + interp_z_0;
+}   /* originalInterp2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string writeCurve(std::string path, int n_points, bool uniform)
+///
+/// \brief A function to write a 1D interpolation data file (a power-curve-like shape)
+///     over [0, 1].
+///
+/// \param path The path to write to.
+///
+/// \param n_points The number of points.
+///
+/// \param uniform If true, the axis is uniform; otherwise it is quadratically graded.
+///
+/// \return The path written to.
+///
+
+std::string writeCurve(std::string path, int n_points, bool uniform)
+{
+    std::ofstream ofs;
+    ofs.open(path, std::ofstream::out);
+    ofs << std::setprecision(17) << "x,y,||,Notes\n";
+    
+    for (int i = 0; i < n_points; i++) {
+        double u = (double)i / (n_points - 1);
+        double x = uniform ? u : u * u;
+        
+        ofs << x << "," << x * x * (3 - 2 * x) << ",||,\n";
+    }
+    
+    ofs.close();
+    return path;
+}   /* writeCurve() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string writeMatrix(std::string path, int n_rows, int n_cols)
+///
+/// \brief A function to write a 2D interpolation data file (a performance-matrix-like
+///     shape) over [0, 1] x [0, 1].
+///
+/// \param path The path to write to.
+///
+/// \param n_rows The number of rows (y values).
+///
+/// \param n_cols The number of columns (x values).
+///
+/// \return The path written to.
+///
+
+std::string writeMatrix(std::string path, int n_rows, int n_cols)
+{
+    std::ofstream ofs;
+    ofs.open(path, std::ofstream::out);
+    ofs << std::setprecision(17) << "DATA,DATA,||,Notes\n" << "DUMMY,";
+    
+    for (int j = 0; j < n_cols; j++) {
+        ofs << (double)j / (n_cols - 1) << ",";
+    }
+    ofs << "||,\n";
+    
+    for (int i = 0; i < n_rows; i++) {
+        double y = (double)i / (n_rows - 1);
+        ofs << y << ",";
+        
+        for (int j = 0; j < n_cols; j++) {
+            double x = (double)j / (n_cols - 1);
+            ofs << x * y * (2 - y) << ",";
+        }
+        ofs << "||,\n";
+    }
+    
+    ofs.close();
+    return path;
+}   /* writeMatrix() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double originalReadMatrix(std::string path)
+///
+/// \brief A function which replicates the original (std::getline() / std::string
+///     split / std::stod()) reading of a 2D interpolation data file, for comparison.
+///
+/// \param path The path to read.
+///
+/// \return The sum of the z values read (so that the work is not optimized away).
+///
+
+double originalReadMatrix(std::string path)
+{
+    std::ifstream ifs;
+    ifs.open(path);
+    
+    bool is_header = true;
+    std::string line;
+    std::vector<std::vector<std::string>> string_matrix;
+    
+    while (not ifs.eof()) {
+        std::getline(ifs, line);
+        
+        if (is_header) {
+            is_header = false;
+            continue;
+        }
+        
+        std::vector<std::string> line_split_vec;
+        size_t idx = 0;
+        
+        while ((idx = line.find(',')) != std::string::npos) {
+            std::string substr = line.substr(0, idx);
+            
+            if (substr == "||") {
+                break;
+            }
+            
+            line_split_vec.push_back(substr);
+            line.erase(0, idx + 1);
+        }
+        
+        if (not line_split_vec.empty()) {
+            string_matrix.push_back(line_split_vec);
+        }
+    }
+    
+    double sum = 0;
+    
+    for (size_t i = 1; i < string_matrix.size(); i++) {
+        for (size_t j = 1; j < string_matrix[0].size(); j++) {
+            sum += std::stod(string_matrix[i][j]);
+        }
+    }
+    
+    return sum;
+}   /* originalReadMatrix() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::vector<double> getQueries(int n_queries, bool correlated)
+///
+/// \brief A function to generate queries over [0, 1].
+///
+/// \param n_queries The number of queries.
+///
+/// \param correlated If true, the queries vary slowly (like a resource time series);
+///     otherwise they are uniformly random.
+///
+/// \return A vector of queries.
+///
+
+std::vector<double> getQueries(int n_queries, bool correlated)
+{
+    std::vector<double> query_vec(n_queries, 0);
+    
+    for (int i = 0; i < n_queries; i++) {
+        if (correlated) {
+            query_vec[i] = 0.5 + 0.49 * sin(2 * M_PI * i / 8760.0);
+        }
+        
+        else {
+            query_vec[i] = (double)rand() / RAND_MAX;
+        }
+    }
+    
+    return query_vec;
+}   /* getQueries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\tBenchmarking Interpolator");
+    std::cout << std::endl << std::endl;
+    
+    srand(0);
+    
+    
+    std::string write_path = "test/test_results/bench_Interpolator/";
+    std::filesystem::create_directories(write_path);
+    
+    int n_queries = 8760 * 25;
+    double sink = 0;
+    
+    
+    //  1. 1D, original versus interp1D()
+    std::cout << n_queries << " queries per case" << std::endl;
+    std::cout << std::setw(10) << "n_points" << std::setw(10) << "axis"
+        << std::setw(12) << "queries" << std::setw(16) << "original [ns]"
+        << std::setw(16) << "interp1D [ns]" << std::setw(16) << "handle [ns]"
+        << std::endl;
+    
+    std::vector<int> n_points_vec = {16, 128, 1024};
+    int data_key = 0;
+    
+    for (size_t i = 0; i < n_points_vec.size(); i++) {
+        for (int uniform = 1; uniform >= 0; uniform--) {
+            Interpolator interpolator;
+            
+            std::string path = writeCurve(
+                write_path + "curve.csv",
+                n_points_vec[i],
+                uniform
+            );
+            
+            interpolator.addData1D(data_key, path);
+            InterpolatorHandle1D handle = interpolator.getHandle1D(data_key);
+            
+            for (int correlated = 1; correlated >= 0; correlated--) {
+                std::vector<double> query_vec = getQueries(n_queries, correlated);
+                
+                auto start = std::chrono::steady_clock::now();
+                
+                for (int j = 0; j < n_queries; j++) {
+                    sink += originalInterp1D(&interpolator, data_key, query_vec[j]);
+                }
+                
+                auto end = std::chrono::steady_clock::now();
+                double original_time_ns =
+                    std::chrono::duration<double, std::nano>(end - start).count();
+                
+                start = std::chrono::steady_clock::now();
+                
+                for (int j = 0; j < n_queries; j++) {
+                    sink += interpolator.interp1D(data_key, query_vec[j]);
+                }
+                
+                end = std::chrono::steady_clock::now();
+                double interp_time_ns =
+                    std::chrono::duration<double, std::nano>(end - start).count();
+                
+                start = std::chrono::steady_clock::now();
+                
+                for (int j = 0; j < n_queries; j++) {
+                    sink += interpolator.interp1D(handle, query_vec[j]);
+                }
+                
+                end = std::chrono::steady_clock::now();
+                double handle_time_ns =
+                    std::chrono::duration<double, std::nano>(end - start).count();
+                
+                std::cout << std::setw(10) << n_points_vec[i]
+                    << std::setw(10) << (uniform ? "uniform" : "graded")
+                    << std::setw(12) << (correlated ? "correlated" : "random")
+                    << std::fixed << std::setprecision(1)
+                    << std::setw(16) << original_time_ns / n_queries
+                    << std::setw(16) << interp_time_ns / n_queries
+                    << std::setw(16) << handle_time_ns / n_queries
+                    << std::endl;
+            }
+        }
+    }
+    
+    std::cout << std::endl;
+    
+    
+    //  2. 2D, original versus interp2D() on wave performance matrix (uniform axes)
+    Interpolator interpolator_2D;
+    interpolator_2D.addData2D(
+        data_key,
+        "data/test/interpolation/wave_energy_converter_normalized_performance_matrix.csv"
+    );
+    
+    const InterpolatorStruct2D* interp_struct_2D_ptr =
+        interpolator_2D.interp_map_2D[data_key].get();
+    
+    std::vector<double> query_x_vec = getQueries(n_queries, true);
+    std::vector<double> query_y_vec = getQueries(n_queries, false);
+    
+    for (int j = 0; j < n_queries; j++) {
+        query_x_vec[j] = interp_struct_2D_ptr->min_x +
+            query_x_vec[j] * (interp_struct_2D_ptr->max_x - interp_struct_2D_ptr->min_x);
+        query_y_vec[j] = interp_struct_2D_ptr->min_y +
+            query_y_vec[j] * (interp_struct_2D_ptr->max_y - interp_struct_2D_ptr->min_y);
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    for (int j = 0; j < n_queries; j++) {
+        sink += originalInterp2D(
+            &interpolator_2D,
+            data_key,
+            query_x_vec[j],
+            query_y_vec[j]
+        );
+    }
+    
+    auto end = std::chrono::steady_clock::now();
+    double original_time_ns =
+        std::chrono::duration<double, std::nano>(end - start).count();
+    
+    start = std::chrono::steady_clock::now();
+    
+    for (int j = 0; j < n_queries; j++) {
+        sink += interpolator_2D.interp2D(data_key, query_x_vec[j], query_y_vec[j]);
+    }
+    
+    end = std::chrono::steady_clock::now();
+    double interp_time_ns = std::chrono::duration<double, std::nano>(end - start).count();
+    
+    InterpolatorHandle2D handle_2D = interpolator_2D.getHandle2D(data_key);
+    
+    start = std::chrono::steady_clock::now();
+    
+    for (int j = 0; j < n_queries; j++) {
+        sink += interpolator_2D.interp2D(handle_2D, query_x_vec[j], query_y_vec[j]);
+    }
+    
+    end = std::chrono::steady_clock::now();
+    double handle_time_ns = std::chrono::duration<double, std::nano>(end - start).count();
+    
+    std::cout << "2D wave performance matrix (" << interp_struct_2D_ptr->n_rows << " x "
+        << interp_struct_2D_ptr->n_cols << ")" << std::endl;
+    std::cout << std::setw(16) << "original [ns]" << std::setw(16) << "interp2D [ns]"
+        << std::setw(16) << "handle [ns]" << std::endl;
+    std::cout << std::setw(16) << original_time_ns / n_queries
+        << std::setw(16) << interp_time_ns / n_queries
+        << std::setw(16) << handle_time_ns / n_queries << std::endl;
+    
+    std::cout << std::endl;
+    
+    
+    //  3. batch versus scalar, over a whole time series
+    #ifdef __AVX2__
+        std::cout << "batch (AVX2) versus scalar" << std::endl;
+    #else
+        std::cout << "batch (no AVX2) versus scalar" << std::endl;
+    #endif  /* __AVX2__ */
+    
+    std::cout << std::setw(10) << "case" << std::setw(16) << "scalar [ns]"
+        << std::setw(16) << "batch [ns]" << std::endl;
+    
+    std::vector<double> batch_vec(n_queries, 0);
+    
+    Interpolator interpolator_1D;
+    interpolator_1D.addData1D(
+        data_key,
+        writeCurve(write_path + "curve.csv", 128, false)
+    );
+    
+    InterpolatorHandle1D handle_1D = interpolator_1D.getHandle1D(data_key);
+    std::vector<double> query_vec = getQueries(n_queries, true);
+    
+    start = std::chrono::steady_clock::now();
+    
+    for (int j = 0; j < n_queries; j++) {
+        batch_vec[j] = interpolator_1D.interp1D(handle_1D, query_vec[j]);
+    }
+    
+    end = std::chrono::steady_clock::now();
+    double scalar_time_ns = std::chrono::duration<double, std::nano>(end - start).count();
+    sink += batch_vec[n_queries / 2];
+    
+    start = std::chrono::steady_clock::now();
+    
+    interpolator_1D.interp1DBatch(handle_1D, query_vec.data(), batch_vec.data(), n_queries);
+    
+    end = std::chrono::steady_clock::now();
+    double batch_time_ns = std::chrono::duration<double, std::nano>(end - start).count();
+    sink += batch_vec[n_queries / 2];
+    
+    std::cout << std::setw(10) << "1D" << std::setw(16) << scalar_time_ns / n_queries
+        << std::setw(16) << batch_time_ns / n_queries << std::endl;
+    
+    start = std::chrono::steady_clock::now();
+    
+    for (int j = 0; j < n_queries; j++) {
+        batch_vec[j] = interpolator_2D.interp2D(handle_2D, query_x_vec[j], query_y_vec[j]);
+    }
+    
+    end = std::chrono::steady_clock::now();
+    scalar_time_ns = std::chrono::duration<double, std::nano>(end - start).count();
+    sink += batch_vec[n_queries / 2];
+    
+    start = std::chrono::steady_clock::now();
+    
+    interpolator_2D.interp2DBatch(
+        handle_2D,
+        query_x_vec.data(),
+        query_y_vec.data(),
+        batch_vec.data(),
+        n_queries
+    );
+    
+    end = std::chrono::steady_clock::now();
+    batch_time_ns = std::chrono::duration<double, std::nano>(end - start).count();
+    sink += batch_vec[n_queries / 2];
+    
+    std::cout << std::setw(10) << "2D" << std::setw(16) << scalar_time_ns / n_queries
+        << std::setw(16) << batch_time_ns / n_queries << std::endl;
+    
+    std::cout << std::endl;
+    
+    
+    //  4. constructing many Interpolators reading the same table (e.g., a wave farm)
+    std::string path_2_matrix =
+        "data/test/interpolation/wave_energy_converter_normalized_performance_matrix.csv";
+    
+    InterpolatorTableCache& table_cache = InterpolatorTableCache :: getInstance();
+    
+    int n_assets = 30;
+    std::vector<Interpolator> asset_vec(n_assets);
+    
+    start = std::chrono::steady_clock::now();
+    
+    for (int j = 0; j < n_assets; j++) {
+        table_cache.clear();
+        asset_vec[j].addData2D(data_key, path_2_matrix);
+    }
+    
+    end = std::chrono::steady_clock::now();
+    double uncached_time_us =
+        std::chrono::duration<double, std::micro>(end - start).count();
+    
+    asset_vec = std::vector<Interpolator>(n_assets);
+    
+    start = std::chrono::steady_clock::now();
+    
+    for (int j = 0; j < n_assets; j++) {
+        asset_vec[j].addData2D(data_key, path_2_matrix);
+    }
+    
+    end = std::chrono::steady_clock::now();
+    double cached_time_us = std::chrono::duration<double, std::micro>(end - start).count();
+    
+    std::cout << n_assets << " Interpolators reading the same 2D table" << std::endl;
+    std::cout << std::setw(16) << "uncached [us]" << std::setw(16) << "cached [us]"
+        << std::endl;
+    std::cout << std::setw(16) << uncached_time_us << std::setw(16) << cached_time_us
+        << std::endl;
+    
+    
+    //  5. reading a large 2D table (original parser versus single-pass parser)
+    int n_side = 500;
+    std::string path_2_large_matrix =
+        writeMatrix(write_path + "large_matrix.csv", n_side, n_side);
+    double n_megabytes = std::filesystem::file_size(path_2_large_matrix) / 1e6;
+    
+    int n_reads = 5;
+    
+    start = std::chrono::steady_clock::now();
+    
+    for (int j = 0; j < n_reads; j++) {
+        sink += originalReadMatrix(path_2_large_matrix);
+    }
+    
+    end = std::chrono::steady_clock::now();
+    double original_time_ms =
+        std::chrono::duration<double, std::milli>(end - start).count() / n_reads;
+    
+    start = std::chrono::steady_clock::now();
+    
+    for (int j = 0; j < n_reads; j++) {
+        table_cache.clear();
+        
+        Interpolator large_interpolator;
+        large_interpolator.addData2D(data_key, path_2_large_matrix);
+        sink += large_interpolator.interp_map_2D[data_key]->z_vec.back();
+    }
+    
+    end = std::chrono::steady_clock::now();
+    double single_pass_time_ms =
+        std::chrono::duration<double, std::milli>(end - start).count() / n_reads;
+    
+    std::cout << std::endl;
+    std::cout << "reading a " << n_side << " x " << n_side << " 2D table ("
+        << n_megabytes << " MB)" << std::endl;
+    std::cout << std::setw(16) << "original [ms]" << std::setw(16) << "single [ms]"
+        << std::setw(16) << "single [MB/s]" << std::endl;
+    std::cout << std::setw(16) << original_time_ms << std::setw(16)
+        << single_pass_time_ms << std::setw(16) << n_megabytes / (single_pass_time_ms / 1e3)
+        << std::endl;
+    
+    std::filesystem::remove_all(write_path);
+    
+    std::cout << std::endl << "(checksum " << sink << ")" << std::endl;
+    std::cout << std::endl;
+    return 0;
+}   /* main() */
+
+// ---------------------------------------------------------------------------------- //
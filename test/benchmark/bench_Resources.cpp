@@ -0,0 +1,217 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+///
+/// \file bench_Resources.cpp
+///
+/// \brief Benchmarking suite for Resources class.
+///
+/// A suite of benchmarks for the Resources class. Writes a 25 year, hourly wave
+/// resource, reads it into Resources, and then reports the memory held by the 2D
+/// resource (structure of arrays) against the previous layout (one heap-allocated
+/// {Hs, Te} vector per timestep), along with the time [ms] to sweep the series in
+/// each layout.
+///
+
+
+#include <chrono>
+
+#ifdef __GLIBC__
+    #include <malloc.h>
+#endif  /* __GLIBC__ */
+
+#include "../utils/testing_utils.h"
+#include "../../header/Resources.h"
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double getHeapBytes(void)
+///
+/// \brief A function to get the number of heap bytes currently in use (glibc only).
+///
+/// \return The number of heap bytes currently in use, or -1 if unavailable.
+///
+
+double getHeapBytes(void)
+{
+    #ifdef __GLIBC__
+        #if __GLIBC__ > 2 or (__GLIBC__ == 2 and __GLIBC_MINOR__ >= 33)
+            return (double)mallinfo2().uordblks;
+        #endif
+    #endif
+    
+    return -1;
+}   /* getHeapBytes() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\tBenchmarking Resources");
+    std::cout << std::endl << std::endl;
+    
+    srand(0);
+    
+    
+    //  1. write a 25 year, hourly electrical load and wave resource
+    std::string write_path = "test/test_results/bench_Resources/";
+    std::string path_2_load = write_path + "electrical_load_25yr_dt-1hr.csv";
+    std::string path_2_wave = write_path + "wave_resource_25yr_dt-1hr.csv";
+    
+    std::filesystem::remove_all(write_path);
+    std::filesystem::create_directories(write_path);
+    
+    int n_points = 25 * 8760;
+    
+    std::ofstream ofs;
+    ofs.open(path_2_load, std::ofstream::out);
+    ofs << "Time (since start of data) [hrs],Electrical Load [kW]\n";
+    
+    for (int i = 0; i < n_points; i++) {
+        ofs << i << "," << 300 + 200 * ((double)rand() / RAND_MAX) << "\n";
+    }
+    
+    ofs.close();
+    
+    ofs.open(path_2_wave, std::ofstream::out);
+    ofs << std::setprecision(15);
+    ofs << "Time (since start of data) [hrs],Significant Wave Height [m],"
+        << "Energy Period [s]\n";
+    
+    for (int i = 0; i < n_points; i++) {
+        ofs << i << "," << 1 + 3 * ((double)rand() / RAND_MAX) << ","
+            << 6 + 8 * ((double)rand() / RAND_MAX) << "\n";
+    }
+    
+    ofs.close();
+    
+    ElectricalLoad electrical_load(path_2_load);
+    
+    
+    //  2. read wave resource (structure of arrays), measure heap held
+    int resource_key = 0;
+    Resources resources;
+    
+    double heap_before_bytes = getHeapBytes();
+    resources.addResource(RenewableType :: WAVE, path_2_wave, resource_key, &electrical_load);
+    double soa_heap_bytes = getHeapBytes() - heap_before_bytes;
+    
+    const ResourceStruct2D& resource_2D = resources.resource_map_2D[resource_key];
+    double soa_nominal_bytes =
+        resource_2D.channel_vec[0].capacity() * sizeof(double) +
+        resource_2D.channel_vec[1].capacity() * sizeof(double);
+    
+    
+    //  3. build previous layout (one {Hs, Te} vector per timestep), measure heap held
+    heap_before_bytes = getHeapBytes();
+    
+    std::vector<std::vector<double>> aos_vec(n_points, {0, 0});
+    
+    for (int i = 0; i < n_points; i++) {
+        aos_vec[i][0] = resource_2D.channel_vec[0][i];
+        aos_vec[i][1] = resource_2D.channel_vec[1][i];
+    }
+    
+    double aos_heap_bytes = getHeapBytes() - heap_before_bytes;
+    double aos_nominal_bytes =
+        n_points * (sizeof(std::vector<double>) + 2 * sizeof(double));
+    
+    
+    //  4. sweep each layout (as Controller does per timestep)
+    int n_sweeps = 20;
+    double sink = 0;
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    for (int j = 0; j < n_sweeps; j++) {
+        for (int i = 0; i < n_points; i++) {
+            sink += aos_vec[i][0] * aos_vec[i][0] * aos_vec[i][1];
+        }
+    }
+    
+    auto end = std::chrono::steady_clock::now();
+    double aos_time_ms =
+        std::chrono::duration<double, std::milli>(end - start).count() / n_sweeps;
+    
+    ResourceSpan significant_wave_height_span =
+        resources.getResourceSpan2D(resource_key, 0);
+    ResourceSpan energy_period_span = resources.getResourceSpan2D(resource_key, 1);
+    
+    start = std::chrono::steady_clock::now();
+    
+    for (int j = 0; j < n_sweeps; j++) {
+        for (int i = 0; i < n_points; i++) {
+            sink += significant_wave_height_span[i] * significant_wave_height_span[i] *
+                energy_period_span[i];
+        }
+    }
+    
+    end = std::chrono::steady_clock::now();
+    double soa_time_ms =
+        std::chrono::duration<double, std::milli>(end - start).count() / n_sweeps;
+    
+    
+    //  5. report
+    std::cout << n_points << " point wave resource (25 years, hourly)" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::setw(28) << "layout" << std::setw(16) << "nominal [MB]"
+        << std::setw(16) << "heap [MB]" << std::setw(16) << "sweep [ms]" << std::endl;
+    std::cout << std::setw(28) << "vector per timestep (AoS)"
+        << std::setw(16) << aos_nominal_bytes / 1e6
+        << std::setw(16) << aos_heap_bytes / 1e6
+        << std::setw(16) << aos_time_ms << std::endl;
+    std::cout << std::setw(28) << "one array per channel (SoA)"
+        << std::setw(16) << soa_nominal_bytes / 1e6
+        << std::setw(16) << soa_heap_bytes / 1e6
+        << std::setw(16) << soa_time_ms << std::endl;
+    
+    std::filesystem::remove_all(write_path);
+    
+    std::cout << std::endl << "(checksum " << sink << ")" << std::endl;
+    std::cout << std::endl;
+    return 0;
+}   /* main() */
+
+// ---------------------------------------------------------------------------------- //
@@ -0,0 +1,275 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file bench_Solar.cpp
+///
+/// \brief Benchmarking suite for Solar class.
+///
+/// A suite of benchmarks for the Solar class. Runs eight detailed (PVWatts/SAM-like)
+/// arrays at a single site (four panel azimuths, at two tilts) over a 5 year, hourly
+/// time series, and then reports the time [ms] taken with the position of the sun
+/// computed on the fly by each array, against the time taken with one solar geometry
+/// shared by all arrays (see SolarGeometryCache). Then reports the time [ms] taken to
+/// compute production alone, timestep by timestep (scalar path) against the
+/// whole-series kernel (see Solar::computeProductionkWBatch()).
+///
+
+
+#include <chrono>
+
+#include "../utils/testing_utils.h"
+#include "../../header/Production/Renewable/Solar.h"
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double runArrays(
+///         std::vector<Solar>* solar_vec_ptr,
+///         std::vector<double>* solar_resource_vec_kWm2_ptr
+///     )
+///
+/// \brief A function to compute and commit production for every given array, over the
+///     full modelling time series.
+///
+/// \param solar_vec_ptr A pointer to the vector of arrays.
+///
+/// \param solar_resource_vec_kWm2_ptr A pointer to the solar resource [kW/m2] series.
+///
+/// \return The sum of production [kW] over all arrays and timesteps (a checksum).
+///
+
+double runArrays(
+    std::vector<Solar>* solar_vec_ptr,
+    std::vector<double>* solar_resource_vec_kWm2_ptr
+)
+{
+    double sum_production_kW = 0;
+    double production_kW = 0;
+    
+    for (size_t i = 0; i < solar_vec_ptr->size(); i++) {
+        Solar* solar_ptr = &(solar_vec_ptr->at(i));
+        
+        for (size_t j = 0; j < solar_resource_vec_kWm2_ptr->size(); j++) {
+            production_kW = solar_ptr->computeProductionkW(
+                j,
+                1,
+                solar_resource_vec_kWm2_ptr->at(j)
+            );
+            
+            solar_ptr->commit(j, 1, production_kW, 1e6);
+            
+            sum_production_kW += production_kW;
+        }
+    }
+    
+    return sum_production_kW;
+}   /* runArrays() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\tBenchmarking Solar");
+    std::cout << std::endl << std::endl;
+    
+    srand(0);
+    
+    
+    //  1. build a 5 year, hourly time series and solar resource
+    int n_points = 5 * 8760;
+    
+    std::vector<double> time_vec_hrs(n_points, 0);
+    std::vector<double> solar_resource_vec_kWm2(n_points, 0);
+    
+    for (int i = 0; i < n_points; i++) {
+        time_vec_hrs[i] = i;
+        solar_resource_vec_kWm2[i] = std::max(
+            0.0,
+            sin((2 * M_PI / 24) * (i - 6)) * ((double)rand() / RAND_MAX)
+        );
+    }
+    
+    std::vector<double> panel_azimuth_vec_deg = {90, 135, 180, 225};
+    std::vector<double> panel_tilt_vec_deg = {20, 40};
+    
+    SolarInputs solar_inputs;
+    
+    solar_inputs.julian_day = 8766;
+    solar_inputs.latitude_deg = 50;
+    solar_inputs.longitude_deg = -125;
+    
+    
+    //  2. position of the sun computed on the fly by each array
+    std::vector<Solar> on_the_fly_solar_vec;
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    for (size_t i = 0; i < panel_azimuth_vec_deg.size(); i++) {
+        for (size_t j = 0; j < panel_tilt_vec_deg.size(); j++) {
+            solar_inputs.panel_azimuth_deg = panel_azimuth_vec_deg[i];
+            solar_inputs.panel_tilt_deg = panel_tilt_vec_deg[j];
+            solar_inputs.power_model = SolarPowerProductionModel :: SOLAR_POWER_SIMPLE;
+            
+            on_the_fly_solar_vec.push_back(
+                Solar(n_points, 5, solar_inputs, &time_vec_hrs)
+            );
+            
+            on_the_fly_solar_vec.back().power_model =
+                SolarPowerProductionModel :: SOLAR_POWER_DETAILED;
+        }
+    }
+    
+    double on_the_fly_sum_kW = runArrays(
+        &on_the_fly_solar_vec,
+        &solar_resource_vec_kWm2
+    );
+    
+    auto end = std::chrono::steady_clock::now();
+    double on_the_fly_time_ms =
+        std::chrono::duration<double, std::milli>(end - start).count();
+    
+    
+    //  3. one shared solar geometry (computed once, on construction of the first array)
+    std::vector<Solar> shared_solar_vec;
+    
+    start = std::chrono::steady_clock::now();
+    
+    for (size_t i = 0; i < panel_azimuth_vec_deg.size(); i++) {
+        for (size_t j = 0; j < panel_tilt_vec_deg.size(); j++) {
+            solar_inputs.panel_azimuth_deg = panel_azimuth_vec_deg[i];
+            solar_inputs.panel_tilt_deg = panel_tilt_vec_deg[j];
+            solar_inputs.power_model = SolarPowerProductionModel :: SOLAR_POWER_DETAILED;
+            
+            shared_solar_vec.push_back(
+                Solar(n_points, 5, solar_inputs, &time_vec_hrs)
+            );
+        }
+    }
+    
+    double shared_sum_kW = runArrays(&shared_solar_vec, &solar_resource_vec_kWm2);
+    
+    end = std::chrono::steady_clock::now();
+    double shared_time_ms =
+        std::chrono::duration<double, std::milli>(end - start).count();
+    
+    
+    //  4. production only, scalar path against whole-series kernel
+    std::vector<double> dt_vec_hrs(n_points, 1);
+    std::vector<double> production_vec_kW(n_points, 0);
+    
+    int n_repeats = 10;
+    double scalar_sum_kW = 0;
+    
+    start = std::chrono::steady_clock::now();
+    
+    for (int r = 0; r < n_repeats; r++) {
+        for (size_t i = 0; i < shared_solar_vec.size(); i++) {
+            for (int j = 0; j < n_points; j++) {
+                scalar_sum_kW += shared_solar_vec[i].computeProductionkW(
+                    j,
+                    1,
+                    solar_resource_vec_kWm2[j]
+                );
+            }
+        }
+    }
+    
+    end = std::chrono::steady_clock::now();
+    double scalar_time_ms =
+        std::chrono::duration<double, std::milli>(end - start).count() / n_repeats;
+    
+    double batch_sum_kW = 0;
+    
+    start = std::chrono::steady_clock::now();
+    
+    for (int r = 0; r < n_repeats; r++) {
+        for (size_t i = 0; i < shared_solar_vec.size(); i++) {
+            shared_solar_vec[i].computeProductionkWBatch(
+                n_points,
+                dt_vec_hrs.data(),
+                solar_resource_vec_kWm2.data(),
+                production_vec_kW.data()
+            );
+            
+            for (int j = 0; j < n_points; j++) {
+                batch_sum_kW += production_vec_kW[j];
+            }
+        }
+    }
+    
+    end = std::chrono::steady_clock::now();
+    double batch_time_ms =
+        std::chrono::duration<double, std::milli>(end - start).count() / n_repeats;
+    
+    
+    //  5. report
+    std::cout << on_the_fly_solar_vec.size() << " detailed arrays at one site, "
+        << n_points << " points (5 years, hourly)" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::setw(36) << "position of the sun" << std::setw(16) << "time [ms]"
+        << std::setw(24) << "sum production [kW]" << std::endl;
+    std::cout << std::setw(36) << "computed on the fly (per array)"
+        << std::setw(16) << on_the_fly_time_ms
+        << std::setw(24) << on_the_fly_sum_kW << std::endl;
+    std::cout << std::setw(36) << "shared (SolarGeometryCache)"
+        << std::setw(16) << shared_time_ms
+        << std::setw(24) << shared_sum_kW << std::endl;
+    std::cout << std::endl;
+    std::cout << std::setw(36) << "production only" << std::setw(16) << "time [ms]"
+        << std::setw(24) << "sum production [kW]" << std::endl;
+    std::cout << std::setw(36) << "scalar (per timestep)"
+        << std::setw(16) << scalar_time_ms
+        << std::setw(24) << scalar_sum_kW / n_repeats << std::endl;
+    std::cout << std::setw(36) << "whole-series kernel"
+        << std::setw(16) << batch_time_ms
+        << std::setw(24) << batch_sum_kW / n_repeats << std::endl;
+    
+    std::cout << std::endl;
+    return 0;
+}   /* main() */
+
+// ---------------------------------------------------------------------------------- //
@@ -0,0 +1,168 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+///
+/// \file bench_TimeSeriesCache.cpp
+///
+/// \brief Benchmarking suite for TimeSeriesCache class.
+///
+/// A suite of benchmarks for the TimeSeriesCache class. Writes a multi-year, sub-hourly
+/// electrical load CSV, and then reports the time [ms] to read it into an
+/// ElectricalLoad by parsing the CSV (cache disabled), on a cold cache (parse plus
+/// sidecar write), and on a warm cache (memory mapped sidecar); then reports the time
+/// for a batch of Models' worth of ElectricalLoads on a warm cache.
+///
+
+
+#include <chrono>
+
+#include "../utils/testing_utils.h"
+#include "../../header/ElectricalLoad.h"
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double timeReadLoadData(ElectricalLoad* electrical_load_ptr, std::string path)
+///
+/// \brief A function to time ElectricalLoad::readLoadData().
+///
+/// \param electrical_load_ptr A pointer to the ElectricalLoad to read into.
+///
+/// \param path The path to the electrical load time series.
+///
+/// \return The time taken [ms].
+///
+
+double timeReadLoadData(ElectricalLoad* electrical_load_ptr, std::string path)
+{
+    auto start = std::chrono::steady_clock::now();
+    electrical_load_ptr->readLoadData(path);
+    auto end = std::chrono::steady_clock::now();
+    
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}   /* timeReadLoadData() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\tBenchmarking TimeSeriesCache");
+    std::cout << std::endl << std::endl;
+    
+    srand(0);
+    
+    
+    //  1. write a 5 year, 5 minute electrical load time series
+    std::string write_path = "test/test_results/bench_TimeSeriesCache/";
+    std::string path_2_csv = write_path + "electrical_load_5yr_dt-5min.csv";
+    
+    std::filesystem::remove_all(write_path);
+    std::filesystem::create_directories(write_path);
+    
+    int n_points = 5 * 8760 * 12;
+    
+    std::ofstream ofs;
+    ofs.open(path_2_csv, std::ofstream::out);
+    ofs << std::setprecision(15);
+    ofs << "Time (since start of data) [hrs],Electrical Load [kW]\n";
+    
+    for (int i = 0; i < n_points; i++) {
+        ofs << i / 12.0 << "," << 300 + 200 * ((double)rand() / RAND_MAX) << "\n";
+    }
+    
+    ofs.close();
+    
+    std::cout << n_points << " points ("
+        << std::fixed << std::setprecision(1)
+        << std::filesystem::file_size(path_2_csv) / 1e6 << " MB CSV)" << std::endl;
+    
+    
+    //  2. single read: parse, cold cache, warm cache
+    ElectricalLoad parsed_electrical_load;
+    parsed_electrical_load.time_series_cache.enabled = false;
+    double parse_time_ms = timeReadLoadData(&parsed_electrical_load, path_2_csv);
+    
+    ElectricalLoad cached_electrical_load;
+    double cold_time_ms = timeReadLoadData(&cached_electrical_load, path_2_csv);
+    double warm_time_ms = timeReadLoadData(&cached_electrical_load, path_2_csv);
+    
+    if (
+        not cached_electrical_load.time_series_cache.last_read_from_cache or
+        cached_electrical_load.load_vec_kW != parsed_electrical_load.load_vec_kW or
+        cached_electrical_load.time_vec_hrs != parsed_electrical_load.time_vec_hrs
+    ) {
+        std::string error_str = "ERROR:  bench_TimeSeriesCache:  ";
+        error_str += "cached and parsed electrical load data differ";
+        
+        throw std::runtime_error(error_str);
+    }
+    
+    std::cout << std::setw(24) << "read" << std::setw(16) << "time [ms]" << std::endl;
+    std::cout << std::setw(24) << "CSV parse (no cache)"
+        << std::setw(16) << parse_time_ms << std::endl;
+    std::cout << std::setw(24) << "cold cache"
+        << std::setw(16) << cold_time_ms << std::endl;
+    std::cout << std::setw(24) << "warm cache (mmap)"
+        << std::setw(16) << warm_time_ms << std::endl << std::endl;
+    
+    
+    //  3. batch of Models' worth of reads on a warm cache
+    int n_models = 50;
+    double batch_time_ms = 0;
+    
+    for (int i = 0; i < n_models; i++) {
+        ElectricalLoad batch_electrical_load;
+        batch_time_ms += timeReadLoadData(&batch_electrical_load, path_2_csv);
+    }
+    
+    std::cout << n_models << " reads (warm cache):  " << batch_time_ms << " ms (versus ~"
+        << n_models * parse_time_ms << " ms parsing)" << std::endl;
+    
+    std::filesystem::remove_all(write_path);
+    
+    std::cout << std::endl;
+    return 0;
+}   /* main() */
+
+// ---------------------------------------------------------------------------------- //
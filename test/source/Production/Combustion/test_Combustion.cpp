@@ -92,44 +92,38 @@ Combustion* testConstruct_Combustion(std::vector<double>* time_vec_hrs_ptr)
         __LINE__
     );
 
-    testFloatEquals(
-        test_combustion_ptr->CO2_emissions_vec_kg.size(),
-        8760,
+    testTruth(
+        test_combustion_ptr->CO2_emissions_vec_kg.empty(),
         __FILE__,
         __LINE__
     );
 
-    testFloatEquals(
-        test_combustion_ptr->CO_emissions_vec_kg.size(),
-        8760,
+    testTruth(
+        test_combustion_ptr->CO_emissions_vec_kg.empty(),
         __FILE__,
         __LINE__
     );
 
-    testFloatEquals(
-        test_combustion_ptr->NOx_emissions_vec_kg.size(),
-        8760,
+    testTruth(
+        test_combustion_ptr->NOx_emissions_vec_kg.empty(),
         __FILE__,
         __LINE__
     );
 
-    testFloatEquals(
-        test_combustion_ptr->SOx_emissions_vec_kg.size(),
-        8760,
+    testTruth(
+        test_combustion_ptr->SOx_emissions_vec_kg.empty(),
         __FILE__,
         __LINE__
     );
 
-    testFloatEquals(
-        test_combustion_ptr->CH4_emissions_vec_kg.size(),
-        8760,
+    testTruth(
+        test_combustion_ptr->CH4_emissions_vec_kg.empty(),
         __FILE__,
         __LINE__
     );
 
-    testFloatEquals(
-        test_combustion_ptr->PM_emissions_vec_kg.size(),
-        8760,
+    testTruth(
+        test_combustion_ptr->PM_emissions_vec_kg.empty(),
         __FILE__,
         __LINE__
     );
@@ -121,7 +121,7 @@ Combustion* testConstruct_Diesel(std::vector<double>* time_vec_hrs_ptr)
 
     testFloatEquals(
         ((Diesel*)test_diesel_ptr)->minimum_load_ratio,
-        0.2,
+        0.4,
         __FILE__,
         __LINE__
     );
@@ -456,9 +456,29 @@ void testFuelConsumptionEmissions_Diesel(Combustion* test_diesel_ptr)
     
     bool is_running = false;
     
+    // emissions series are only materialized on demand
+    testTruth(test_diesel_ptr->CO2_emissions_vec_kg.empty(), __FILE__, __LINE__);
+    
+    test_diesel_ptr->computeEmissionsSeries();
+    
+    testFloatEquals(
+        test_diesel_ptr->CO2_emissions_vec_kg.size(),
+        test_diesel_ptr->fuel_consumption_vec_L.size(),
+        __FILE__,
+        __LINE__
+    );
+    
     for (int i = 0; i < 48; i++) {
         is_running = test_diesel_ptr->is_running_vec[i];
         
+        testFloatEquals(
+            test_diesel_ptr->CO2_emissions_vec_kg[i],
+            test_diesel_ptr->CO2_emissions_intensity_kgL *
+                test_diesel_ptr->fuel_consumption_vec_L[i],
+            __FILE__,
+            __LINE__
+        );
+        
         testFloatEquals(
             is_running,
             expected_is_running_vec[i],
@@ -724,6 +744,66 @@ void testFuelLookup_Diesel(Combustion* test_diesel_lookup_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testFuelCurveTable_Diesel(Combustion* test_diesel_lookup_ptr)
+///
+/// \brief Function to test that the compiled fuel curve table reproduces the fuel
+///     consumption interpolation data over its whole domain, and that out of bounds
+///     load ratios are still caught.
+///
+/// \param test_diesel_lookup_ptr A Combustion pointer to the test Diesel object using
+///     fuel consumption lookup.
+///
+
+void testFuelCurveTable_Diesel(Combustion* test_diesel_lookup_ptr)
+{
+    FuelCurveTable* table_ptr = &(test_diesel_lookup_ptr->fuel_curve_table);
+    
+    testGreaterThan(table_ptr->n_bins, 0, __FILE__, __LINE__);
+    testFloatEquals(table_ptr->min_load_ratio, 0, __FILE__, __LINE__);
+    testFloatEquals(table_ptr->max_load_ratio, 1, __FILE__, __LINE__);
+    testFloatEquals(table_ptr->slope_vec_Lhr.size(), 15, __FILE__, __LINE__);
+    
+    int n_queries = 10000;
+    
+    for (int i = 0; i <= n_queries; i++) {
+        double load_ratio = double(i) / n_queries;
+        
+        testFloatEquals(
+            test_diesel_lookup_ptr->getFuelConsumptionL(
+                0.5, load_ratio * test_diesel_lookup_ptr->capacity_kW
+            ),
+            0.5 * test_diesel_lookup_ptr->interpolator.interp1D(0, load_ratio),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    bool error_flag = true;
+    
+    try {
+        test_diesel_lookup_ptr->getFuelConsumptionL(
+            1, 1.1 * test_diesel_lookup_ptr->capacity_kW
+        );
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testFuelCurveTable_Diesel() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 int main(int argc, char** argv)
@@ -764,6 +844,7 @@ int main(int argc, char** argv)
         testEconomics_Diesel(test_diesel_ptr);
         
         testFuelLookup_Diesel(test_diesel_lookup_ptr);
+        testFuelCurveTable_Diesel(test_diesel_lookup_ptr);
     }
 
 
@@ -154,7 +154,7 @@ void testEfficiencyInterpolation_Hydro(Noncombustion* test_hydro_ptr)
         testFloatEquals(
             test_hydro_ptr->interpolator.interp_map_1D[
                 HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY
-            ].x_vec[i],
+            ]->x_vec[i],
             expected_gen_power_ratios[i],
             __FILE__,
             __LINE__
@@ -163,7 +163,7 @@ void testEfficiencyInterpolation_Hydro(Noncombustion* test_hydro_ptr)
         testFloatEquals(
             test_hydro_ptr->interpolator.interp_map_1D[
                 HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY
-            ].y_vec[i],
+            ]->y_vec[i],
             expected_gen_efficiencies[i],
             __FILE__,
             __LINE__
@@ -196,7 +196,7 @@ void testEfficiencyInterpolation_Hydro(Noncombustion* test_hydro_ptr)
         testFloatEquals(
             test_hydro_ptr->interpolator.interp_map_1D[
                 HydroInterpKeys :: TURBINE_EFFICIENCY_INTERP_KEY
-            ].x_vec[i],
+            ]->x_vec[i],
             expected_turb_power_ratios[i],
             __FILE__,
             __LINE__
@@ -205,7 +205,7 @@ void testEfficiencyInterpolation_Hydro(Noncombustion* test_hydro_ptr)
         testFloatEquals(
             test_hydro_ptr->interpolator.interp_map_1D[
                 HydroInterpKeys :: TURBINE_EFFICIENCY_INTERP_KEY
-            ].y_vec[i],
+            ]->y_vec[i],
             expected_turb_efficiencies[i],
             __FILE__,
             __LINE__
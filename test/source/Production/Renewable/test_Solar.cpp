@@ -472,6 +472,192 @@ void testDetailed_Solar(void)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testSolarGeometryCache_Solar(std::vector<double>* time_vec_hrs_ptr)
+///
+/// \brief Function to test that Solar assets at the same site (and over the same
+///     modelling time series) share a single solar geometry, that assets elsewhere do
+///     not, and that production from the shared geometry matches production from the
+///     position of the sun computed on the fly.
+///
+/// \param time_vec_hrs_ptr A pointer to the vector containing the modelling time series.
+///
+
+void testSolarGeometryCache_Solar(std::vector<double>* time_vec_hrs_ptr)
+{
+    SolarGeometryCache& solar_geometry_cache = SolarGeometryCache :: getInstance();
+    size_t initial_cache_size = solar_geometry_cache.size();
+    
+    //  1. init east and west facing arrays (same site), and an array elsewhere
+    SolarInputs solar_inputs;
+    
+    solar_inputs.power_model = SolarPowerProductionModel :: SOLAR_POWER_DETAILED;
+    solar_inputs.julian_day = 8766;
+    solar_inputs.latitude_deg = 50;
+    solar_inputs.longitude_deg = -125;
+    solar_inputs.panel_tilt_deg = 30;
+    
+    solar_inputs.panel_azimuth_deg = 90;
+    Solar test_solar_east(8760, 1, solar_inputs, time_vec_hrs_ptr);
+    
+    solar_inputs.panel_azimuth_deg = 270;
+    Solar test_solar_west(8760, 1, solar_inputs, time_vec_hrs_ptr);
+    
+    solar_inputs.latitude_deg = 60;
+    Solar test_solar_north(8760, 1, solar_inputs, time_vec_hrs_ptr);
+    
+    solar_inputs.latitude_deg = 50;
+    solar_inputs.power_model = SolarPowerProductionModel :: SOLAR_POWER_SIMPLE;
+    Solar test_solar_simple(8760, 1, solar_inputs, time_vec_hrs_ptr);
+    
+    //  2. check sharing
+    testTruth(test_solar_east.solar_geometry_ptr != NULL, __FILE__, __LINE__);
+    testTruth(test_solar_north.solar_geometry_ptr != NULL, __FILE__, __LINE__);
+    testTruth(test_solar_simple.solar_geometry_ptr == NULL, __FILE__, __LINE__);
+    
+    testTruth(
+        test_solar_east.solar_geometry_ptr == test_solar_west.solar_geometry_ptr,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        test_solar_east.solar_geometry_ptr != test_solar_north.solar_geometry_ptr,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_solar_east.solar_geometry_ptr->size(),
+        8760,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        solar_geometry_cache.size(),
+        initial_cache_size + 2,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  3. check shared geometry against geometry computed on the fly
+    Solar test_solar_on_the_fly(test_solar_west);
+    test_solar_on_the_fly.solar_geometry_ptr.reset();
+    
+    double production_kW = 0;
+    double on_the_fly_production_kW = 0;
+    
+    for (int i = 0; i < 8760; i++) {
+        double solar_resource_kWm2 = 0.5 + 0.5 * sin((2 * M_PI / 24) * i);
+        
+        production_kW = test_solar_west.computeProductionkW(
+            i, 1, solar_resource_kWm2
+        );
+        
+        on_the_fly_production_kW = test_solar_on_the_fly.computeProductionkW(
+            i, 1, solar_resource_kWm2
+        );
+        
+        test_solar_west.commit(i, 1, production_kW, 100);
+        test_solar_on_the_fly.commit(i, 1, on_the_fly_production_kW, 100);
+        
+        testFloatEquals(
+            production_kW,
+            on_the_fly_production_kW,
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    return;
+}   /* testSolarGeometryCache_Solar() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testProductionBatch_Solar(std::vector<double>* time_vec_hrs_ptr)
+///
+/// \brief Function to test that the whole-series production kernel (detailed model)
+///     matches the scalar path (i.e., computeProductionkW() at each timestep), for a
+///     range of panel orientations, and that the batch method falls back to the scalar
+///     path for the simple model.
+///
+/// \param time_vec_hrs_ptr A pointer to the vector containing the modelling time series.
+///
+
+void testProductionBatch_Solar(std::vector<double>* time_vec_hrs_ptr)
+{
+    int n_points = time_vec_hrs_ptr->size();
+    
+    std::vector<double> dt_vec_hrs(n_points, 1);
+    std::vector<double> solar_resource_vec_kWm2(n_points, 0);
+    
+    for (int i = 0; i < n_points; i++) {
+        solar_resource_vec_kWm2[i] = 1.2 * sin((2 * M_PI / 24) * (i - 6)) *
+            ((double)rand() / RAND_MAX);
+    }
+    
+    std::vector<double> panel_azimuth_vec_deg = {0, 90, 180, 270};
+    std::vector<double> panel_tilt_vec_deg = {0, 30, 90};
+    
+    std::vector<double> batch_production_vec_kW(n_points, 0);
+    double scalar_production_kW = 0;
+    
+    SolarInputs solar_inputs;
+    
+    solar_inputs.julian_day = 8766;
+    solar_inputs.latitude_deg = 50;
+    solar_inputs.longitude_deg = -125;
+    solar_inputs.renewable_inputs.production_inputs.capacity_kW = 100;
+    
+    for (size_t i = 0; i < panel_azimuth_vec_deg.size(); i++) {
+        for (size_t j = 0; j < panel_tilt_vec_deg.size(); j++) {
+            for (int k = 0; k < N_SOLAR_POWER_PRODUCTION_MODELS; k++) {
+                solar_inputs.panel_azimuth_deg = panel_azimuth_vec_deg[i];
+                solar_inputs.panel_tilt_deg = panel_tilt_vec_deg[j];
+                solar_inputs.power_model = SolarPowerProductionModel(k);
+                
+                Solar test_solar(n_points, 1, solar_inputs, time_vec_hrs_ptr);
+                
+                test_solar.computeProductionkWBatch(
+                    n_points,
+                    dt_vec_hrs.data(),
+                    solar_resource_vec_kWm2.data(),
+                    batch_production_vec_kW.data()
+                );
+                
+                for (int t = 0; t < n_points; t++) {
+                    scalar_production_kW = test_solar.computeProductionkW(
+                        t,
+                        dt_vec_hrs[t],
+                        solar_resource_vec_kWm2[t]
+                    );
+                    
+                    testFloatEquals(
+                        batch_production_vec_kW[t],
+                        scalar_production_kW,
+                        __FILE__,
+                        __LINE__
+                    );
+                }
+            }
+        }
+    }
+    
+    return;
+}   /* testProductionBatch_Solar() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -704,6 +890,8 @@ int main(int argc, char** argv)
         );
         
         testDetailed_Solar();
+        testSolarGeometryCache_Solar(&time_vec_hrs);
+        testProductionBatch_Solar(&time_vec_hrs);
         
         testProductionConstraint_Solar(test_solar_ptr);
         
@@ -468,6 +468,94 @@ void testProductionLookup_Wave(Renewable* test_wave_lookup_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testProductionBatch_Wave(Renewable* test_wave_lookup_ptr)
+///
+/// \brief Function to test that the whole-series production lookup matches the scalar
+///     path (i.e., computeProductionkW() at each timestep), including timesteps with
+///     no waves.
+///
+/// \param test_wave_lookup_ptr A Renewable pointer to the test Wave object using
+///     production lookup.
+///
+
+void testProductionBatch_Wave(Renewable* test_wave_lookup_ptr)
+{
+    int n_points = 8760;
+    
+    std::vector<double> dt_vec_hrs(n_points, 1);
+    std::vector<double> significant_wave_height_vec_m(n_points, 0);
+    std::vector<double> energy_period_vec_s(n_points, 0);
+    
+    for (int i = 0; i < n_points; i++) {
+        if (i % 11 != 0) {
+            significant_wave_height_vec_m[i] = 0.25 + 7.5 * ((double)rand() / RAND_MAX);
+        }
+        
+        if (i % 13 != 0) {
+            energy_period_vec_s[i] = 5 + 15 * ((double)rand() / RAND_MAX);
+        }
+    }
+    
+    std::vector<double> batch_production_vec_kW(n_points, -1);
+    
+    test_wave_lookup_ptr->computeProductionkWBatch(
+        n_points,
+        dt_vec_hrs.data(),
+        significant_wave_height_vec_m.data(),
+        energy_period_vec_s.data(),
+        batch_production_vec_kW.data()
+    );
+    
+    for (int i = 0; i < n_points; i++) {
+        testFloatEquals(
+            batch_production_vec_kW[i],
+            test_wave_lookup_ptr->computeProductionkW(
+                i,
+                dt_vec_hrs[i],
+                significant_wave_height_vec_m[i],
+                energy_period_vec_s[i]
+            ),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  the resource binding entry point (as used by the Controller) reads both channels
+    ResourceBinding resource_binding;
+    
+    resource_binding.resource_span.data_ptr = significant_wave_height_vec_m.data();
+    resource_binding.resource_span.n_points = n_points;
+    resource_binding.resource_span_2D.data_ptr = energy_period_vec_s.data();
+    resource_binding.resource_span_2D.n_points = n_points;
+    
+    std::vector<double> binding_production_vec_kW(n_points, -1);
+    
+    test_wave_lookup_ptr->computeProductionkWBatch(
+        n_points,
+        dt_vec_hrs.data(),
+        &resource_binding,
+        binding_production_vec_kW.data()
+    );
+    
+    for (int i = 0; i < n_points; i++) {
+        testFloatEquals(
+            binding_production_vec_kW[i],
+            batch_production_vec_kW[i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    return;
+}   /* testProductionBatch_Wave() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 int main(int argc, char** argv)
@@ -503,6 +591,7 @@ int main(int argc, char** argv)
         testEconomics_Wave(test_wave_ptr);
         
         testProductionLookup_Wave(test_wave_lookup_ptr);
+        testProductionBatch_Wave(test_wave_lookup_ptr);
     }
 
 
@@ -87,7 +87,7 @@ Production* testConstruct_Production(std::vector<double>* time_vec_hrs_ptr)
 
     testFloatEquals(
         production_inputs.nominal_discount_annual,
-        0.04,
+        0.08,
         __FILE__,
         __LINE__
     );
@@ -108,7 +108,7 @@ Production* testConstruct_Production(std::vector<double>* time_vec_hrs_ptr)
 
     testFloatEquals(
         test_production_ptr->real_discount_annual,
-        0.0196078431372549,
+        0.0588235294117647,
         __FILE__,
         __LINE__
     );
@@ -142,11 +142,17 @@ Production* testConstruct_Production(std::vector<double>* time_vec_hrs_ptr)
     );
 
     testFloatEquals(
-        test_production_ptr->capital_cost_vec.size(),
+        test_production_ptr->getCapitalCostSeries().size(),
         8760,
         __FILE__,
         __LINE__
     );
+    
+    testTruth(
+        test_production_ptr->capital_cost_event_vec.empty(),
+        __FILE__,
+        __LINE__
+    );
 
     testFloatEquals(
         test_production_ptr->operation_maintenance_cost_vec.size(),
@@ -197,6 +203,105 @@ void testBadConstruct_Production(std::vector<double>* time_vec_hrs_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testCapitalCostEvents_Production(Production* test_production_ptr)
+///
+/// \brief Function to test that capital costs are logged as events, that the log is
+///     expanded into a time series as expected (both by walking it, and in full), and
+///     that events logged out of time order are rejected.
+///
+/// \param test_production_ptr A pointer to the test Production object.
+///
+
+void testCapitalCostEvents_Production(Production* test_production_ptr)
+{
+    //  1. log events (two in the same timestep)
+    test_production_ptr->incurCapitalCost(
+        0,
+        1000,
+        CapitalCostReason :: CAPITAL_COST_INITIAL
+    );
+    
+    test_production_ptr->incurCapitalCost(
+        100,
+        500,
+        CapitalCostReason :: CAPITAL_COST_REPLACEMENT
+    );
+    
+    test_production_ptr->incurCapitalCost(
+        100,
+        250,
+        CapitalCostReason :: CAPITAL_COST_REPLACEMENT
+    );
+    
+    testFloatEquals(
+        test_production_ptr->capital_cost_event_vec.size(),
+        3,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  2. walk and expand the log
+    std::vector<double> capital_cost_vec = test_production_ptr->getCapitalCostSeries();
+    size_t capital_cost_event_idx = 0;
+    
+    testFloatEquals(capital_cost_vec.size(), 8760, __FILE__, __LINE__);
+    
+    for (int i = 0; i < 8760; i++) {
+        double expected_capital_cost = 0;
+        
+        if (i == 0) {
+            expected_capital_cost = 1000;
+        }
+        
+        else if (i == 100) {
+            expected_capital_cost = 750;
+        }
+        
+        testFloatEquals(
+            test_production_ptr->getCapitalCost(i, &capital_cost_event_idx),
+            expected_capital_cost,
+            __FILE__,
+            __LINE__
+        );
+        
+        testFloatEquals(
+            capital_cost_vec[i],
+            expected_capital_cost,
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    testFloatEquals(capital_cost_event_idx, 3, __FILE__, __LINE__);
+    
+    //  3. out of order event
+    bool error_flag = true;
+    
+    try {
+        test_production_ptr->incurCapitalCost(
+            50,
+            1,
+            CapitalCostReason :: CAPITAL_COST_REPLACEMENT
+        );
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testCapitalCostEvents_Production() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 int main(int argc, char** argv)
@@ -224,6 +329,8 @@ int main(int argc, char** argv)
         
     try {
         testBadConstruct_Production(&time_vec_hrs);
+        
+        testCapitalCostEvents_Production(test_production_ptr);
     }
 
 
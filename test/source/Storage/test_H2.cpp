@@ -101,11 +101,38 @@ Storage* testConstruct_H2(void)
     );
 
     testFloatEquals(
-        test_storage_ptr->capital_cost_vec.size(),
+        test_storage_ptr->getCapitalCostSeries().size(),
         8760,
         __FILE__,
         __LINE__
     );
+    
+    testFloatEquals(
+        test_storage_ptr->capital_cost_event_vec.size(),
+        1,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        test_storage_ptr->capital_cost_event_vec[0].timestep == 0,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        test_storage_ptr->capital_cost_event_vec[0].reason ==
+            CapitalCostReason :: CAPITAL_COST_INITIAL,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_storage_ptr->capital_cost_event_vec[0].cost,
+        test_storage_ptr->capital_cost,
+        __FILE__,
+        __LINE__
+    );
 
     testFloatEquals(
         test_storage_ptr->operation_maintenance_cost_vec.size(),
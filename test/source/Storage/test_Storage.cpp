@@ -101,11 +101,17 @@ Storage* testConstruct_Storage(void)
     );
 
     testFloatEquals(
-        test_storage_ptr->capital_cost_vec.size(),
+        test_storage_ptr->getCapitalCostSeries().size(),
         8760,
         __FILE__,
         __LINE__
     );
+    
+    testTruth(
+        test_storage_ptr->capital_cost_event_vec.empty(),
+        __FILE__,
+        __LINE__
+    );
 
     testFloatEquals(
         test_storage_ptr->operation_maintenance_cost_vec.size(),
@@ -0,0 +1,418 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+/// \file test_BufferedWriter.cpp
+///
+/// \brief Testing suite for BufferedWriter class.
+///
+/// A suite of tests for the BufferedWriter class. Each test writes the same sequence
+/// of values with both a BufferedWriter and a std::ofstream (under its default
+/// flags), and then checks that the two files are byte-identical.
+///
+
+
+#include "../utils/testing_utils.h"
+#include "../../header/BufferedWriter.h"
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string readFile(std::string path_2_file)
+///
+/// \brief Helper function to read the full contents of a file.
+///
+/// \param path_2_file A path (either relative or absolute) to the file to read.
+///
+/// \return The contents of the file.
+///
+
+std::string readFile(std::string path_2_file)
+{
+    std::ifstream ifs(path_2_file, std::ifstream::binary);
+    
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    
+    return ss.str();
+}   /* readFile() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testIdentical_BufferedWriter(
+///         std::string path_2_reference,
+///         std::string path_2_test,
+///         size_t total_bytes_written
+///     )
+///
+/// \brief Helper function to check that the file written by a BufferedWriter is
+///     byte-identical to the reference file written by a std::ofstream, and that the
+///     BufferedWriter's byte count is consistent. Both files are removed afterwards.
+///
+/// \param path_2_reference A path to the file written by the std::ofstream.
+///
+/// \param path_2_test A path to the file written by the BufferedWriter.
+///
+/// \param total_bytes_written The BufferedWriter's total_bytes_written at close.
+///
+
+void testIdentical_BufferedWriter(
+    std::string path_2_reference,
+    std::string path_2_test,
+    size_t total_bytes_written
+)
+{
+    std::string reference_str = readFile(path_2_reference);
+    std::string test_str = readFile(path_2_test);
+    
+    testTruth(not reference_str.empty(), __FILE__, __LINE__);
+    testFloatEquals(test_str.size(), reference_str.size(), __FILE__, __LINE__);
+    testTruth(test_str == reference_str, __FILE__, __LINE__);
+    testFloatEquals(total_bytes_written, test_str.size(), __FILE__, __LINE__);
+    
+    std::filesystem::remove(path_2_reference);
+    std::filesystem::remove(path_2_test);
+    
+    return;
+}   /* testIdentical_BufferedWriter() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testDoubles_BufferedWriter(std::string path_2_dir)
+///
+/// \brief Function to test that doubles are written exactly as std::ofstream writes
+///     them, including exponent formatting, signed zero, and non-finite values.
+///
+/// \param path_2_dir A path to the directory in which to write the test files.
+///
+
+void testDoubles_BufferedWriter(std::string path_2_dir)
+{
+    std::vector<double> value_vec = {
+        0,
+        -0.0,
+        1,
+        -1,
+        0.1,
+        0.5,
+        2.0 / 3.0,
+        123456,
+        123456.7,
+        999999.5,
+        1e+06,
+        1234567,
+        -1e+06,
+        1e-04,
+        1e-05,
+        1.5e-05,
+        -1e-05,
+        1e+100,
+        1e-300,
+        std::numeric_limits<double>::max(),
+        std::numeric_limits<double>::min(),
+        std::numeric_limits<double>::denorm_min(),
+        std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity(),
+        std::numeric_limits<double>::quiet_NaN(),
+        -std::numeric_limits<double>::quiet_NaN()
+    };
+    
+    for (int i = 0; i < 1000; i++) {
+        value_vec.push_back(
+            (double(rand()) / RAND_MAX - 0.5) * pow(10, (rand() % 41) - 20)
+        );
+    }
+    
+    auto write = [&value_vec](auto& stream) {
+        for (size_t i = 0; i < value_vec.size(); i++) {
+            stream << value_vec[i] << ",";
+        }
+        
+        stream << "\n";
+    };
+    
+    std::string path_2_reference = path_2_dir + "doubles_reference.csv";
+    std::string path_2_test = path_2_dir + "doubles_test.csv";
+    
+    std::ofstream ofs;
+    ofs.open(path_2_reference, std::ofstream::out);
+    write(ofs);
+    ofs.close();
+    
+    BufferedWriter writer;
+    writer.open(path_2_test, std::ofstream::out);
+    write(writer);
+    size_t total_bytes_written = writer.total_bytes_written;
+    writer.close();
+    
+    testIdentical_BufferedWriter(path_2_reference, path_2_test, total_bytes_written);
+    
+    return;
+}   /* testDoubles_BufferedWriter() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testIntegers_BufferedWriter(std::string path_2_dir)
+///
+/// \brief Function to test that the integer, bool, char, and string overloads write
+///     exactly what std::ofstream writes (including the extremes of each integer
+///     type).
+///
+/// \param path_2_dir A path to the directory in which to write the test files.
+///
+
+void testIntegers_BufferedWriter(std::string path_2_dir)
+{
+    std::string header_str = "Time (since start of data) [hrs],Load [kW]";
+    
+    auto write = [&header_str](auto& stream) {
+        stream << header_str << "\n";
+        
+        stream << int(0) << "," << int(-7) << "," << int(8760) << ",";
+        stream << std::numeric_limits<int>::min() << ",";
+        stream << std::numeric_limits<int>::max() << "\n";
+        
+        stream << long(-1) << "," << std::numeric_limits<long>::min() << ",";
+        stream << std::numeric_limits<long>::max() << "\n";
+        
+        stream << (long long)(-1) << ",";
+        stream << std::numeric_limits<long long>::min() << ",";
+        stream << std::numeric_limits<long long>::max() << "\n";
+        
+        stream << (unsigned int)(0) << ",";
+        stream << std::numeric_limits<unsigned int>::max() << "\n";
+        
+        stream << (unsigned long)(0) << ",";
+        stream << std::numeric_limits<unsigned long>::max() << "\n";
+        
+        stream << (unsigned long long)(0) << ",";
+        stream << std::numeric_limits<unsigned long long>::max() << "\n";
+        
+        stream << size_t(8760) << "," << true << "," << false << "\n";
+        
+        stream << 'x' << ',' << "" << "," << std::string("") << "\n";
+    };
+    
+    std::string path_2_reference = path_2_dir + "integers_reference.csv";
+    std::string path_2_test = path_2_dir + "integers_test.csv";
+    
+    std::ofstream ofs;
+    ofs.open(path_2_reference, std::ofstream::out);
+    write(ofs);
+    ofs.close();
+    
+    BufferedWriter writer;
+    writer.open(path_2_test, std::ofstream::out);
+    write(writer);
+    size_t total_bytes_written = writer.total_bytes_written;
+    writer.close();
+    
+    testIdentical_BufferedWriter(path_2_reference, path_2_test, total_bytes_written);
+    
+    return;
+}   /* testIntegers_BufferedWriter() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testBufferBoundary_BufferedWriter(std::string path_2_dir)
+///
+/// \brief Function to test that output is unchanged when the buffer is flushed many
+///     times mid-stream, including by values and strings that straddle the end of
+///     the buffer and by strings larger than the buffer (which bypass it).
+///
+/// \param path_2_dir A path to the directory in which to write the test files.
+///
+
+void testBufferBoundary_BufferedWriter(std::string path_2_dir)
+{
+    std::string long_str(1000, 'a');
+    
+    auto write = [&long_str](auto& stream) {
+        for (int i = 0; i < 8760; i++) {
+            stream << i << "," << 1000 * sin(0.001 * i) << "," << (i % 2 == 0);
+            stream << ",-1.23457e-05,";
+            
+            if (i % 997 == 0) {
+                stream << long_str;
+            }
+            
+            stream << "\n";
+        }
+    };
+    
+    //  1. buffer smaller than a single long string (minimum buffer size)
+    std::string path_2_reference = path_2_dir + "boundary_reference.csv";
+    std::string path_2_test = path_2_dir + "boundary_test.csv";
+    
+    std::ofstream ofs;
+    ofs.open(path_2_reference, std::ofstream::out);
+    write(ofs);
+    ofs.close();
+    
+    BufferedWriter writer(1);
+    writer.open(path_2_test, std::ofstream::out);
+    write(writer);
+    size_t total_bytes_written = writer.total_bytes_written;
+    writer.close();
+    
+    std::string reference_str = readFile(path_2_reference);
+    
+    testIdentical_BufferedWriter(path_2_reference, path_2_test, total_bytes_written);
+    
+    //  2. buffer sizes that do not divide the output evenly
+    std::vector<size_t> buffer_bytes_vec = {97, 1009, 4096, reference_str.size() - 1};
+    
+    for (size_t i = 0; i < buffer_bytes_vec.size(); i++) {
+        ofs.open(path_2_reference, std::ofstream::out);
+        write(ofs);
+        ofs.close();
+        
+        BufferedWriter sized_writer(buffer_bytes_vec[i]);
+        sized_writer.open(path_2_test, std::ofstream::out);
+        write(sized_writer);
+        total_bytes_written = sized_writer.total_bytes_written;
+        sized_writer.close();
+        
+        testIdentical_BufferedWriter(
+            path_2_reference,
+            path_2_test,
+            total_bytes_written
+        );
+    }
+    
+    //  3. reopening (in append mode) flushes and restarts the byte count
+    ofs.open(path_2_reference, std::ofstream::out);
+    write(ofs);
+    ofs.close();
+    
+    ofs.open(path_2_reference, std::ofstream::app);
+    write(ofs);
+    ofs.close();
+    
+    writer.open(path_2_test, std::ofstream::out);
+    write(writer);
+    
+    writer.open(path_2_test, std::ofstream::app);
+    write(writer);
+    total_bytes_written = writer.total_bytes_written;
+    writer.close();
+    
+    testFloatEquals(
+        total_bytes_written,
+        readFile(path_2_test).size() / 2,
+        __FILE__,
+        __LINE__
+    );
+    
+    testIdentical_BufferedWriter(
+        path_2_reference,
+        path_2_test,
+        readFile(path_2_test).size()
+    );
+    
+    return;
+}   /* testBufferBoundary_BufferedWriter() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\n\tTesting BufferedWriter");
+    
+    #ifdef _WIN32
+        std::cout << std::endl;
+    #endif
+    
+    srand(time(NULL));
+    
+    
+    std::string path_2_dir = "test/test_results/buffered_writer/";
+    std::filesystem::create_directories(path_2_dir);
+    
+    
+    try {
+        testDoubles_BufferedWriter(path_2_dir);
+        testIntegers_BufferedWriter(path_2_dir);
+        testBufferBoundary_BufferedWriter(path_2_dir);
+    }
+
+
+    catch (...) {
+        printGold(" ........................... ");
+        printRed("FAIL");
+        std::cout << std::endl;
+        throw;
+    }
+
+
+    printGold(" ........................... ");
+    printGreen("PASS");
+    std::cout << std::endl;
+    return 0;
+}   /* main() */
+
+// ---------------------------------------------------------------------------------- //
@@ -46,6 +46,9 @@
 
 #include "../utils/testing_utils.h"
 #include "../../header/Controller.h"
+#include "../../header/Production/Renewable/Solar.h"
+#include "../../header/Production/Renewable/Wave.h"
+#include "../../header/Production/Renewable/Wind.h"
 
 
 // ---------------------------------------------------------------------------------- //
@@ -62,6 +65,12 @@ Controller* testConstruct_Controller(void)
 {
     Controller* test_controller_ptr = new Controller();
     
+    testTruth(
+        test_controller_ptr->n_threads == 1,
+        __FILE__,
+        __LINE__
+    );
+    
     return test_controller_ptr;
 }   /* testConstruct_Controller() */
 
@@ -69,6 +78,846 @@ Controller* testConstruct_Controller(void)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::vector<Combustion*> getTestFleet_Controller(
+///         ElectricalLoad* electrical_load_ptr,
+///         std::vector<double> capacity_vec_kW
+///     )
+///
+/// \brief A function to construct a fleet of Diesel assets with the given capacities.
+///
+/// \param electrical_load_ptr A pointer to the test ElectricalLoad object.
+///
+/// \param capacity_vec_kW A vector of Diesel capacities [kW].
+///
+/// \return A vector of Combustion pointers to the test Diesel assets.
+///
+
+std::vector<Combustion*> getTestFleet_Controller(
+    ElectricalLoad* electrical_load_ptr,
+    std::vector<double> capacity_vec_kW
+)
+{
+    std::vector<Combustion*> combustion_ptr_vec;
+    
+    for (size_t i = 0; i < capacity_vec_kW.size(); i++) {
+        DieselInputs diesel_inputs;
+        diesel_inputs.combustion_inputs.production_inputs.capacity_kW =
+            capacity_vec_kW[i];
+        
+        combustion_ptr_vec.push_back(
+            new Diesel(
+                electrical_load_ptr->n_points,
+                electrical_load_ptr->n_years,
+                diesel_inputs,
+                &(electrical_load_ptr->time_vec_hrs)
+            )
+        );
+    }
+    
+    return combustion_ptr_vec;
+}   /* getTestFleet_Controller() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::map<double, std::vector<bool>> getBruteForceCombustionMap_Controller(
+///         std::vector<Combustion*>* combustion_ptr_vec_ptr
+///     )
+///
+/// \brief A function to construct a Combustion map by enumerating every one of the
+///     2^n operating states (on/off) of the given fleet, keeping only states with the
+///     minimum number of assets running. This is the reference against which the
+///     Controller Combustion map is checked.
+///
+/// \param combustion_ptr_vec_ptr A pointer to a vector of Combustion pointers.
+///
+/// \return The reference Combustion map.
+///
+
+std::map<double, std::vector<bool>> getBruteForceCombustionMap_Controller(
+    std::vector<Combustion*>* combustion_ptr_vec_ptr
+)
+{
+    std::map<double, std::vector<bool>> combustion_map;
+    
+    unsigned int n_cols = combustion_ptr_vec_ptr->size();
+    unsigned long int n_rows = pow(2, n_cols);
+    
+    for (unsigned long int row = 0; row < n_rows; row++) {
+        std::vector<bool> state_vec(n_cols, false);
+        
+        unsigned int asset_count = 0;
+        unsigned long int x = row;
+        double total_capacity_kW = 0;
+        
+        for (unsigned int i = 0; i < n_cols; i++) {
+            if (x <= 0) {
+                break;
+            }
+            
+            if (x % 2 != 0) {
+                state_vec[i] = true;
+                total_capacity_kW += combustion_ptr_vec_ptr->at(i)->capacity_kW;
+                asset_count++;
+            }
+            
+            x /= 2;
+        }
+        
+        if (combustion_map.count(total_capacity_kW) == 0) {
+            combustion_map[total_capacity_kW] = state_vec;
+        }
+        
+        else {
+            unsigned int incumbent_asset_count = 0;
+            
+            for (unsigned int i = 0; i < n_cols; i++) {
+                if (combustion_map[total_capacity_kW][i]) {
+                    incumbent_asset_count++;
+                }
+            }
+            
+            if (asset_count < incumbent_asset_count) {
+                combustion_map[total_capacity_kW] = state_vec;
+            }
+        }
+    }
+    
+    return combustion_map;
+}   /* getBruteForceCombustionMap_Controller() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testCombustionMap_Controller(
+///         Controller* test_controller_ptr,
+///         ElectricalLoad* test_electrical_load_ptr
+///     )
+///
+/// \brief Function to check that the Combustion map constructed on Controller::init()
+///     agrees exactly (capacities and operating states) with brute force enumeration,
+///     for an assortment of small fleets.
+///
+/// \param test_controller_ptr A pointer to the test Controller object.
+///
+/// \param test_electrical_load_ptr A pointer to the test ElectricalLoad object.
+///
+
+void testCombustionMap_Controller(
+    Controller* test_controller_ptr,
+    ElectricalLoad* test_electrical_load_ptr
+)
+{
+    Resources test_resources;
+    std::vector<Renewable*> test_renewable_ptr_vec;
+    
+    std::vector<std::vector<double>> test_capacity_vec_vec_kW = {
+        {},
+        {100},
+        {100, 150, 250},
+        {100, 150, 250, 100, 100},
+        {300, 100, 200, 200},
+        {100, 200, 150, 150},
+        {250, 250, 250, 250, 500, 500, 1000, 1000}
+    };
+    
+    //  random fleets (some drawn from a few distinct capacities, some arbitrary)
+    for (int i = 0; i < 4; i++) {
+        std::vector<double> capacity_vec_kW;
+        int n_assets = 1 + rand() % 12;
+        
+        for (int j = 0; j < n_assets; j++) {
+            if (i % 2 == 0) {
+                capacity_vec_kW.push_back(100 * (1 + rand() % 4));
+            }
+            
+            else {
+                capacity_vec_kW.push_back(50 + 500 * ((double)rand() / RAND_MAX));
+            }
+        }
+        
+        test_capacity_vec_vec_kW.push_back(capacity_vec_kW);
+    }
+    
+    for (size_t i = 0; i < test_capacity_vec_vec_kW.size(); i++) {
+        std::vector<Combustion*> test_combustion_ptr_vec = getTestFleet_Controller(
+            test_electrical_load_ptr,
+            test_capacity_vec_vec_kW[i]
+        );
+        
+        test_controller_ptr->clear();
+        test_controller_ptr->init(
+            test_electrical_load_ptr,
+            &test_renewable_ptr_vec,
+            &test_resources,
+            &test_combustion_ptr_vec
+        );
+        
+        std::map<double, std::vector<bool>> expected_combustion_map =
+            getBruteForceCombustionMap_Controller(&test_combustion_ptr_vec);
+        
+        testFloatEquals(
+            test_controller_ptr->combustion_map_resolution_kW,
+            0,
+            __FILE__,
+            __LINE__
+        );
+        
+        testTruth(
+            test_controller_ptr->combustion_map == expected_combustion_map,
+            __FILE__,
+            __LINE__
+        );
+        
+        for (size_t j = 0; j < test_combustion_ptr_vec.size(); j++) {
+            delete test_combustion_ptr_vec[j];
+        }
+    }
+    
+    test_controller_ptr->clear();
+    
+    return;
+}   /* testCombustionMap_Controller() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testLargeCombustionMap_Controller(
+///         Controller* test_controller_ptr,
+///         ElectricalLoad* test_electrical_load_ptr
+///     )
+///
+/// \brief Function to check that the Combustion map remains bounded, and consistent,
+///     for fleets far too large to enumerate (40 assets).
+///
+/// \param test_controller_ptr A pointer to the test Controller object.
+///
+/// \param test_electrical_load_ptr A pointer to the test ElectricalLoad object.
+///
+
+void testLargeCombustionMap_Controller(
+    Controller* test_controller_ptr,
+    ElectricalLoad* test_electrical_load_ptr
+)
+{
+    Resources test_resources;
+    std::vector<Renewable*> test_renewable_ptr_vec;
+    
+    //  1. 40 assets of a few distinct capacities (resolved exactly)
+    std::vector<double> capacity_vec_kW;
+    
+    for (int i = 0; i < 40; i++) {
+        capacity_vec_kW.push_back(250 * (1 + i % 3));
+    }
+    
+    std::vector<Combustion*> test_combustion_ptr_vec = getTestFleet_Controller(
+        test_electrical_load_ptr,
+        capacity_vec_kW
+    );
+    
+    test_controller_ptr->clear();
+    test_controller_ptr->init(
+        test_electrical_load_ptr,
+        &test_renewable_ptr_vec,
+        &test_resources,
+        &test_combustion_ptr_vec
+    );
+    
+    testFloatEquals(
+        test_controller_ptr->combustion_map_resolution_kW,
+        0,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  every multiple of 250 kW up to 19,750 kW is attainable
+    testFloatEquals(
+        test_controller_ptr->combustion_map.size(),
+        80,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  minimum asset count is attained by running largest assets first
+    std::map<double, std::vector<bool>>::iterator iter;
+    
+    for (
+        iter = test_controller_ptr->combustion_map.begin();
+        iter != test_controller_ptr->combustion_map.end();
+        iter++
+    ) {
+        int n_units = round(iter->first / 250);
+        int expected_asset_count = 0;
+        
+        for (int size = 3; size >= 1; size--) {
+            int n_available = (size == 1) ? 14 : 13;
+            int n_used = std::min(n_units / size, n_available);
+            
+            n_units -= n_used * size;
+            expected_asset_count += n_used;
+        }
+        
+        int asset_count = 0;
+        double total_capacity_kW = 0;
+        
+        for (size_t i = 0; i < iter->second.size(); i++) {
+            if (iter->second[i]) {
+                asset_count++;
+                total_capacity_kW += capacity_vec_kW[i];
+            }
+        }
+        
+        testFloatEquals(total_capacity_kW, iter->first, __FILE__, __LINE__);
+        testFloatEquals(asset_count, expected_asset_count, __FILE__, __LINE__);
+    }
+    
+    for (size_t i = 0; i < test_combustion_ptr_vec.size(); i++) {
+        delete test_combustion_ptr_vec[i];
+    }
+    
+    //  2. 40 assets of arbitrary capacities (binned)
+    capacity_vec_kW.clear();
+    double total_capacity_kW = 0;
+    
+    for (int i = 0; i < 40; i++) {
+        capacity_vec_kW.push_back(50 + 500 * ((double)rand() / RAND_MAX));
+        total_capacity_kW += capacity_vec_kW.back();
+    }
+    
+    test_combustion_ptr_vec = getTestFleet_Controller(
+        test_electrical_load_ptr,
+        capacity_vec_kW
+    );
+    
+    test_controller_ptr->clear();
+    test_controller_ptr->init(
+        test_electrical_load_ptr,
+        &test_renewable_ptr_vec,
+        &test_resources,
+        &test_combustion_ptr_vec
+    );
+    
+    testGreaterThan(
+        test_controller_ptr->combustion_map_resolution_kW,
+        0,
+        __FILE__,
+        __LINE__
+    );
+    
+    testLessThanOrEqualTo(
+        test_controller_ptr->combustion_map.size(),
+        COMBUSTION_MAP_MAX_STATES + 1,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  all-off and all-on states are always retained
+    testFloatEquals(
+        test_controller_ptr->combustion_map.begin()->first,
+        0,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_controller_ptr->combustion_map.rbegin()->first,
+        total_capacity_kW,
+        __FILE__,
+        __LINE__
+    );
+    
+    for (
+        iter = test_controller_ptr->combustion_map.begin();
+        iter != test_controller_ptr->combustion_map.end();
+        iter++
+    ) {
+        double state_capacity_kW = 0;
+        
+        for (size_t i = 0; i < iter->second.size(); i++) {
+            if (iter->second[i]) {
+                state_capacity_kW += capacity_vec_kW[i];
+            }
+        }
+        
+        testFloatEquals(state_capacity_kW, iter->first, __FILE__, __LINE__);
+    }
+    
+    for (size_t i = 0; i < test_combustion_ptr_vec.size(); i++) {
+        delete test_combustion_ptr_vec[i];
+    }
+    
+    test_controller_ptr->clear();
+    
+    return;
+}   /* testLargeCombustionMap_Controller() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testCombustionTable_Controller(
+///         Controller* test_controller_ptr,
+///         ElectricalLoad* test_electrical_load_ptr
+///     )
+///
+/// \brief Function to check that the flat Combustion table (sorted capacities and
+///     packed state matrix) frozen on Controller::init() agrees with the Combustion
+///     map, for a fleet requiring more than one 64-bit word per row.
+///
+/// \param test_controller_ptr A pointer to the test Controller object.
+///
+/// \param test_electrical_load_ptr A pointer to the test ElectricalLoad object.
+///
+
+void testCombustionTable_Controller(
+    Controller* test_controller_ptr,
+    ElectricalLoad* test_electrical_load_ptr
+)
+{
+    Resources test_resources;
+    std::vector<Renewable*> test_renewable_ptr_vec;
+    
+    std::vector<double> capacity_vec_kW;
+    
+    for (int i = 0; i < 70; i++) {
+        capacity_vec_kW.push_back(100 * (1 + i % 3));
+    }
+    
+    std::vector<Combustion*> test_combustion_ptr_vec = getTestFleet_Controller(
+        test_electrical_load_ptr,
+        capacity_vec_kW
+    );
+    
+    test_controller_ptr->clear();
+    test_controller_ptr->init(
+        test_electrical_load_ptr,
+        &test_renewable_ptr_vec,
+        &test_resources,
+        &test_combustion_ptr_vec
+    );
+    
+    size_t n_words = test_controller_ptr->n_combustion_table_words;
+    
+    testTruth(n_words == 2, __FILE__, __LINE__);
+    
+    testTruth(
+        test_controller_ptr->combustion_table_capacity_vec_kW.size() ==
+            test_controller_ptr->combustion_map.size(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        test_controller_ptr->combustion_table_state_vec.size() ==
+            n_words * test_controller_ptr->combustion_map.size(),
+        __FILE__,
+        __LINE__
+    );
+    
+    size_t row = 0;
+    
+    for (
+        std::map<double, std::vector<bool>>::iterator iter =
+            test_controller_ptr->combustion_map.begin();
+        iter != test_controller_ptr->combustion_map.end();
+        iter++
+    ) {
+        testFloatEquals(
+            test_controller_ptr->combustion_table_capacity_vec_kW[row],
+            iter->first,
+            __FILE__,
+            __LINE__
+        );
+        
+        for (size_t i = 0; i < iter->second.size(); i++) {
+            bool is_running = (
+                test_controller_ptr->combustion_table_state_vec[
+                    row * n_words + i / 64
+                ] >> (i % 64)
+            ) & uint64_t(1);
+            
+            testTruth(is_running == iter->second[i], __FILE__, __LINE__);
+        }
+        
+        row++;
+    }
+    
+    for (size_t i = 0; i < test_combustion_ptr_vec.size(); i++) {
+        delete test_combustion_ptr_vec[i];
+    }
+    
+    test_controller_ptr->clear();
+    
+    testTruth(
+        test_controller_ptr->combustion_table_capacity_vec_kW.empty(),
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testCombustionTable_Controller() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testResourceBinding_Controller(
+///         Controller* test_controller_ptr,
+///         ElectricalLoad* test_electrical_load_ptr
+///     )
+///
+/// \brief Function to check that Controller::init() binds Renewable assets directly to
+///     their resource time series (1D and 2D), that the production computed through
+///     those bindings is as expected, and that an unrecognized resource key is an
+///     error (rather than a silently inserted, empty resource).
+///
+/// \param test_controller_ptr A pointer to the test Controller object.
+///
+/// \param test_electrical_load_ptr A pointer to the test ElectricalLoad object.
+///
+
+void testResourceBinding_Controller(
+    Controller* test_controller_ptr,
+    ElectricalLoad* test_electrical_load_ptr
+)
+{
+    //  1. bind a Wind asset (1D) and a Wave asset (2D)
+    Resources test_resources;
+    
+    int wind_resource_key = 0;
+    int wave_resource_key = 1;
+    
+    test_resources.addResource(
+        RenewableType :: WIND,
+        "data/test/resources/wind_speed_peak-25ms_1yr_dt-1hr.csv",
+        wind_resource_key,
+        test_electrical_load_ptr
+    );
+    
+    test_resources.addResource(
+        RenewableType :: WAVE,
+        "data/test/resources/waves_H_s_peak-8m_T_e_peak-15s_1yr_dt-1hr.csv",
+        wave_resource_key,
+        test_electrical_load_ptr
+    );
+    
+    WindInputs wind_inputs;
+    wind_inputs.resource_key = wind_resource_key;
+    
+    WaveInputs wave_inputs;
+    wave_inputs.resource_key = wave_resource_key;
+    
+    std::vector<Renewable*> test_renewable_ptr_vec = {
+        new Wind(
+            test_electrical_load_ptr->n_points,
+            1,
+            wind_inputs,
+            &(test_electrical_load_ptr->time_vec_hrs)
+        ),
+        new Wave(
+            test_electrical_load_ptr->n_points,
+            1,
+            wave_inputs,
+            &(test_electrical_load_ptr->time_vec_hrs)
+        )
+    };
+    
+    std::vector<Combustion*> test_combustion_ptr_vec;
+    
+    test_controller_ptr->clear();
+    test_controller_ptr->init(
+        test_electrical_load_ptr,
+        &test_renewable_ptr_vec,
+        &test_resources,
+        &test_combustion_ptr_vec
+    );
+    
+    testTruth(
+        test_controller_ptr->renewable_resource_binding_vec.size() == 2,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        test_controller_ptr->renewable_resource_binding_vec[0].resource_span.begin() ==
+            test_resources.resource_map_1D[wind_resource_key].data(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        test_controller_ptr->renewable_resource_binding_vec[1].resource_span.begin() ==
+            test_resources.resource_map_2D[wave_resource_key].channel_vec[0].data(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        test_controller_ptr->renewable_resource_binding_vec[1].resource_span_2D.begin() ==
+            test_resources.resource_map_2D[wave_resource_key].channel_vec[1].data(),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  2. check production computed through bindings
+    for (int i = 0; i < test_electrical_load_ptr->n_points; i += 97) {
+        double dt_hrs = test_electrical_load_ptr->dt_vec_hrs[i];
+        
+        testFloatEquals(
+            test_renewable_ptr_vec[0]->production_vec_kW[i],
+            test_renewable_ptr_vec[0]->computeProductionkW(
+                i,
+                dt_hrs,
+                test_resources.resource_map_1D[wind_resource_key][i]
+            ),
+            __FILE__,
+            __LINE__
+        );
+        
+        testFloatEquals(
+            test_renewable_ptr_vec[1]->production_vec_kW[i],
+            test_renewable_ptr_vec[1]->computeProductionkW(
+                i,
+                dt_hrs,
+                test_resources.resource_map_2D[wave_resource_key][i][0],
+                test_resources.resource_map_2D[wave_resource_key][i][1]
+            ),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  3. unrecognized resource key
+    test_renewable_ptr_vec[0]->resource_key = 99;
+    
+    try {
+        test_controller_ptr->clear();
+        test_controller_ptr->init(
+            test_electrical_load_ptr,
+            &test_renewable_ptr_vec,
+            &test_resources,
+            &test_combustion_ptr_vec
+        );
+        
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    catch (std::invalid_argument& e) {
+        // Task failed successfully! =P
+    }
+    
+    testTruth(
+        test_resources.resource_map_1D.count(99) == 0,
+        __FILE__,
+        __LINE__
+    );
+    
+    for (size_t i = 0; i < test_renewable_ptr_vec.size(); i++) {
+        delete test_renewable_ptr_vec[i];
+    }
+    
+    test_controller_ptr->clear();
+    
+    testTruth(
+        test_controller_ptr->renewable_resource_binding_vec.empty(),
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testResourceBinding_Controller() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testParallelProduction_Controller(
+///         Controller* test_controller_ptr,
+///         ElectricalLoad* test_electrical_load_ptr
+///     )
+///
+/// \brief Function to check that computing Renewable production (and net load) on
+///     init() over several threads gives exactly the same results as doing so on one
+///     thread.
+///
+/// \param test_controller_ptr A pointer to the test Controller object.
+///
+/// \param test_electrical_load_ptr A pointer to the test ElectricalLoad object.
+///
+
+void testParallelProduction_Controller(
+    Controller* test_controller_ptr,
+    ElectricalLoad* test_electrical_load_ptr
+)
+{
+    //  1. set up a mixed fleet of Solar, Wave, and Wind assets
+    Resources test_resources;
+    
+    int solar_resource_key = 0;
+    int wave_resource_key = 1;
+    int wind_resource_key = 2;
+    
+    test_resources.addResource(
+        RenewableType :: SOLAR,
+        "data/test/resources/solar_GHI_peak-1kWm2_1yr_dt-1hr.csv",
+        solar_resource_key,
+        test_electrical_load_ptr
+    );
+    
+    test_resources.addResource(
+        RenewableType :: WAVE,
+        "data/test/resources/waves_H_s_peak-8m_T_e_peak-15s_1yr_dt-1hr.csv",
+        wave_resource_key,
+        test_electrical_load_ptr
+    );
+    
+    test_resources.addResource(
+        RenewableType :: WIND,
+        "data/test/resources/wind_speed_peak-25ms_1yr_dt-1hr.csv",
+        wind_resource_key,
+        test_electrical_load_ptr
+    );
+    
+    std::vector<Renewable*> test_renewable_ptr_vec;
+    
+    for (int i = 0; i < 4; i++) {
+        SolarInputs solar_inputs;
+        solar_inputs.resource_key = solar_resource_key;
+        solar_inputs.panel_azimuth_deg = 90 * i;
+        solar_inputs.power_model = SolarPowerProductionModel(
+            i % N_SOLAR_POWER_PRODUCTION_MODELS
+        );
+        
+        test_renewable_ptr_vec.push_back(
+            new Solar(
+                test_electrical_load_ptr->n_points,
+                1,
+                solar_inputs,
+                &(test_electrical_load_ptr->time_vec_hrs)
+            )
+        );
+        
+        WaveInputs wave_inputs;
+        wave_inputs.resource_key = wave_resource_key;
+        wave_inputs.power_model = (i % 2 == 0) ?
+            WavePowerProductionModel :: WAVE_POWER_GAUSSIAN :
+            WavePowerProductionModel :: WAVE_POWER_PARABOLOID;
+        
+        test_renewable_ptr_vec.push_back(
+            new Wave(
+                test_electrical_load_ptr->n_points,
+                1,
+                wave_inputs,
+                &(test_electrical_load_ptr->time_vec_hrs)
+            )
+        );
+        
+        WindInputs wind_inputs;
+        wind_inputs.resource_key = wind_resource_key;
+        wind_inputs.renewable_inputs.production_inputs.capacity_kW = 100 * (i + 1);
+        
+        test_renewable_ptr_vec.push_back(
+            new Wind(
+                test_electrical_load_ptr->n_points,
+                1,
+                wind_inputs,
+                &(test_electrical_load_ptr->time_vec_hrs)
+            )
+        );
+    }
+    
+    std::vector<Combustion*> test_combustion_ptr_vec;
+    
+    //  2. compute production on one thread
+    test_controller_ptr->clear();
+    test_controller_ptr->setNThreads(1);
+    test_controller_ptr->init(
+        test_electrical_load_ptr,
+        &test_renewable_ptr_vec,
+        &test_resources,
+        &test_combustion_ptr_vec
+    );
+    
+    std::vector<double> serial_net_load_vec_kW = test_controller_ptr->net_load_vec_kW;
+    std::vector<std::vector<double>> serial_production_vec_kW;
+    
+    for (size_t i = 0; i < test_renewable_ptr_vec.size(); i++) {
+        std::vector<double>* production_vec_kW_ptr =
+            &(test_renewable_ptr_vec[i]->production_vec_kW);
+        
+        serial_production_vec_kW.push_back(*production_vec_kW_ptr);
+        
+        for (size_t j = 0; j < production_vec_kW_ptr->size(); j++) {
+            (*production_vec_kW_ptr)[j] = 0;
+        }
+    }
+    
+    //  3. compute production on several threads, check results are identical
+    for (int n_threads : {2, 4, 0}) {
+        test_controller_ptr->clear();
+        test_controller_ptr->setNThreads(n_threads);
+        test_controller_ptr->init(
+            test_electrical_load_ptr,
+            &test_renewable_ptr_vec,
+            &test_resources,
+            &test_combustion_ptr_vec
+        );
+        
+        testTruth(
+            test_controller_ptr->net_load_vec_kW == serial_net_load_vec_kW,
+            __FILE__,
+            __LINE__
+        );
+        
+        for (size_t i = 0; i < test_renewable_ptr_vec.size(); i++) {
+            testTruth(
+                test_renewable_ptr_vec[i]->production_vec_kW ==
+                    serial_production_vec_kW[i],
+                __FILE__,
+                __LINE__
+            );
+        }
+    }
+    
+    for (size_t i = 0; i < test_renewable_ptr_vec.size(); i++) {
+        delete test_renewable_ptr_vec[i];
+    }
+    
+    test_controller_ptr->clear();
+    test_controller_ptr->setNThreads(1);
+    
+    return;
+}   /* testParallelProduction_Controller() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 int main(int argc, char** argv)
@@ -87,10 +936,18 @@ int main(int argc, char** argv)
 
 
     Controller* test_controller_ptr = testConstruct_Controller();
+    
+    ElectricalLoad test_electrical_load(
+        "data/test/electrical_load/electrical_load_generic_peak-500kW_1yr_dt-1hr.csv"
+    );
 
 
     try {
-        //...
+        testCombustionMap_Controller(test_controller_ptr, &test_electrical_load);
+        testLargeCombustionMap_Controller(test_controller_ptr, &test_electrical_load);
+        testCombustionTable_Controller(test_controller_ptr, &test_electrical_load);
+        testResourceBinding_Controller(test_controller_ptr, &test_electrical_load);
+        testParallelProduction_Controller(test_controller_ptr, &test_electrical_load);
     }
 
 
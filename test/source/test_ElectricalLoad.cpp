@@ -242,6 +242,160 @@ void testDataRead_ElectricalLoad(ElectricalLoad* test_electrical_load_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testTimeSeriesCache_ElectricalLoad(ElectricalLoad* test_electrical_load_ptr)
+///
+/// \brief A function to check that reading through the time series cache (first from
+///     CSV, then from the binary sidecar) gives exactly the same data, and that stale
+///     or corrupt sidecars are ignored.
+///
+/// \param test_electrical_load_ptr A pointer to the test ElectricalLoad object.
+///
+
+void testTimeSeriesCache_ElectricalLoad(ElectricalLoad* test_electrical_load_ptr)
+{
+    //  1. copy load data to a scratch directory (no existing sidecar)
+    std::string cache_dir = "test/test_results/time_series_cache/";
+    std::string path_2_csv = cache_dir + "electrical_load.csv";
+    
+    std::filesystem::remove_all(cache_dir);
+    std::filesystem::create_directories(cache_dir);
+    std::filesystem::copy_file(
+        test_electrical_load_ptr->path_2_electrical_load_time_series,
+        path_2_csv
+    );
+    
+    ElectricalLoad cached_electrical_load;
+    std::string sidecar_path =
+        cached_electrical_load.time_series_cache.getSidecarPath(path_2_csv);
+    
+    //  2. first read parses CSV and writes sidecar
+    cached_electrical_load.readLoadData(path_2_csv);
+    
+    testTruth(
+        not cached_electrical_load.time_series_cache.last_read_from_cache,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(std::filesystem::exists(sidecar_path), __FILE__, __LINE__);
+    
+    //  3. second read is served from sidecar, and is bit-for-bit the same
+    cached_electrical_load.readLoadData(path_2_csv);
+    
+    testTruth(
+        cached_electrical_load.time_series_cache.last_read_from_cache,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        cached_electrical_load.n_points == test_electrical_load_ptr->n_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        cached_electrical_load.time_vec_hrs == test_electrical_load_ptr->time_vec_hrs,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        cached_electrical_load.load_vec_kW == test_electrical_load_ptr->load_vec_kW,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        cached_electrical_load.dt_vec_hrs == test_electrical_load_ptr->dt_vec_hrs,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        cached_electrical_load.mean_load_kW,
+        test_electrical_load_ptr->mean_load_kW,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        cached_electrical_load.max_load_kW,
+        test_electrical_load_ptr->max_load_kW,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  4. corrupt sidecar data, check it is ignored (and rewritten)
+    std::fstream sidecar(sidecar_path, std::ios::in | std::ios::out | std::ios::binary);
+    sidecar.seekp(-1, std::ios::end);
+    sidecar.put('\x7f');
+    sidecar.close();
+    
+    cached_electrical_load.readLoadData(path_2_csv);
+    
+    testTruth(
+        not cached_electrical_load.time_series_cache.last_read_from_cache,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        cached_electrical_load.load_vec_kW == test_electrical_load_ptr->load_vec_kW,
+        __FILE__,
+        __LINE__
+    );
+    
+    cached_electrical_load.readLoadData(path_2_csv);
+    
+    testTruth(
+        cached_electrical_load.time_series_cache.last_read_from_cache,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  5. touch source CSV, check stale sidecar is ignored
+    std::filesystem::last_write_time(
+        path_2_csv,
+        std::filesystem::last_write_time(path_2_csv) + std::chrono::seconds(1)
+    );
+    
+    cached_electrical_load.readLoadData(path_2_csv);
+    
+    testTruth(
+        not cached_electrical_load.time_series_cache.last_read_from_cache,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  6. check disabled cache always parses CSV
+    cached_electrical_load.time_series_cache.enabled = false;
+    cached_electrical_load.readLoadData(path_2_csv);
+    
+    testTruth(
+        not cached_electrical_load.time_series_cache.last_read_from_cache,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        cached_electrical_load.load_vec_kW == test_electrical_load_ptr->load_vec_kW,
+        __FILE__,
+        __LINE__
+    );
+    
+    std::filesystem::remove_all(cache_dir);
+    
+    return;
+}   /* testTimeSeriesCache_ElectricalLoad() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 int main(int argc, char** argv)
@@ -265,6 +419,7 @@ int main(int argc, char** argv)
     try {
         testPostConstructionAttributes_ElectricalLoad(test_electrical_load_ptr);
         testDataRead_ElectricalLoad(test_electrical_load_ptr);
+        testTimeSeriesCache_ElectricalLoad(test_electrical_load_ptr);
     }
 
 
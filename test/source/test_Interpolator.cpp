@@ -46,6 +46,7 @@
 
 #include "../utils/testing_utils.h"
 #include "../../header/Interpolator.h"
+#include "../../header/InterpolatorTableCache.h"
 
 
 // ---------------------------------------------------------------------------------- //
@@ -102,14 +103,14 @@ void testDataRead1D_Interpolator(
     );
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_1D[data_key_1D].n_points,
+        test_interpolator_ptr->interp_map_1D[data_key_1D]->n_points,
         16,
         __FILE__,
         __LINE__
     );
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_1D[data_key_1D].x_vec.size(),
+        test_interpolator_ptr->interp_map_1D[data_key_1D]->x_vec.size(),
         16,
         __FILE__,
         __LINE__
@@ -153,16 +154,16 @@ void testDataRead1D_Interpolator(
         27.254952
     };
 
-    for (int i = 0; i < test_interpolator_ptr->interp_map_1D[data_key_1D].n_points; i++) {
+    for (int i = 0; i < test_interpolator_ptr->interp_map_1D[data_key_1D]->n_points; i++) {
         testFloatEquals(
-            test_interpolator_ptr->interp_map_1D[data_key_1D].x_vec[i],
+            test_interpolator_ptr->interp_map_1D[data_key_1D]->x_vec[i],
             expected_x_vec[i],
             __FILE__,
             __LINE__
         );
         
         testFloatEquals(
-            test_interpolator_ptr->interp_map_1D[data_key_1D].y_vec[i],
+            test_interpolator_ptr->interp_map_1D[data_key_1D]->y_vec[i],
             expected_y_vec[i],
             __FILE__,
             __LINE__
@@ -170,14 +171,14 @@ void testDataRead1D_Interpolator(
     }
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_1D[data_key_1D].min_x,
+        test_interpolator_ptr->interp_map_1D[data_key_1D]->min_x,
         expected_x_vec[0],
         __FILE__,
         __LINE__
     );
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_1D[data_key_1D].max_x,
+        test_interpolator_ptr->interp_map_1D[data_key_1D]->max_x,
         expected_x_vec[expected_x_vec.size() - 1],
         __FILE__,
         __LINE__
@@ -409,43 +410,36 @@ void testDataRead2D_Interpolator(
     );
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_2D[data_key_2D].n_rows,
+        test_interpolator_ptr->interp_map_2D[data_key_2D]->n_rows,
         16,
         __FILE__,
         __LINE__
     );
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_2D[data_key_2D].n_cols,
+        test_interpolator_ptr->interp_map_2D[data_key_2D]->n_cols,
         16,
         __FILE__,
         __LINE__
     );
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_2D[data_key_2D].x_vec.size(),
+        test_interpolator_ptr->interp_map_2D[data_key_2D]->x_vec.size(),
         16,
         __FILE__,
         __LINE__
     );
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_2D[data_key_2D].y_vec.size(),
+        test_interpolator_ptr->interp_map_2D[data_key_2D]->y_vec.size(),
         16,
         __FILE__,
         __LINE__
     );
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_2D[data_key_2D].z_matrix.size(),
-        16,
-        __FILE__,
-        __LINE__
-    );
-
-    testFloatEquals(
-        test_interpolator_ptr->interp_map_2D[data_key_2D].z_matrix[0].size(),
-        16,
+        test_interpolator_ptr->interp_map_2D[data_key_2D]->z_vec.size(),
+        16 * 16,
         __FILE__,
         __LINE__
     );
@@ -473,18 +467,18 @@ void testDataRead2D_Interpolator(
         20
     };
 
-    for (int i = 0; i < test_interpolator_ptr->interp_map_2D[data_key_2D].n_cols; i++) {
+    for (int i = 0; i < test_interpolator_ptr->interp_map_2D[data_key_2D]->n_cols; i++) {
         testFloatEquals(
-            test_interpolator_ptr->interp_map_2D[data_key_2D].x_vec[i],
+            test_interpolator_ptr->interp_map_2D[data_key_2D]->x_vec[i],
             expected_x_vec[i],
             __FILE__,
             __LINE__
         );
     }
 
-    for (int i = 0; i < test_interpolator_ptr->interp_map_2D[data_key_2D].n_rows; i++) {
+    for (int i = 0; i < test_interpolator_ptr->interp_map_2D[data_key_2D]->n_rows; i++) {
         testFloatEquals(
-            test_interpolator_ptr->interp_map_2D[data_key_2D].y_vec[i],
+            test_interpolator_ptr->interp_map_2D[data_key_2D]->y_vec[i],
             expected_y_vec[i],
             __FILE__,
             __LINE__
@@ -492,28 +486,28 @@ void testDataRead2D_Interpolator(
     }
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_2D[data_key_2D].min_x,
+        test_interpolator_ptr->interp_map_2D[data_key_2D]->min_x,
         expected_x_vec[0],
         __FILE__,
         __LINE__
     );
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_2D[data_key_2D].max_x,
+        test_interpolator_ptr->interp_map_2D[data_key_2D]->max_x,
         expected_x_vec[expected_x_vec.size() - 1],
         __FILE__,
         __LINE__
     );
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_2D[data_key_2D].min_y,
+        test_interpolator_ptr->interp_map_2D[data_key_2D]->min_y,
         expected_y_vec[0],
         __FILE__,
         __LINE__
     );
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_2D[data_key_2D].max_y,
+        test_interpolator_ptr->interp_map_2D[data_key_2D]->max_y,
         expected_y_vec[expected_y_vec.size() - 1],
         __FILE__,
         __LINE__
@@ -538,10 +532,12 @@ void testDataRead2D_Interpolator(
         {0, 0, 0, 0.0997625, 0.1998625, 0.2888625, 0.3667625, 0.4335625, 0.4892625, 0.5338625, 0.5673625, 0.5897625, 0.6010625, 0.6012625, 0.5903625, 0.5683625}
     };
 
-    for (int i = 0; i < test_interpolator_ptr->interp_map_2D[data_key_2D].n_rows; i++) {
-        for (int j = 0; j < test_interpolator_ptr->interp_map_2D[data_key_2D].n_cols; j++) {
+    for (int i = 0; i < test_interpolator_ptr->interp_map_2D[data_key_2D]->n_rows; i++) {
+        for (int j = 0; j < test_interpolator_ptr->interp_map_2D[data_key_2D]->n_cols; j++) {
             testFloatEquals(
-                test_interpolator_ptr->interp_map_2D[data_key_2D].z_matrix[i][j],
+                test_interpolator_ptr->interp_map_2D[data_key_2D]->z_vec[
+                    i * test_interpolator_ptr->interp_map_2D[data_key_2D]->n_cols + j
+                ],
                 expected_z_matrix[i][j],
                 __FILE__,
                 __LINE__
@@ -719,6 +715,861 @@ void testInterpolation2D_Interpolator(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double referenceInterp1D(const InterpolatorStruct1D* interp_struct_1D_ptr, double x)
+///
+/// \brief Function to perform a reference 1D interpolation, finding the interpolation
+///     index by linear scan (as Interpolator did originally).
+///
+/// \param interp_struct_1D_ptr A pointer to the 1D interpolation data.
+///
+/// \param x The query value.
+///
+/// \return An interpolation of the given query value.
+///
+
+double referenceInterp1D(const InterpolatorStruct1D* interp_struct_1D_ptr, double x)
+{
+    const std::vector<double>& x_vec = interp_struct_1D_ptr->x_vec;
+    const std::vector<double>& y_vec = interp_struct_1D_ptr->y_vec;
+    
+    int idx = 0;
+    while (not (x >= x_vec[idx] and x <= x_vec[idx + 1])) {
+        idx++;
+    }
+    
+    return ((y_vec[idx + 1] - y_vec[idx]) / (x_vec[idx + 1] - x_vec[idx])) *
+        (x - x_vec[idx]) + y_vec[idx];
+}   /* referenceInterp1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double referenceInterp2D(
+///         const InterpolatorStruct2D* interp_struct_2D_ptr,
+///         double x,
+///         double y
+///     )
+///
+/// \brief Function to perform a reference 2D interpolation, finding the interpolation
+///     indices by linear scan (as Interpolator did originally).
+///
+/// \param interp_struct_2D_ptr A pointer to the 2D interpolation data.
+///
+/// \param x The first query value.
+///
+/// \param y The second query value.
+///
+/// \return An interpolation of the given query values.
+///
+
+double referenceInterp2D(
+    const InterpolatorStruct2D* interp_struct_2D_ptr,
+    double x,
+    double y
+)
+{
+    const std::vector<double>& x_vec = interp_struct_2D_ptr->x_vec;
+    const std::vector<double>& y_vec = interp_struct_2D_ptr->y_vec;
+    const std::vector<double>& z_vec = interp_struct_2D_ptr->z_vec;
+    int n_cols = interp_struct_2D_ptr->n_cols;
+    
+    int idx_x = 0;
+    while (not (x >= x_vec[idx_x] and x <= x_vec[idx_x + 1])) {
+        idx_x++;
+    }
+    
+    int idx_y = 0;
+    while (not (y >= y_vec[idx_y] and y <= y_vec[idx_y + 1])) {
+        idx_y++;
+    }
+    
+    double x_0 = x_vec[idx_x];
+    double x_1 = x_vec[idx_x + 1];
+    
+    double z_0 = z_vec[idx_y * n_cols + idx_x];
+    double z_1 = z_vec[idx_y * n_cols + idx_x + 1];
+    double interp_z_0 = ((z_1 - z_0) / (x_1 - x_0)) * (x - x_0) + z_0;
+    
+    z_0 = z_vec[(idx_y + 1) * n_cols + idx_x];
+    z_1 = z_vec[(idx_y + 1) * n_cols + idx_x + 1];
+    double interp_z_1 = ((z_1 - z_0) / (x_1 - x_0)) * (x - x_0) + z_0;
+    
+    double y_0 = y_vec[idx_y];
+    double y_1 = y_vec[idx_y + 1];
+    
+    return ((interp_z_1 - interp_z_0) / (y_1 - y_0)) * (y - y_0) + interp_z_0;
+}   /* referenceInterp2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::vector<double> getQueryVec(const std::vector<double>* x_vec_ptr, int n_random)
+///
+/// \brief Function to generate a vector of interpolation queries over the domain of the
+///     given axis: every grid point, a random sample, and then a fine increasing and
+///     decreasing sweep (mimicking temporally correlated queries).
+///
+/// \param x_vec_ptr A pointer to the given axis.
+///
+/// \param n_random The number of random queries.
+///
+/// \return A vector of interpolation queries.
+///
+
+std::vector<double> getQueryVec(const std::vector<double>* x_vec_ptr, int n_random)
+{
+    double min_x = x_vec_ptr->front();
+    double max_x = x_vec_ptr->back();
+    
+    std::vector<double> query_vec = *x_vec_ptr;
+    
+    for (int i = 0; i < n_random; i++) {
+        query_vec.push_back(min_x + (max_x - min_x) * ((double)rand() / RAND_MAX));
+    }
+    
+    int n_sweep = 1000;
+    
+    for (int i = 0; i <= n_sweep; i++) {
+        query_vec.push_back(min_x + (max_x - min_x) * ((double)i / n_sweep));
+    }
+    
+    for (int i = n_sweep; i >= 0; i--) {
+        query_vec.push_back(min_x + (max_x - min_x) * ((double)i / n_sweep));
+    }
+    
+    return query_vec;
+}   /* getQueryVec() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testIndexSearch_Interpolator(
+///         Interpolator* test_interpolator_ptr,
+///         int data_key_1D,
+///         int data_key_2D
+///     )
+///
+/// \brief Function to check that the O(1) (uniform axis) and hinted binary (non-uniform
+///     axis) index searches give bit-for-bit the same interpolations as a linear scan,
+///     including at grid points and on a uniform axis prone to rounding.
+///
+/// \param test_interpolator_ptr A pointer to the test Interpolator object.
+///
+/// \param data_key_1D A key used to index into the Interpolator object (non-uniform).
+///
+/// \param data_key_2D A key used to index into the Interpolator object (uniform).
+///
+
+void testIndexSearch_Interpolator(
+    Interpolator* test_interpolator_ptr,
+    int data_key_1D,
+    int data_key_2D
+)
+{
+    //  1. check axis properties
+    const InterpolatorStruct1D* interp_struct_1D_ptr =
+        test_interpolator_ptr->interp_map_1D[data_key_1D].get();
+    const InterpolatorStruct2D* interp_struct_2D_ptr =
+        test_interpolator_ptr->interp_map_2D[data_key_2D].get();
+    
+    testTruth(interp_struct_1D_ptr->x_axis.is_increasing, __FILE__, __LINE__);
+    testTruth(not interp_struct_1D_ptr->x_axis.is_uniform, __FILE__, __LINE__);
+    
+    testTruth(interp_struct_2D_ptr->x_axis.is_uniform, __FILE__, __LINE__);
+    testTruth(interp_struct_2D_ptr->y_axis.is_uniform, __FILE__, __LINE__);
+    
+    //  2. non-uniform 1D (hinted binary search)
+    std::vector<double> query_vec = getQueryVec(&(interp_struct_1D_ptr->x_vec), 1000);
+    
+    for (size_t i = 0; i < query_vec.size(); i++) {
+        testTruth(
+            test_interpolator_ptr->interp1D(data_key_1D, query_vec[i]) ==
+                referenceInterp1D(interp_struct_1D_ptr, query_vec[i]),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  3. uniform 1D, with rounding-prone spacing (0, 0.1, 0.2, ...)
+    std::string path_2_data = "test/test_results/interpolation/uniform_curve.csv";
+    std::filesystem::create_directories("test/test_results/interpolation/");
+    
+    std::ofstream ofs;
+    ofs.open(path_2_data, std::ofstream::out);
+    ofs << std::setprecision(17) << "x,y,||,Notes\n";
+    
+    for (int i = 0; i <= 100; i++) {
+        ofs << 0.1 * i << "," << sin(0.1 * i) << ",||,\n";
+    }
+    
+    ofs.close();
+    
+    int data_key_uniform = 3;
+    test_interpolator_ptr->addData1D(data_key_uniform, path_2_data);
+    
+    const InterpolatorStruct1D* uniform_struct_ptr =
+        test_interpolator_ptr->interp_map_1D[data_key_uniform].get();
+    
+    testTruth(uniform_struct_ptr->x_axis.is_uniform, __FILE__, __LINE__);
+    
+    query_vec = getQueryVec(&(uniform_struct_ptr->x_vec), 1000);
+    
+    for (size_t i = 0; i < query_vec.size(); i++) {
+        testTruth(
+            test_interpolator_ptr->interp1D(data_key_uniform, query_vec[i]) ==
+                referenceInterp1D(uniform_struct_ptr, query_vec[i]),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    std::filesystem::remove(path_2_data);
+    
+    //  4. uniform 2D
+    std::vector<double> query_x_vec = getQueryVec(&(interp_struct_2D_ptr->x_vec), 100);
+    std::vector<double> query_y_vec = getQueryVec(&(interp_struct_2D_ptr->y_vec), 100);
+    
+    for (size_t i = 0; i < query_y_vec.size(); i += 7) {
+        for (size_t j = 0; j < query_x_vec.size(); j++) {
+            testTruth(
+                test_interpolator_ptr->interp2D(
+                    data_key_2D,
+                    query_x_vec[j],
+                    query_y_vec[i]
+                ) ==
+                    referenceInterp2D(
+                        interp_struct_2D_ptr,
+                        query_x_vec[j],
+                        query_y_vec[i]
+                    ),
+                __FILE__,
+                __LINE__
+            );
+        }
+    }
+    
+    return;
+}   /* testIndexSearch_Interpolator() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testHandles_Interpolator(
+///         Interpolator* test_interpolator_ptr,
+///         int data_key_1D,
+///         int data_key_2D
+///     )
+///
+/// \brief Function to check that interpolation through handles gives bit-for-bit the
+///     same results as interpolation by data key, that bad handles and keys are caught,
+///     and that handles remain valid in (and refer to) a copy of the Interpolator.
+///
+/// \param test_interpolator_ptr A pointer to the test Interpolator object.
+///
+/// \param data_key_1D A key used to index into the Interpolator object.
+///
+/// \param data_key_2D A key used to index into the Interpolator object.
+///
+
+void testHandles_Interpolator(
+    Interpolator* test_interpolator_ptr,
+    int data_key_1D,
+    int data_key_2D
+)
+{
+    //  1. get handles (repeated requests give the same handle)
+    InterpolatorHandle1D handle_1D = test_interpolator_ptr->getHandle1D(data_key_1D);
+    InterpolatorHandle2D handle_2D = test_interpolator_ptr->getHandle2D(data_key_2D);
+    
+    testFloatEquals(
+        test_interpolator_ptr->getHandle1D(data_key_1D).idx,
+        handle_1D.idx,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_interpolator_ptr->getHandle2D(data_key_2D).idx,
+        handle_2D.idx,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  2. handle versus key interpolation
+    const InterpolatorStruct1D* interp_struct_1D_ptr =
+        test_interpolator_ptr->interp_map_1D[data_key_1D].get();
+    const InterpolatorStruct2D* interp_struct_2D_ptr =
+        test_interpolator_ptr->interp_map_2D[data_key_2D].get();
+    
+    std::vector<double> query_vec = getQueryVec(&(interp_struct_1D_ptr->x_vec), 1000);
+    
+    for (size_t i = 0; i < query_vec.size(); i++) {
+        testTruth(
+            test_interpolator_ptr->interp1D(handle_1D, query_vec[i]) ==
+                test_interpolator_ptr->interp1D(data_key_1D, query_vec[i]),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    std::vector<double> query_x_vec = getQueryVec(&(interp_struct_2D_ptr->x_vec), 100);
+    std::vector<double> query_y_vec = getQueryVec(&(interp_struct_2D_ptr->y_vec), 100);
+    
+    for (size_t i = 0; i < query_y_vec.size(); i += 13) {
+        for (size_t j = 0; j < query_x_vec.size(); j++) {
+            testTruth(
+                test_interpolator_ptr->interp2D(
+                    handle_2D,
+                    query_x_vec[j],
+                    query_y_vec[i]
+                ) ==
+                    test_interpolator_ptr->interp2D(
+                        data_key_2D,
+                        query_x_vec[j],
+                        query_y_vec[i]
+                    ),
+                __FILE__,
+                __LINE__
+            );
+        }
+    }
+    
+    //  3. bad handles and keys
+    InterpolatorHandle1D bad_handle_1D;
+    InterpolatorHandle2D bad_handle_2D;
+    bad_handle_2D.idx = 99;
+    
+    bool error_flag = true;
+    
+    try {
+        test_interpolator_ptr->interp1D(bad_handle_1D, 0.5);
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    try {
+        test_interpolator_ptr->interp2D(bad_handle_2D, 0.5, 6);
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    try {
+        test_interpolator_ptr->getHandle1D(-99);
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    try {
+        test_interpolator_ptr->interp1D(handle_1D, 2);
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    //  4. handles remain valid in a copy (which shares the immutable data)
+    Interpolator copy_interpolator(*test_interpolator_ptr);
+    
+    testTruth(
+        copy_interpolator.interp1D(handle_1D, 0.5) ==
+            test_interpolator_ptr->interp1D(handle_1D, 0.5),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        copy_interpolator.interp2D(handle_2D, 0.75, 6) ==
+            test_interpolator_ptr->interp2D(handle_2D, 0.75, 6),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        copy_interpolator.interp_map_1D[data_key_1D].get() ==
+            test_interpolator_ptr->interp_map_1D[data_key_1D].get(),
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testHandles_Interpolator() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testBatch_Interpolator(
+///         Interpolator* test_interpolator_ptr,
+///         int data_key_1D,
+///         int data_key_2D
+///     )
+///
+/// \brief Function to check that batch interpolation gives bit-for-bit the same
+///     results as scalar interpolation (for batch sizes which do and do not fill whole
+///     vector lanes), and that an out-of-domain query in a batch is caught before any
+///     output is written.
+///
+/// \param test_interpolator_ptr A pointer to the test Interpolator object.
+///
+/// \param data_key_1D A key used to index into the Interpolator object.
+///
+/// \param data_key_2D A key used to index into the Interpolator object.
+///
+
+void testBatch_Interpolator(
+    Interpolator* test_interpolator_ptr,
+    int data_key_1D,
+    int data_key_2D
+)
+{
+    const InterpolatorStruct1D* interp_struct_1D_ptr =
+        test_interpolator_ptr->interp_map_1D[data_key_1D].get();
+    const InterpolatorStruct2D* interp_struct_2D_ptr =
+        test_interpolator_ptr->interp_map_2D[data_key_2D].get();
+    
+    //  1. 1D batch versus scalar
+    std::vector<double> query_vec = getQueryVec(&(interp_struct_1D_ptr->x_vec), 1000);
+    std::vector<size_t> n_vec = {0, 1, 3, 4, 5, 7, query_vec.size()};
+    
+    for (size_t k = 0; k < n_vec.size(); k++) {
+        std::vector<double> batch_vec(n_vec[k], -1);
+        
+        test_interpolator_ptr->interp1DBatch(
+            data_key_1D,
+            query_vec.data(),
+            batch_vec.data(),
+            n_vec[k]
+        );
+        
+        for (size_t i = 0; i < n_vec[k]; i++) {
+            testTruth(
+                batch_vec[i] == test_interpolator_ptr->interp1D(data_key_1D, query_vec[i]),
+                __FILE__,
+                __LINE__
+            );
+        }
+    }
+    
+    //  2. 2D batch versus scalar
+    std::vector<double> query_x_vec = getQueryVec(&(interp_struct_2D_ptr->x_vec), 1000);
+    std::vector<double> query_y_vec = getQueryVec(&(interp_struct_2D_ptr->y_vec), 1000);
+    
+    size_t n_2D = std::min(query_x_vec.size(), query_y_vec.size());
+    n_vec = {0, 1, 3, 4, 5, 7, n_2D};
+    
+    for (size_t k = 0; k < n_vec.size(); k++) {
+        std::vector<double> batch_vec(n_vec[k], -1);
+        
+        test_interpolator_ptr->interp2DBatch(
+            test_interpolator_ptr->getHandle2D(data_key_2D),
+            query_x_vec.data(),
+            query_y_vec.data(),
+            batch_vec.data(),
+            n_vec[k]
+        );
+        
+        for (size_t i = 0; i < n_vec[k]; i++) {
+            testTruth(
+                batch_vec[i] ==
+                    test_interpolator_ptr->interp2D(
+                        data_key_2D,
+                        query_x_vec[i],
+                        query_y_vec[i]
+                    ),
+                __FILE__,
+                __LINE__
+            );
+        }
+    }
+    
+    //  3. out-of-domain query in batch
+    std::vector<double> bad_query_vec = {0.1, 0.2, 0.3, 0.4, 0.5, 2, 0.7};
+    std::vector<double> batch_vec(bad_query_vec.size(), -1);
+    
+    bool error_flag = true;
+    
+    try {
+        test_interpolator_ptr->interp1DBatch(
+            data_key_1D,
+            bad_query_vec.data(),
+            batch_vec.data(),
+            bad_query_vec.size()
+        );
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    for (size_t i = 0; i < batch_vec.size(); i++) {
+        testFloatEquals(batch_vec[i], -1, __FILE__, __LINE__);
+    }
+    
+    try {
+        test_interpolator_ptr->interp2DBatch(
+            data_key_2D,
+            query_x_vec.data(),
+            bad_query_vec.data(),
+            batch_vec.data(),
+            bad_query_vec.size()
+        );
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testBatch_Interpolator() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testTableCache_Interpolator(
+///         Interpolator* test_interpolator_ptr,
+///         int data_key_1D,
+///         std::string path_2_data_1D
+///     )
+///
+/// \brief Function to check that Interpolators reading the same (unchanged) file share
+///     a single table (including when constructed concurrently), that an edited file (1D
+///     or 2D) is read again, and that tables are freed once no longer held.
+///
+/// \param test_interpolator_ptr A pointer to the test Interpolator object.
+///
+/// \param data_key_1D A key used to index into the Interpolator object.
+///
+/// \param path_2_data_1D The path to the 1D data read by the test Interpolator object.
+///
+
+void testTableCache_Interpolator(
+    Interpolator* test_interpolator_ptr,
+    int data_key_1D,
+    std::string path_2_data_1D
+)
+{
+    InterpolatorTableCache& table_cache = InterpolatorTableCache :: getInstance();
+    
+    //  1. same file, shared table
+    Interpolator interpolator_a;
+    interpolator_a.addData1D(0, path_2_data_1D);
+    
+    testTruth(
+        interpolator_a.interp_map_1D[0].get() ==
+            test_interpolator_ptr->interp_map_1D[data_key_1D].get(),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  2. same file, read concurrently, shared table
+    std::vector<Interpolator> interpolator_vec(8);
+    std::vector<std::thread> thread_vec;
+    
+    for (size_t i = 0; i < interpolator_vec.size(); i++) {
+        thread_vec.push_back(
+            std::thread(
+                [&interpolator_vec, i, path_2_data_1D]() {
+                    interpolator_vec[i].addData1D(0, path_2_data_1D);
+                }
+            )
+        );
+    }
+    
+    for (size_t i = 0; i < thread_vec.size(); i++) {
+        thread_vec[i].join();
+    }
+    
+    for (size_t i = 0; i < interpolator_vec.size(); i++) {
+        testTruth(
+            interpolator_vec[i].interp_map_1D[0].get() ==
+                interpolator_a.interp_map_1D[0].get(),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  3. edited file, new table
+    std::string path_2_data = "test/test_results/interpolation/edited_curve.csv";
+    std::filesystem::create_directories("test/test_results/interpolation/");
+    
+    std::ofstream ofs;
+    ofs.open(path_2_data, std::ofstream::out);
+    ofs << "x,y,||,Notes\n0,0,||,\n1,1,||,\n";
+    ofs.close();
+    
+    Interpolator interpolator_b;
+    interpolator_b.addData1D(0, path_2_data);
+    
+    ofs.open(path_2_data, std::ofstream::out);
+    ofs << "x,y,||,Notes\n0,0,||,\n1,2,||,\n";
+    ofs.close();
+    
+    Interpolator interpolator_c;
+    interpolator_c.addData1D(0, path_2_data);
+    
+    Interpolator interpolator_d;
+    interpolator_d.addData1D(0, path_2_data);
+    
+    testTruth(
+        interpolator_b.interp_map_1D[0].get() != interpolator_c.interp_map_1D[0].get(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        interpolator_c.interp_map_1D[0].get() == interpolator_d.interp_map_1D[0].get(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(interpolator_b.interp1D(0, 0.5), 0.5, __FILE__, __LINE__);
+    testFloatEquals(interpolator_c.interp1D(0, 0.5), 1, __FILE__, __LINE__);
+    
+    //  4. edited 2D file (same size, one cell changed), new table
+    std::string path_2_data_2D = "test/test_results/interpolation/edited_matrix.csv";
+    
+    ofs.open(path_2_data_2D, std::ofstream::out);
+    ofs << "DATA,DATA,DATA,||,\nDUMMY,0,1,||,\n0,0,0,||,\n1,0,1,||,\n";
+    ofs.close();
+    
+    Interpolator interpolator_e;
+    interpolator_e.addData2D(0, path_2_data_2D);
+    
+    ofs.open(path_2_data_2D, std::ofstream::out);
+    ofs << "DATA,DATA,DATA,||,\nDUMMY,0,1,||,\n0,0,0,||,\n1,0,3,||,\n";
+    ofs.close();
+    
+    Interpolator interpolator_f;
+    interpolator_f.addData2D(0, path_2_data_2D);
+    
+    testTruth(
+        interpolator_e.interp_map_2D[0].get() != interpolator_f.interp_map_2D[0].get(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(interpolator_e.interp2D(0, 1, 1), 1, __FILE__, __LINE__);
+    testFloatEquals(interpolator_f.interp2D(0, 1, 1), 3, __FILE__, __LINE__);
+    
+    std::filesystem::remove(path_2_data_2D);
+    
+    //  5. tables freed once no longer held (key built from the file as now on disk)
+    std::ifstream ifs(path_2_data, std::ios::binary);
+    std::string contents(
+        (std::istreambuf_iterator<char>(ifs)),
+        std::istreambuf_iterator<char>()
+    );
+    ifs.close();
+    
+    std::string table_key = table_cache.getTableKey(path_2_data, contents);
+    
+    testTruth(table_cache.get1D(table_key) != NULL, __FILE__, __LINE__);
+    
+    interpolator_c = Interpolator();
+    interpolator_d = Interpolator();
+    
+    testTruth(table_cache.get1D(table_key) == NULL, __FILE__, __LINE__);
+    
+    std::filesystem::remove(path_2_data);
+    
+    return;
+}   /* testTableCache_Interpolator() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testParse_Interpolator(void)
+///
+/// \brief Function to check that the single-pass data file parser reads what the
+///     std::stod() based parser did (CRLF line endings, blank lines, padded and signed
+///     cells, scientific notation, notes after "||"), and that non-numeric or missing
+///     cells are detected.
+///
+
+void testParse_Interpolator(void)
+{
+    std::string path_2_data = "test/test_results/interpolation/parse_curve.csv";
+    std::filesystem::create_directories("test/test_results/interpolation/");
+    
+    std::ofstream ofs;
+    
+    //  1. 1D curve
+    ofs.open(path_2_data, std::ofstream::out | std::ofstream::binary);
+    ofs << "x,y,||,Notes, more notes\r\n";
+    ofs << "0, +1.5,||,a note: 1,2\r\n";
+    ofs << "\r\n";
+    ofs << "\n";
+    ofs << "5e-1,-2.5E1,\r\n";
+    ofs << " 1 ,3,4,||,\n";
+    ofs.close();
+    
+    Interpolator interpolator_1D;
+    interpolator_1D.addData1D(0, path_2_data);
+    
+    std::vector<double> expected_x_vec = {0, 0.5, 1};
+    std::vector<double> expected_y_vec = {1.5, -25, 3};
+    
+    testTruth(
+        interpolator_1D.interp_map_1D[0]->n_points == 3,
+        __FILE__,
+        __LINE__
+    );
+    
+    for (size_t i = 0; i < expected_x_vec.size(); i++) {
+        testFloatEquals(
+            interpolator_1D.interp_map_1D[0]->x_vec[i],
+            expected_x_vec[i],
+            __FILE__,
+            __LINE__
+        );
+        
+        testFloatEquals(
+            interpolator_1D.interp_map_1D[0]->y_vec[i],
+            expected_y_vec[i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  2. 2D matrix
+    ofs.open(path_2_data, std::ofstream::out | std::ofstream::binary);
+    ofs << "DATA,DATA,DATA,||,Notes\r\n";
+    ofs << "DUMMY,0.5,1,||,\r\n";
+    ofs << "0,1,2,||,\r\n";
+    ofs << "\r\n";
+    ofs << "1,3,4.5e0,\r\n";
+    ofs << "2,5,6,7,||,";
+    ofs.close();
+    
+    Interpolator interpolator_2D;
+    interpolator_2D.addData2D(0, path_2_data);
+    
+    testTruth(interpolator_2D.interp_map_2D[0]->n_rows == 3, __FILE__, __LINE__);
+    testTruth(interpolator_2D.interp_map_2D[0]->n_cols == 2, __FILE__, __LINE__);
+    
+    std::vector<double> expected_z_vec = {1, 2, 3, 4.5, 5, 6};
+    
+    for (size_t i = 0; i < expected_z_vec.size(); i++) {
+        testFloatEquals(
+            interpolator_2D.interp_map_2D[0]->z_vec[i],
+            expected_z_vec[i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    testFloatEquals(interpolator_2D.interp_map_2D[0]->x_vec[0], 0.5, __FILE__, __LINE__);
+    testFloatEquals(interpolator_2D.interp_map_2D[0]->y_vec[2], 2, __FILE__, __LINE__);
+    testFloatEquals(interpolator_2D.interp2D(0, 0.75, 1.5), 4.625, __FILE__, __LINE__);
+    
+    //  3. non-numeric and missing cells
+    std::vector<std::string> bad_1D_vec = {
+        "x,y,||,\n0,0,||,\n1,one,||,\n",
+        "x,y,||,\n0,0,||,\n1,||,\n",
+        "x,y,||,\n"
+    };
+    
+    std::vector<std::string> bad_2D_vec = {
+        "DATA,DATA,DATA,\nDUMMY,0,1,\n0,0,0,\n1,0,x,\n",
+        "DATA,DATA,DATA,\nDUMMY,0,1,\n0,0,0,\n1,0,\n",
+        "DATA,DATA,DATA,\nDUMMY,0,1,\n"
+    };
+    
+    for (size_t i = 0; i < bad_1D_vec.size() + bad_2D_vec.size(); i++) {
+        bool is_1D = i < bad_1D_vec.size();
+        
+        ofs.open(path_2_data, std::ofstream::out | std::ofstream::binary);
+        ofs << (is_1D ? bad_1D_vec[i] : bad_2D_vec[i - bad_1D_vec.size()]);
+        ofs.close();
+        
+        try {
+            Interpolator bad_interpolator;
+            
+            if (is_1D) {
+                bad_interpolator.addData1D(0, path_2_data);
+            }
+            
+            else {
+                bad_interpolator.addData2D(0, path_2_data);
+            }
+            
+            expectedErrorNotDetected(__FILE__, __LINE__);
+        }
+        
+        catch (std::runtime_error& e) {
+            // Task failed successfully! =P
+        }
+    }
+    
+    //  4. missing file
+    std::filesystem::remove(path_2_data);
+    
+    try {
+        Interpolator bad_interpolator;
+        bad_interpolator.addData1D(0, path_2_data);
+        
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    catch (std::invalid_argument& e) {
+        // Task failed successfully! =P
+    }
+    
+    return;
+}   /* testParse_Interpolator() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 int main(int argc, char** argv)
@@ -757,6 +1608,12 @@ int main(int argc, char** argv)
         testDataRead2D_Interpolator(test_interpolator_ptr, data_key_2D, path_2_data_2D);
         testInvalidInterpolation2D_Interpolator(test_interpolator_ptr, data_key_2D);
         testInterpolation2D_Interpolator(test_interpolator_ptr, data_key_2D);
+        
+        testIndexSearch_Interpolator(test_interpolator_ptr, data_key_1D, data_key_2D);
+        testHandles_Interpolator(test_interpolator_ptr, data_key_1D, data_key_2D);
+        testBatch_Interpolator(test_interpolator_ptr, data_key_1D, data_key_2D);
+        testTableCache_Interpolator(test_interpolator_ptr, data_key_1D, path_2_data_1D);
+        testParse_Interpolator();
     }
 
 
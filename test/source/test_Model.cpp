@@ -1702,6 +1702,1212 @@ void testFuelConsumptionEmissions_Model(Model* test_model_ptr)
 // ---------------------------------------------------------------------------------- //
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn Model* getCloneForkModel_Model(
+///         std::string path_2_electrical_load_time_series,
+///         bool summary_only
+///     )
+///
+/// \brief A function to construct a small (deterministic) test Model, for use in
+///     testing clone() and fork() (and summary only runs).
+///
+/// \param path_2_electrical_load_time_series A path to electrical load data.
+///
+/// \param summary_only A flag which indicates whether or not the Model should record
+///     only summary results.
+///
+/// \return A pointer to a test Model object.
+///
+
+Model* getCloneForkModel_Model(
+    std::string path_2_electrical_load_time_series,
+    bool summary_only = false
+)
+{
+    ModelInputs model_inputs;
+    model_inputs.path_2_electrical_load_time_series = path_2_electrical_load_time_series;
+    model_inputs.control_mode = ControlMode :: CYCLE_CHARGING;
+    model_inputs.summary_only = summary_only;
+    
+    Model* model_ptr = new Model(model_inputs);
+    
+    model_ptr->addResource(
+        RenewableType :: SOLAR,
+        "data/test/resources/solar_GHI_peak-1kWm2_1yr_dt-1hr.csv",
+        0
+    );
+    
+    DieselInputs diesel_inputs;
+    diesel_inputs.combustion_inputs.production_inputs.capacity_kW = 300;
+    model_ptr->addDiesel(diesel_inputs);
+    
+    diesel_inputs.combustion_inputs.production_inputs.capacity_kW = 150;
+    model_ptr->addDiesel(diesel_inputs);
+    
+    SolarInputs solar_inputs;
+    solar_inputs.renewable_inputs.production_inputs.capacity_kW = 250;
+    solar_inputs.resource_key = 0;
+    model_ptr->addSolar(solar_inputs);
+    
+    LiIonInputs liion_inputs;
+    liion_inputs.storage_inputs.power_capacity_kW = 250;
+    liion_inputs.storage_inputs.energy_capacity_kWh = 1000;
+    model_ptr->addLiIon(liion_inputs);
+    
+    return model_ptr;
+}   /* getCloneForkModel_Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testCloneFork_Model(std::string path_2_electrical_load_time_series)
+///
+/// \brief Function to check that Model::clone() produces an independent deep copy which
+///     shares electrical load and resource data, and that Model::fork() continues
+///     exactly as an uninterrupted run would (or, if the fork is altered, shares the
+///     dispatch prior to the fork).
+///
+/// \param path_2_electrical_load_time_series A path to electrical load data.
+///
+
+void testCloneFork_Model(std::string path_2_electrical_load_time_series)
+{
+    //  1. reference (uninterrupted) run
+    Model* reference_model_ptr =
+        getCloneForkModel_Model(path_2_electrical_load_time_series);
+    
+    reference_model_ptr->run();
+    
+    int n_points = reference_model_ptr->electrical_load_ptr->n_points;
+    int fork_timestep = n_points / 2;
+    
+    testTruth(reference_model_ptr->next_timestep == n_points, __FILE__, __LINE__);
+    
+    //  2. clone before run
+    Model* model_ptr = getCloneForkModel_Model(path_2_electrical_load_time_series);
+    Model* clone_ptr = model_ptr->clone();
+    
+    testTruth(
+        clone_ptr->electrical_load_ptr == model_ptr->electrical_load_ptr,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        clone_ptr->resources_ptr == model_ptr->resources_ptr,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        clone_ptr->combustion_ptr_vec.size() == model_ptr->combustion_ptr_vec.size(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        clone_ptr->combustion_ptr_vec[0] != model_ptr->combustion_ptr_vec[0],
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        clone_ptr->storage_ptr_vec[0] != model_ptr->storage_ptr_vec[0],
+        __FILE__,
+        __LINE__
+    );
+    
+    clone_ptr->run();
+    
+    testTruth(
+        clone_ptr->net_present_cost == reference_model_ptr->net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        clone_ptr->total_fuel_consumed_L == reference_model_ptr->total_fuel_consumed_L,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(model_ptr->next_timestep == 0, __FILE__, __LINE__);
+    
+    delete clone_ptr;
+    
+    //  3. fork part way through run, continue both
+    Model* fork_ptr = model_ptr->fork(fork_timestep);
+    
+    testTruth(model_ptr->next_timestep == fork_timestep, __FILE__, __LINE__);
+    testTruth(fork_ptr->next_timestep == fork_timestep, __FILE__, __LINE__);
+    
+    model_ptr->run();
+    fork_ptr->run();
+    
+    testTruth(
+        model_ptr->net_present_cost == reference_model_ptr->net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        fork_ptr->net_present_cost == reference_model_ptr->net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        fork_ptr->levellized_cost_of_energy_kWh ==
+            reference_model_ptr->levellized_cost_of_energy_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        fork_ptr->total_emissions.CO2_kg == reference_model_ptr->total_emissions.CO2_kg,
+        __FILE__,
+        __LINE__
+    );
+    
+    for (int i = 0; i < n_points; i++) {
+        testFloatEquals(
+            fork_ptr->storage_ptr_vec[0]->charge_vec_kWh[i],
+            reference_model_ptr->storage_ptr_vec[0]->charge_vec_kWh[i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    delete fork_ptr;
+    delete model_ptr;
+    
+    //  4. fork part way through run, alter fork (control mode)
+    model_ptr = getCloneForkModel_Model(path_2_electrical_load_time_series);
+    fork_ptr = model_ptr->fork(fork_timestep);
+    
+    fork_ptr->controller.setControlMode(ControlMode :: LOAD_FOLLOWING);
+    fork_ptr->run();
+    
+    for (int i = 0; i < fork_timestep; i++) {
+        testFloatEquals(
+            fork_ptr->combustion_ptr_vec[0]->production_vec_kW[i],
+            reference_model_ptr->combustion_ptr_vec[0]->production_vec_kW[i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    testTruth(
+        fork_ptr->total_fuel_consumed_L != reference_model_ptr->total_fuel_consumed_L,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  5. cannot run backwards
+    bool error_flag = true;
+    
+    try {
+        fork_ptr->runUntil(fork_timestep);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    delete fork_ptr;
+    delete model_ptr;
+    delete reference_model_ptr;
+    
+    return;
+}   /* testCloneFork_Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testSummaryOnly_Model(std::string path_2_electrical_load_time_series)
+///
+/// \brief Function to check that a summary only Model run records no per-timestep
+///     result vectors, and yet reproduces the summary results of a full Model run.
+///
+/// \param path_2_electrical_load_time_series A path to electrical load data.
+///
+
+void testSummaryOnly_Model(std::string path_2_electrical_load_time_series)
+{
+    //  1. full and summary only runs
+    Model* full_model_ptr = getCloneForkModel_Model(path_2_electrical_load_time_series);
+    full_model_ptr->run();
+    
+    Model* summary_model_ptr =
+        getCloneForkModel_Model(path_2_electrical_load_time_series, true);
+    
+    testTruth(summary_model_ptr->summary_only, __FILE__, __LINE__);
+    testTruth(summary_model_ptr->controller.summary_only, __FILE__, __LINE__);
+    
+    summary_model_ptr->run();
+    
+    //  2. check that no time series were recorded
+    testTruth(
+        summary_model_ptr->controller.net_load_vec_kW.empty(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        summary_model_ptr->controller.missed_load_vec_kW.empty(),
+        __FILE__,
+        __LINE__
+    );
+    
+    for (size_t i = 0; i < summary_model_ptr->combustion_ptr_vec.size(); i++) {
+        Combustion* combustion_ptr = summary_model_ptr->combustion_ptr_vec[i];
+        
+        testTruth(combustion_ptr->summary_only, __FILE__, __LINE__);
+        testTruth(combustion_ptr->production_vec_kW.size() == 1, __FILE__, __LINE__);
+        testTruth(combustion_ptr->getCapitalCostSeries().empty(), __FILE__, __LINE__);
+        
+        testTruth(
+            combustion_ptr->fuel_consumption_vec_L.size() == 1,
+            __FILE__,
+            __LINE__
+        );
+        
+        testTruth(combustion_ptr->CO2_emissions_vec_kg.empty(), __FILE__, __LINE__);
+        
+        //  capital cost events are logged identically in either mode
+        Combustion* full_combustion_ptr = full_model_ptr->combustion_ptr_vec[i];
+        
+        testFloatEquals(
+            combustion_ptr->capital_cost_event_vec.size(),
+            full_combustion_ptr->capital_cost_event_vec.size(),
+            __FILE__,
+            __LINE__
+        );
+        
+        for (size_t j = 0; j < combustion_ptr->capital_cost_event_vec.size(); j++) {
+            testTruth(
+                combustion_ptr->capital_cost_event_vec[j].timestep ==
+                    full_combustion_ptr->capital_cost_event_vec[j].timestep,
+                __FILE__,
+                __LINE__
+            );
+            
+            testFloatEquals(
+                combustion_ptr->capital_cost_event_vec[j].cost,
+                full_combustion_ptr->capital_cost_event_vec[j].cost,
+                __FILE__,
+                __LINE__
+            );
+        }
+        
+        //  the expanded capital cost series of the full run accounts for every event
+        std::vector<double> capital_cost_vec =
+            full_combustion_ptr->getCapitalCostSeries();
+        
+        testFloatEquals(
+            capital_cost_vec.size(),
+            full_model_ptr->electrical_load_ptr->n_points,
+            __FILE__,
+            __LINE__
+        );
+        
+        double event_cost = 0;
+        double series_cost = 0;
+        
+        for (size_t j = 0; j < full_combustion_ptr->capital_cost_event_vec.size(); j++) {
+            event_cost += full_combustion_ptr->capital_cost_event_vec[j].cost;
+        }
+        
+        for (size_t j = 0; j < capital_cost_vec.size(); j++) {
+            series_cost += capital_cost_vec[j];
+        }
+        
+        testFloatEquals(series_cost, event_cost, __FILE__, __LINE__);
+    }
+    
+    testTruth(
+        summary_model_ptr->renewable_ptr_vec[0]->dispatch_vec_kW.size() == 1,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        summary_model_ptr->storage_ptr_vec[0]->charge_vec_kWh.size() == 2,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  3. check summary results against full run
+    testFloatEquals(
+        summary_model_ptr->net_present_cost,
+        full_model_ptr->net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_model_ptr->levellized_cost_of_energy_kWh,
+        full_model_ptr->levellized_cost_of_energy_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_model_ptr->renewable_penetration,
+        full_model_ptr->renewable_penetration,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_model_ptr->total_dispatch_kWh,
+        full_model_ptr->total_dispatch_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_model_ptr->total_discharge_kWh,
+        full_model_ptr->total_discharge_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_model_ptr->total_fuel_consumed_L,
+        full_model_ptr->total_fuel_consumed_L,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_model_ptr->total_emissions.CO2_kg,
+        full_model_ptr->total_emissions.CO2_kg,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_model_ptr->total_emissions.PM_kg,
+        full_model_ptr->total_emissions.PM_kg,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_model_ptr->controller.total_missed_load_kWh,
+        full_model_ptr->controller.total_missed_load_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    for (size_t i = 0; i < summary_model_ptr->combustion_ptr_vec.size(); i++) {
+        testFloatEquals(
+            summary_model_ptr->combustion_ptr_vec[i]->net_present_cost,
+            full_model_ptr->combustion_ptr_vec[i]->net_present_cost,
+            __FILE__,
+            __LINE__
+        );
+        
+        testTruth(
+            summary_model_ptr->combustion_ptr_vec[i]->n_replacements ==
+                full_model_ptr->combustion_ptr_vec[i]->n_replacements,
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    testFloatEquals(
+        summary_model_ptr->storage_ptr_vec[0]->net_present_cost,
+        full_model_ptr->storage_ptr_vec[0]->net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  4. check that emissions series, derived lazily from fuel consumption, agree
+    //     with the fuel consumed and with the emissions totals of the full run
+    for (size_t i = 0; i < full_model_ptr->combustion_ptr_vec.size(); i++) {
+        Combustion* combustion_ptr = full_model_ptr->combustion_ptr_vec[i];
+        
+        testTruth(combustion_ptr->CO2_emissions_vec_kg.empty(), __FILE__, __LINE__);
+        
+        combustion_ptr->computeEmissionsSeries();
+        
+        testFloatEquals(
+            combustion_ptr->CO2_emissions_vec_kg.size(),
+            full_model_ptr->electrical_load_ptr->n_points,
+            __FILE__,
+            __LINE__
+        );
+        
+        double total_CO2_kg = 0;
+        
+        for (size_t j = 0; j < combustion_ptr->CO2_emissions_vec_kg.size(); j++) {
+            testFloatEquals(
+                combustion_ptr->CO2_emissions_vec_kg[j],
+                combustion_ptr->CO2_emissions_intensity_kgL *
+                    combustion_ptr->fuel_consumption_vec_L[j],
+                __FILE__,
+                __LINE__
+            );
+            
+            testFloatEquals(
+                combustion_ptr->NOx_emissions_vec_kg[j],
+                combustion_ptr->NOx_emissions_intensity_kgL *
+                    combustion_ptr->fuel_consumption_vec_L[j],
+                __FILE__,
+                __LINE__
+            );
+            
+            total_CO2_kg += combustion_ptr->CO2_emissions_vec_kg[j];
+        }
+        
+        if (combustion_ptr->total_emissions.CO2_kg > 0) {
+            testFloatEquals(
+                total_CO2_kg / combustion_ptr->total_emissions.CO2_kg,
+                1,
+                __FILE__,
+                __LINE__
+            );
+        }
+    }
+    
+    delete summary_model_ptr;
+    delete full_model_ptr;
+    
+    //  4. H2 records only the current and previous time steps if summary only, and
+    //     reproduces the summary results of a full run
+    H2Inputs h2_inputs;
+    
+    full_model_ptr = getCloneForkModel_Model(path_2_electrical_load_time_series);
+    full_model_ptr->addH2(h2_inputs);
+    full_model_ptr->run();
+    
+    summary_model_ptr =
+        getCloneForkModel_Model(path_2_electrical_load_time_series, true);
+    summary_model_ptr->addH2(h2_inputs);
+    summary_model_ptr->run();
+    
+    H2* full_h2_ptr = (H2*)(full_model_ptr->storage_ptr_vec.back());
+    H2* summary_h2_ptr = (H2*)(summary_model_ptr->storage_ptr_vec.back());
+    
+    size_t n_points = full_model_ptr->electrical_load_ptr->n_points;
+    
+    testTruth(full_h2_ptr->tank_level_vec_kg.size() == n_points, __FILE__, __LINE__);
+    
+    testTruth(
+        full_h2_ptr->electrolyzer.el_draw_vec_kW.size() == n_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        full_h2_ptr->fuelcell.fc_output_vec_kW.size() == n_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(summary_h2_ptr->summary_only, __FILE__, __LINE__);
+    testTruth(summary_h2_ptr->tank_level_vec_kg.size() == 2, __FILE__, __LINE__);
+    testTruth(summary_h2_ptr->charge_vec_kWh.size() == 2, __FILE__, __LINE__);
+    
+    testTruth(
+        summary_h2_ptr->electrolyzer.el_draw_vec_kW.size() == 2,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        summary_h2_ptr->fuelcell.fc_output_vec_kW.size() == 2,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_h2_ptr->net_present_cost,
+        full_h2_ptr->net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_h2_ptr->total_discharge_kWh,
+        full_h2_ptr->total_discharge_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_h2_ptr->total_h2_produced_kg,
+        full_h2_ptr->total_h2_produced_kg,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_h2_ptr->SOH_el,
+        full_h2_ptr->SOH_el,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_h2_ptr->SOH_fc,
+        full_h2_ptr->SOH_fc,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        summary_model_ptr->net_present_cost,
+        full_model_ptr->net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    delete summary_model_ptr;
+    delete full_model_ptr;
+    
+    return;
+}   /* testSummaryOnly_Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testDiscountFactorCache_Model(std::string path_2_electrical_load_time_series)
+///
+/// \brief Function to check that the Model's discount factor cache computes discount
+///     factors once per distinct rate, that they are correct, that it is shared by
+///     clones, and that asset economics computed from it agree with economics computed
+///     without it.
+///
+/// \param path_2_electrical_load_time_series A path to electrical load data.
+///
+
+void testDiscountFactorCache_Model(std::string path_2_electrical_load_time_series)
+{
+    //  1. run Model
+    Model* test_model_ptr = getCloneForkModel_Model(path_2_electrical_load_time_series);
+    test_model_ptr->run();
+    
+    DiscountFactorCache* cache_ptr = test_model_ptr->discount_factor_cache_ptr;
+    
+    testTruth(
+        cache_ptr == &(test_model_ptr->discount_factor_cache),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(not cache_ptr->discount_factor_map.empty(), __FILE__, __LINE__);
+    
+    //  2. check discount factors, and that they are computed only once per rate
+    double real_discount_annual =
+        test_model_ptr->combustion_ptr_vec[0]->real_discount_annual;
+    
+    std::vector<double>* factor_vec_ptr =
+        cache_ptr->getDiscountFactors(real_discount_annual);
+    
+    testTruth(
+        factor_vec_ptr == cache_ptr->getDiscountFactors(real_discount_annual),
+        __FILE__,
+        __LINE__
+    );
+    
+    std::vector<double>* time_vec_hrs_ptr =
+        &(test_model_ptr->electrical_load_ptr->time_vec_hrs);
+    
+    testTruth(
+        factor_vec_ptr->size() == time_vec_hrs_ptr->size(),
+        __FILE__,
+        __LINE__
+    );
+    
+    for (size_t i = 0; i < factor_vec_ptr->size(); i++) {
+        testFloatEquals(
+            (*factor_vec_ptr)[i],
+            1.0 / pow(1 + real_discount_annual, (*time_vec_hrs_ptr)[i] / 8760),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  3. check cached economics against uncached economics
+    for (size_t i = 0; i < test_model_ptr->combustion_ptr_vec.size(); i++) {
+        Combustion* combustion_ptr = test_model_ptr->combustion_ptr_vec[i];
+        double cached_net_present_cost = combustion_ptr->net_present_cost;
+        
+        combustion_ptr->net_present_cost = 0;
+        combustion_ptr->computeEconomics(time_vec_hrs_ptr);
+        
+        testFloatEquals(
+            combustion_ptr->net_present_cost,
+            cached_net_present_cost,
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    Renewable* renewable_ptr = test_model_ptr->renewable_ptr_vec[0];
+    double cached_net_present_cost = renewable_ptr->net_present_cost;
+    
+    renewable_ptr->net_present_cost = 0;
+    renewable_ptr->computeEconomics(time_vec_hrs_ptr);
+    
+    testFloatEquals(
+        renewable_ptr->net_present_cost,
+        cached_net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    Storage* storage_ptr = test_model_ptr->storage_ptr_vec[0];
+    cached_net_present_cost = storage_ptr->net_present_cost;
+    
+    storage_ptr->net_present_cost = 0;
+    storage_ptr->computeEconomics(time_vec_hrs_ptr);
+    
+    testFloatEquals(
+        storage_ptr->net_present_cost,
+        cached_net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  4. check that clones share the cache
+    Model* clone_model_ptr = test_model_ptr->clone();
+    
+    testTruth(
+        clone_model_ptr->discount_factor_cache_ptr == cache_ptr,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  5. check that cost vectors of the wrong length are rejected
+    std::vector<double> bad_cost_vec(3, 1);
+    bool error_flag = true;
+    
+    try {
+        cache_ptr->computePresentValue(real_discount_annual, &bad_cost_vec);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    delete clone_model_ptr;
+    delete test_model_ptr;
+    
+    return;
+}   /* testDiscountFactorCache_Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testRecomputeEconomics_Model(std::string path_2_electrical_load_time_series)
+///
+/// \brief Function to check that recomputing Model economics under new economic inputs
+///     (without re-running dispatch) agrees with a full Model run under those inputs,
+///     that cost scalars scale net present cost (and the cost series written to
+///     results) as expected, and that Models which have not been run, or which record
+///     only summary results, are rejected.
+///
+/// \param path_2_electrical_load_time_series A path to electrical load data.
+///
+
+void testRecomputeEconomics_Model(std::string path_2_electrical_load_time_series)
+{
+    //  1. run Model, check that default economic inputs reproduce the run
+    Model* test_model_ptr = getCloneForkModel_Model(path_2_electrical_load_time_series);
+    test_model_ptr->run();
+    
+    double net_present_cost = test_model_ptr->net_present_cost;
+    double levellized_cost_of_energy_kWh =
+        test_model_ptr->levellized_cost_of_energy_kWh;
+    double renewable_penetration = test_model_ptr->renewable_penetration;
+    
+    CostInputs cost_inputs;
+    test_model_ptr->recomputeEconomics(cost_inputs);
+    
+    testFloatEquals(
+        test_model_ptr->net_present_cost,
+        net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_model_ptr->levellized_cost_of_energy_kWh,
+        levellized_cost_of_energy_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_model_ptr->renewable_penetration,
+        renewable_penetration,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  2. check new rates against a full Model run under those rates
+    cost_inputs.nominal_inflation_annual = 0.03;
+    cost_inputs.nominal_discount_annual = 0.1;
+    test_model_ptr->recomputeEconomics(cost_inputs);
+    
+    Model* rerun_model_ptr =
+        getCloneForkModel_Model(path_2_electrical_load_time_series);
+    
+    for (size_t i = 0; i < rerun_model_ptr->combustion_ptr_vec.size(); i++) {
+        rerun_model_ptr->combustion_ptr_vec[i]->resetEconomics(0.03, 0.1);
+    }
+    
+    for (size_t i = 0; i < rerun_model_ptr->renewable_ptr_vec.size(); i++) {
+        rerun_model_ptr->renewable_ptr_vec[i]->resetEconomics(0.03, 0.1);
+    }
+    
+    for (size_t i = 0; i < rerun_model_ptr->storage_ptr_vec.size(); i++) {
+        rerun_model_ptr->storage_ptr_vec[i]->resetEconomics(0.03, 0.1);
+    }
+    
+    rerun_model_ptr->run();
+    
+    testTruth(
+        test_model_ptr->net_present_cost != net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_model_ptr->net_present_cost,
+        rerun_model_ptr->net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_model_ptr->levellized_cost_of_energy_kWh,
+        rerun_model_ptr->levellized_cost_of_energy_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    for (size_t i = 0; i < test_model_ptr->combustion_ptr_vec.size(); i++) {
+        testFloatEquals(
+            test_model_ptr->combustion_ptr_vec[i]->net_present_cost,
+            rerun_model_ptr->combustion_ptr_vec[i]->net_present_cost,
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    testFloatEquals(
+        test_model_ptr->storage_ptr_vec[0]->levellized_cost_of_energy_kWh,
+        rerun_model_ptr->storage_ptr_vec[0]->levellized_cost_of_energy_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  3. check that cost scalars scale net present cost (and levellized cost)
+    cost_inputs.nominal_inflation_annual = 0.02;
+    cost_inputs.nominal_discount_annual = 0.08;
+    cost_inputs.capital_cost_scalar = 2;
+    cost_inputs.operation_maintenance_cost_scalar = 2;
+    cost_inputs.fuel_cost_scalar = 2;
+    test_model_ptr->recomputeEconomics(cost_inputs);
+    
+    testFloatEquals(
+        test_model_ptr->net_present_cost,
+        2 * net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_model_ptr->levellized_cost_of_energy_kWh,
+        2 * levellized_cost_of_energy_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    cost_inputs.fuel_cost_scalar = 0;
+    test_model_ptr->recomputeEconomics(cost_inputs);
+    
+    double total_fuel_cost = 0;
+    DiscountFactorCache* cache_ptr = test_model_ptr->discount_factor_cache_ptr;
+    
+    for (size_t i = 0; i < test_model_ptr->combustion_ptr_vec.size(); i++) {
+        Combustion* combustion_ptr = test_model_ptr->combustion_ptr_vec[i];
+        
+        total_fuel_cost += cache_ptr->computePresentValue(
+            combustion_ptr->real_fuel_escalation_annual,
+            &(combustion_ptr->fuel_cost_vec)
+        );
+    }
+    
+    testGreaterThan(total_fuel_cost, 0, __FILE__, __LINE__);
+    
+    testFloatEquals(
+        test_model_ptr->net_present_cost,
+        2 * (net_present_cost - total_fuel_cost),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  4. check that the cost series written after recomputing are scaled, and so
+    //     discount back to the recomputed net present cost
+    std::string write_path = "test/test_results/recompute_economics/";
+    std::filesystem::create_directories("test/test_results/");
+    
+    test_model_ptr->writeResults(write_path, -1, ColumnarFormat :: COLUMNAR_FLOAT64);
+    
+    ColumnarReader reader(write_path + "time_series_results.pgmcol");
+    
+    auto written_present_value = [&reader, cache_ptr](
+        std::string group,
+        int index,
+        std::string column,
+        double rate
+    ) {
+        std::vector<double> cost_vec =
+            reader.readColumn(reader.getColumnIndex(group, index, column));
+        
+        return cache_ptr->computePresentValue(rate, &cost_vec);
+    };
+    
+    double written_net_present_cost = 0;
+    
+    for (size_t i = 0; i < test_model_ptr->combustion_ptr_vec.size(); i++) {
+        Combustion* combustion_ptr = test_model_ptr->combustion_ptr_vec[i];
+        
+        written_net_present_cost +=
+            written_present_value(
+                "Combustion",
+                i,
+                "Capital Cost (actual)",
+                combustion_ptr->real_discount_annual
+            ) +
+            written_present_value(
+                "Combustion",
+                i,
+                "Operation and Maintenance Cost (actual)",
+                combustion_ptr->real_discount_annual
+            ) +
+            written_present_value(
+                "Combustion",
+                i,
+                "Fuel Cost (actual)",
+                combustion_ptr->real_fuel_escalation_annual
+            );
+        
+        for (int j = 0; j < combustion_ptr->n_points; j++) {
+            testFloatEquals(combustion_ptr->getFuelCost(j), 0, __FILE__, __LINE__);
+            
+            testFloatEquals(
+                combustion_ptr->getOperationMaintenanceCost(j),
+                2 * combustion_ptr->operation_maintenance_cost_vec[j],
+                __FILE__,
+                __LINE__
+            );
+        }
+    }
+    
+    for (size_t i = 0; i < test_model_ptr->renewable_ptr_vec.size(); i++) {
+        Renewable* renewable_ptr = test_model_ptr->renewable_ptr_vec[i];
+        
+        written_net_present_cost +=
+            written_present_value(
+                "Renewable",
+                i,
+                "Capital Cost (actual)",
+                renewable_ptr->real_discount_annual
+            ) +
+            written_present_value(
+                "Renewable",
+                i,
+                "Operation and Maintenance Cost (actual)",
+                renewable_ptr->real_discount_annual
+            );
+    }
+    
+    for (size_t i = 0; i < test_model_ptr->storage_ptr_vec.size(); i++) {
+        Storage* storage_ptr = test_model_ptr->storage_ptr_vec[i];
+        
+        written_net_present_cost +=
+            written_present_value(
+                "Storage",
+                i,
+                "Capital Cost (actual)",
+                storage_ptr->real_discount_annual
+            ) +
+            written_present_value(
+                "Storage",
+                i,
+                "Operation and Maintenance Cost (actual)",
+                storage_ptr->real_discount_annual
+            );
+    }
+    
+    for (size_t i = 0; i < test_model_ptr->noncombustion_ptr_vec.size(); i++) {
+        Noncombustion* noncombustion_ptr = test_model_ptr->noncombustion_ptr_vec[i];
+        
+        written_net_present_cost +=
+            written_present_value(
+                "Noncombustion",
+                i,
+                "Capital Cost (actual)",
+                noncombustion_ptr->real_discount_annual
+            ) +
+            written_present_value(
+                "Noncombustion",
+                i,
+                "Operation and Maintenance Cost (actual)",
+                noncombustion_ptr->real_discount_annual
+            );
+    }
+    
+    testFloatEquals(
+        written_net_present_cost / test_model_ptr->net_present_cost,
+        1,
+        __FILE__,
+        __LINE__
+    );
+    
+    std::filesystem::remove_all(write_path);
+    
+    //  5. check that Models which have not been run are rejected
+    Model* unrun_model_ptr =
+        getCloneForkModel_Model(path_2_electrical_load_time_series);
+    bool error_flag = true;
+    
+    try {
+        unrun_model_ptr->recomputeEconomics(cost_inputs);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    //  6. check that summary only Models are rejected
+    Model* summary_model_ptr = getCloneForkModel_Model(
+        path_2_electrical_load_time_series,
+        true
+    );
+    summary_model_ptr->run();
+    
+    try {
+        summary_model_ptr->recomputeEconomics(cost_inputs);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    delete summary_model_ptr;
+    delete unrun_model_ptr;
+    delete rerun_model_ptr;
+    delete test_model_ptr;
+    
+    return;
+}   /* testRecomputeEconomics_Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testColumnarResults_Model(std::string path_2_electrical_load_time_series)
+///
+/// \brief Function to check that the binary columnar results file written by
+///     Model::writeResults() reads back (column by column) to the Model results.
+///
+/// \param path_2_electrical_load_time_series A path to electrical load data.
+///
+
+void testColumnarResults_Model(std::string path_2_electrical_load_time_series)
+{
+    //  1. run Model, write float64 and float32 columnar results
+    Model* test_model_ptr = getCloneForkModel_Model(path_2_electrical_load_time_series);
+    test_model_ptr->run();
+    
+    std::string write_path_64 = "test/test_results/columnar_float64/";
+    std::string write_path_32 = "test/test_results/columnar_float32/";
+    int max_lines = 100;
+    
+    std::filesystem::create_directories("test/test_results/");
+    
+    test_model_ptr->writeResults(write_path_64, -1, ColumnarFormat :: COLUMNAR_FLOAT64);
+    
+    test_model_ptr->writeResults(
+        write_path_32,
+        max_lines,
+        ColumnarFormat :: COLUMNAR_FLOAT32
+    );
+    
+    //  2. check float64 header
+    ColumnarReader reader_64(write_path_64 + "time_series_results.pgmcol");
+    
+    testTruth(reader_64.bytes_per_value == 8, __FILE__, __LINE__);
+    
+    testTruth(
+        reader_64.n_rows == test_model_ptr->electrical_load_ptr->n_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    for (size_t i = 0; i < reader_64.column_vec.size(); i++) {
+        testTruth(
+            reader_64.column_vec[i].data_offset % COLUMNAR_ALIGNMENT_BYTES == 0,
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  3. check float64 columns (exact)
+    std::vector<double> load_vec_kW = reader_64.readColumn(
+        reader_64.getColumnIndex("Model", -1, "Electrical Load")
+    );
+    
+    for (int i = 0; i < reader_64.n_rows; i++) {
+        testTruth(
+            load_vec_kW[i] == test_model_ptr->electrical_load_ptr->load_vec_kW[i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    Combustion* combustion_ptr = test_model_ptr->combustion_ptr_vec[0];
+    
+    int column_index = reader_64.getColumnIndex("Combustion", 0, "Dispatch");
+    
+    testTruth(
+        reader_64.column_vec[column_index].type_str == combustion_ptr->type_str,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(reader_64.column_vec[column_index].units == "kW", __FILE__, __LINE__);
+    
+    std::vector<double> dispatch_vec_kW = reader_64.readColumn(column_index);
+    std::vector<double> is_running_vec = reader_64.readColumn(
+        reader_64.getColumnIndex("Combustion", 0, "Is Running")
+    );
+    
+    for (int i = 0; i < reader_64.n_rows; i++) {
+        testTruth(
+            dispatch_vec_kW[i] == combustion_ptr->dispatch_vec_kW[i],
+            __FILE__,
+            __LINE__
+        );
+        
+        testTruth(
+            is_running_vec[i] == (combustion_ptr->is_running_vec[i] ? 1 : 0),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    Storage* storage_ptr = test_model_ptr->storage_ptr_vec[0];
+    std::vector<double> charge_vec_kWh = reader_64.readColumn(
+        reader_64.getColumnIndex("Storage", 0, "Charge (at end of timestep)")
+    );
+    
+    for (int i = 0; i < reader_64.n_rows; i++) {
+        testTruth(
+            charge_vec_kWh[i] == storage_ptr->charge_vec_kWh[i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  4. check float32 columns (truncated to max_lines, exact to float precision)
+    ColumnarReader reader_32(write_path_32 + "time_series_results.pgmcol");
+    
+    testTruth(reader_32.bytes_per_value == 4, __FILE__, __LINE__);
+    testTruth(reader_32.n_rows == max_lines, __FILE__, __LINE__);
+    
+    testTruth(
+        reader_32.column_vec.size() == reader_64.column_vec.size(),
+        __FILE__,
+        __LINE__
+    );
+    
+    dispatch_vec_kW = reader_32.readColumn(
+        reader_32.getColumnIndex("Combustion", 0, "Dispatch")
+    );
+    
+    for (int i = 0; i < reader_32.n_rows; i++) {
+        testTruth(
+            dispatch_vec_kW[i] == (float)(combustion_ptr->dispatch_vec_kW[i]),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  5. check that missing columns and files are reported
+    bool error_flag = true;
+    
+    try {
+        reader_64.getColumnIndex("Combustion", 0, "Not a Column");
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    try {
+        ColumnarReader bad_reader(write_path_64 + "Model/summary_results.md");
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    delete test_model_ptr;
+    
+    return;
+}   /* testColumnarResults_Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
 
 // ---------------------------------------------------------------------------------- //
 
@@ -1826,6 +3032,12 @@ int main(int argc, char** argv)
         testEconomics_Model(test_model_ptr);
         testFuelConsumptionEmissions_Model(test_model_ptr);
         
+        testCloneFork_Model(path_2_electrical_load_time_series);
+        testSummaryOnly_Model(path_2_electrical_load_time_series);
+        testDiscountFactorCache_Model(path_2_electrical_load_time_series);
+        testRecomputeEconomics_Model(path_2_electrical_load_time_series);
+        testColumnarResults_Model(path_2_electrical_load_time_series);
+        
         test_model_ptr->writeResults("test/test_results/");
     }
 
@@ -560,6 +560,58 @@ void testAddWaveResource_Resources(
         );
     }
     
+    ResourceSpan significant_wave_height_span =
+        test_resources_ptr->getResourceSpan2D(wave_resource_key, 0);
+    ResourceSpan energy_period_span =
+        test_resources_ptr->getResourceSpan2D(wave_resource_key, 1);
+    
+    testTruth(
+        significant_wave_height_span.size() ==
+            (size_t)test_electrical_load_ptr->n_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        energy_period_span.size() == (size_t)test_electrical_load_ptr->n_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    for (size_t i = 0; i < expected_significant_wave_height_vec_m.size(); i++) {
+        testFloatEquals(
+            significant_wave_height_span[i],
+            expected_significant_wave_height_vec_m[i],
+            __FILE__,
+            __LINE__
+        );
+        
+        testFloatEquals(
+            energy_period_span[i],
+            expected_energy_period_vec_s[i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    try {
+        test_resources_ptr->getResourceSpan2D(wave_resource_key, 2);
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    catch (std::invalid_argument& e) {
+        // Task failed successfully! =P
+    }
+    
+    try {
+        test_resources_ptr->getResourceSpan2D(wave_resource_key + 99, 0);
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    catch (std::invalid_argument& e) {
+        // Task failed successfully! =P
+    }
+    
     return;
 }   /* testAddWaveResource_Resources() */
 
@@ -777,6 +829,161 @@ void testAddHydroResource_Resources(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testAddResources_Resources(
+///         Resources* test_resources_ptr,
+///         ElectricalLoad* test_electrical_load_ptr
+///     )
+///
+/// \brief Function to test adding a batch of resources (read concurrently), and then
+///     check that the result matches adding them one at a time. Also checks that a
+///     failing batch adds nothing, and that its error is deterministic (that of the
+///     first failing resource, in order, regardless of thread count).
+///
+/// \param test_resources_ptr A pointer to the test Resources object (holding the
+///     resources added one at a time).
+///
+/// \param test_electrical_load_ptr A pointer to the test ElectricalLoad object.
+///
+
+void testAddResources_Resources(
+    Resources* test_resources_ptr,
+    ElectricalLoad* test_electrical_load_ptr
+)
+{
+    //  1. batch matches one at a time
+    std::vector<ResourceInputs> resource_inputs_vec(5);
+    
+    resource_inputs_vec[0].renewable_type = RenewableType :: SOLAR;
+    resource_inputs_vec[0].path_2_resource_data =
+        "data/test/resources/solar_GHI_peak-1kWm2_1yr_dt-1hr.csv";
+    resource_inputs_vec[0].resource_key = 0;
+    
+    resource_inputs_vec[1].renewable_type = RenewableType :: TIDAL;
+    resource_inputs_vec[1].path_2_resource_data =
+        "data/test/resources/tidal_speed_peak-3ms_1yr_dt-1hr.csv";
+    resource_inputs_vec[1].resource_key = 1;
+    
+    resource_inputs_vec[2].renewable_type = RenewableType :: WAVE;
+    resource_inputs_vec[2].path_2_resource_data =
+        "data/test/resources/waves_H_s_peak-8m_T_e_peak-15s_1yr_dt-1hr.csv";
+    resource_inputs_vec[2].resource_key = 2;
+    
+    resource_inputs_vec[3].renewable_type = RenewableType :: WIND;
+    resource_inputs_vec[3].path_2_resource_data =
+        "data/test/resources/wind_speed_peak-25ms_1yr_dt-1hr.csv";
+    resource_inputs_vec[3].resource_key = 3;
+    
+    resource_inputs_vec[4].noncombustion_type = NoncombustionType :: HYDRO;
+    resource_inputs_vec[4].path_2_resource_data =
+        "data/test/resources/hydro_inflow_peak-20000m3hr_1yr_dt-1hr.csv";
+    resource_inputs_vec[4].resource_key = 4;
+    
+    Resources batch_resources;
+    batch_resources.addResources(resource_inputs_vec, test_electrical_load_ptr, 4);
+    
+    testTruth(
+        batch_resources.resource_map_1D == test_resources_ptr->resource_map_1D,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        batch_resources.string_map_1D == test_resources_ptr->string_map_1D,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        batch_resources.path_map_2D == test_resources_ptr->path_map_2D,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        batch_resources.resource_map_2D[2].channel_vec ==
+            test_resources_ptr->resource_map_2D[2].channel_vec,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  2. repeated key (within batch, and against Resources)
+    std::vector<ResourceInputs> repeated_inputs_vec = {
+        resource_inputs_vec[3],
+        resource_inputs_vec[3]
+    };
+    
+    repeated_inputs_vec[0].resource_key = 10;
+    repeated_inputs_vec[1].resource_key = 10;
+    
+    try {
+        batch_resources.addResources(repeated_inputs_vec, test_electrical_load_ptr);
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    catch (std::invalid_argument& e) {
+        // Task failed successfully! =P
+    }
+    
+    try {
+        batch_resources.addResources({resource_inputs_vec[0]}, test_electrical_load_ptr);
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    catch (std::invalid_argument& e) {
+        // Task failed successfully! =P
+    }
+    
+    //  3. failing batch adds nothing, and reports first failure (in order)
+    std::vector<ResourceInputs> bad_inputs_vec(4, resource_inputs_vec[0]);
+    
+    bad_inputs_vec[0].path_2_resource_data = resource_inputs_vec[0].path_2_resource_data;
+    bad_inputs_vec[1].path_2_resource_data =
+        "data/test/resources/solar_GHI_peak-1kWm2_1yr_dt-1hr_BAD_TIMES.csv";
+    bad_inputs_vec[2].path_2_resource_data =
+        "data/test/resources/solar_GHI_peak-1kWm2_1yr_dt-1hr_BAD_LENGTH.csv";
+    bad_inputs_vec[3].path_2_resource_data = resource_inputs_vec[0].path_2_resource_data;
+    
+    for (size_t i = 0; i < bad_inputs_vec.size(); i++) {
+        bad_inputs_vec[i].resource_key = 20 + i;
+    }
+    
+    std::vector<int> n_threads_vec = {1, 2, 4};
+    
+    for (size_t i = 0; i < n_threads_vec.size(); i++) {
+        try {
+            batch_resources.addResources(
+                bad_inputs_vec,
+                test_electrical_load_ptr,
+                n_threads_vec[i]
+            );
+            
+            expectedErrorNotDetected(__FILE__, __LINE__);
+        }
+        
+        catch (std::runtime_error& e) {
+            std::string error_str = e.what();
+            
+            testTruth(
+                error_str.find("BAD_TIMES") != std::string::npos,
+                __FILE__,
+                __LINE__
+            );
+        }
+        
+        testTruth(batch_resources.resource_map_1D.size() == 4, __FILE__, __LINE__);
+        testTruth(batch_resources.path_map_1D.count(20) == 0, __FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testAddResources_Resources() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 int main(int argc, char** argv)
@@ -869,6 +1076,9 @@ int main(int argc, char** argv)
             path_2_hydro_resource_data,
             hydro_resource_key
         );
+        
+        
+        testAddResources_Resources(test_resources_ptr, test_electrical_load_ptr);
     }
 
 
@@ -0,0 +1,512 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file test_Sweep.cpp
+///
+/// \brief Testing suite for Sweep class.
+///
+/// A suite of tests for the Sweep class.
+///
+
+
+#include "../utils/testing_utils.h"
+#include "../../header/Sweep.h"
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn Sweep* testConstruct_Sweep(SweepInputs test_sweep_inputs)
+///
+/// \brief A function to construct a Sweep object.
+///
+/// \param test_sweep_inputs A SweepInputs structure for the Sweep constructor.
+///
+/// \return A pointer to a test Sweep object.
+///
+
+Sweep* testConstruct_Sweep(SweepInputs test_sweep_inputs)
+{
+    Sweep* test_sweep_ptr = new Sweep(test_sweep_inputs);
+    
+    testTruth(
+        test_sweep_ptr->electrical_load.path_2_electrical_load_time_series ==
+        test_sweep_inputs.path_2_electrical_load_time_series,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(test_sweep_ptr->n_threads == 4, __FILE__, __LINE__);
+    
+    return test_sweep_ptr;
+}   /* testConstruct_Sweep() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+/// 
+/// \fn void testBadConstruct_Sweep(void)
+///
+/// \brief Function to check if passing bad SweepInputs to the Sweep constructor is
+///     handled appropriately.
+///
+
+void testBadConstruct_Sweep(void)
+{
+    bool error_flag = true;
+    
+    try {
+        SweepInputs bad_sweep_inputs;   // path_2_electrical_load_time_series left empty
+        
+        Sweep bad_sweep(bad_sweep_inputs);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testBadConstruct_Sweep() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::vector<ScenarioInputs> getTestScenarios_Sweep(int solar_resource_key)
+///
+/// \brief A function to construct a set of test scenarios.
+///
+/// \param solar_resource_key The resource key of the test solar resource.
+///
+/// \return A vector of test scenarios.
+///
+
+std::vector<ScenarioInputs> getTestScenarios_Sweep(int solar_resource_key)
+{
+    std::vector<ScenarioInputs> scenario_inputs_vec;
+    
+    for (int n_diesels = 1; n_diesels <= 3; n_diesels++) {
+        for (int solar_kW = 0; solar_kW <= 500; solar_kW += 250) {
+            ScenarioInputs scenario_inputs;
+            
+            if (n_diesels == 2) {
+                scenario_inputs.model_inputs.control_mode = ControlMode :: CYCLE_CHARGING;
+            }
+            
+            for (int i = 0; i < n_diesels; i++) {
+                DieselInputs diesel_inputs;
+                diesel_inputs.combustion_inputs.production_inputs.capacity_kW =
+                    600 / n_diesels;
+                
+                scenario_inputs.diesel_inputs_vec.push_back(diesel_inputs);
+            }
+            
+            if (solar_kW > 0) {
+                SolarInputs solar_inputs;
+                solar_inputs.renewable_inputs.production_inputs.capacity_kW = solar_kW;
+                solar_inputs.resource_key = solar_resource_key;
+                
+                scenario_inputs.solar_inputs_vec.push_back(solar_inputs);
+                
+                LiIonInputs liion_inputs;
+                liion_inputs.storage_inputs.power_capacity_kW = solar_kW / 2;
+                liion_inputs.storage_inputs.energy_capacity_kWh = 2 * solar_kW;
+                
+                scenario_inputs.liion_inputs_vec.push_back(liion_inputs);
+            }
+            
+            scenario_inputs_vec.push_back(scenario_inputs);
+        }
+    }
+    
+    return scenario_inputs_vec;
+}   /* getTestScenarios_Sweep() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testRun_Sweep(
+///         Sweep* test_sweep_ptr,
+///         std::string path_2_solar_resource_data
+///     )
+///
+/// \brief Function to check that a parallel Sweep reproduces, exactly, the results of
+///     running each scenario as a stand-alone Model, and that summaries are streamed
+///     to the callback.
+///
+/// \param test_sweep_ptr A pointer to the test Sweep object.
+///
+/// \param path_2_solar_resource_data A path to the test solar resource data.
+///
+
+void testRun_Sweep(
+    Sweep* test_sweep_ptr,
+    std::string path_2_solar_resource_data
+)
+{
+    int solar_resource_key = 0;
+    
+    test_sweep_ptr->addResource(
+        RenewableType :: SOLAR,
+        path_2_solar_resource_data,
+        solar_resource_key
+    );
+    
+    std::vector<ScenarioInputs> scenario_inputs_vec =
+        getTestScenarios_Sweep(solar_resource_key);
+    
+    for (size_t i = 0; i < scenario_inputs_vec.size(); i++) {
+        test_sweep_ptr->addScenario(scenario_inputs_vec[i]);
+    }
+    
+    //  1. run, counting callbacks
+    std::vector<int> callback_count_vec(scenario_inputs_vec.size(), 0);
+    
+    test_sweep_ptr->run(
+        [&](const ScenarioSummary& scenario_summary) {
+            callback_count_vec[scenario_summary.scenario_index]++;
+        }
+    );
+    
+    testTruth(
+        test_sweep_ptr->scenario_summary_vec.size() == scenario_inputs_vec.size(),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  2. compare against stand-alone Model runs
+    for (size_t i = 0; i < scenario_inputs_vec.size(); i++) {
+        ScenarioSummary* summary_ptr = &(test_sweep_ptr->scenario_summary_vec[i]);
+        
+        testTruth(callback_count_vec[i] == 1, __FILE__, __LINE__);
+        testTruth(summary_ptr->scenario_index == int(i), __FILE__, __LINE__);
+        testTruth(summary_ptr->is_complete, __FILE__, __LINE__);
+        testTruth(summary_ptr->error_str.empty(), __FILE__, __LINE__);
+        
+        ModelInputs model_inputs = scenario_inputs_vec[i].model_inputs;
+        model_inputs.path_2_electrical_load_time_series =
+            test_sweep_ptr->electrical_load.path_2_electrical_load_time_series;
+        
+        Model model(model_inputs);
+        
+        model.addResource(
+            RenewableType :: SOLAR,
+            path_2_solar_resource_data,
+            solar_resource_key
+        );
+        
+        for (size_t j = 0; j < scenario_inputs_vec[i].diesel_inputs_vec.size(); j++) {
+            model.addDiesel(scenario_inputs_vec[i].diesel_inputs_vec[j]);
+        }
+        
+        for (size_t j = 0; j < scenario_inputs_vec[i].solar_inputs_vec.size(); j++) {
+            model.addSolar(scenario_inputs_vec[i].solar_inputs_vec[j]);
+        }
+        
+        for (size_t j = 0; j < scenario_inputs_vec[i].liion_inputs_vec.size(); j++) {
+            model.addLiIon(scenario_inputs_vec[i].liion_inputs_vec[j]);
+        }
+        
+        model.run();
+        
+        testTruth(
+            summary_ptr->net_present_cost == model.net_present_cost,
+            __FILE__,
+            __LINE__
+        );
+        
+        testTruth(
+            summary_ptr->levellized_cost_of_energy_kWh ==
+                model.levellized_cost_of_energy_kWh,
+            __FILE__,
+            __LINE__
+        );
+        
+        testTruth(
+            summary_ptr->total_fuel_consumed_L == model.total_fuel_consumed_L,
+            __FILE__,
+            __LINE__
+        );
+        
+        testTruth(
+            summary_ptr->total_emissions.CO2_kg == model.total_emissions.CO2_kg,
+            __FILE__,
+            __LINE__
+        );
+        
+        testTruth(
+            summary_ptr->renewable_penetration == model.renewable_penetration,
+            __FILE__,
+            __LINE__
+        );
+        
+        testGreaterThan(summary_ptr->total_dispatch_kWh, 0, __FILE__, __LINE__);
+        testGreaterThanOrEqualTo(
+            summary_ptr->total_missed_load_kWh,
+            0,
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    return;
+}   /* testRun_Sweep() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testBadScenarios_Sweep(Sweep* test_sweep_ptr)
+///
+/// \brief Function to check that bad scenarios are handled appropriately: a scenario
+///     referring to a missing resource is rejected (up front) by run(), while a
+///     scenario which fails on construction is logged (and the rest still run).
+///
+/// \param test_sweep_ptr A pointer to the test Sweep object.
+///
+
+void testBadScenarios_Sweep(Sweep* test_sweep_ptr)
+{
+    //  1. missing resource key
+    ScenarioInputs bad_scenario_inputs;
+    
+    WindInputs wind_inputs;
+    wind_inputs.resource_key = 42;
+    bad_scenario_inputs.wind_inputs_vec.push_back(wind_inputs);
+    
+    test_sweep_ptr->scenario_inputs_vec.clear();
+    test_sweep_ptr->addScenario(bad_scenario_inputs);
+    
+    bool error_flag = true;
+    
+    try {
+        test_sweep_ptr->run();
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    //  2. bad asset inputs
+    ScenarioInputs good_scenario_inputs;
+    good_scenario_inputs.diesel_inputs_vec.push_back(DieselInputs());
+    
+    bad_scenario_inputs.wind_inputs_vec.clear();
+    bad_scenario_inputs.diesel_inputs_vec.push_back(DieselInputs());
+    bad_scenario_inputs.diesel_inputs_vec.back().combustion_inputs.production_inputs.capacity_kW = -1;
+    
+    test_sweep_ptr->scenario_inputs_vec.clear();
+    test_sweep_ptr->addScenario(good_scenario_inputs);
+    test_sweep_ptr->addScenario(bad_scenario_inputs);
+    test_sweep_ptr->addScenario(good_scenario_inputs);
+    
+    test_sweep_ptr->run();
+    
+    testTruth(test_sweep_ptr->scenario_summary_vec[0].is_complete, __FILE__, __LINE__);
+    testTruth(
+        not test_sweep_ptr->scenario_summary_vec[1].is_complete,
+        __FILE__,
+        __LINE__
+    );
+    testTruth(
+        not test_sweep_ptr->scenario_summary_vec[1].error_str.empty(),
+        __FILE__,
+        __LINE__
+    );
+    testTruth(test_sweep_ptr->scenario_summary_vec[2].is_complete, __FILE__, __LINE__);
+    
+    testTruth(
+        test_sweep_ptr->scenario_summary_vec[0].net_present_cost ==
+            test_sweep_ptr->scenario_summary_vec[2].net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testBadScenarios_Sweep() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testSharedModel_Sweep(Sweep* test_sweep_ptr)
+///
+/// \brief Function to check that a Model sharing electrical load and resource data
+///     refers to (rather than copies) the shared data, and refuses to add resources.
+///
+/// \param test_sweep_ptr A pointer to the test Sweep object.
+///
+
+void testSharedModel_Sweep(Sweep* test_sweep_ptr)
+{
+    Model shared_model(
+        ModelInputs(),
+        &(test_sweep_ptr->electrical_load),
+        &(test_sweep_ptr->resources)
+    );
+    
+    testTruth(
+        shared_model.electrical_load_ptr == &(test_sweep_ptr->electrical_load),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        shared_model.resources_ptr == &(test_sweep_ptr->resources),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(shared_model.electrical_load.load_vec_kW.empty(), __FILE__, __LINE__);
+    
+    bool error_flag = true;
+    
+    try {
+        shared_model.addResource(
+            RenewableType :: SOLAR,
+            "data/test/resources/solar_GHI_peak-1kWm2_1yr_dt-1hr.csv",
+            1
+        );
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    try {
+        Model bad_model(ModelInputs(), NULL, NULL);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testSharedModel_Sweep() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\tTesting Sweep");
+    
+    #ifdef _WIN32
+        std::cout << std::endl;
+    #endif
+    
+    srand(time(NULL));
+    
+    
+    std::string path_2_electrical_load_time_series =
+        "data/test/electrical_load/electrical_load_generic_peak-500kW_1yr_dt-1hr.csv";
+    
+    std::string path_2_solar_resource_data =
+        "data/test/resources/solar_GHI_peak-1kWm2_1yr_dt-1hr.csv";
+    
+    SweepInputs test_sweep_inputs;
+    test_sweep_inputs.path_2_electrical_load_time_series =
+        path_2_electrical_load_time_series;
+    test_sweep_inputs.n_threads = 4;
+    
+    Sweep* test_sweep_ptr = testConstruct_Sweep(test_sweep_inputs);
+    
+    
+    try {
+        testBadConstruct_Sweep();
+        
+        testRun_Sweep(test_sweep_ptr, path_2_solar_resource_data);
+        testBadScenarios_Sweep(test_sweep_ptr);
+        testSharedModel_Sweep(test_sweep_ptr);
+    }
+
+
+    catch (...) {
+        delete test_sweep_ptr;
+        
+        printGold(" .................................... ");
+        printRed("FAIL");
+        std::cout << std::endl;
+        throw;
+    }
+
+
+    delete test_sweep_ptr;
+
+    printGold(" .................................... ");
+    printGreen("PASS");
+    std::cout << std::endl;
+    return 0;
+}   /* main() */
+
+// ---------------------------------------------------------------------------------- //